@@ -0,0 +1,2118 @@
+/*
+ *    Copyright (c) 2018-2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a HLX control protocol load generator and
+ *      end-to-end latency benchmark program executable.
+ *
+ */
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <boost/foreach.hpp>
+#include <boost/filesystem.hpp>
+
+#include <CoreFoundation/CFURL.h>
+
+#include <CFUtilities/CFString.hpp>
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <LogUtilities/LogUtilities.hpp>
+#include <NuovationsUtilities/GenerateShortOptions.hpp>
+
+#include <OpenHLX/Client/CommandExchangeBasis.hpp>
+#include <OpenHLX/Client/CommandManager.hpp>
+#include <OpenHLX/Client/ConnectionManager.hpp>
+#include <OpenHLX/Client/ConnectionManagerDelegate.hpp>
+#include <OpenHLX/Client/GroupsControllerCommands.hpp>
+#include <OpenHLX/Client/ZonesControllerCommands.hpp>
+#include <OpenHLX/Common/ConnectionManagerBasis.hpp>
+#include <OpenHLX/Common/EqualizerPresetsControllerBasis.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/FavoritesControllerBasis.hpp>
+#include <OpenHLX/Common/GroupsControllerBasis.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Common/SourcesControllerBasis.hpp>
+#include <OpenHLX/Common/Timeout.hpp>
+#include <OpenHLX/Common/Timer.hpp>
+#include <OpenHLX/Common/TimerDelegate.hpp>
+#include <OpenHLX/Common/Version.hpp>
+#include <OpenHLX/Common/ZonesControllerBasis.hpp>
+#include <OpenHLX/Model/IdentifierModel.hpp>
+#include <OpenHLX/Model/VolumeModel.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+#include <OpenHLX/Utilities/ElementsOf.hpp>
+#include <OpenHLX/Utilities/Parse.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Client;
+using namespace HLX::Common;
+using namespace HLX::Model;
+using namespace HLX::Utilities;
+using namespace Nuovations;
+using namespace boost::filesystem;
+using namespace std;
+
+
+// Preprocessor Definitions
+
+#define OPT_BASE                     0x00001000
+
+#define OPT_CONNECTIONS              'c'
+#define OPT_DEBUG                    'd'
+#define OPT_HELP                     'h'
+#define OPT_IPV4_ONLY                '4'
+#define OPT_IPV6_ONLY                '6'
+#define OPT_JSON                     'j'
+#define OPT_MIX                      'm'
+#define OPT_REQUESTS                 'n'
+#define OPT_QUIET                    'q'
+#define OPT_RATE                     'r'
+#define OPT_SYSLOG                   's'
+#define OPT_TIMEOUT                  't'
+#define OPT_VERBOSE                  'v'
+#define OPT_VERSION                  'V'
+
+#define OPT_SEED                     (OPT_BASE + 1)
+
+// Scale Options
+
+#define OPT_EQUALIZER_PRESETS        (OPT_BASE + 2)
+#define OPT_FAVORITES                (OPT_BASE + 3)
+#define OPT_GROUPS                   (OPT_BASE + 4)
+#define OPT_SOURCES                  (OPT_BASE + 5)
+#define OPT_ZONES                    (OPT_BASE + 6)
+
+// Type Declarations
+
+enum OptFlags {
+    kOptNone            = 0x00000000,
+    kOptIPv4Only        = 0x00000001,
+    kOptIPv6Only        = 0x00000002,
+    kOptPriority        = 0x00000004,
+    kOptQuiet           = 0x00000008,
+    kOptSyslog          = 0x00000010,
+
+    kOptTimeout         = 0x00000080,
+
+    kOptJSON            = 0x00000100
+};
+
+/**
+ *  The classes of commands that may be mixed in a benchmark run.
+ *
+ */
+enum CommandClass {
+    kCommandClassQuery     = 0,
+    kCommandClassMutation  = 1,
+    kCommandClassGroup     = 2,
+
+    kCommandClassCount
+};
+
+/**
+ *  The types of commands issued, and for which statistics are
+ *  accumulated, in a benchmark run.
+ *
+ */
+enum CommandType {
+    kCommandTypeZoneQuery    = 0,
+    kCommandTypeGroupQuery,
+    kCommandTypeZoneVolume,
+    kCommandTypeZoneMute,
+    kCommandTypeZoneSource,
+    kCommandTypeGroupVolume,
+    kCommandTypeGroupMute,
+    kCommandTypeGroupSource,
+
+    kCommandTypeCount
+};
+
+/**
+ *  A monotonic time, in nanoseconds.
+ *
+ */
+typedef uint64_t Timestamp;
+
+typedef Status (*LimitSetter)(const IdentifierModel::IdentifierType &aLimit);
+
+class HLXBench;
+
+// Function Prototypes
+
+// Global Variables
+
+static uint32_t             sOptFlags            = 0;
+static Log::Level           sDebug               = 0;
+static Log::Level           sError               = 0;
+static Log::Level           sVerbose             = 0;
+
+static const char *         sProgram             = nullptr;
+
+static Timeout              sTimeout;
+
+static uint32_t             sConnections         = 1;
+static uint32_t             sRequests            = 1000;
+static uint32_t             sRate                = 0;
+static uint32_t             sSeed                = 1;
+static uint32_t             sMix[kCommandClassCount] = { 60, 30, 10 };
+
+static HLXBench *           sHLXBench            = nullptr;
+
+static const struct option  sOptions[] = {
+    { "connections",             required_argument,  nullptr,   OPT_CONNECTIONS             },
+    { "debug",                   optional_argument,  nullptr,   OPT_DEBUG                   },
+    { "equalizer-presets",       required_argument,  nullptr,   OPT_EQUALIZER_PRESETS       },
+    { "favorites",               required_argument,  nullptr,   OPT_FAVORITES               },
+    { "groups",                  required_argument,  nullptr,   OPT_GROUPS                  },
+    { "help",                    no_argument,        nullptr,   OPT_HELP                    },
+    { "ipv4-only",               no_argument,        nullptr,   OPT_IPV4_ONLY               },
+    { "ipv6-only",               no_argument,        nullptr,   OPT_IPV6_ONLY               },
+    { "json",                    no_argument,        nullptr,   OPT_JSON                    },
+    { "mix",                     required_argument,  nullptr,   OPT_MIX                     },
+    { "quiet",                   no_argument,        nullptr,   OPT_QUIET                   },
+    { "rate",                    required_argument,  nullptr,   OPT_RATE                    },
+    { "requests",                required_argument,  nullptr,   OPT_REQUESTS                },
+    { "seed",                    required_argument,  nullptr,   OPT_SEED                    },
+    { "sources",                 required_argument,  nullptr,   OPT_SOURCES                 },
+    { "syslog",                  no_argument,        nullptr,   OPT_SYSLOG                  },
+    { "timeout",                 required_argument,  nullptr,   OPT_TIMEOUT                 },
+    { "verbose",                 optional_argument,  nullptr,   OPT_VERBOSE                 },
+    { "version",                 no_argument,        nullptr,   OPT_VERSION                 },
+    { "zones",                   required_argument,  nullptr,   OPT_ZONES                   },
+
+    { nullptr,                   0,                  nullptr,   0                           }
+};
+
+static const char * const   sShortUsageString =
+"Usage: %s [ options ] { <URL> | <host[:port]> }\n";
+
+static const char * const   sLongUsageString =
+"\n"
+" General options:\n"
+"\n"
+"  -d, --debug[=LEVEL]         Enable diagnostic output, optionally at level \n"
+"                              LEVEL.\n"
+"  -h, --help                  Print this help, then exit.\n"
+"  -q, --quiet                 Run silently, suppressing all diagnostic and \n"
+"                              informative output.\n"
+"  -s, --syslog                Write all error, diagnostic and informative \n"
+"                              output only to the system log, rather than to \n"
+"                              both the system log as well as standard error \n"
+"                              and standard output.\n"
+"  -v, --verbose[=LEVEL]       Enable verbose output, optionally at level LEVEL.\n"
+"  -V, --version               Print version and copyright information, then\n"
+"                              exit.\n"
+"\n"
+" Benchmark Options:\n"
+"\n"
+"  -4, --ipv4-only             Force hlxbench to use IPv4 addresses only.\n"
+"  -6, --ipv6-only             Force hlxbench to use IPv6 addresses only.\n"
+"  -c, --connections=COUNT     Open COUNT concurrent connections to the server\n"
+"                              (default: 1).\n"
+"  -j, --json                  Report results as JSON rather than text.\n"
+"  -m, --mix=QUERY:MUTATION:GROUP\n"
+"                              Issue query, zone mutation, and group commands\n"
+"                              in proportion to the specified weights\n"
+"                              (default: 60:30:10).\n"
+"  -n, --requests=COUNT        Issue COUNT requests in total across all\n"
+"                              connections (default: 1000).\n"
+"  -r, --rate=REQUESTS         Issue REQUESTS requests per second in total\n"
+"                              across all connections. Zero, the default,\n"
+"                              issues each connection's next request as soon\n"
+"                              as its previous one completes.\n"
+"  --seed=SEED                 Seed the command mix pseudorandom number\n"
+"                              generator with SEED (default: 1).\n"
+"  -t, --timeout=MILLISECONDS  Set a connection and command timeout of\n"
+"                              MILLISECONDS milliseconds.\n"
+"\n"
+" Scale Options:\n"
+"\n"
+"  --equalizer-presets=COUNT   Expect COUNT equalizer presets (default: 10).\n"
+"  --favorites=COUNT           Expect COUNT favorites (default: 10).\n"
+"  --groups=COUNT              Expect COUNT groups (default: 10).\n"
+"  --sources=COUNT             Expect COUNT sources (default: 8).\n"
+"  --zones=COUNT               Expect COUNT zones (default: 24).\n"
+"\n"
+"                              COUNT may range from 1 to 254 and should match\n"
+"                              that of the HLX server, for example, a\n"
+"                              simulator run with the same options.\n"
+"\n";
+
+/**
+ *  Per-command type descriptions, indexed by command type.
+ *
+ */
+static const struct {
+    const char *    mName;
+    CommandClass    mClass;
+} sCommandTypes[kCommandTypeCount] = {
+    { "zone-query",    kCommandClassQuery    },
+    { "group-query",   kCommandClassQuery    },
+    { "zone-volume",   kCommandClassMutation },
+    { "zone-mute",     kCommandClassMutation },
+    { "zone-source",   kCommandClassMutation },
+    { "group-volume",  kCommandClassGroup    },
+    { "group-mute",    kCommandClassGroup    },
+    { "group-source",  kCommandClassGroup    }
+};
+
+/**
+ *  @brief
+ *    Return the current monotonic time.
+ *
+ *  @returns
+ *    The current monotonic time, in nanoseconds.
+ *
+ */
+static Timestamp
+GetTimestamp(void)
+{
+    static constexpr Timestamp kNanosecondsPerSecond = 1000000000;
+    struct timespec            lTimespec;
+
+    clock_gettime(CLOCK_MONOTONIC, &lTimespec);
+
+    return ((static_cast<Timestamp>(lTimespec.tv_sec) * kNanosecondsPerSecond) +
+            static_cast<Timestamp>(lTimespec.tv_nsec));
+}
+
+/**
+ *  @brief
+ *    Draw a pseudorandom value in the range [0, aCount).
+ *
+ *  Unlike the standard distributions, whose algorithms are
+ *  implementation-defined, this depends only on the fully-specified
+ *  Mersenne Twister engine such that a given seed yields the same
+ *  command sequence on any platform.
+ *
+ *  @param[in]  aGenerator  A mutable reference to the engine to draw
+ *                          from.
+ *  @param[in]  aCount      The number of values to draw from.
+ *
+ *  @returns
+ *    The drawn value.
+ *
+ */
+static uint32_t
+Draw(std::mt19937 &aGenerator, const uint32_t &aCount)
+{
+    return (static_cast<uint32_t>(aGenerator() % aCount));
+}
+
+/**
+ *  @brief
+ *    An object for accumulating the outcomes and latencies of a
+ *    single type of command.
+ *
+ */
+class Statistics
+{
+public:
+    Statistics(void);
+    ~Statistics(void) = default;
+
+    void      Add(const Timestamp &aLatency);
+    void      Add(const Statistics &aStatistics);
+    void      AddError(void);
+
+    size_t    GetCount(void) const;
+    size_t    GetErrors(void) const;
+    Timestamp GetPercentile(const double &aPercentile);
+    Timestamp GetMax(void);
+
+private:
+    void      Sort(void);
+
+private:
+    std::vector<Timestamp>  mLatencies;
+    size_t                  mErrors;
+    bool                    mSorted;
+};
+
+/**
+ *  @brief
+ *    An object for a single benchmark connection to the HLX server.
+ *
+ *  Each connection issues its share of the requests, one at a time,
+ *  either as fast as the server will respond or paced against a
+ *  schedule derived from the requested rate. In the latter case,
+ *  latency is measured from the time at which a request was scheduled
+ *  to be issued rather than when it was actually issued such that a
+ *  slow server is not hidden by requests backing up behind one
+ *  another.
+ *
+ */
+class BenchConnection :
+    public Client::ConnectionManagerDelegate,
+    public Common::TimerDelegate
+{
+public:
+    BenchConnection(HLXBench &aBench);
+    ~BenchConnection(void);
+
+    Status Init(const RunLoopParameters &aRunLoopParameters,
+                const uint32_t &aSeed,
+                const uint32_t &aRequests,
+                const double &aRate);
+
+    Status Connect(const char *aMaybeURL,
+                   const ConnectionManagerBasis::Versions &aVersions,
+                   const Timeout &aTimeout);
+    Status Start(void);
+    Status Stop(void);
+
+    Statistics &GetStatistics(const CommandType &aType);
+
+private:
+    Status SendNext(void);
+    Status CreateCommand(const CommandType &aType,
+                         Client::Command::ExchangeBasis::MutableCountedPointer &aCommand);
+    CommandType DrawCommandType(void);
+    void   DidComplete(const Status &aStatus);
+
+    static void CommandCompleteHandler(Client::Command::ExchangeBasis::MutableCountedPointer &aExchange, const RegularExpression::Matches &aMatches, void *aContext);
+    static void CommandErrorHandler(Client::Command::ExchangeBasis::MutableCountedPointer &aExchange, const Error &aError, void *aContext);
+
+    // Connection Manager Delegate Methods
+
+    void ConnectionManagerWillResolve(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost) final;
+    void ConnectionManagerIsResolving(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost) final;
+    void ConnectionManagerDidResolve(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost, const IPAddress &aIPAddress) final;
+    void ConnectionManagerDidNotResolve(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost, const Error &aError) final;
+
+    void ConnectionManagerWillConnect(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef, const Timeout &aTimeout) final;
+    void ConnectionManagerIsConnecting(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef, const Timeout &aTimeout) final;
+    void ConnectionManagerDidConnect(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef) final;
+    void ConnectionManagerDidNotConnect(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef, const Error &aError) final;
+
+    void ConnectionManagerWillDisconnect(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, CFURLRef aURLRef) final;
+    void ConnectionManagerDidDisconnect(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, CFURLRef aURLRef, const Error &aError) final;
+    void ConnectionManagerDidNotDisconnect(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, CFURLRef aURLRef, const Error &aError) final;
+
+    void ConnectionManagerError(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const Error &aError) final;
+
+    // Timer Delegate Methods
+
+    void TimerDidFire(Timer &aTimer) final;
+
+private:
+    HLXBench &                 mBench;
+    Client::ConnectionManager  mConnectionManager;
+    Client::CommandManager     mCommandManager;
+    Timer                      mTimer;
+    Timeout                    mTimeout;
+    std::mt19937               mGenerator;
+    uint32_t                   mRequests;
+    uint32_t                   mRequestsScheduled;
+    uint32_t                   mRequestsCompleted;
+    double                     mRate;
+    double                     mCredits;
+    double                     mCreditsPerTick;
+    std::deque<Timestamp>      mScheduled;
+    bool                       mIsOutstanding;
+    CommandType                mOutstandingType;
+    Timestamp                  mOutstandingStart;
+    bool                       mIsStopping;
+    Statistics                 mStatistics[kCommandTypeCount];
+};
+
+/**
+ *  @brief
+ *    An object that effects the desired HLX benchmark.
+ *
+ *  This instantiates the requested number of benchmark connections,
+ *  starts them together once all are connected, and accumulates and
+ *  reports their results once all have completed.
+ *
+ */
+class HLXBench
+{
+public:
+    HLXBench(void);
+    ~HLXBench(void);
+
+    Status Init(void);
+    Status Start(const char *aMaybeURL,
+                 const bool &aUseIPv6,
+                 const bool &aUseIPv4,
+                 const Timeout &aTimeout);
+    Status Stop(void);
+    Status Stop(const Status &aStatus);
+
+    Status GetStatus(void) const;
+    void SetStatus(const Status &aStatus);
+
+    void ConnectionDidConnect(BenchConnection &aConnection);
+    void ConnectionDidFinish(BenchConnection &aConnection);
+
+    void Report(void);
+
+private:
+    void ReportText(Statistics (&aStatistics)[kCommandTypeCount], Statistics &aTotal, const double &aElapsed);
+    void ReportJSON(Statistics (&aStatistics)[kCommandTypeCount], Statistics &aTotal, const double &aElapsed);
+
+private:
+    typedef std::vector<std::unique_ptr<BenchConnection>> BenchConnections;
+
+    RunLoopParameters  mRunLoopParameters;
+    BenchConnections   mConnections;
+    size_t             mConnected;
+    size_t             mFinished;
+    Timestamp          mStart;
+    Timestamp          mEnd;
+    Status             mStatus;
+};
+
+// MARK: Statistics
+
+Statistics :: Statistics(void) :
+    mLatencies(),
+    mErrors(0),
+    mSorted(true)
+{
+    return;
+}
+
+void Statistics :: Add(const Timestamp &aLatency)
+{
+    mLatencies.push_back(aLatency);
+
+    mSorted = false;
+}
+
+void Statistics :: Add(const Statistics &aStatistics)
+{
+    mLatencies.insert(mLatencies.end(),
+                      aStatistics.mLatencies.begin(),
+                      aStatistics.mLatencies.end());
+
+    mErrors += aStatistics.mErrors;
+
+    mSorted = false;
+}
+
+void Statistics :: AddError(void)
+{
+    mErrors++;
+}
+
+size_t Statistics :: GetCount(void) const
+{
+    return (mLatencies.size());
+}
+
+size_t Statistics :: GetErrors(void) const
+{
+    return (mErrors);
+}
+
+/**
+ *  @brief
+ *    Return the specified latency percentile.
+ *
+ *  This returns the specified latency percentile using the
+ *  nearest-rank method.
+ *
+ *  @param[in]  aPercentile  The percentile, in the range (0, 100], to
+ *                           return.
+ *
+ *  @returns
+ *    The latency, in nanoseconds, at the percentile or zero if there
+ *    are no latencies.
+ *
+ */
+Timestamp Statistics :: GetPercentile(const double &aPercentile)
+{
+    Timestamp lRetval = 0;
+
+    nlEXPECT(!mLatencies.empty(), done);
+
+    Sort();
+
+    {
+        const double lRank  = (aPercentile / 100.0) * static_cast<double>(mLatencies.size());
+        size_t       lIndex = static_cast<size_t>(lRank);
+
+        if (static_cast<double>(lIndex) < lRank)
+        {
+            lIndex++;
+        }
+
+        lIndex = ((lIndex == 0) ? 0 : (lIndex - 1));
+        lIndex = std::min(lIndex, mLatencies.size() - 1);
+
+        lRetval = mLatencies[lIndex];
+    }
+
+ done:
+    return (lRetval);
+}
+
+Timestamp Statistics :: GetMax(void)
+{
+    return (GetPercentile(100.0));
+}
+
+void Statistics :: Sort(void)
+{
+    if (!mSorted)
+    {
+        std::sort(mLatencies.begin(), mLatencies.end());
+
+        mSorted = true;
+    }
+}
+
+// MARK: Benchmark Connection
+
+BenchConnection :: BenchConnection(HLXBench &aBench) :
+    Client::ConnectionManagerDelegate(),
+    Common::TimerDelegate(),
+    mBench(aBench),
+    mConnectionManager(),
+    mCommandManager(),
+    mTimer(),
+    mTimeout(),
+    mGenerator(),
+    mRequests(0),
+    mRequestsScheduled(0),
+    mRequestsCompleted(0),
+    mRate(0),
+    mCredits(0),
+    mCreditsPerTick(0),
+    mScheduled(),
+    mIsOutstanding(false),
+    mOutstandingType(kCommandTypeZoneQuery),
+    mOutstandingStart(0),
+    mIsStopping(false)
+{
+    return;
+}
+
+BenchConnection :: ~BenchConnection(void)
+{
+    mTimer.Destroy();
+}
+
+/**
+ *  @brief
+ *    This is the class initializer.
+ *
+ *  @param[in]  aRunLoopParameters  An immutable reference to the run
+ *                                  loop parameters to initialize the
+ *                                  connection with.
+ *  @param[in]  aSeed               The seed for the connection command
+ *                                  mix generator.
+ *  @param[in]  aRequests           The number of requests this
+ *                                  connection is to issue.
+ *  @param[in]  aRate               The rate, in requests per second,
+ *                                  at which this connection is to
+ *                                  issue requests or zero to issue
+ *                                  them back-to-back.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+BenchConnection :: Init(const RunLoopParameters &aRunLoopParameters,
+                        const uint32_t &aSeed,
+                        const uint32_t &aRequests,
+                        const double &aRate)
+{
+    static constexpr Timeout::Value kTickMillisecondsMin = 1;
+    Status lRetval = kStatus_Success;
+
+    lRetval = mConnectionManager.Init(aRunLoopParameters);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mCommandManager.Init(mConnectionManager, aRunLoopParameters);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mConnectionManager.AddDelegate(this);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mGenerator.seed(aSeed);
+
+    mRequests = aRequests;
+    mRate     = aRate;
+
+    // When paced, tick at the request interval, though no faster than
+    // the timer granularity, crediting each tick with the fractional
+    // number of requests due in that interval.
+
+    if (mRate > 0)
+    {
+        const Timeout::Value lTickMilliseconds = std::max(kTickMillisecondsMin,
+                                                          static_cast<Timeout::Value>(1000.0 / mRate));
+        const Timeout        lTick(lTickMilliseconds);
+
+        mCreditsPerTick = (mRate * static_cast<double>(lTickMilliseconds)) / 1000.0;
+
+        lRetval = mTimer.Init(aRunLoopParameters, lTick);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = mTimer.SetDelegate(this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+Status
+BenchConnection :: Connect(const char *aMaybeURL,
+                           const ConnectionManagerBasis::Versions &aVersions,
+                           const Timeout &aTimeout)
+{
+    Status lRetval;
+
+    mTimeout = aTimeout;
+
+    lRetval = mConnectionManager.Connect(aMaybeURL, aVersions, aTimeout);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+Status
+BenchConnection :: Start(void)
+{
+    Status lRetval = kStatus_Success;
+
+    if (mRequests == 0)
+    {
+        mBench.ConnectionDidFinish(*this);
+    }
+    else if (mRate > 0)
+    {
+        lRetval = mTimer.Start();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+    else
+    {
+        lRetval = SendNext();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+Status
+BenchConnection :: Stop(void)
+{
+    mIsStopping = true;
+
+    if (mRate > 0)
+    {
+        mTimer.Stop();
+    }
+
+    return (mConnectionManager.Disconnect());
+}
+
+Statistics &
+BenchConnection :: GetStatistics(const CommandType &aType)
+{
+    return (mStatistics[aType]);
+}
+
+/**
+ *  @brief
+ *    Issue the next request, if any.
+ *
+ *  When unpaced, this schedules and issues the next request
+ *  immediately. When paced, this issues the oldest scheduled but not
+ *  yet issued request, if any.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If memory could not be allocated for
+ *                            the command exchange.
+ *
+ */
+Status
+BenchConnection :: SendNext(void)
+{
+    Client::Command::ExchangeBasis::MutableCountedPointer lCommand;
+    Status                                                lRetval = kStatus_Success;
+
+    nlEXPECT(!mIsOutstanding, done);
+
+    if (mRate == 0)
+    {
+        nlEXPECT(mRequestsScheduled < mRequests, done);
+
+        mScheduled.push_back(GetTimestamp());
+        mRequestsScheduled++;
+    }
+
+    nlEXPECT(!mScheduled.empty(), done);
+
+    mOutstandingStart = mScheduled.front();
+    mScheduled.pop_front();
+
+    mOutstandingType = DrawCommandType();
+
+    lRetval = CreateCommand(mOutstandingType, lCommand);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mIsOutstanding = true;
+
+    lRetval = mCommandManager.SendCommand(lCommand,
+                                          mTimeout,
+                                          BenchConnection::CommandCompleteHandler,
+                                          BenchConnection::CommandErrorHandler,
+                                          this);
+    nlREQUIRE_SUCCESS_ACTION(lRetval, done, mIsOutstanding = false);
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Draw the type of the next command to issue.
+ *
+ *  This first draws the command class according to the requested mix
+ *  weights and then, uniformly, a command type within that class.
+ *
+ *  @returns
+ *    The type of the next command to issue.
+ *
+ */
+CommandType
+BenchConnection :: DrawCommandType(void)
+{
+    const uint32_t lWeights = sMix[kCommandClassQuery] + sMix[kCommandClassMutation] + sMix[kCommandClassGroup];
+    uint32_t       lWeight  = Draw(mGenerator, lWeights);
+    size_t         lClass   = kCommandClassQuery;
+    uint32_t       lTypes   = 0;
+    uint32_t       lType;
+    CommandType    lRetval  = kCommandTypeZoneQuery;
+
+    while (lWeight >= sMix[lClass])
+    {
+        lWeight -= sMix[lClass];
+        lClass++;
+    }
+
+    for (size_t i = 0; i < ElementsOf(sCommandTypes); i++)
+    {
+        if (sCommandTypes[i].mClass == static_cast<CommandClass>(lClass))
+        {
+            lTypes++;
+        }
+    }
+
+    lType = Draw(mGenerator, lTypes);
+
+    for (size_t i = 0; i < ElementsOf(sCommandTypes); i++)
+    {
+        if (sCommandTypes[i].mClass == static_cast<CommandClass>(lClass))
+        {
+            if (lType-- == 0)
+            {
+                lRetval = static_cast<CommandType>(i);
+                break;
+            }
+        }
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Create a command exchange of the specified type.
+ *
+ *  This creates a command exchange of the specified type, drawing any
+ *  object identifiers and values uniformly over their valid ranges.
+ *
+ *  @param[in]   aType     The type of command exchange to create.
+ *  @param[out]  aCommand  A mutable reference to storage for the
+ *                         created command exchange.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If memory could not be allocated for
+ *                            the command exchange.
+ *
+ */
+Status
+BenchConnection :: CreateCommand(const CommandType &aType,
+                                 Client::Command::ExchangeBasis::MutableCountedPointer &aCommand)
+{
+    const IdentifierModel::IdentifierType lZone   = static_cast<IdentifierModel::IdentifierType>(IdentifierModel::kIdentifierMin + Draw(mGenerator, Common::ZonesControllerBasis::GetZonesMax()));
+    const IdentifierModel::IdentifierType lGroup  = static_cast<IdentifierModel::IdentifierType>(IdentifierModel::kIdentifierMin + Draw(mGenerator, Common::GroupsControllerBasis::GetGroupsMax()));
+    const IdentifierModel::IdentifierType lSource = static_cast<IdentifierModel::IdentifierType>(IdentifierModel::kIdentifierMin + Draw(mGenerator, Common::SourcesControllerBasis::GetSourcesMax()));
+    const VolumeModel::LevelType          lLevel  = static_cast<VolumeModel::LevelType>(VolumeModel::kLevelMin + static_cast<int32_t>(Draw(mGenerator, static_cast<uint32_t>(VolumeModel::kLevelMax - VolumeModel::kLevelMin + 1))));
+    Status                                lRetval = kStatus_Success;
+
+    switch (aType)
+    {
+
+    case kCommandTypeZoneQuery:
+        aCommand.reset(new Client::Command::Zones::Query());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Zones::Query>(aCommand)->Init(lZone);
+        break;
+
+    case kCommandTypeGroupQuery:
+        aCommand.reset(new Client::Command::Groups::Query());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Groups::Query>(aCommand)->Init(lGroup);
+        break;
+
+    case kCommandTypeZoneVolume:
+        aCommand.reset(new Client::Command::Zones::SetVolume());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Zones::SetVolume>(aCommand)->Init(lZone, lLevel);
+        break;
+
+    case kCommandTypeZoneMute:
+        aCommand.reset(new Client::Command::Zones::ToggleMute());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Zones::ToggleMute>(aCommand)->Init(lZone);
+        break;
+
+    case kCommandTypeZoneSource:
+        aCommand.reset(new Client::Command::Zones::SetSource());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Zones::SetSource>(aCommand)->Init(lZone, lSource);
+        break;
+
+    case kCommandTypeGroupVolume:
+        aCommand.reset(new Client::Command::Groups::SetVolume());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Groups::SetVolume>(aCommand)->Init(lGroup, lLevel);
+        break;
+
+    case kCommandTypeGroupMute:
+        aCommand.reset(new Client::Command::Groups::ToggleMute());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Groups::ToggleMute>(aCommand)->Init(lGroup);
+        break;
+
+    case kCommandTypeGroupSource:
+        aCommand.reset(new Client::Command::Groups::SetSource());
+        nlREQUIRE_ACTION(aCommand, done, lRetval = -ENOMEM);
+
+        lRetval = std::static_pointer_cast<Client::Command::Groups::SetSource>(aCommand)->Init(lGroup, lSource);
+        break;
+
+    default:
+        lRetval = -EINVAL;
+        break;
+
+    }
+
+ done:
+    return (lRetval);
+}
+
+void
+BenchConnection :: DidComplete(const Status &aStatus)
+{
+    const Timestamp lNow = GetTimestamp();
+    Status          lStatus;
+
+    mIsOutstanding = false;
+
+    if (aStatus >= kStatus_Success)
+    {
+        mStatistics[mOutstandingType].Add(lNow - mOutstandingStart);
+    }
+    else
+    {
+        mStatistics[mOutstandingType].AddError();
+    }
+
+    mRequestsCompleted++;
+
+    if (mRequestsCompleted == mRequests)
+    {
+        if (mRate > 0)
+        {
+            mTimer.Stop();
+        }
+
+        mBench.ConnectionDidFinish(*this);
+    }
+    else
+    {
+        lStatus = SendNext();
+        nlREQUIRE_SUCCESS_ACTION(lStatus, done, mBench.Stop(lStatus));
+    }
+
+ done:
+    return;
+}
+
+void
+BenchConnection :: CommandCompleteHandler(Client::Command::ExchangeBasis::MutableCountedPointer &aExchange, const RegularExpression::Matches &aMatches, void *aContext)
+{
+    BenchConnection *lConnection = static_cast<BenchConnection *>(aContext);
+
+    (void)aExchange;
+    (void)aMatches;
+
+    if (lConnection != nullptr)
+    {
+        lConnection->DidComplete(kStatus_Success);
+    }
+}
+
+void
+BenchConnection :: CommandErrorHandler(Client::Command::ExchangeBasis::MutableCountedPointer &aExchange, const Error &aError, void *aContext)
+{
+    BenchConnection *lConnection = static_cast<BenchConnection *>(aContext);
+
+    (void)aExchange;
+
+    Log::Debug().Write("Command error: %d (%s).\n", aError, strerror(-aError));
+
+    if (lConnection != nullptr)
+    {
+        lConnection->DidComplete(aError);
+    }
+}
+
+// Connection Manager Delegate Methods
+
+void
+BenchConnection :: ConnectionManagerWillResolve(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+    (void)aHost;
+}
+
+void
+BenchConnection :: ConnectionManagerIsResolving(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+    (void)aHost;
+}
+
+void
+BenchConnection :: ConnectionManagerDidResolve(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost, const IPAddress &aIPAddress)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+    (void)aHost;
+    (void)aIPAddress;
+}
+
+void
+BenchConnection :: ConnectionManagerDidNotResolve(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const char *aHost, const Error &aError)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+
+    Log::Error().Write("Did not resolve \"%s\": %d (%s).\n", aHost, aError, strerror(-aError));
+
+    mBench.Stop(aError);
+}
+
+void
+BenchConnection :: ConnectionManagerWillConnect(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef, const Timeout &aTimeout)
+{
+    (void)aConnectionManager;
+    (void)aURLRef;
+    (void)aTimeout;
+}
+
+void
+BenchConnection :: ConnectionManagerIsConnecting(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef, const Timeout &aTimeout)
+{
+    (void)aConnectionManager;
+    (void)aURLRef;
+    (void)aTimeout;
+}
+
+void
+BenchConnection :: ConnectionManagerDidConnect(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef)
+{
+    (void)aConnectionManager;
+
+    Log::Info().Write("Connected to %s.\n", CFString(CFURLGetString(aURLRef)).GetCString());
+
+    mBench.ConnectionDidConnect(*this);
+}
+
+void
+BenchConnection :: ConnectionManagerDidNotConnect(Client::ConnectionManager &aConnectionManager, CFURLRef aURLRef, const Error &aError)
+{
+    (void)aConnectionManager;
+
+    Log::Error().Write("Did not connect to %s: %d (%s).\n", CFString(CFURLGetString(aURLRef)).GetCString(), aError, strerror(-aError));
+
+    mBench.Stop(aError);
+}
+
+void
+BenchConnection :: ConnectionManagerWillDisconnect(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, CFURLRef aURLRef)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+    (void)aURLRef;
+}
+
+void
+BenchConnection :: ConnectionManagerDidDisconnect(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, CFURLRef aURLRef, const Error &aError)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+
+    // A disconnection other than one we initiated ends the benchmark
+    // prematurely.
+
+    if (!mIsStopping)
+    {
+        Log::Error().Write("Disconnected from %s: %d (%s).\n", CFString(CFURLGetString(aURLRef)).GetCString(), aError, strerror(-aError));
+
+        mBench.Stop((aError < kStatus_Success) ? aError : kError_ServerDisconnected);
+    }
+}
+
+void
+BenchConnection :: ConnectionManagerDidNotDisconnect(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, CFURLRef aURLRef, const Error &aError)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+    (void)aURLRef;
+    (void)aError;
+}
+
+void
+BenchConnection :: ConnectionManagerError(ConnectionManagerBasis &aConnectionManager, const ConnectionManagerBasis::Roles &aRoles, const Error &aError)
+{
+    (void)aConnectionManager;
+    (void)aRoles;
+
+    Log::Error().Write("Connection error: %d (%s).\n", aError, strerror(-aError));
+
+    mBench.Stop(aError);
+}
+
+// Timer Delegate Methods
+
+void
+BenchConnection :: TimerDidFire(Timer &aTimer)
+{
+    const Timestamp lNow = GetTimestamp();
+    Status          lStatus;
+
+    (void)aTimer;
+
+    mCredits += mCreditsPerTick;
+
+    while ((mCredits >= 1.0) && (mRequestsScheduled < mRequests))
+    {
+        mScheduled.push_back(lNow);
+
+        mCredits -= 1.0;
+        mRequestsScheduled++;
+    }
+
+    if (mRequestsScheduled == mRequests)
+    {
+        mTimer.Stop();
+    }
+
+    lStatus = SendNext();
+    nlREQUIRE_SUCCESS_ACTION(lStatus, done, mBench.Stop(lStatus));
+
+ done:
+    return;
+}
+
+// MARK: Benchmark
+
+HLXBench :: HLXBench(void) :
+    mRunLoopParameters(),
+    mConnections(),
+    mConnected(0),
+    mFinished(0),
+    mStart(0),
+    mEnd(0),
+    mStatus(kStatus_Success)
+{
+    return;
+}
+
+HLXBench :: ~HLXBench(void)
+{
+    return;
+}
+
+Status HLXBench :: Init(void)
+{
+    const double lRate   = (static_cast<double>(sRate) / static_cast<double>(sConnections));
+    Status       lRetval = kStatus_Success;
+
+    lRetval = mRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    // Divide the requests and rate evenly among the connections and
+    // seed each connection's generator distinctly, yet
+    // deterministically, such that each connection issues the same
+    // command sequence from run to run.
+
+    for (uint32_t i = 0; i < sConnections; i++)
+    {
+        const uint32_t lRequests = ((sRequests / sConnections) + ((i < (sRequests % sConnections)) ? 1 : 0));
+        std::unique_ptr<BenchConnection> lConnection(new BenchConnection(*this));
+
+        nlREQUIRE_ACTION(lConnection != nullptr, done, lRetval = -ENOMEM);
+
+        lRetval = lConnection->Init(mRunLoopParameters, sSeed + i, lRequests, lRate);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        mConnections.push_back(std::move(lConnection));
+    }
+
+ done:
+    return (lRetval);
+}
+
+Status
+HLXBench :: Start(const char *aMaybeURL,
+                  const bool &aUseIPv6,
+                  const bool &aUseIPv4,
+                  const Timeout &aTimeout)
+{
+    using Common::Utilities::GetVersions;
+
+    const ConnectionManagerBasis::Versions lVersions = GetVersions(aUseIPv6, aUseIPv4);
+    Status                                 lRetval   = kStatus_Success;
+
+    for (auto &lConnection : mConnections)
+    {
+        lRetval = lConnection->Connect(aMaybeURL, lVersions, aTimeout);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+Status HLXBench :: Stop(void)
+{
+    return (Stop(kStatus_Success));
+}
+
+Status HLXBench :: Stop(const Status &aStatus)
+{
+    if (mStatus == kStatus_Success)
+    {
+        SetStatus(aStatus);
+    }
+
+    for (auto &lConnection : mConnections)
+    {
+        lConnection->Stop();
+    }
+
+    CFRunLoopStop(mRunLoopParameters.GetRunLoop());
+
+    return (kStatus_Success);
+}
+
+Status HLXBench :: GetStatus(void) const
+{
+    return (mStatus);
+}
+
+void HLXBench :: SetStatus(const Status &aStatus)
+{
+    mStatus = aStatus;
+}
+
+/**
+ *  @brief
+ *    Handle a benchmark connection having connected.
+ *
+ *  Once every connection has connected, this starts them all
+ *  together such that connection establishment is excluded from the
+ *  measured interval.
+ *
+ */
+void HLXBench :: ConnectionDidConnect(BenchConnection &aConnection)
+{
+    Status lStatus = kStatus_Success;
+
+    (void)aConnection;
+
+    mConnected++;
+
+    nlEXPECT(mConnected == mConnections.size(), done);
+
+    Log::Info().Write("Issuing %u requests over %zu connection%s.\n",
+                      sRequests,
+                      mConnections.size(),
+                      ((mConnections.size() == 1) ? "" : "s"));
+
+    mStart = GetTimestamp();
+
+    for (auto &lConnection : mConnections)
+    {
+        lStatus = lConnection->Start();
+        nlREQUIRE_SUCCESS_ACTION(lStatus, done, Stop(lStatus));
+    }
+
+ done:
+    return;
+}
+
+void HLXBench :: ConnectionDidFinish(BenchConnection &aConnection)
+{
+    (void)aConnection;
+
+    mFinished++;
+
+    if (mFinished == mConnections.size())
+    {
+        mEnd = GetTimestamp();
+
+        Stop();
+    }
+}
+
+/**
+ *  @brief
+ *    Report the benchmark results.
+ *
+ *  This accumulates the per-connection statistics for each command
+ *  type and reports them, along with the overall throughput, on
+ *  standard output as either text or JSON.
+ *
+ */
+void HLXBench :: Report(void)
+{
+    static constexpr double kNanosecondsPerSecond = 1000000000.0;
+    Statistics              lStatistics[kCommandTypeCount];
+    Statistics              lTotal;
+    double                  lElapsed;
+
+    for (auto &lConnection : mConnections)
+    {
+        for (size_t i = 0; i < kCommandTypeCount; i++)
+        {
+            const CommandType lType = static_cast<CommandType>(i);
+
+            lStatistics[i].Add(lConnection->GetStatistics(lType));
+            lTotal.Add(lConnection->GetStatistics(lType));
+        }
+    }
+
+    lElapsed = ((mEnd > mStart) ? (static_cast<double>(mEnd - mStart) / kNanosecondsPerSecond) : 0);
+
+    if (sOptFlags & kOptJSON)
+    {
+        ReportJSON(lStatistics, lTotal, lElapsed);
+    }
+    else
+    {
+        ReportText(lStatistics, lTotal, lElapsed);
+    }
+}
+
+static double
+ToMilliseconds(const Timestamp &aNanoseconds)
+{
+    static constexpr double kNanosecondsPerMillisecond = 1000000.0;
+
+    return (static_cast<double>(aNanoseconds) / kNanosecondsPerMillisecond);
+}
+
+static void
+ReportTextRow(const char *aName, Statistics &aStatistics)
+{
+    printf("%-14s %8zu %7zu %10.3f %10.3f %10.3f %10.3f\n",
+           aName,
+           aStatistics.GetCount(),
+           aStatistics.GetErrors(),
+           ToMilliseconds(aStatistics.GetPercentile(50.0)),
+           ToMilliseconds(aStatistics.GetPercentile(99.0)),
+           ToMilliseconds(aStatistics.GetPercentile(99.9)),
+           ToMilliseconds(aStatistics.GetMax()));
+}
+
+void HLXBench :: ReportText(Statistics (&aStatistics)[kCommandTypeCount], Statistics &aTotal, const double &aElapsed)
+{
+    printf("connections: %u\n", sConnections);
+    printf("requests:    %u\n", sRequests);
+    printf("rate:        %u/s%s\n", sRate, ((sRate == 0) ? " (unpaced)" : ""));
+    printf("seed:        %u\n", sSeed);
+    printf("elapsed:     %.3f s\n", aElapsed);
+    printf("throughput:  %.1f requests/s\n",
+           ((aElapsed > 0) ? (static_cast<double>(aTotal.GetCount()) / aElapsed) : 0));
+    printf("\n");
+    printf("%-14s %8s %7s %10s %10s %10s %10s\n",
+           "command", "count", "errors", "p50 ms", "p99 ms", "p999 ms", "max ms");
+
+    for (size_t i = 0; i < kCommandTypeCount; i++)
+    {
+        if ((aStatistics[i].GetCount() > 0) || (aStatistics[i].GetErrors() > 0))
+        {
+            ReportTextRow(sCommandTypes[i].mName, aStatistics[i]);
+        }
+    }
+
+    ReportTextRow("all", aTotal);
+}
+
+static void
+ReportJSONObject(const char *aName, Statistics &aStatistics, const bool &aLast)
+{
+    printf("    \"%s\": { \"count\": %zu, \"errors\": %zu, "
+           "\"p50_ms\": %.3f, \"p99_ms\": %.3f, \"p999_ms\": %.3f, "
+           "\"max_ms\": %.3f }%s\n",
+           aName,
+           aStatistics.GetCount(),
+           aStatistics.GetErrors(),
+           ToMilliseconds(aStatistics.GetPercentile(50.0)),
+           ToMilliseconds(aStatistics.GetPercentile(99.0)),
+           ToMilliseconds(aStatistics.GetPercentile(99.9)),
+           ToMilliseconds(aStatistics.GetMax()),
+           (aLast ? "" : ","));
+}
+
+void HLXBench :: ReportJSON(Statistics (&aStatistics)[kCommandTypeCount], Statistics &aTotal, const double &aElapsed)
+{
+    static constexpr bool kLast = true;
+
+    printf("{\n");
+    printf("  \"connections\": %u,\n", sConnections);
+    printf("  \"requests\": %u,\n", sRequests);
+    printf("  \"rate\": %u,\n", sRate);
+    printf("  \"seed\": %u,\n", sSeed);
+    printf("  \"mix\": { \"query\": %u, \"mutation\": %u, \"group\": %u },\n",
+           sMix[kCommandClassQuery],
+           sMix[kCommandClassMutation],
+           sMix[kCommandClassGroup]);
+    printf("  \"elapsed_s\": %.6f,\n", aElapsed);
+    printf("  \"throughput\": %.3f,\n",
+           ((aElapsed > 0) ? (static_cast<double>(aTotal.GetCount()) / aElapsed) : 0));
+    printf("  \"commands\": {\n");
+
+    for (size_t i = 0; i < kCommandTypeCount; i++)
+    {
+        ReportJSONObject(sCommandTypes[i].mName, aStatistics[i], !kLast);
+    }
+
+    ReportJSONObject("all", aTotal, kLast);
+
+    printf("  }\n");
+    printf("}\n");
+}
+
+static void OnSignal(int aSignal)
+{
+    Log::Debug().Write("%s: caught signal %d\n", __func__, aSignal);
+
+    if (sHLXBench != nullptr)
+    {
+        sHLXBench->Stop(-EINTR);
+    }
+}
+
+static void SetSignalHandler(int aSignal, void (*aHandler)(int aSignal))
+{
+    struct sigaction sa;
+    int              signals[] = { aSignal };
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = aHandler;
+
+    for (size_t i = 0; i < ElementsOf(signals); i++)
+    {
+        if (sigaction(signals[i], &sa, nullptr) == -1)
+        {
+            perror("Can't catch signal");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/*
+ *  unsigned int SetLevel()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a debug
+ *    or information/verbosity level and, if successful, sets the
+ *    specified level value. Otherwise, if the specified argument is
+ *    NULL, then the level is simply incremented.
+ *
+ *  Input(s):
+ *    inLevel    - A reference to the value to set or increment.
+ *    inArgument - An optional pointer to a NULL-terminated C string
+ *                 representing a level to parse and set if valid.
+ *
+ *  Output(s):
+ *    inLevel    - A reference to the set or incremented value.
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetLevel(Log::Level &inLevel, const char *inArgument)
+{
+    unsigned int errors = 0;
+
+    if (inArgument != nullptr) {
+        inLevel = static_cast<Log::Level>(strtoul(inArgument, nullptr, 10));
+
+        if (inLevel == UINT32_MAX || errno == ERANGE) {
+            Log::Error().Write("Invalid log level `%s'\n", inArgument);
+            errors++;
+        }
+
+    } else {
+        inLevel++;
+
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetCount()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as an
+ *    unsigned count and, if successful, sets the specified count
+ *    value.
+ *
+ *  Input(s):
+ *    inName     - A pointer to a NULL-terminated C string naming the
+ *                 count, for diagnostic output.
+ *    inCount    - A reference to the value to set.
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    inCount    - A reference to the set value.
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetCount(const char *inName, uint32_t &inCount, const char *inArgument)
+{
+    unsigned int errors = 0;
+    Status       status;
+
+    status = Parse(inArgument, inCount);
+
+    if (status != kStatus_Success) {
+        Log::Error().Write("Invalid %s `%s'\n", inName, inArgument);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetLimit()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as an
+ *    expected server object count and, if successful, sets that
+ *    count as the maximum for the object type with the specified
+ *    setter.
+ *
+ *  Input(s):
+ *    inName     - A pointer to a NULL-terminated C string naming the
+ *                 object type, for diagnostic output.
+ *    inSetter   - The setter for the maximum number of objects of the
+ *                 type.
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetLimit(const char *inName, LimitSetter inSetter, const char *inArgument)
+{
+    IdentifierModel::IdentifierType limit;
+    unsigned int                    errors = 0;
+    Status                          status;
+
+    status = Parse(inArgument, limit);
+
+    if (status == kStatus_Success) {
+        status = inSetter(limit);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid %s count `%s'; please specify a count "
+                           "from %u to %u.\n",
+                           inName,
+                           inArgument,
+                           IdentifierModel::kIdentifierMin,
+                           IdentifierModel::kIdentifierMax);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetMix()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    colon-delimited triple of query, mutation, and group command
+ *    weights and, if successful, sets the command mix.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the mix to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetMix(const char *inArgument)
+{
+    uint32_t     mix[kCommandClassCount];
+    const char * start = inArgument;
+    unsigned int errors = 0;
+    uint32_t     total = 0;
+
+    for (size_t i = 0; i < kCommandClassCount; i++) {
+        const char * end = strchr(start, ':');
+        const size_t length = ((end == nullptr) ? strlen(start) : static_cast<size_t>(end - start));
+        Status       status;
+
+        if ((end == nullptr) != (i == (kCommandClassCount - 1))) {
+            errors++;
+            break;
+        }
+
+        status = Parse(start, length, mix[i]);
+
+        if (status != kStatus_Success) {
+            errors++;
+            break;
+        }
+
+        total += mix[i];
+
+        start = end + 1;
+    }
+
+    if (!errors && (total == 0)) {
+        errors++;
+    }
+
+    if (errors) {
+        Log::Error().Write("Invalid command mix `%s'; please specify "
+                           "QUERY:MUTATION:GROUP weights, at least one "
+                           "of which is non-zero.\n", inArgument);
+    } else {
+        memcpy(sMix, mix, sizeof (sMix));
+    }
+
+    return (errors);
+}
+
+/*
+ *  void PrintUsage()
+ *
+ *  Description:
+ *    This routine prints out the proper command line usage for this
+ *    program.
+ *
+ *  Input(s):
+ *    *inProgram - The name with which the program was invoked by
+ *                 the parent process.
+ *    inStatus   - The exit status returned to the parent process.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    N/A
+ *
+ */
+static void
+PrintUsage(const char *inProgram, int inStatus)
+{
+    const std::string theName = path(inProgram).filename().string();
+
+    // Regardless of the desired exit status, display a short usage
+    // synopsis.
+
+    printf(sShortUsageString, theName.c_str());
+
+    // Depending on the desired exit status, display either a helpful
+    // suggestion on obtaining more information or display a long
+    // usage synopsis.
+
+    if (inStatus != EXIT_SUCCESS)
+        printf("Try `%s -h' for more information.\n", theName.c_str());
+
+    if (inStatus != EXIT_FAILURE) {
+        printf(sLongUsageString);
+    }
+
+    exit(inStatus);
+}
+
+static void
+PrintVersion(const char *inProgram)
+{
+    const std::string theName = path(inProgram).filename().string();
+
+    printf("%s %s\n%s\n",
+           theName.c_str(),
+           GetVersionString(),
+           GetCopyrightString());
+
+    exit(EXIT_SUCCESS);
+}
+
+/*
+ *  void DecodeOptions()
+ *
+ *  Description:
+ *    This routine steps through the command-line arguments, parsing out
+ *    recognzied options.
+ *
+ *  Input(s):
+ *    inProgram - A pointer to a NULL-terminated C string of the name of
+ *                the program.
+ *    argc      - The number of arguments on the command line.
+ *    argv      - A pointer to an array of C strings containing the
+ *                command-line arguments.
+ *    inOptions - A pointer to an options list enumerating the allowed/
+ *                expected program options and arguments.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    N/A
+ *
+ */
+static void
+DecodeOptions(const char *inProgram,
+              int argc,
+              char * const argv[],
+              const struct option *inOptions,
+              size_t & outConsumed)
+{
+    constexpr bool  posixly_correct = true;
+    char const *    p;
+    int             c;
+    unsigned int    error = 0;
+    string          shortOptions;
+    Timeout::Value  timeoutMilliseconds;
+
+    // Generate a list of those single-character options available as
+    // a subset of the long option list.
+
+    Nuovations::Utilities::GenerateShortOptions(!posixly_correct, inOptions, shortOptions);
+
+    p = shortOptions.c_str();
+
+    // Start parsing invocation options
+
+    while (!error && (c = getopt_long(argc, argv, p, inOptions, nullptr)) != -1) {
+
+        switch (c) {
+
+        case OPT_CONNECTIONS:
+            error += SetCount("connection count", sConnections, optarg);
+            break;
+
+        case OPT_DEBUG:
+            error += SetLevel(sDebug, optarg);
+            break;
+
+        case OPT_EQUALIZER_PRESETS:
+            error += SetLimit("equalizer preset", Common::EqualizerPresetsControllerBasis::SetEqualizerPresetsMax, optarg);
+            break;
+
+        case OPT_FAVORITES:
+            error += SetLimit("favorite", Common::FavoritesControllerBasis::SetFavoritesMax, optarg);
+            break;
+
+        case OPT_GROUPS:
+            error += SetLimit("group", Common::GroupsControllerBasis::SetGroupsMax, optarg);
+            break;
+
+        case OPT_HELP:
+            PrintUsage(inProgram, EXIT_SUCCESS);
+            break;
+
+        case OPT_IPV4_ONLY:
+            if (sOptFlags & kOptIPv6Only)
+            {
+                Log::Error().Write("The '-6' and '-4' options are mutually-exclusive. Please choose one or the other.\n");
+                error++;
+            }
+            else
+            {
+                sOptFlags |= kOptIPv4Only;
+            }
+            break;
+
+        case OPT_IPV6_ONLY:
+            if (sOptFlags & kOptIPv4Only)
+            {
+                Log::Error().Write("The '-4' and '-6' options are mutually-exclusive. Please choose one or the other.\n");
+                error++;
+            }
+            else
+            {
+                sOptFlags |= kOptIPv6Only;
+            }
+            break;
+
+        case OPT_JSON:
+            sOptFlags |= kOptJSON;
+            break;
+
+        case OPT_MIX:
+            error += SetMix(optarg);
+            break;
+
+        case OPT_QUIET:
+            sOptFlags |= kOptQuiet;
+            break;
+
+        case OPT_RATE:
+            error += SetCount("rate", sRate, optarg);
+            break;
+
+        case OPT_REQUESTS:
+            error += SetCount("request count", sRequests, optarg);
+            break;
+
+        case OPT_SEED:
+            error += SetCount("seed", sSeed, optarg);
+            break;
+
+        case OPT_SOURCES:
+            error += SetLimit("source", Common::SourcesControllerBasis::SetSourcesMax, optarg);
+            break;
+
+        case OPT_SYSLOG:
+            sOptFlags |= kOptSyslog;
+            break;
+
+        case OPT_TIMEOUT:
+            {
+                const Status  lStatus = Parse(optarg, timeoutMilliseconds);
+
+                if (lStatus != kStatus_Success)
+                {
+                    Log::Error().Write("Cannot interpret timeout value '%s' as a duration in milliseconds.\n", optarg);
+                    error++;
+                }
+                else
+                {
+                    sOptFlags |= kOptTimeout;
+                }
+            }
+            break;
+
+        case OPT_VERBOSE:
+            error += SetLevel(sVerbose, optarg);
+            break;
+
+        case OPT_VERSION:
+            PrintVersion(inProgram);
+            break;
+
+        case OPT_ZONES:
+            error += SetLimit("zone", Common::ZonesControllerBasis::SetZonesMax, optarg);
+            break;
+
+        default:
+            Log::Error().Write("Unknown option '%d'!\n", optopt);
+            error++;
+            break;
+
+        }
+    }
+
+    // If we have accumulated any errors at this point, bail out since
+    // any further handling of arguments is likely to fail due to bad
+    // user input.
+
+    if (error) {
+        goto exit;
+    }
+
+    // Update argument parameters to reflect those consumed by getopt.
+
+    argc -= optind;
+    argv += optind;
+
+    outConsumed = static_cast<size_t>(optind);
+
+    // Reset the optind value; otherwise, option processing in any
+    // dispatched command will skip that many arguments before option
+    // processing actually starts.
+
+    optind = 0;
+
+    // At this point, we should have exactly one other argument, the
+    // URL or host name and optional port to connect to.
+
+    if (argc != 1) {
+        error++;
+        goto exit;
+    }
+
+    // Check that there is at least one connection.
+
+    if (sConnections == 0) {
+        Log::Error().Write("Please specify at least one connection.\n");
+        error++;
+    }
+
+    // Check that the timeout, if specified, makes sense.
+
+    if (sOptFlags & kOptTimeout) {
+        if (timeoutMilliseconds <= 0) {
+            Log::Error().Write("The specified timeout `%d' is not greater "
+                               "than zero. Please specify a non-zero, "
+                               "positive timeout.\n", timeoutMilliseconds);
+            error++;
+
+        } else {
+            const Timeout tempTimeout(timeoutMilliseconds);
+
+            sTimeout = tempTimeout;
+
+        }
+    } else {
+        sTimeout = kTimeoutDefault;
+
+    }
+
+    // If there were any errors parsing the command line arguments,
+    // remind the user of proper invocation semantics and return an
+    // error to the parent process.
+
+exit:
+    if (error) {
+        PrintUsage(inProgram, EXIT_FAILURE);
+    }
+
+    return;
+}
+
+/*
+ *  bool FilterSyslog()
+ *
+ *  Description:
+ *    This routine filters any writers from the specified log chain
+ *    that are not syslog writers.
+ *
+ *    Note that we have to be careful here. Chains are copied as a
+ *    shared pointer, so they are effectively just aliases. So,
+ *    we need to first find the writer(s) we are looking for, reset
+ *    the chain and then add them back. Otherwise, if we simply try
+ *    to copy the input chain and then reset it, we'll loose all the
+ *    writers.
+ *
+ *  Input(s):
+ *    inChain - A reference to the writer chain that should be
+ *              scrubbed of all writers but those for the syslog.
+ *
+ *  Output(s):
+ *    inChain - A reference to the writer chain scrubbed of all
+ *              writers but those for the syslog.
+ *
+ *  Returns:
+ *    True if syslog writers were successfully filtered from the
+ *    writer chain.
+ *
+ */
+static bool
+FilterSyslog(Log::Writer::Chain &inChain)
+{
+    bool didFilter = false;
+    const size_t theLinks = inChain.Size();
+    vector<Log::Writer::Base *> savedWriters;
+
+    // First, find and save the writers we would like to keep in the
+    // writer chain, syslog writers.
+
+    for (size_t theLink = 0; theLink < theLinks; theLink++) {
+            Log::Writer::Base * theWriter =
+                    inChain.Link<Log::Writer::Base>(theLink);
+
+            if (theWriter != nullptr) {
+                    if (typeid(*theWriter) == typeid(Log::Writer::Syslog)) {
+                            savedWriters.push_back(theWriter);
+                    }
+            }
+    }
+
+    // Now, reset the input chain and add back any found syslog writers.
+
+    inChain.Reset();
+
+    BOOST_FOREACH(Log::Writer::Base * savedWriter, savedWriters) {
+            inChain.Push(*static_cast<Log::Writer::Syslog *>(savedWriter));
+    }
+
+    didFilter = (savedWriters.size() && inChain.Size());
+
+    return (didFilter);
+}
+
+/*
+ *  bool FilterSyslog()
+ *
+ *  Description:
+ *    This routine filters any writers from the specified logger that
+ *    are not syslog writers.
+ *
+ *  Input(s):
+ *    inLogger - A reference to the logger for which the writer chain
+ *               should be scrubbed of all writers but those for the
+ *               syslog.
+ *
+ *  Output(s):
+ *    inLogger - A reference to the logger with its writer chain
+ *               scrubbed of all writers but those for the syslog.
+ *
+ *  Returns:
+ *    True if a syslog writer(s) was/were successfully filtered from
+ *    the logger; otherwise, false.
+ *
+ */
+static bool
+FilterSyslog(Log::Logger &inLogger)
+{
+    Log::Writer::Base & theWriter = inLogger.GetWriter();
+
+    if (typeid(theWriter) == typeid(Log::Writer::Chain))
+    {
+        return (FilterSyslog(static_cast<Log::Writer::Chain &>(theWriter)));
+    }
+
+    return (typeid(theWriter) == typeid(Log::Writer::Syslog));
+}
+
+int main(int argc, char * const argv[])
+{
+    HLXBench     lHLXBench;
+    Status       lStatus;
+    size_t       n = 0;
+    const char * lMaybeURL = nullptr;
+
+    // Cache the program invocation name for later use
+
+    sProgram = argv[0];
+
+    // Decode invocation parameters.
+
+    DecodeOptions(sProgram, argc, argv, sOptions, n);
+
+    lMaybeURL = argv[n];
+
+    SetSignalHandler(SIGHUP,  OnSignal);
+    SetSignalHandler(SIGINT,  OnSignal);
+    SetSignalHandler(SIGQUIT, OnSignal);
+    SetSignalHandler(SIGTERM, OnSignal);
+
+    // Update logging streams, adjusting the filters and writers as
+    // dictated by invocation options.
+
+    Log::SetFilter(Log::Debug(), sDebug,   sOptFlags & kOptQuiet);
+    Log::SetFilter(Log::Error(), sError,   false);
+    Log::SetFilter(Log::Info(),  sVerbose, sOptFlags & kOptQuiet);
+
+    if (sOptFlags & kOptSyslog) {
+        FilterSyslog(Log::Debug());
+        FilterSyslog(Log::Error());
+        FilterSyslog(Log::Info());
+    }
+
+    {
+        const bool lUseIPv4 = (((sOptFlags & kOptIPv6Only) == kOptIPv6Only) ? false : true);
+        const bool lUseIPv6 = (((sOptFlags & kOptIPv4Only) == kOptIPv4Only) ? false : true);
+
+        sHLXBench = &lHLXBench;
+
+        lStatus = lHLXBench.Init();
+        nlREQUIRE_SUCCESS_ACTION(lStatus, done, lHLXBench.SetStatus(lStatus));
+
+        lStatus = lHLXBench.Start(lMaybeURL, lUseIPv6, lUseIPv4, sTimeout);
+        nlREQUIRE_SUCCESS_ACTION(lStatus, done, lHLXBench.SetStatus(lStatus));
+    }
+
+    CFRunLoopRun();
+
+    if (lHLXBench.GetStatus() == kStatus_Success)
+    {
+        lHLXBench.Report();
+    }
+
+ done:
+    return((lHLXBench.GetStatus() == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
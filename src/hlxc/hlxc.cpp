@@ -23,9 +23,13 @@
  *
  */
 
+#include <deque>
+#include <fstream>
+#include <iostream>
 #include <string>
 #include <vector>
 
+#include <ctype.h>
 #include <errno.h>
 #include <getopt.h>
 #include <signal.h>
@@ -57,9 +61,15 @@
 #include <OpenHLX/Client/SourcesStateChangeNotifications.hpp>
 #include <OpenHLX/Client/ZonesStateChangeNotifications.hpp>
 #include <OpenHLX/Common/ConnectionManagerBasis.hpp>
+#include <OpenHLX/Common/EqualizerPresetsControllerBasis.hpp>
+#include <OpenHLX/Common/FavoritesControllerBasis.hpp>
+#include <OpenHLX/Common/GroupsControllerBasis.hpp>
 #include <OpenHLX/Common/OutputStringStream.hpp>
+#include <OpenHLX/Common/SourcesControllerBasis.hpp>
 #include <OpenHLX/Common/Timeout.hpp>
 #include <OpenHLX/Common/Version.hpp>
+#include <OpenHLX/Common/ZonesControllerBasis.hpp>
+#include <OpenHLX/Model/IdentifierModel.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 #include <OpenHLX/Utilities/ElementsOf.hpp>
 #include <OpenHLX/Utilities/Utilities.hpp>
@@ -80,6 +90,7 @@ using namespace std;
 
 #define OPT_BASE                     0x00001000
 
+#define OPT_BATCH                    'b'
 #define OPT_DEBUG                    'd'
 #define OPT_HELP                     'h'
 #define OPT_IPV4_ONLY                '4'
@@ -144,6 +155,14 @@ using namespace std;
 #define OPT_ADD_ZONE                 (OPT_BASE + 39)
 #define OPT_REMOVE_ZONE              (OPT_BASE + 40)
 
+// Scale Options
+
+#define OPT_EQUALIZER_PRESETS        (OPT_BASE + 41)
+#define OPT_FAVORITES                (OPT_BASE + 42)
+#define OPT_GROUPS                   (OPT_BASE + 43)
+#define OPT_SOURCES                  (OPT_BASE + 44)
+#define OPT_ZONES                    (OPT_BASE + 45)
+
 
 // Type Declarations
 
@@ -154,6 +173,7 @@ enum OptFlags {
     kOptPriority         = 0x00000004,
     kOptQuiet            = 0x00000008,
     kOptSyslog           = 0x00000010,
+    kOptBatch            = 0x00000020,
 
     kOptTimeout          = 0x00000080,
 
@@ -227,11 +247,39 @@ struct ClientArgument {
     StateChange::Type   mExpectedClientArgumentCompletionEvent;
 };
 
+/**
+ *  @brief
+ *    An object that represents a HLX client command request read from
+ *    a batch file, the line it was read from, and whether its expected
+ *    completion event has been received.
+ *
+ *  The client argument option argument strings point into the
+ *  tokenized line arguments, so the object must not be copied once
+ *  those have been set.
+ *
+ */
+struct BatchOperation {
+    size_t                    mLine;
+    std::string               mText;
+    std::vector<std::string>  mArguments;
+    ClientArgument            mClientArgument;
+    uint32_t                  mOptFlags;
+    bool                      mDidComplete;
+};
+
+typedef std::deque<BatchOperation> BatchOperations;
+
+typedef Status (*LimitSetter)(const IdentifierModel::IdentifierType &aLimit);
+
 class HLXClient;
 
 // Function Prototypes
 
+static void SetRefreshScope(const ClientArgument &aClientArgument, const uint32_t &aOptFlags, Client::Application::Controller::RefreshScope &aRefreshScope);
 static Status DispatchCommand(Client::Application::Controller &aController, ClientArgument &aClientArgument, const uint32_t &aOptFlags, const Timeout &aTimeout);
+static Status DispatchBatch(Client::Application::Controller &aController, BatchOperations &aOperations, const Timeout &aTimeout);
+static void MaybeCompleteBatchOperation(BatchOperations &aOperations, const StateChange::NotificationBasis &aStateChangeNotification);
+static void CompleteBatch(BatchOperations &aOperations);
 
 // Global Variables
 
@@ -248,7 +296,12 @@ static ClientArgument       sClientArgument;
 
 static HLXClient *          sHLXClient           = nullptr;
 
+static const char *         sBatchPath           = nullptr;
+static BatchOperations      sBatchOperations;
+static bool                 sBatchDidDispatch    = false;
+
 static const struct option  sOptions[] = {
+    { "batch",                   required_argument,  nullptr,   OPT_BATCH                   },
     { "debug",                   optional_argument,  nullptr,   OPT_DEBUG                   },
     { "help",                    no_argument,        nullptr,   OPT_HELP                    },
     { "ipv4-only",               no_argument,        nullptr,   OPT_IPV4_ONLY               },
@@ -304,11 +357,18 @@ static const struct option  sOptions[] = {
     { "add-zone",                required_argument,  nullptr,   OPT_ADD_ZONE                },
     { "remove-zone",             required_argument,  nullptr,   OPT_REMOVE_ZONE             },
 
+    { "equalizer-presets",       required_argument,  nullptr,   OPT_EQUALIZER_PRESETS       },
+    { "favorites",               required_argument,  nullptr,   OPT_FAVORITES               },
+    { "groups",                  required_argument,  nullptr,   OPT_GROUPS                  },
+    { "sources",                 required_argument,  nullptr,   OPT_SOURCES                 },
+    { "zones",                   required_argument,  nullptr,   OPT_ZONES                   },
+
     { nullptr,                   0,                  nullptr,   0                           }
 };
 
 static const char * const   sShortUsageString =
-"Usage: %s [ options ] { <URL> | <host[:port]> | <file> } [ <identifier option> [ { equalizer preset | group | source | zone } <option> ]]\n";
+"Usage: %s [ options ] { <URL> | <host[:port]> | <file> } [ <identifier option> [ { equalizer preset | group | source | zone } <option> ]]\n"
+"       %s [ options ] --batch=FILE { <URL> | <host[:port]> | <file> }\n";
 
 static const char * const   sLongUsageString =
 "\n"
@@ -332,9 +392,27 @@ static const char * const   sLongUsageString =
 "\n"
 "  -4, --ipv4-only                     Force hlxc to use IPv4 addresses only.\n"
 "  -6, --ipv6-only                     Force hlxc to use IPv6 addresses only.\n"
+"  -b, --batch=FILE                    Read identifier and operation options,\n"
+"                                      one command per line, from FILE (or\n"
+"                                      standard input, if FILE is '-') and\n"
+"                                      execute them all over one connection.\n"
 "  -t, --timeout=MILLISECONDS          Set a connection timeout of MILLISECONDS \n"
 "                                      milliseconds.\n"
 "\n"
+" Scale Options:\n"
+"\n"
+"  --equalizer-presets=COUNT           Expect COUNT equalizer presets\n"
+"                                      (default: 10).\n"
+"  --favorites=COUNT                   Expect COUNT favorites (default: 10).\n"
+"  --groups=COUNT                      Expect COUNT groups (default: 10).\n"
+"  --sources=COUNT                     Expect COUNT sources (default: 8).\n"
+"  --zones=COUNT                       Expect COUNT zones (default: 24).\n"
+"\n"
+"                                      COUNT may range from 1 to 254 and\n"
+"                                      should match that of the HLX server,\n"
+"                                      for example, a simulator run with the\n"
+"                                      same options.\n"
+"\n"
 " Identifier Options:\n"
 "\n"
 "  --equalizer-preset=PRESET           Perform operation on the equalizer preset\n"
@@ -691,8 +769,37 @@ void HLXClient :: ControllerDidConnect(Client::Application::Controller &aControl
 
     Log::Info().Write("Connected to %s.\n", CFString(CFURLGetString(aURLRef)).GetCString());
 
-    lStatus = mHLXClientController.Refresh();
-    nlREQUIRE_SUCCESS(lStatus, done);
+    // If the user provided a class or command argument, or a batch of
+    // them, then refresh only the state needed to dispatch commands
+    // against those arguments. Otherwise, the application was invoked
+    // in read-only, query mode. In the latter case, refresh all state.
+
+    if (sOptFlags & kOptBatch)
+    {
+        Client::Application::Controller::RefreshScope lRefreshScope;
+
+        BOOST_FOREACH(const BatchOperation &lOperation, sBatchOperations)
+        {
+            SetRefreshScope(lOperation.mClientArgument, lOperation.mOptFlags, lRefreshScope);
+        }
+
+        lStatus = mHLXClientController.Refresh(lRefreshScope);
+        nlREQUIRE_SUCCESS(lStatus, done);
+    }
+    else if (sOptFlags & (kOptHasObjectArg | kOptHasOperationArg))
+    {
+        Client::Application::Controller::RefreshScope lRefreshScope;
+
+        SetRefreshScope(sClientArgument, sOptFlags, lRefreshScope);
+
+        lStatus = mHLXClientController.Refresh(lRefreshScope);
+        nlREQUIRE_SUCCESS(lStatus, done);
+    }
+    else
+    {
+        lStatus = mHLXClientController.Refresh();
+        nlREQUIRE_SUCCESS(lStatus, done);
+    }
 
  done:
     return;
@@ -781,12 +888,40 @@ void HLXClient :: ControllerDidRefresh(Client::Application::ControllerBasis &aCo
 
     Log::Info().Write("Client data received.\n");
 
-    // If the user provided both a class and a command argument, then
-    // attempt to dispatch a command against those
+    // If the user provided a batch, then the first refresh completes
+    // the state needed to dispatch it and the second, issued after all
+    // of its commands, completes the batch itself.
+    //
+    // Otherwise, if the user provided both a class and a command
+    // argument, then attempt to dispatch a command against those
     // arguments. Otherwise, the application was invoked in read-only,
     // query mode. In the latter case, just disconnect and quit.
 
-    if (sOptFlags & (kOptHasObjectArg | kOptHasOperationArg))
+    if (sOptFlags & kOptBatch)
+    {
+        Client::Application::Controller &lController = static_cast<Client::Application::Controller &>(aController);
+
+        if (!sBatchDidDispatch)
+        {
+            lStatus = DispatchBatch(lController, sBatchOperations, sTimeout);
+
+            if (lStatus != kStatus_Success)
+            {
+                Stop(lStatus);
+            }
+            else if (sBatchOperations.empty())
+            {
+                Stop();
+            }
+        }
+        else
+        {
+            CompleteBatch(sBatchOperations);
+
+            Stop();
+        }
+    }
+    else if (sOptFlags & (kOptHasObjectArg | kOptHasOperationArg))
     {
         Client::Application::Controller &lController = static_cast<Client::Application::Controller &>(aController);
 
@@ -1160,7 +1295,11 @@ void HLXClient :: ControllerStateDidChange(Client::Application::ControllerBasis
     }
 
  done:
-    if (sClientArgument.mDidDispatch == true)
+    if (sOptFlags & kOptBatch)
+    {
+        MaybeCompleteBatchOperation(sBatchOperations, aStateChangeNotification);
+    }
+    else if (sClientArgument.mDidDispatch == true)
     {
         if (lType == sClientArgument.mExpectedClientArgumentCompletionEvent)
         {
@@ -1257,6 +1396,56 @@ SetLevel(Log::Level &inLevel, const char *inArgument)
     return (errors);
 }
 
+/*
+ *  unsigned int SetLimit()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as an
+ *    expected server object count and, if successful, sets that
+ *    count as the maximum for the object type with the specified
+ *    setter.
+ *
+ *  Input(s):
+ *    inName     - A pointer to a NULL-terminated C string naming the
+ *                 object type, for diagnostic output.
+ *    inSetter   - The setter for the maximum number of objects of the
+ *                 type.
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetLimit(const char *inName, LimitSetter inSetter, const char *inArgument)
+{
+    IdentifierModel::IdentifierType limit;
+    unsigned int                    errors = 0;
+    Status                          status;
+
+    status = Parse(inArgument, limit);
+
+    if (status == kStatus_Success) {
+        status = inSetter(limit);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid %s count `%s'; please specify a count "
+                           "from %u to %u.\n",
+                           inName,
+                           inArgument,
+                           IdentifierModel::kIdentifierMin,
+                           IdentifierModel::kIdentifierMax);
+        errors++;
+    }
+
+    return (errors);
+}
+
 /*
  *  void PrintUsage()
  *
@@ -1284,7 +1473,7 @@ PrintUsage(const char *inProgram, int inStatus)
     // Regardless of the desired exit status, display a short usage
     // synopsis.
 
-    printf(sShortUsageString, theName.c_str());
+    printf(sShortUsageString, theName.c_str(), theName.c_str());
 
     // Depending on the desired exit status, display either a helpful
     // suggestion on obtaining more information or display a long
@@ -1482,183 +1671,497 @@ SetOperationOption(ClientArgument &aClientArgument, const Option &aOption, const
 }
 
 /*
- *  void DecodeOptions()
+ *  bool SetCommandOption()
  *
  *  Description:
- *    This routine steps through the command-line arguments, parsing out
- *    recognzied options.
+ *    This routine sets the specified command object, subobject, or
+ *    operation option and its argument, if any, in the specified client
+ *    argument, if the option is one of those options.
  *
  *  Input(s):
- *    inProgram - A pointer to a NULL-terminated C string of the name of
- *                the program.
- *    argc      - The number of arguments on the command line.
- *    argv      - A pointer to an array of C strings containing the
- *                command-line arguments.
- *    inOptions - A pointer to an options list enumerating the allowed/
- *                expected program options and arguments.
+ *    aClientArgument - A reference to the client argument to set the
+ *                      option in.
+ *    aOption         - The option to set.
+ *    aArgument       - A pointer to an optional NULL-terminated C
+ *                      string argument for the option.
+ *    aOptFlags       - A reference to the option flags to update.
  *
  *  Output(s):
- *    N/A
+ *    aClientArgument - A reference to the updated client argument.
+ *    aOptFlags       - A reference to the updated option flags.
  *
  *  Returns:
- *    N/A
+ *    True if the option was a command object, subobject, or operation
+ *    option; otherwise, false.
  *
  */
-static void
-DecodeOptions(const char *inProgram,
-              int argc,
-              char * const argv[],
-              const struct option *inOptions,
-              size_t & outConsumed)
+static bool
+SetCommandOption(ClientArgument &aClientArgument, const int &aOption, const char *aArgument, uint32_t &aOptFlags)
 {
-    const bool      posixly_correct = true;
-    char const *    p;
-    int             c;
-    unsigned int    error = 0;
-    string          shortOptions;
-    Timeout::Value  timeoutMilliseconds;
-
-    // Generate a list of those single-character options available as
-    // a subset of the long option list.
+    bool lRetval = true;
 
-    Nuovations::Utilities::GenerateShortOptions(!posixly_correct, inOptions, shortOptions);
+    switch (aOption) {
 
-    p = shortOptions.c_str();
+    case OPT_GROUP:
+    case OPT_EQUALIZER_PRESET:
+    case OPT_SOURCE:
+    case OPT_ZONE:
+        SetObjectOption(aClientArgument,
+                        static_cast<Option>(aOption),
+                        aArgument,
+                        aOptFlags);
+        break;
 
-    // Start parsing invocation options
+    case OPT_EQUALIZER_BAND:
+        SetSubobjectOption(aClientArgument,
+                           static_cast<Option>(aOption),
+                           aArgument,
+                           aOptFlags);
+        break;
 
-    while (!error && (c = getopt_long(argc, argv, p, inOptions, nullptr)) != -1) {
+    case OPT_GET_BALANCE:
+    case OPT_GET_BASS:
+    case OPT_GET_EQUALIZER_BAND:
+    case OPT_GET_MUTE:
+    case OPT_GET_NAME:
+    case OPT_GET_SOUND_MODE:
+    case OPT_GET_SOURCE:
+    case OPT_GET_TREBLE:
+    case OPT_GET_VOLUME:
+    case OPT_SET_BALANCE:
+    case OPT_SET_BASS:
+    case OPT_SET_EQUALIZER_BAND:
+    case OPT_SET_EQUALIZER_PRESET:
+    case OPT_SET_HIGHPASS_CROSSOVER:
+    case OPT_SET_LOWPASS_CROSSOVER:
+    case OPT_SET_MUTE:
+    case OPT_SET_NAME:
+    case OPT_SET_SOUND_MODE:
+    case OPT_SET_SOURCE:
+    case OPT_SET_TREBLE:
+    case OPT_SET_VOLUME:
+    case OPT_SET_VOLUME_LOCKED:
+    case OPT_ADD_ZONE:
+    case OPT_REMOVE_ZONE:
+    case OPT_DECREASE_BASS:
+    case OPT_DECREASE_EQUALIZER_BAND:
+    case OPT_DECREASE_TREBLE:
+    case OPT_DECREASE_VOLUME:
+    case OPT_INCREASE_BALANCE_LEFT:
+    case OPT_INCREASE_BALANCE_RIGHT:
+    case OPT_INCREASE_BASS:
+    case OPT_INCREASE_EQUALIZER_BAND:
+    case OPT_INCREASE_TREBLE:
+    case OPT_INCREASE_VOLUME:
+    case OPT_TOGGLE_MUTE:
+        SetOperationOption(aClientArgument,
+                           static_cast<Option>(aOption),
+                           aArgument,
+                           aOptFlags);
+        break;
 
-        switch (c) {
+    default:
+        lRetval = false;
+        break;
 
-        case OPT_DEBUG:
-            error += SetLevel(sDebug, optarg);
-            break;
+    }
 
-        case OPT_HELP:
-            PrintUsage(inProgram, EXIT_SUCCESS);
-            break;
+    return (lRetval);
+}
 
-        case OPT_IPV4_ONLY:
-            if (sOptFlags & kOptIPv6Only)
-            {
-                Log::Error().Write("The '-6' and '-4' options are mutually-exclusive. Please choose one or the other.\n");
-                error++;
-            }
-            else
-            {
-                sOptFlags |= kOptIPv4Only;
-            }
-            break;
+/*
+ *  Status TokenizeBatchLine()
+ *
+ *  Description:
+ *    This routine splits the specified batch file line into
+ *    whitespace-delimited arguments, treating any run of characters
+ *    enclosed in double quotes, such as a name containing spaces, as
+ *    part of a single argument.
+ *
+ *  Input(s):
+ *    aLine      - A reference to the line to split.
+ *
+ *  Output(s):
+ *    aArguments - A reference to the arguments split from the line.
+ *
+ *  Returns:
+ *    kStatus_Success if OK; otherwise, -EINVAL if the line has an
+ *    unterminated quote.
+ *
+ */
+static Status
+TokenizeBatchLine(const std::string &aLine, std::vector<std::string> &aArguments)
+{
+    std::string::const_iterator  lCurrent = aLine.begin();
+    Status                       lRetval = kStatus_Success;
 
-        case OPT_IPV6_ONLY:
-            if (sOptFlags & kOptIPv4Only)
-            {
-                Log::Error().Write("The '-4' and '-6' options are mutually-exclusive. Please choose one or the other.\n");
-                error++;
-            }
-            else
-            {
-                sOptFlags |= kOptIPv6Only;
-            }
-            break;
+    while (lCurrent != aLine.end())
+    {
+        std::string  lArgument;
+        bool         lInQuotes = false;
 
-        case OPT_QUIET:
-            sOptFlags |= kOptQuiet;
-            break;
+        while ((lCurrent != aLine.end()) && isspace(*lCurrent))
+            lCurrent++;
 
-        case OPT_SYSLOG:
-            sOptFlags |= kOptSyslog;
+        if (lCurrent == aLine.end())
             break;
 
-        case OPT_TIMEOUT:
-            {
-                const Status  lStatus = Parse(optarg, timeoutMilliseconds);
+        while ((lCurrent != aLine.end()) && (lInQuotes || !isspace(*lCurrent)))
+        {
+            if (*lCurrent == '"')
+                lInQuotes = !lInQuotes;
+            else
+                lArgument.push_back(*lCurrent);
 
-                if (lStatus != kStatus_Success)
-                {
-                    Log::Error().Write("Cannot interpret timeout value '%s' as a duration in milliseconds.\n", optarg);
-                    error++;
-                }
-                else
-                {
-                    sOptFlags |= kOptTimeout;
-                }
-            }
-            break;
+            lCurrent++;
+        }
 
-        case OPT_VERBOSE:
-            error += SetLevel(sVerbose, optarg);
-            break;
+        nlREQUIRE_ACTION(!lInQuotes, done, lRetval = -EINVAL);
 
-        case OPT_VERSION:
-            PrintVersion(inProgram);
-            break;
+        aArguments.push_back(lArgument);
+    }
 
-        case OPT_GROUP:
-        case OPT_EQUALIZER_PRESET:
-        case OPT_SOURCE:
-        case OPT_ZONE:
-            SetObjectOption(sClientArgument,
-                            static_cast<Option>(c),
-                            optarg,
-                            sOptFlags);
-            break;
+ done:
+    return (lRetval);
+}
 
-        case OPT_EQUALIZER_BAND:
-            SetSubobjectOption(sClientArgument,
-                               static_cast<Option>(c),
-                               optarg,
-                               sOptFlags);
-            break;
+/*
+ *  Status ParseBatchOperation()
+ *
+ *  Description:
+ *    This routine parses the tokenized arguments of the specified
+ *    batch operation as identifier, subobject, and operation options,
+ *    using the same option vocabulary as the command line.
+ *
+ *  Input(s):
+ *    inProgram  - A pointer to a NULL-terminated C string of the name of
+ *                 the program.
+ *    inOptions  - A pointer to an options list enumerating the allowed/
+ *                 expected program options and arguments.
+ *    aOperation - A reference to the batch operation to parse.
+ *
+ *  Output(s):
+ *    aOperation - A reference to the parsed batch operation.
+ *
+ *  Returns:
+ *    kStatus_Success if OK; otherwise, -EINVAL if the operation has
+ *    an option other than an identifier, subobject, or operation
+ *    option, has other arguments, or lacks either an identifier or an
+ *    operation option.
+ *
+ */
+static Status
+ParseBatchOperation(const char *inProgram,
+                    const struct option *inOptions,
+                    BatchOperation &aOperation)
+{
+    const bool           posixly_correct = true;
+    std::vector<char *>  lArguments;
+    int                  lArgumentCount;
+    int                  c;
+    string               shortOptions;
+    Status               lRetval = kStatus_Success;
 
-        case OPT_GET_BALANCE:
-        case OPT_GET_BASS:
-        case OPT_GET_EQUALIZER_BAND:
-        case OPT_GET_MUTE:
-        case OPT_GET_NAME:
-        case OPT_GET_SOUND_MODE:
-        case OPT_GET_SOURCE:
-        case OPT_GET_TREBLE:
-        case OPT_GET_VOLUME:
-        case OPT_SET_BALANCE:
-        case OPT_SET_BASS:
-        case OPT_SET_EQUALIZER_BAND:
-        case OPT_SET_EQUALIZER_PRESET:
-        case OPT_SET_HIGHPASS_CROSSOVER:
-        case OPT_SET_LOWPASS_CROSSOVER:
-        case OPT_SET_MUTE:
-        case OPT_SET_NAME:
-        case OPT_SET_SOUND_MODE:
-        case OPT_SET_SOURCE:
-        case OPT_SET_TREBLE:
-        case OPT_SET_VOLUME:
-        case OPT_SET_VOLUME_LOCKED:
-        case OPT_ADD_ZONE:
-        case OPT_REMOVE_ZONE:
-        case OPT_DECREASE_BASS:
-        case OPT_DECREASE_EQUALIZER_BAND:
-        case OPT_DECREASE_TREBLE:
-        case OPT_DECREASE_VOLUME:
-        case OPT_INCREASE_BALANCE_LEFT:
-        case OPT_INCREASE_BALANCE_RIGHT:
-        case OPT_INCREASE_BASS:
-        case OPT_INCREASE_EQUALIZER_BAND:
-        case OPT_INCREASE_TREBLE:
-        case OPT_INCREASE_VOLUME:
-        case OPT_TOGGLE_MUTE:
-            SetOperationOption(sClientArgument,
-                               static_cast<Option>(c),
-                               optarg,
-                               sOptFlags);
-            break;
+    Nuovations::Utilities::GenerateShortOptions(!posixly_correct, inOptions, shortOptions);
 
-        default:
-            Log::Error().Write("Unknown option '%d'!\n", optopt);
-            error++;
-            break;
+    lArguments.push_back(const_cast<char *>(inProgram));
 
-        }
+    BOOST_FOREACH(std::string &lArgument, aOperation.mArguments)
+    {
+        lArguments.push_back(&lArgument[0]);
+    }
+
+    lArgumentCount = static_cast<int>(lArguments.size());
+
+    lArguments.push_back(nullptr);
+
+    optind = 0;
+
+    while ((lRetval == kStatus_Success) &&
+           (c = getopt_long(lArgumentCount, &lArguments[0], shortOptions.c_str(), inOptions, nullptr)) != -1)
+    {
+        if (!SetCommandOption(aOperation.mClientArgument, c, optarg, aOperation.mOptFlags))
+        {
+            Log::Error().Write("Line %zu: only identifier and operation options may be used in a batch.\n", aOperation.mLine);
+            lRetval = -EINVAL;
+        }
+    }
+
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    if (optind != lArgumentCount)
+    {
+        Log::Error().Write("Line %zu: unexpected argument '%s'.\n", aOperation.mLine, lArguments[static_cast<size_t>(optind)]);
+        lRetval = -EINVAL;
+        goto done;
+    }
+
+    if ((aOperation.mOptFlags & (kOptHasObjectArg | kOptHasOperationArg)) != (kOptHasObjectArg | kOptHasOperationArg))
+    {
+        Log::Error().Write("Line %zu: both an identifier and an operation option are required.\n", aOperation.mLine);
+        lRetval = -EINVAL;
+        goto done;
+    }
+
+    // The expected completion event depends on the identifier option,
+    // which may follow the operation option on the line, so establish
+    // it again now that both have been parsed.
+
+    SetOperationOption(aOperation.mClientArgument,
+                       aOperation.mClientArgument.mOperationOptionArgument.mOption,
+                       aOperation.mClientArgument.mOperationOptionArgument.mArgument.mString,
+                       aOperation.mOptFlags);
+
+ done:
+    optind = 0;
+
+    return (lRetval);
+}
+
+/*
+ *  Status ReadBatchOperations()
+ *
+ *  Description:
+ *    This routine reads and parses, one per line, the batch operations
+ *    in the specified file, skipping blank lines and those whose first
+ *    non-whitespace character is '#'.
+ *
+ *  Input(s):
+ *    inProgram   - A pointer to a NULL-terminated C string of the name of
+ *                  the program.
+ *    inOptions   - A pointer to an options list enumerating the allowed/
+ *                  expected program options and arguments.
+ *    aPath       - A pointer to a NULL-terminated C string of the path
+ *                  of the file to read or "-" for standard input.
+ *
+ *  Output(s):
+ *    aOperations - A reference to the batch operations read.
+ *
+ *  Returns:
+ *    kStatus_Success if OK; -ENOENT if the file could not be opened;
+ *    otherwise, -EINVAL if any line could not be parsed.
+ *
+ */
+static Status
+ReadBatchOperations(const char *inProgram,
+                    const struct option *inOptions,
+                    const char *aPath,
+                    BatchOperations &aOperations)
+{
+    const bool     lUseStandardInput = (strcmp(aPath, "-") == 0);
+    std::ifstream  lFile;
+    std::string    lLine;
+    size_t         lLineNumber = 0;
+    Status         lStatus;
+    Status         lRetval = kStatus_Success;
+
+    if (!lUseStandardInput)
+    {
+        lFile.open(aPath);
+
+        if (!lFile.is_open())
+        {
+            Log::Error().Write("Could not open batch file '%s'.\n", aPath);
+            lRetval = -ENOENT;
+            goto done;
+        }
+    }
+
+    {
+        std::istream &lStream = (lUseStandardInput ? std::cin : lFile);
+
+        while (std::getline(lStream, lLine))
+        {
+            const size_t lFirst = lLine.find_first_not_of(" \t\r");
+
+            lLineNumber++;
+
+            if ((lFirst == std::string::npos) || (lLine[lFirst] == '#'))
+                continue;
+
+            // Construct the operation in place such that the option
+            // argument strings, which point into its tokenized
+            // arguments, remain valid.
+
+            aOperations.push_back(BatchOperation());
+
+            {
+                BatchOperation &lOperation = aOperations.back();
+
+                lOperation.mLine = lLineNumber;
+                lOperation.mText = lLine.substr(lFirst, lLine.find_last_not_of(" \t\r") - lFirst + 1);
+
+                lStatus = TokenizeBatchLine(lOperation.mText, lOperation.mArguments);
+
+                if (lStatus != kStatus_Success)
+                {
+                    Log::Error().Write("Line %zu: unterminated quote.\n", lLineNumber);
+                    lRetval = lStatus;
+                    continue;
+                }
+
+                lStatus = ParseBatchOperation(inProgram, inOptions, lOperation);
+
+                if (lStatus != kStatus_Success)
+                {
+                    lRetval = lStatus;
+                }
+            }
+        }
+    }
+
+ done:
+    return (lRetval);
+}
+
+/*
+ *  void DecodeOptions()
+ *
+ *  Description:
+ *    This routine steps through the command-line arguments, parsing out
+ *    recognzied options.
+ *
+ *  Input(s):
+ *    inProgram - A pointer to a NULL-terminated C string of the name of
+ *                the program.
+ *    argc      - The number of arguments on the command line.
+ *    argv      - A pointer to an array of C strings containing the
+ *                command-line arguments.
+ *    inOptions - A pointer to an options list enumerating the allowed/
+ *                expected program options and arguments.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    N/A
+ *
+ */
+static void
+DecodeOptions(const char *inProgram,
+              int argc,
+              char * const argv[],
+              const struct option *inOptions,
+              size_t & outConsumed)
+{
+    const bool      posixly_correct = true;
+    char const *    p;
+    int             c;
+    unsigned int    error = 0;
+    string          shortOptions;
+    Timeout::Value  timeoutMilliseconds;
+
+    // Generate a list of those single-character options available as
+    // a subset of the long option list.
+
+    Nuovations::Utilities::GenerateShortOptions(!posixly_correct, inOptions, shortOptions);
+
+    p = shortOptions.c_str();
+
+    // Start parsing invocation options
+
+    while (!error && (c = getopt_long(argc, argv, p, inOptions, nullptr)) != -1) {
+
+        switch (c) {
+
+        case OPT_BATCH:
+            sBatchPath = optarg;
+            sOptFlags |= kOptBatch;
+            break;
+
+        case OPT_DEBUG:
+            error += SetLevel(sDebug, optarg);
+            break;
+
+        case OPT_EQUALIZER_PRESETS:
+            error += SetLimit("equalizer preset", Common::EqualizerPresetsControllerBasis::SetEqualizerPresetsMax, optarg);
+            break;
+
+        case OPT_FAVORITES:
+            error += SetLimit("favorite", Common::FavoritesControllerBasis::SetFavoritesMax, optarg);
+            break;
+
+        case OPT_GROUPS:
+            error += SetLimit("group", Common::GroupsControllerBasis::SetGroupsMax, optarg);
+            break;
+
+        case OPT_HELP:
+            PrintUsage(inProgram, EXIT_SUCCESS);
+            break;
+
+        case OPT_IPV4_ONLY:
+            if (sOptFlags & kOptIPv6Only)
+            {
+                Log::Error().Write("The '-6' and '-4' options are mutually-exclusive. Please choose one or the other.\n");
+                error++;
+            }
+            else
+            {
+                sOptFlags |= kOptIPv4Only;
+            }
+            break;
+
+        case OPT_IPV6_ONLY:
+            if (sOptFlags & kOptIPv4Only)
+            {
+                Log::Error().Write("The '-4' and '-6' options are mutually-exclusive. Please choose one or the other.\n");
+                error++;
+            }
+            else
+            {
+                sOptFlags |= kOptIPv6Only;
+            }
+            break;
+
+        case OPT_QUIET:
+            sOptFlags |= kOptQuiet;
+            break;
+
+        case OPT_SOURCES:
+            error += SetLimit("source", Common::SourcesControllerBasis::SetSourcesMax, optarg);
+            break;
+
+        case OPT_SYSLOG:
+            sOptFlags |= kOptSyslog;
+            break;
+
+        case OPT_TIMEOUT:
+            {
+                const Status  lStatus = Parse(optarg, timeoutMilliseconds);
+
+                if (lStatus != kStatus_Success)
+                {
+                    Log::Error().Write("Cannot interpret timeout value '%s' as a duration in milliseconds.\n", optarg);
+                    error++;
+                }
+                else
+                {
+                    sOptFlags |= kOptTimeout;
+                }
+            }
+            break;
+
+        case OPT_VERBOSE:
+            error += SetLevel(sVerbose, optarg);
+            break;
+
+        case OPT_VERSION:
+            PrintVersion(inProgram);
+            break;
+
+        case OPT_ZONES:
+            error += SetLimit("zone", Common::ZonesControllerBasis::SetZonesMax, optarg);
+            break;
+
+        default:
+            if (!SetCommandOption(sClientArgument, c, optarg, sOptFlags))
+            {
+                Log::Error().Write("Unknown option '%d'!\n", optopt);
+                error++;
+            }
+            break;
+
+        }
     }
 
     // If we have accumulated any errors at this point, bail out since
@@ -1690,6 +2193,23 @@ DecodeOptions(const char *inProgram,
         goto exit;
     }
 
+    // A batch supplies its own identifier and operation options, one
+    // command per line, so those options may not also be given on the
+    // command line.
+
+    if (sOptFlags & kOptBatch) {
+        if (sOptFlags & (kOptHasObjectArg | kOptHasSubobjectArg | kOptHasOperationArg)) {
+            Log::Error().Write("The '--batch' option and identifier or operation options are mutually-exclusive. Please choose one or the other.\n");
+            error++;
+            goto exit;
+        }
+
+        if (ReadBatchOperations(inProgram, inOptions, sBatchPath, sBatchOperations) != kStatus_Success) {
+            error++;
+            goto exit;
+        }
+    }
+
     // Check that the timeout, if specified, makes sense.
 
     if (sOptFlags & kOptTimeout) {
@@ -1817,6 +2337,13 @@ FilterSyslog(Log::Logger &inLogger)
     return (typeid(theWriter) == typeid(Log::Writer::Syslog));
 }
 
+static bool IsIdentifier(const char *aString)
+{
+    const size_t lLength = strlen(aString);
+
+    return ((lLength > 0) && (strspn(aString, "0123456789") == lLength));
+}
+
 static Status ParseIdentifier(const char *aObjectDescription, const char *aString, IdentifierModel::IdentifierType &aIdentifier)
 {
     Status lRetval;
@@ -1879,45 +2406,77 @@ static Status ParseObjectOption(Client::Application::Controller &aController, Cl
     case OPT_EQUALIZER_PRESET:
         Log::Debug().Write("Attempting to convert equalizer preset \"%s\" into an identifier...\n", aClientArgument.mObjectOptionArgument.mArgument.mString);
 
-        lRetval = aController.EqualizerPresetLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mEqualizerPreset);
-        if (lRetval != kStatus_Success)
+        if (IsIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString))
         {
             lRetval = ParseEqualizerPresetIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mEqualizerPreset);
             nlEXPECT_SUCCESS(lRetval, done);
         }
+        else
+        {
+            lRetval = aController.EqualizerPresetLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mEqualizerPreset);
+            if (lRetval != kStatus_Success)
+            {
+                lRetval = ParseEqualizerPresetIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mEqualizerPreset);
+                nlEXPECT_SUCCESS(lRetval, done);
+            }
+        }
         break;
 
     case OPT_GROUP:
         Log::Debug().Write("Attempting to convert group \"%s\" into an identifier...\n", aClientArgument.mObjectOptionArgument.mArgument.mString);
 
-        lRetval = aController.GroupLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mGroup);
-        if (lRetval != kStatus_Success)
+        if (IsIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString))
         {
             lRetval = ParseGroupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mGroup);
             nlEXPECT_SUCCESS(lRetval, done);
         }
+        else
+        {
+            lRetval = aController.GroupLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mGroup);
+            if (lRetval != kStatus_Success)
+            {
+                lRetval = ParseGroupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mGroup);
+                nlEXPECT_SUCCESS(lRetval, done);
+            }
+        }
         break;
 
     case OPT_SOURCE:
         Log::Debug().Write("Attempting to convert source \"%s\" into an identifier...\n", aClientArgument.mObjectOptionArgument.mArgument.mString);
 
-        lRetval = aController.SourceLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mSource);
-        if (lRetval != kStatus_Success)
+        if (IsIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString))
         {
             lRetval = ParseSourceIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mSource);
             nlEXPECT_SUCCESS(lRetval, done);
         }
+        else
+        {
+            lRetval = aController.SourceLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mSource);
+            if (lRetval != kStatus_Success)
+            {
+                lRetval = ParseSourceIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mSource);
+                nlEXPECT_SUCCESS(lRetval, done);
+            }
+        }
         break;
 
     case OPT_ZONE:
         Log::Debug().Write("Attempting to convert zone \"%s\" into an identifier...\n", aClientArgument.mObjectOptionArgument.mArgument.mString);
 
-        lRetval = aController.ZoneLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mZone);
-        if (lRetval != kStatus_Success)
+        if (IsIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString))
         {
             lRetval = ParseZoneIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mZone);
             nlEXPECT_SUCCESS(lRetval, done);
         }
+        else
+        {
+            lRetval = aController.ZoneLookupIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mZone);
+            if (lRetval != kStatus_Success)
+            {
+                lRetval = ParseZoneIdentifier(aClientArgument.mObjectOptionArgument.mArgument.mString, aClientArgument.mObjectOptionArgument.mArgument.mUnion.mZone);
+                nlEXPECT_SUCCESS(lRetval, done);
+            }
+        }
         break;
 
     default:
@@ -2043,12 +2602,20 @@ static Status ParseOperationOption(Client::Application::Controller &aController,
         {
             Log::Debug().Write("Attempting to convert equalizer preset \"%s\" into an identifier...\n", aClientArgument.mOperationOptionArgument.mArgument.mString);
 
-            lRetval = aController.EqualizerPresetLookupIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mEqualizerPreset);
-            if (lRetval != kStatus_Success)
+            if (IsIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString))
             {
                 lRetval = ParseEqualizerPresetIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mEqualizerPreset);
                 nlEXPECT_SUCCESS(lRetval, done);
             }
+            else
+            {
+                lRetval = aController.EqualizerPresetLookupIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mEqualizerPreset);
+                if (lRetval != kStatus_Success)
+                {
+                    lRetval = ParseEqualizerPresetIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mEqualizerPreset);
+                    nlEXPECT_SUCCESS(lRetval, done);
+                }
+            }
             nlREQUIRE_SUCCESS(lRetval, done);
         }
         break;
@@ -2077,12 +2644,20 @@ static Status ParseOperationOption(Client::Application::Controller &aController,
         {
             Log::Debug().Write("Attempting to convert source \"%s\" into an identifier...\n", aClientArgument.mOperationOptionArgument.mArgument.mString);
 
-            lRetval = aController.SourceLookupIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mSource);
-            if (lRetval != kStatus_Success)
+            if (IsIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString))
             {
                 lRetval = ParseSourceIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mSource);
                 nlEXPECT_SUCCESS(lRetval, done);
             }
+            else
+            {
+                lRetval = aController.SourceLookupIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mSource);
+                if (lRetval != kStatus_Success)
+                {
+                    lRetval = ParseSourceIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mSource);
+                    nlEXPECT_SUCCESS(lRetval, done);
+                }
+            }
             nlREQUIRE_SUCCESS(lRetval, done);
         }
         break;
@@ -2107,12 +2682,20 @@ static Status ParseOperationOption(Client::Application::Controller &aController,
         {
             Log::Debug().Write("Attempting to convert zone \"%s\" into an identifier...\n", aClientArgument.mOperationOptionArgument.mArgument.mString);
 
-            lRetval = aController.ZoneLookupIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mZone);
-            if (lRetval != kStatus_Success)
+            if (IsIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString))
             {
                 lRetval = ParseZoneIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mZone);
                 nlEXPECT_SUCCESS(lRetval, done);
             }
+            else
+            {
+                lRetval = aController.ZoneLookupIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mZone);
+                if (lRetval != kStatus_Success)
+                {
+                    lRetval = ParseZoneIdentifier(aClientArgument.mOperationOptionArgument.mArgument.mString, aClientArgument.mOperationOptionArgument.mArgument.mUnion.mZone);
+                    nlEXPECT_SUCCESS(lRetval, done);
+                }
+            }
             nlREQUIRE_SUCCESS(lRetval, done);
         }
         break;
@@ -2140,6 +2723,113 @@ static Status ParseOperationOption(Client::Application::Controller &aController,
     return (lRetval);
 }
 
+static void SetRefreshScope(const char *aString, bool &aAll, IdentifierModel::IdentifierType &aIdentifier)
+{
+    using HLX::Model::Utilities::ParseIdentifier;
+
+    Status lStatus;
+
+    // A numeric identifier requires the state of only the object so
+    // identified. A name, on the other hand, can only be resolved
+    // against the state of all objects of the same class.
+
+    if (IsIdentifier(aString))
+    {
+        IdentifierModel::IdentifierType lIdentifier;
+
+        lStatus = ParseIdentifier(aString, lIdentifier);
+
+        // Where more than one object of the same class is identified,
+        // as in a batch, the state of all objects of that class is
+        // required.
+
+        if (lStatus == kStatus_Success)
+        {
+            if (aIdentifier == IdentifierModel::kIdentifierInvalid)
+            {
+                aIdentifier = lIdentifier;
+            }
+            else if (aIdentifier != lIdentifier)
+            {
+                aAll = true;
+            }
+        }
+    }
+    else
+    {
+        aAll = true;
+    }
+}
+
+static void SetRefreshScope(const ClientArgument &aClientArgument, const uint32_t &aOptFlags, Client::Application::Controller::RefreshScope &aRefreshScope)
+{
+    IdentifierModel::IdentifierType  lSourceIdentifier = IdentifierModel::kIdentifierInvalid;
+
+    if (aOptFlags & kOptHasObjectArg)
+    {
+        const char * const lString = aClientArgument.mObjectOptionArgument.mArgument.mString;
+
+        switch (aClientArgument.mObjectOptionArgument.mOption)
+        {
+
+        case OPT_EQUALIZER_PRESET:
+            SetRefreshScope(lString, aRefreshScope.mEqualizerPresets, aRefreshScope.mEqualizerPreset);
+            break;
+
+        case OPT_GROUP:
+            SetRefreshScope(lString, aRefreshScope.mGroups, aRefreshScope.mGroup);
+            break;
+
+        case OPT_SOURCE:
+            // Sources may only be refreshed as a whole, so a source
+            // identifier requires no refresh at all.
+
+            SetRefreshScope(lString, aRefreshScope.mSources, lSourceIdentifier);
+            break;
+
+        case OPT_ZONE:
+            SetRefreshScope(lString, aRefreshScope.mZones, aRefreshScope.mZone);
+            break;
+
+        default:
+            break;
+
+        }
+    }
+
+    // Operations that take an object argument require, at most, only
+    // the state needed to resolve that argument's name.
+
+    if (aOptFlags & kOptHasOperationArg)
+    {
+        const char * const lString = aClientArgument.mOperationOptionArgument.mArgument.mString;
+
+        switch (aClientArgument.mOperationOptionArgument.mOption)
+        {
+
+        case OPT_SET_EQUALIZER_PRESET:
+            if (!IsIdentifier(lString))
+                aRefreshScope.mEqualizerPresets = true;
+            break;
+
+        case OPT_SET_SOURCE:
+            if (!IsIdentifier(lString))
+                aRefreshScope.mSources = true;
+            break;
+
+        case OPT_ADD_ZONE:
+        case OPT_REMOVE_ZONE:
+            if (!IsIdentifier(lString))
+                aRefreshScope.mZones = true;
+            break;
+
+        default:
+            break;
+
+        }
+    }
+}
+
 static Status DispatchCommand(Client::Application::Controller &aController, ClientArgument &aClientArgument, const Timeout &aTimeout)
 {
     Status  lRetval = kStatus_Success;
@@ -2442,6 +3132,166 @@ static Status DispatchCommand(Client::Application::Controller &aController, Clie
     return (lRetval);
 }
 
+static Status DispatchBatch(Client::Application::Controller &aController, BatchOperations &aOperations, const Timeout &aTimeout)
+{
+    Client::Application::Controller::RefreshScope  lRefreshScope;
+    Status                                         lRetval = kStatus_Success;
+
+    // Dispatch every command in the batch back-to-back; the client
+    // command manager queues them and sends each as soon as the
+    // response to its predecessor arrives, without waiting on this
+    // program in between.
+
+    BOOST_FOREACH(BatchOperation &lOperation, aOperations)
+    {
+        lRetval = DispatchCommand(aController, lOperation.mClientArgument, lOperation.mOptFlags, aTimeout);
+
+        if (lRetval != kStatus_Success)
+        {
+            printf("%zu: %s: failed: %d (%s)\n", lOperation.mLine, lOperation.mText.c_str(), lRetval, strerror(-lRetval));
+            fflush(stdout);
+            goto done;
+        }
+    }
+
+    sBatchDidDispatch = true;
+
+    // Commands that are already satisfied by the present server state
+    // produce no completion event. So, queue a refresh of a single
+    // zone behind the batch; since responses arrive in order, its
+    // completion marks the completion of every command before it.
+
+    if (!aOperations.empty())
+    {
+        lRefreshScope.mZone = IdentifierModel::kIdentifierMin;
+
+        lRetval = aController.Refresh(lRefreshScope);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+static bool IsBatchOperationNotification(const BatchOperation &aOperation, const StateChange::NotificationBasis &aStateChangeNotification)
+{
+    const StateChange::Type           lType = aStateChangeNotification.GetType();
+    const Argument &                  lObjectArgument = aOperation.mClientArgument.mObjectOptionArgument.mArgument;
+    IdentifierModel::IdentifierType   lIdentifier;
+    IdentifierModel::IdentifierType   lObjectIdentifier;
+    bool                              lRetval = false;
+
+    nlEXPECT(aOperation.mClientArgument.mDidDispatch, done);
+    nlEXPECT(!aOperation.mDidComplete, done);
+    nlEXPECT(lType == aOperation.mClientArgument.mExpectedClientArgumentCompletionEvent, done);
+
+    switch (lType)
+    {
+
+    case StateChange::kStateChangeType_EqualizerPresetBand:
+    case StateChange::kStateChangeType_EqualizerPresetName:
+        lIdentifier = static_cast<const StateChange::EqualizerPresetsNotificationBasis &>(aStateChangeNotification).GetIdentifier();
+        break;
+
+    case StateChange::kStateChangeType_GroupMute:
+    case StateChange::kStateChangeType_GroupName:
+    case StateChange::kStateChangeType_GroupSource:
+    case StateChange::kStateChangeType_GroupVolume:
+    case StateChange::kStateChangeType_GroupZoneAdded:
+    case StateChange::kStateChangeType_GroupZoneRemoved:
+        lIdentifier = static_cast<const StateChange::GroupsNotificationBasis &>(aStateChangeNotification).GetIdentifier();
+        break;
+
+    case StateChange::kStateChangeType_SourceName:
+        lIdentifier = static_cast<const StateChange::SourcesNotificationBasis &>(aStateChangeNotification).GetIdentifier();
+        break;
+
+    case StateChange::kStateChangeType_ZoneBalance:
+    case StateChange::kStateChangeType_ZoneEqualizerBand:
+    case StateChange::kStateChangeType_ZoneEqualizerPreset:
+    case StateChange::kStateChangeType_ZoneHighpassCrossover:
+    case StateChange::kStateChangeType_ZoneLowpassCrossover:
+    case StateChange::kStateChangeType_ZoneMute:
+    case StateChange::kStateChangeType_ZoneName:
+    case StateChange::kStateChangeType_ZoneSoundMode:
+    case StateChange::kStateChangeType_ZoneSource:
+    case StateChange::kStateChangeType_ZoneTone:
+    case StateChange::kStateChangeType_ZoneVolume:
+    case StateChange::kStateChangeType_ZoneVolumeLocked:
+        lIdentifier = static_cast<const StateChange::ZonesNotificationBasis &>(aStateChangeNotification).GetIdentifier();
+        break;
+
+    default:
+        goto done;
+
+    }
+
+    switch (aOperation.mClientArgument.mObjectOptionArgument.mOption)
+    {
+
+    case OPT_EQUALIZER_PRESET:
+        lObjectIdentifier = lObjectArgument.mUnion.mEqualizerPreset;
+        break;
+
+    case OPT_GROUP:
+        lObjectIdentifier = lObjectArgument.mUnion.mGroup;
+        break;
+
+    case OPT_SOURCE:
+        lObjectIdentifier = lObjectArgument.mUnion.mSource;
+        break;
+
+    case OPT_ZONE:
+        lObjectIdentifier = lObjectArgument.mUnion.mZone;
+        break;
+
+    default:
+        goto done;
+
+    }
+
+    lRetval = (lIdentifier == lObjectIdentifier);
+
+ done:
+    return (lRetval);
+}
+
+static void MaybeCompleteBatchOperation(BatchOperations &aOperations, const StateChange::NotificationBasis &aStateChangeNotification)
+{
+    // Attribute the notification to the earliest outstanding command
+    // that expects it.
+
+    BOOST_FOREACH(BatchOperation &lOperation, aOperations)
+    {
+        if (IsBatchOperationNotification(lOperation, aStateChangeNotification))
+        {
+            lOperation.mDidComplete = true;
+
+            printf("%zu: %s: completed\n", lOperation.mLine, lOperation.mText.c_str());
+            fflush(stdout);
+            break;
+        }
+    }
+}
+
+static void CompleteBatch(BatchOperations &aOperations)
+{
+    // Any command still outstanding once the whole batch has been
+    // acknowledged was satisfied by the server state as it was.
+
+    BOOST_FOREACH(BatchOperation &lOperation, aOperations)
+    {
+        if (!lOperation.mDidComplete)
+        {
+            lOperation.mDidComplete = true;
+
+            printf("%zu: %s: completed without change\n", lOperation.mLine, lOperation.mText.c_str());
+        }
+    }
+
+    fflush(stdout);
+}
+
 int main(int argc, char * const argv[])
 {
     HLXClient    lHLXClient;
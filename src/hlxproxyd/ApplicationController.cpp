@@ -771,6 +771,30 @@ Controller :: ControllerError(Client::ObjectControllerBasis &aController, const
 
 // MARK: Client-facing Server Configuration Controller Delegate Methods
 
+Status
+Controller :: QueryChangedConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    ProxyObjectControllerContainer::Controllers::iterator  lCurrent, lEnd;
+    Status                 lRetval;
+
+
+    (void)aController;
+
+    lCurrent = ProxyObjectControllerContainer::GetControllers().begin();
+    lEnd     = ProxyObjectControllerContainer::GetControllers().end();
+
+    while (lCurrent != lEnd)
+    {
+        lRetval = lCurrent->second.mController->QueryChangedConfiguration(aConnection, aSequence, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lCurrent++;
+    }
+
+done:
+    return (lRetval);
+}
+
 Status
 Controller :: QueryCurrentConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
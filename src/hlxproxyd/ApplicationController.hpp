@@ -155,6 +155,7 @@ public:
 
     // Client-facing Server Configuration Controller Delegate Methods
 
+    Common::Status QueryChangedConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) final;
     Common::Status QueryCurrentConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) final;
 
 private:
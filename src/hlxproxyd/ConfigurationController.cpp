@@ -24,7 +24,9 @@
 
 #include "ConfigurationController.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include <errno.h>
 
@@ -32,6 +34,7 @@
 
 #include <OpenHLX/Utilities/Assert.hpp>
 #include <OpenHLX/Utilities/ElementsOf.hpp>
+#include <OpenHLX/Utilities/Parse.hpp>
 
 #include "ConfigurationControllerDelegate.hpp"
 
@@ -216,6 +219,11 @@ ConfigurationController :: DoRequestHandlers(const bool &aRegister)
             ConfigurationController::LoadFromBackupRequestReceivedHandler
         },
 
+        {
+            kQueryChangedRequest,
+            ConfigurationController::QueryChangedRequestReceivedHandler
+        },
+
         {
             kQueryCurrentRequest,
             ConfigurationController::QueryCurrentRequestReceivedHandler
@@ -229,6 +237,16 @@ ConfigurationController :: DoRequestHandlers(const bool &aRegister)
         {
             kSaveToBackupRequest,
             ConfigurationController::SaveToBackupRequestReceivedHandler
+        },
+
+        {
+            kSubscribeRequest,
+            ConfigurationController::SubscribeRequestReceivedHandler
+        },
+
+        {
+            kSubscribeAllRequest,
+            ConfigurationController::SubscribeAllRequestReceivedHandler
         }
     };
     static constexpr size_t  lRequestHandlerCount = ElementsOf(lRequestHandlers);
@@ -436,6 +454,83 @@ void ConfigurationController :: LoadFromBackupRequestReceivedHandler(Server::Con
     return;
 }
 
+void ConfigurationController :: QueryChangedRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches)
+{
+    Model::ChangeSequence::SequenceType                   lSequence;
+    Server::Command::Configuration::QueryChangedResponse  lResponse;
+    ConnectionBuffer::MutableCountedPointer               lResponseBuffer;
+    Status                                                lStatus;
+    const uint8_t *                                       lBuffer;
+    size_t                                                lSize;
+
+
+    (void)aSize;
+
+    nlREQUIRE_ACTION(aMatches.size() == Server::Command::Configuration::QueryChangedRequest::kExpectedMatches, done, lStatus = kError_BadCommand);
+
+    // Match 2/2: Change Sequence Number
+
+    lStatus = Utilities::Parse(aBuffer + aMatches.at(1).rm_so,
+                               Common::Utilities::Distance(aMatches.at(1)),
+                               lSequence);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    // A change sequence number later than the current one cannot
+    // have been issued by this proxy instance (for example, it was
+    // issued before a restart). Treat it as though the client had
+    // never synchronized such that all configuration is returned.
+
+    if (lSequence > Model::ChangeSequence::GetSequence())
+    {
+        lSequence = Model::ChangeSequence::kSequenceNone;
+    }
+
+    // First, allocate and initialize the response buffer.
+
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    // Next, invoke the delegate for fanout such that other
+    // participants can insert their changed settings or state to the
+    // representation.
+    //
+    // Unlike a query of the current configuration, a query of changed
+    // configuration cannot be proxied to the server, which does not
+    // support it. Consequently, if the proxy does not yet have the
+    // configuration cached, the request simply fails and the client
+    // should fall back to a query of the current configuration.
+
+    lStatus = OnQueryChangedConfiguration(aConnection, lSequence, lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    // Finally, conclude with the change sequence number as of the
+    // response. This must be sampled after the fanout since
+    // participants stamp any outstanding changes as they are queried.
+
+    lStatus = lResponse.Init(Model::ChangeSequence::GetSequence());
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lBuffer = lResponse.GetBuffer();
+    lSize = lResponse.GetSize();
+
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    if (lStatus >= kStatus_Success)
+    {
+        lStatus = SendResponse(aConnection, lResponseBuffer);
+        nlVERIFY_SUCCESS(lStatus);
+    }
+    else
+    {
+        lStatus = SendErrorResponse(aConnection);
+        nlVERIFY_SUCCESS(lStatus);
+    }
+
+    return;
+}
+
 void ConfigurationController :: QueryCurrentRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches)
 {
     Server::Command::Configuration::QueryCurrentResponse  lResponse;
@@ -452,10 +547,7 @@ void ConfigurationController :: QueryCurrentRequestReceivedHandler(Server::Conne
 
     // First, allocate and initialize the response buffer.
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Next, invoke the delegate for fanout such that other
@@ -471,7 +563,7 @@ void ConfigurationController :: QueryCurrentRequestReceivedHandler(Server::Conne
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -566,6 +658,135 @@ void ConfigurationController :: SaveToBackupRequestReceivedHandler(Server::Conne
     return;
 }
 
+void ConfigurationController :: SubscribeRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches)
+{
+    Server::Command::Configuration::SubscribeResponse  lResponse;
+    ConnectionBuffer::MutableCountedPointer            lResponseBuffer;
+    Server::SubscriptionFilter::ObjectType             lType;
+    std::vector<IdentifierModel::IdentifierType>       lIdentifiers;
+    const char *                                       lObject;
+    size_t                                             lObjectSize;
+    const char *                                       lCurrent;
+    const char *                                       lEnd;
+    Status                                             lStatus;
+    const uint8_t *                                    lBuffer;
+    size_t                                             lSize;
+
+
+    (void)aSize;
+
+    nlREQUIRE_ACTION(aMatches.size() == Server::Command::Configuration::SubscribeRequest::kExpectedMatches, done, lStatus = kError_BadCommand);
+
+    // Match 2/4: Object Designator
+
+    lObject     = reinterpret_cast<const char *>(aBuffer + aMatches.at(1).rm_so);
+    lObjectSize = Common::Utilities::Distance(aMatches.at(1));
+
+    lStatus = Server::SubscriptionFilter::GetObjectType(lObject, lObjectSize, lType);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    // Match 3/4: Object Identifiers
+    //
+    // Parse and validate all of the identifiers before subscribing to
+    // any of them such that a malformed request leaves the existing
+    // subscriptions unchanged.
+
+    lCurrent = reinterpret_cast<const char *>(aBuffer + aMatches.at(2).rm_so);
+    lEnd     = reinterpret_cast<const char *>(aBuffer + aMatches.at(2).rm_eo);
+
+    while (lCurrent < lEnd)
+    {
+        const char *                    lSeparator = std::find(lCurrent, lEnd, ',');
+        IdentifierModel::IdentifierType lIdentifier;
+
+        lStatus = Utilities::Parse(lCurrent, static_cast<size_t>(lSeparator - lCurrent), lIdentifier);
+        nlREQUIRE_SUCCESS(lStatus, done);
+
+        nlREQUIRE_ACTION(lIdentifier >= IdentifierModel::kIdentifierMin, done, lStatus = -ERANGE);
+
+        lIdentifiers.push_back(lIdentifier);
+
+        lCurrent = (lSeparator == lEnd) ? lEnd : lSeparator + 1;
+    }
+
+    for (const auto &lIdentifier : lIdentifiers)
+    {
+        lStatus = aConnection.GetSubscriptionFilter().Subscribe(lType, lIdentifier);
+        nlREQUIRE(lStatus >= kStatus_Success, done);
+    }
+
+    // Echo the subscription back to the requesting client.
+
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lStatus = lResponse.Init(lObject,
+                             lObjectSize,
+                             reinterpret_cast<const char *>(aBuffer + aMatches.at(2).rm_so),
+                             Common::Utilities::Distance(aMatches.at(2)));
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lBuffer = lResponse.GetBuffer();
+    lSize = lResponse.GetSize();
+
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lStatus = SendResponse(aConnection, lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    if (lStatus < kStatus_Success)
+    {
+        lStatus = SendErrorResponse(aConnection);
+        nlVERIFY_SUCCESS(lStatus);
+    }
+
+    return;
+}
+
+void ConfigurationController :: SubscribeAllRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches)
+{
+    Server::Command::Configuration::SubscribeAllResponse  lResponse;
+    ConnectionBuffer::MutableCountedPointer               lResponseBuffer;
+    Status                                                lStatus;
+    const uint8_t *                                       lBuffer;
+    size_t                                                lSize;
+
+
+    (void)aBuffer;
+    (void)aSize;
+
+    nlREQUIRE_ACTION(aMatches.size() == Server::Command::Configuration::SubscribeAllRequest::kExpectedMatches, done, lStatus = kError_BadCommand);
+
+    lStatus = aConnection.GetSubscriptionFilter().SubscribeAll();
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lStatus = lResponse.Init();
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lBuffer = lResponse.GetBuffer();
+    lSize = lResponse.GetSize();
+
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lStatus = SendResponse(aConnection, lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    if (lStatus < kStatus_Success)
+    {
+        lStatus = SendErrorResponse(aConnection);
+        nlVERIFY_SUCCESS(lStatus);
+    }
+
+    return;
+}
+
 // MARK: Client-facing Server Command Request Handler Trampolines
 
 void ConfigurationController :: LoadFromBackupRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches, void *aContext)
@@ -578,6 +799,16 @@ void ConfigurationController :: LoadFromBackupRequestReceivedHandler(Server::Con
     }
 }
 
+void ConfigurationController :: QueryChangedRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches, void *aContext)
+{
+    ConfigurationController *lController = static_cast<ConfigurationController *>(aContext);
+
+    if (lController != nullptr)
+    {
+        lController->QueryChangedRequestReceivedHandler(aConnection, aBuffer, aSize, aMatches);
+    }
+}
+
 void ConfigurationController :: QueryCurrentRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches, void *aContext)
 {
     ConfigurationController *lController = static_cast<ConfigurationController *>(aContext);
@@ -608,8 +839,43 @@ void ConfigurationController :: SaveToBackupRequestReceivedHandler(Server::Conne
     }
 }
 
+void ConfigurationController :: SubscribeRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches, void *aContext)
+{
+    ConfigurationController *lController = static_cast<ConfigurationController *>(aContext);
+
+    if (lController != nullptr)
+    {
+        lController->SubscribeRequestReceivedHandler(aConnection, aBuffer, aSize, aMatches);
+    }
+}
+
+void ConfigurationController :: SubscribeAllRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches, void *aContext)
+{
+    ConfigurationController *lController = static_cast<ConfigurationController *>(aContext);
+
+    if (lController != nullptr)
+    {
+        lController->SubscribeAllRequestReceivedHandler(aConnection, aBuffer, aSize, aMatches);
+    }
+}
+
 // MARK: Client-facing Server Configuration Delegation Fanout Methods
 
+Status
+ConfigurationController :: OnQueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    Status lRetval = kStatus_Success;
+
+    if (mDelegate != nullptr)
+    {
+        lRetval = mDelegate->QueryChangedConfiguration(*this, aConnection, aSequence, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+done:
+    return (lRetval);
+}
+
 Status
 ConfigurationController :: OnQueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
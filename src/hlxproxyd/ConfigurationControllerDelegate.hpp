@@ -28,6 +28,8 @@
 
 #include <CoreFoundation/CFDictionary.h>
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
+
 
 namespace HLX
 {
@@ -53,6 +55,8 @@ class ConfigurationController;
  *  notifications regarding the management of HLX server
  *  configuration, including:
  *
+ *    - Querying the configuration changed since a change sequence
+ *      number.
  *    - Querying the current configuration.
  *
  *  @ingroup proxy
@@ -64,6 +68,7 @@ public:
     ConfigurationControllerDelegate(void) = default;
     virtual ~ConfigurationControllerDelegate(void) = default;
 
+    virtual Common::Status QueryChangedConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) = 0;
     virtual Common::Status QueryCurrentConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) = 0;
 };
 
@@ -57,9 +57,9 @@ namespace Proxy
 EqualizerPresetsController :: EqualizerPresetsController(void) :
     Common::EqualizerPresetsControllerBasis(),
     Client::EqualizerPresetsControllerBasis(Common::EqualizerPresetsControllerBasis::mEqualizerPresets,
-                                            Common::EqualizerPresetsControllerBasis::kEqualizerPresetsMax),
+                                            Common::EqualizerPresetsControllerBasis::sEqualizerPresetsMax),
     Server::EqualizerPresetsControllerBasis(Common::EqualizerPresetsControllerBasis::mEqualizerPresets,
-                                            Common::EqualizerPresetsControllerBasis::kEqualizerPresetsMax),
+                                            Common::EqualizerPresetsControllerBasis::sEqualizerPresetsMax),
     Proxy::ObjectControllerBasis()
 {
     return;
@@ -231,6 +231,21 @@ done:
 
 // MARK: Configuration Management Methods
 
+Status
+EqualizerPresetsController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    Status  lRetval = kStatus_Success;
+
+
+    (void)aConnection;
+
+    lRetval = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 Status
 EqualizerPresetsController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
@@ -471,10 +486,7 @@ void EqualizerPresetsController :: QueryRequestReceivedHandler(Server::Connectio
                                                 lEqualizerPresetIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -490,7 +502,7 @@ void EqualizerPresetsController :: QueryRequestReceivedHandler(Server::Connectio
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -661,10 +673,7 @@ EqualizerPresetsController :: HandleAdjustBandReceived(Server::ConnectionBasis &
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     lRetval = HandleAdjustBandReceived(aEqualizerPresetIdentifier, aEqualizerBandIdentifier, aBandAdjustment, lResponseBuffer);
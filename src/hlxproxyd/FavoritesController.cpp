@@ -58,9 +58,9 @@ namespace Proxy
 FavoritesController :: FavoritesController(void) :
     Common::FavoritesControllerBasis(),
     Client::FavoritesControllerBasis(Common::FavoritesControllerBasis::mFavorites,
-                                     Common::FavoritesControllerBasis::kFavoritesMax),
+                                     Common::FavoritesControllerBasis::sFavoritesMax),
     Server::FavoritesControllerBasis(Common::FavoritesControllerBasis::mFavorites,
-                                     Common::FavoritesControllerBasis::kFavoritesMax),
+                                     Common::FavoritesControllerBasis::sFavoritesMax),
     Proxy::ObjectControllerBasis()
 {
     return;
@@ -212,6 +212,21 @@ done:
 
 // MARK: Configuration Management Methods
 
+Status
+FavoritesController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    Status  lRetval = kStatus_Success;
+
+
+    (void)aConnection;
+
+    lRetval = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 Status
 FavoritesController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
@@ -327,10 +342,7 @@ void FavoritesController :: QueryRequestReceivedHandler(Server::ConnectionBasis
                                                 lFavoriteIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -346,7 +358,7 @@ void FavoritesController :: QueryRequestReceivedHandler(Server::ConnectionBasis
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
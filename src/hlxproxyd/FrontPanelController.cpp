@@ -393,10 +393,7 @@ void FrontPanelController :: QueryRequestReceivedHandler(Server::ConnectionBasis
 
     nlREQUIRE_ACTION(aMatches.size() == Server::Command::FrontPanel::QueryRequest::kExpectedMatches, done, lStatus = kError_BadCommand);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = GetModel().GetLocked(lLocked);
@@ -557,7 +554,7 @@ FrontPanelController :: HandleBrightnessResponse(const FrontPanelModel::Brightne
     lBuffer = lBrightnessResponse.GetBuffer();
     lSize = lBrightnessResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -579,7 +576,7 @@ FrontPanelController :: HandleLockedResponse(const FrontPanelModel::LockedType &
     lBuffer = lLockedResponse.GetBuffer();
     lSize = lLockedResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
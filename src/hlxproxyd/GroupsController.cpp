@@ -62,9 +62,9 @@ namespace Proxy
 GroupsController :: GroupsController(void) :
     Common::GroupsControllerBasis(),
     Client::GroupsControllerBasis(Common::GroupsControllerBasis::mGroups,
-                                  Common::GroupsControllerBasis::kGroupsMax),
+                                  Common::GroupsControllerBasis::sGroupsMax),
     Server::GroupsControllerBasis(Common::GroupsControllerBasis::mGroups,
-                                  Common::GroupsControllerBasis::kGroupsMax),
+                                  Common::GroupsControllerBasis::sGroupsMax),
     Proxy::ObjectControllerBasis()
 {
     return;
@@ -281,6 +281,21 @@ done:
 
 // MARK: Configuration Management Methods
 
+Status
+GroupsController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    Status  lRetval = kStatus_Success;
+
+
+    (void)aConnection;
+
+    lRetval = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 Status
 GroupsController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
@@ -843,10 +858,7 @@ void GroupsController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aC
     lStatus = lResponse.Init(lGroupIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -859,7 +871,7 @@ void GroupsController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aC
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
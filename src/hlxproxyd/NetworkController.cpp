@@ -708,10 +708,7 @@ void NetworkController :: QueryRequestReceivedHandler(Server::ConnectionBasis &a
 
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion, including both
@@ -728,7 +725,7 @@ void NetworkController :: QueryRequestReceivedHandler(Server::ConnectionBasis &a
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -98,6 +98,37 @@ ObjectControllerBasis :: Init(Client::CommandManager &aClientCommandManager, Ser
 
 // MARK: Configuration Management Methods
 
+/**
+ *  @brief
+ *    Query the configuration changed since the specified change
+ *    sequence number.
+ *
+ *  By default, this queries the current configuration in full, which
+ *  is appropriate for controllers without identified objects whose
+ *  changes are tracked.
+ *
+ *  @param[in]      aConnection  A mutable reference to the connection
+ *                               on which the query was received.
+ *  @param[in]      aSequence    An immutable reference to the change
+ *                               sequence number after which changed
+ *                               configuration is to be queried.
+ *  @param[in,out]  aBuffer      A mutable reference to the shared
+ *                               pointer into which the response is to
+ *                               be generated.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the configuration has not yet
+ *                                  been retrieved from the server.
+ *
+ */
+Status
+ObjectControllerBasis :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    (void)aSequence;
+
+    return (QueryCurrentConfiguration(aConnection, aBuffer));
+}
+
 Status
 ObjectControllerBasis :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
@@ -227,7 +258,6 @@ ObjectControllerBasis :: ProxyNotification(const uint8_t *aNotificationBuffer,
                                      void *aClientContext)
 {
     ConnectionBuffer::MutableCountedPointer  lResponseBuffer;
-    uint8_t *                                lResult;
     Status                                   lRetval;
 
 
@@ -236,17 +266,23 @@ ObjectControllerBasis :: ProxyNotification(const uint8_t *aNotificationBuffer,
                                    aNotificationMatches,
                                    aClientContext);
 
-    // Allocate a buffer and put the notification contents into it and
+    // Allocate a buffer, copy the notification contents into it, and
     // send it to all subscribed clients.
-
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init(const_cast<uint8_t *>(aNotificationBuffer), aNotificationSize);
+    //
+    // The notification contents belong to the upstream connection
+    // receive buffer, which is consumed and reused once this returns,
+    // whereas the response may be sent later (for example, by a
+    // connection worker or the socket ring). Consequently, the
+    // response must own a copy of the contents rather than refer to
+    // them.
+
+    lRetval = ConnectionBuffer::Create(lResponseBuffer, aNotificationSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    lResult = lResponseBuffer->Put(aNotificationSize);
-    nlREQUIRE_ACTION(lResult != nullptr, done, lRetval = -ENOSPC);
+    lRetval = Common::Utilities::Put(*lResponseBuffer.get(),
+                                     aNotificationBuffer,
+                                     aNotificationSize);
+    nlREQUIRE_SUCCESS(lRetval, done);
 
     lRetval = mServerCommandManager->SendResponse(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
@@ -309,7 +345,6 @@ ObjectControllerBasis :: ProxyMutationCompleteHandler(Client::Command::ExchangeB
     const uint8_t *                         lServerResponseBuffer     = lServerResponse->GetBuffer()->GetHead();
     const size_t                            lServerResponseBufferSize = lServerResponse->GetBuffer()->GetSize();
     ConnectionBuffer::MutableCountedPointer lProxyResponseBuffer;
-    uint8_t *                               lResult;
     Status                                  lStatus;
 
     (void)aRequestBuffer;
@@ -320,15 +355,17 @@ ObjectControllerBasis :: ProxyMutationCompleteHandler(Client::Command::ExchangeB
                               aClientMatches,
                               aContext);
 
-    lProxyResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lProxyResponseBuffer, done, lStatus = -ENOMEM);
+    // As with notifications, the server response belongs to the
+    // exchange, which may be released before the proxied response is
+    // sent, so the proxied response owns a copy of it.
 
-    lStatus = lProxyResponseBuffer->Init(const_cast<uint8_t *>(lServerResponseBuffer),
-                                         lServerResponseBufferSize);
+    lStatus = ConnectionBuffer::Create(lProxyResponseBuffer, lServerResponseBufferSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResult = lProxyResponseBuffer->Put(lServerResponseBufferSize);
-    nlREQUIRE_ACTION(lResult != nullptr, done, lStatus = -ENOSPC);
+    lStatus = Common::Utilities::Put(*lProxyResponseBuffer.get(),
+                                     lServerResponseBuffer,
+                                     lServerResponseBufferSize);
+    nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
     lStatus = mServerCommandManager->SendResponse(aClientConnection, lProxyResponseBuffer);
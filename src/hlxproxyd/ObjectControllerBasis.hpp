@@ -28,6 +28,7 @@
 #include <OpenHLX/Client/CommandManager.hpp>
 #include <OpenHLX/Common/Errors.hpp>
 #include <OpenHLX/Common/Timeout.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Server/CommandManager.hpp>
 
 
@@ -55,6 +56,7 @@ public:
 
     // Configuration Management Methods
 
+    virtual Common::Status QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer);
     virtual Common::Status QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer);
 
     // Command Proxying
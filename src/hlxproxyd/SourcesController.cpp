@@ -58,9 +58,9 @@ namespace Proxy
 SourcesController :: SourcesController(void) :
     Common::SourcesControllerBasis(),
     Client::SourcesControllerBasis(Common::SourcesControllerBasis::mSources,
-                                   Common::SourcesControllerBasis::kSourcesMax),
+                                   Common::SourcesControllerBasis::sSourcesMax),
     Server::SourcesControllerBasis(Common::SourcesControllerBasis::mSources,
-                                   Common::SourcesControllerBasis::kSourcesMax),
+                                   Common::SourcesControllerBasis::sSourcesMax),
     Proxy::ObjectControllerBasis()
 {
     return;
@@ -205,6 +205,21 @@ done:
 
 // MARK: Configuration Management Methods
 
+Status
+SourcesController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    Status  lRetval = kStatus_Success;
+
+
+    (void)aConnection;
+
+    lRetval = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 Status
 SourcesController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
@@ -74,6 +74,7 @@ public:
 
     // Configuration Management Methods
 
+    Common::Status QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) final;
     Common::Status QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) final;
 
     // Server-facing Client Notification Handler Trampolines
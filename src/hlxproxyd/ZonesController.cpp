@@ -59,9 +59,9 @@ namespace Proxy
 ZonesController :: ZonesController(void) :
     Common::ZonesControllerBasis(),
     Client::ZonesControllerBasis(Common::ZonesControllerBasis::mZones,
-                                 Common::ZonesControllerBasis::kZonesMax),
+                                 Common::ZonesControllerBasis::sZonesMax),
     Server::ZonesControllerBasis(Common::ZonesControllerBasis::mZones,
-                                 Common::ZonesControllerBasis::kZonesMax),
+                                 Common::ZonesControllerBasis::sZonesMax),
     Proxy::ObjectControllerBasis()
 {
     return;
@@ -408,6 +408,21 @@ done:
 
 // MARK: Configuration Management Methods
 
+Status
+ZonesController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    Status  lRetval = kStatus_Success;
+
+
+    (void)aConnection;
+
+    lRetval = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 Status
 ZonesController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
@@ -1714,10 +1729,7 @@ void ZonesController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aCo
     lStatus = lResponse.Init(lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion, indicating that
@@ -1732,7 +1744,7 @@ void ZonesController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aCo
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -1787,10 +1799,7 @@ void ZonesController :: QueryMuteRequestReceivedHandler(Server::ConnectionBasis
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -1850,10 +1859,7 @@ void ZonesController :: QuerySourceRequestReceivedHandler(Server::ConnectionBasi
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -1913,10 +1919,7 @@ void ZonesController :: QueryVolumeRequestReceivedHandler(Server::ConnectionBasi
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -2492,7 +2495,7 @@ ZonesController :: HandleAdjustBalanceReceived(const Model::ZoneModel::Identifie
     lBuffer = lBalanceResponse.GetBuffer();
     lSize = lBalanceResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -2526,7 +2529,7 @@ ZonesController :: HandleSetBalanceReceived(const Model::ZoneModel::IdentifierTy
     lBuffer = lBalanceResponse.GetBuffer();
     lSize = lBalanceResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -2542,10 +2545,7 @@ ZonesController :: HandleAdjustBassReceived(Server::ConnectionBasis &aConnection
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // First, ensure that the sound mode is set to tone mode
@@ -2628,10 +2628,7 @@ ZonesController :: HandleAdjustTrebleReceived(Server::ConnectionBasis &aConnecti
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // First, ensure that the sound mode is set to tone mode
@@ -2844,10 +2841,7 @@ ZonesController :: HandleAdjustEqualizerBandReceived(Server::ConnectionBasis &aC
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // First, ensure that the sound mode is set to zone equalizer mode
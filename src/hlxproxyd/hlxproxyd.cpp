@@ -33,6 +33,13 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <boost/foreach.hpp>
 #include <boost/filesystem.hpp>
 
@@ -45,9 +52,18 @@
 #include <NuovationsUtilities/GenerateShortOptions.hpp>
 
 #include <OpenHLX/Common/ConnectionManagerBasis.hpp>
+#include <OpenHLX/Common/EqualizerPresetsControllerBasis.hpp>
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoop.hpp>
+#include <OpenHLX/Common/FavoritesControllerBasis.hpp>
+#include <OpenHLX/Common/GroupsControllerBasis.hpp>
 #include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Common/SocketRing.hpp>
+#include <OpenHLX/Common/SourcesControllerBasis.hpp>
 #include <OpenHLX/Common/Version.hpp>
+#include <OpenHLX/Common/ZonesControllerBasis.hpp>
+#include <OpenHLX/Model/IdentifierModel.hpp>
+#include <OpenHLX/Server/ConnectionManager.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 #include <OpenHLX/Utilities/Parse.hpp>
 #include <OpenHLX/Utilities/ElementsOf.hpp>
@@ -72,17 +88,29 @@ using namespace std;
 
 #define OPT_CONNECT                  'c'
 #define OPT_DEBUG                    'd'
+#define OPT_EQUALIZER_PRESETS        (OPT_BASE + 10)
+#define OPT_EVENT_LOOP               (OPT_BASE + 4)
+#define OPT_FAVORITES                (OPT_BASE + 11)
+#define OPT_GROUPS                   (OPT_BASE + 12)
+#define OPT_IO_URING                 (OPT_BASE + 5)
 #define OPT_HELP                     'h'
+#define OPT_IDLE_TIMEOUT             (OPT_BASE + 7)
 #define OPT_INITIAL_REFRESH          (OPT_BASE + 1)
+#define OPT_IO_WORKERS               (OPT_BASE + 3)
 #define OPT_IPV4_ONLY                '4'
 #define OPT_IPV6_ONLY                '6'
 #define OPT_LISTEN                   'l'
+#define OPT_MAX_CONNECTIONS          (OPT_BASE + 6)
 #define OPT_NO_INITIAL_REFRESH       (OPT_BASE + 2)
+#define OPT_PROCESSES                (OPT_BASE + 9)
 #define OPT_QUIET                    'q'
+#define OPT_REQUEST_RATE             (OPT_BASE + 8)
+#define OPT_SOURCES                  (OPT_BASE + 13)
 #define OPT_SYSLOG                   's'
 #define OPT_TIMEOUT                  't'
 #define OPT_VERBOSE                  'v'
 #define OPT_VERSION                  'V'
+#define OPT_ZONES                    (OPT_BASE + 14)
 
 // Type Declarations
 
@@ -96,13 +124,25 @@ enum OptFlags {
 
     kOptTimeout          = 0x00000080,
 
-    kOptNoInitialRefresh = 0x00000100
+    kOptNoInitialRefresh = 0x00000100,
+    kOptEventLoop        = 0x00000200,
+    kOptIOURing          = 0x00000400
 };
 
 class HLXProxy;
 
+typedef std::vector<const char *>                HostURLs;
+typedef std::vector<std::unique_ptr<HLXProxy>>   HLXProxies;
+typedef std::vector<std::string>                 ProcessURLs;
+typedef std::vector<pid_t>                       ProcessIdentifiers;
+
+typedef Status (*LimitSetter)(const Model::IdentifierModel::IdentifierType &aLimit);
+
 // Function Prototypes
 
+static void ScheduleReapProxies(CFRunLoopRef aRunLoopRef);
+static void ProcessesDidListen(void);
+
 // Global Variables
 
 static uint32_t             sOptFlags            = 0;
@@ -114,24 +154,46 @@ static const char *         sProgram             = nullptr;
 
 static Timeout              sTimeout;
 
-static const char *         sConnectMaybeURL     = nullptr;
-static const char *         sListenMaybeURL      = nullptr;
+static HostURLs             sConnectMaybeURLs;
+static HostURLs             sListenMaybeURLs;
+
+static HLXProxies           sHLXProxies;
+static CFRunLoopTimerRef    sReapTimerRef        = nullptr;
+static bool                 sProxiesFailed       = false;
 
-static HLXProxy *           sHLXProxy            = nullptr;
+static const size_t         kProcessesMax        = 64;
+static size_t               sProcesses           = 0;
+static ProcessIdentifiers   sProcessIdentifiers;
+static std::string          sProcessDirectory;
+static ProcessURLs          sProcessURLs;
+static int                  sProcessReadyDescriptor = -1;
+static size_t               sProcessesListening  = 0;
 
 static const struct option  sOptions[] = {
     { "connect",                 required_argument,  nullptr,   OPT_CONNECT                 },
     { "debug",                   optional_argument,  nullptr,   OPT_DEBUG                   },
+    { "equalizer-presets",       required_argument,  nullptr,   OPT_EQUALIZER_PRESETS       },
+    { "event-loop",              no_argument,        nullptr,   OPT_EVENT_LOOP              },
+    { "favorites",               required_argument,  nullptr,   OPT_FAVORITES               },
+    { "groups",                  required_argument,  nullptr,   OPT_GROUPS                  },
     { "help",                    no_argument,        nullptr,   OPT_HELP                    },
+    { "idle-timeout",            required_argument,  nullptr,   OPT_IDLE_TIMEOUT            },
     { "initial-refresh",         no_argument,        nullptr,   OPT_INITIAL_REFRESH         },
+    { "io-uring",                no_argument,        nullptr,   OPT_IO_URING                },
+    { "io-workers",              required_argument,  nullptr,   OPT_IO_WORKERS              },
     { "ipv4-only",               no_argument,        nullptr,   OPT_IPV4_ONLY               },
     { "ipv6-only",               no_argument,        nullptr,   OPT_IPV6_ONLY               },
     { "listen",                  required_argument,  nullptr,   OPT_LISTEN                  },
+    { "max-connections",         required_argument,  nullptr,   OPT_MAX_CONNECTIONS         },
     { "no-initial-refresh",      no_argument,        nullptr,   OPT_NO_INITIAL_REFRESH      },
+    { "processes",               required_argument,  nullptr,   OPT_PROCESSES               },
     { "quiet",                   no_argument,        nullptr,   OPT_QUIET                   },
+    { "request-rate",            required_argument,  nullptr,   OPT_REQUEST_RATE            },
+    { "sources",                 required_argument,  nullptr,   OPT_SOURCES                 },
     { "timeout",                 required_argument,  nullptr,   OPT_TIMEOUT                 },
     { "verbose",                 optional_argument,  nullptr,   OPT_VERBOSE                 },
     { "version",                 no_argument,        nullptr,   OPT_VERSION                 },
+    { "zones",                   required_argument,  nullptr,   OPT_ZONES                   },
 
     { nullptr,                   0,                  nullptr,   0                           }
 };
@@ -167,10 +229,30 @@ static const char * const   sLongUsageString =
 "                              colon-delimited TCP port number, IPv4 or IPv6\n"
 "                              address, or IPv4 or IPv6 address plus colon-delimited\n"
 "                              TCP port number.\n"
+"\n"
+"                              This option may be specified more than once to\n"
+"                              proxy multiple HLX servers, in which case each\n"
+"                              must be paired, in order, with a --listen option.\n"
+"  --event-loop                Dispatch timers, listeners, and raw TCP and\n"
+"                              local client connections on the main thread\n"
+"                              with a native epoll event loop, where\n"
+"                              supported, rather than with the run loop.\n"
+"  --idle-timeout=MILLISECONDS Disconnect client connections that send\n"
+"                              nothing for MILLISECONDS milliseconds\n"
+"                              (default: 0, never).\n"
 "  --[no-]initial-refresh      Do [not] perform an initial proxy cache pre-\n"
 "                              warming by requesting all relevant and supported\n"
 "                              HLX state before listening and allowing clients\n"
 "                              to connect. Pre-warming is the default.\n"
+"  --io-uring                  Implies --event-loop and, where supported,\n"
+"                              additionally accepts, receives, and sends for\n"
+"                              raw TCP and local client connections with\n"
+"                              batched io_uring submissions, falling back to\n"
+"                              the event loop alone where not.\n"
+"  --io-workers=COUNT          Shard client connection input and output\n"
+"                              across COUNT worker threads, from 0 to 64, for\n"
+"                              each HLX server proxied (default: 0, on the\n"
+"                              main thread).\n"
 "  -l, --listen=HOST           Optionally specify that hlxproxyd should listen for\n"
 "                              incoming HLX client connections at host HOST.\n"
 "\n"
@@ -182,8 +264,36 @@ static const char * const   sLongUsageString =
 "                              If not specified, hlxproxyd will listen on the default\n"
 "                              TCP port (23) for the IPv4 and IPv6 wildcard or\n"
 "                              \"any\" addresses.\n"
+"\n"
+"                              When more than one --connect option is\n"
+"                              specified, the Nth --listen option specifies\n"
+"                              where clients of the Nth HLX server connect.\n"
+"  --max-connections=COUNT     Refuse client connections beyond COUNT\n"
+"                              concurrent connections for each HLX server\n"
+"                              proxied (default: 0, unlimited).\n"
+"  --processes=COUNT           Serve clients from COUNT worker processes,\n"
+"                              from 0 to 64, sharing the listen addresses,\n"
+"                              each relaying to a primary process that\n"
+"                              alone connects to the HLX server (default:\n"
+"                              0, clients are served by a single process).\n"
+"  --request-rate=RATE[:BURST] Limit each client connection to RATE requests\n"
+"                              per second, with bursts of up to BURST\n"
+"                              requests, dropping those in excess (default:\n"
+"                              0, unlimited; BURST defaults to RATE).\n"
 "  -t, --timeout=MILLISECONDS  Set a connection timeout of MILLISECONDS \n"
 "                              milliseconds.\n"
+"\n"
+" Scale Options:\n"
+"\n"
+"  --equalizer-presets=COUNT   Proxy COUNT equalizer presets (default: 10).\n"
+"  --favorites=COUNT           Proxy COUNT favorites (default: 10).\n"
+"  --groups=COUNT              Proxy COUNT groups (default: 10).\n"
+"  --sources=COUNT             Proxy COUNT sources (default: 8).\n"
+"  --zones=COUNT               Proxy COUNT zones (default: 24).\n"
+"\n"
+"                              COUNT may range from 1 to 254 and should match\n"
+"                              that of every HLX server proxied, for example,\n"
+"                              a simulator run with the same options.\n"
 "\n";
 
 class HLXProxy :
@@ -202,6 +312,7 @@ public:
     Status Listen(void);
     Status Stop(void);
     Status Stop(const Status &aStatus);
+    bool IsStopped(void) const;
 
     const Proxy::Application::Controller &GetController(void) const;
     Proxy::Application::Controller &GetController(void);
@@ -209,6 +320,8 @@ public:
     Status GetStatus(void) const;
     void SetStatus(const Status &aStatus);
 
+    const char *GetConnectMaybeURL(void) const;
+
     void SetVersions(const bool &aUseIPv6,
                      const bool &aUseIPv4);
     const ConnectionManagerBasis::Versions &GetVersions(void) const;
@@ -271,8 +384,11 @@ private:
 
 private:
     RunLoopParameters                mRunLoopParameters;
+    EventLoop                        mEventLoop;
+    SocketRing                       mSocketRing;
     Proxy::Application::Controller   mHLXProxyController;
     Status                           mStatus;
+    bool                             mStopped;
     const char *                     mConnectMaybeURL;
     const char *                     mListenMaybeURL;
     ConnectionManagerBasis::Versions mVersions;
@@ -309,8 +425,11 @@ GetString(const Proxy::Application::ControllerDelegate::Roles &aRoles)
 HLXProxy :: HLXProxy(void) :
     ControllerDelegate(),
     mRunLoopParameters(),
+    mEventLoop(),
+    mSocketRing(),
     mHLXProxyController(),
     mStatus(kStatus_Success),
+    mStopped(false),
     mConnectMaybeURL(nullptr),
     mListenMaybeURL(nullptr),
     mVersions(0)
@@ -333,6 +452,36 @@ Status HLXProxy :: Init(const char *aConnectMaybeURL,
     lRetval = mRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    if (sOptFlags & kOptEventLoop)
+    {
+        lRetval = mEventLoop.Init(mRunLoopParameters);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = mRunLoopParameters.SetEventLoop(&mEventLoop);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    // The socket ring is an optimization; if it is unavailable, for
+    // example, because the running kernel does not support it or
+    // does not permit it, fall back to the event loop alone.
+
+    if (sOptFlags & kOptIOURing)
+    {
+        lRetval = mSocketRing.Init(mRunLoopParameters);
+
+        if (lRetval == kStatus_Success)
+        {
+            lRetval = mRunLoopParameters.SetSocketRing(&mSocketRing);
+            nlREQUIRE_SUCCESS(lRetval, done);
+        }
+        else
+        {
+            Log::Error().Write("Could not initialize io_uring (%s); falling back to the event loop.\n", strerror(-lRetval));
+
+            lRetval = kStatus_Success;
+        }
+    }
+
     lRetval = mHLXProxyController.Init(mRunLoopParameters);
     nlREQUIRE_SUCCESS(lRetval, done);
 
@@ -412,13 +561,32 @@ Status HLXProxy :: Stop(const Status &aStatus)
 {
     Status lStatus = kStatus_Success;
 
+    // Only the first stop, and its status, counts; any subsequent
+    // stop is a consequence of it.
+
+    nlEXPECT(!mStopped, done);
+
     SetStatus(aStatus);
 
-    CFRunLoopStop(mRunLoopParameters.GetRunLoop());
+    mStopped = true;
+
+    Log::Info().Write("Stopping proxy for %s.\n", GetConnectMaybeURL());
 
+    // All proxies share the run loop. Rather than stopping it, and
+    // every other proxy with it, have this proxy reaped once its
+    // delegations have unwound.
+
+    ScheduleReapProxies(mRunLoopParameters.GetRunLoop());
+
+ done:
     return (lStatus);
 }
 
+bool HLXProxy :: IsStopped(void) const
+{
+    return (mStopped);
+}
+
 const Proxy::Application::Controller &
 HLXProxy :: GetController(void) const
 {
@@ -441,6 +609,12 @@ void HLXProxy :: SetStatus(const Status &aStatus)
     mStatus = aStatus;
 }
 
+const char *
+HLXProxy :: GetConnectMaybeURL(void) const
+{
+    return ((mConnectMaybeURL == nullptr) ? "(null)" : mConnectMaybeURL);
+}
+
 void
 HLXProxy :: SetVersions(const bool &aUseIPv6,
                         const bool &aUseIPv4)
@@ -540,6 +714,8 @@ void HLXProxy :: ControllerDidListen(Proxy::Application::Controller &aController
     (void)aController;
 
     Log::Info().Write("Listened at %s.\n", (aURLRef == nullptr) ? "(null)" : CFString(CFURLGetString(aURLRef)).GetCString());
+
+    ProcessesDidListen();
 }
 
 void HLXProxy :: ControllerDidNotListen(Proxy::Application::Controller &aController, CFURLRef aURLRef, const Common::Error &aError)
@@ -718,7 +894,7 @@ void HLXProxy :: ControllerWillRefresh(Client::Application::ControllerBasis &aCo
 {
     (void)aController;
 
-    Log::Info().Write("Waiting for client data...\n");
+    Log::Info().Write("Waiting for client data from %s...\n", GetConnectMaybeURL());
 
     return;
 }
@@ -727,7 +903,7 @@ void HLXProxy :: ControllerIsRefreshing(Client::Application::ControllerBasis &aC
 {
     (void)aController;
 
-    Log::Info().Write("%u%% of client data received.\n", aPercentComplete);
+    Log::Info().Write("%u%% of client data from %s received.\n", aPercentComplete, GetConnectMaybeURL());
 }
 
 void HLXProxy :: ControllerDidRefresh(Client::Application::ControllerBasis &aController)
@@ -737,7 +913,7 @@ void HLXProxy :: ControllerDidRefresh(Client::Application::ControllerBasis &aCon
 
     (void)aController;
 
-    Log::Info().Write("Client data received.\n");
+    Log::Info().Write("Client data from %s received.\n", GetConnectMaybeURL());
 
     if ((sOptFlags & kOptNoInitialRefresh) != kOptNoInitialRefresh)
     {
@@ -807,12 +983,110 @@ static void OnSignal(int aSignal)
 {
     Log::Debug().Write("%s: caught signal %d\n", __func__, aSignal);
 
-    if (sHLXProxy != nullptr)
+    for (auto &lHLXProxy : sHLXProxies)
+    {
+        lHLXProxy->SetStatus(-errno);
+    }
+
+    CFRunLoopStop(CFRunLoopGetMain());
+}
+
+/*
+ *  void ReapProxies()
+ *
+ *  Description:
+ *    This routine destroys any proxies that have stopped, recording
+ *    whether any of them failed, and stops the run loop once no
+ *    proxies remain, such that one proxied server failing or
+ *    disconnecting does not take down the proxies of the others.
+ *
+ *  Input(s):
+ *    aTimerRef - A reference to the run loop timer that fired.
+ *    aContext  - Unused.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    N/A
+ *
+ */
+static void
+ReapProxies(CFRunLoopTimerRef aTimerRef, void *aContext)
+{
+    HLXProxies::iterator lCurrent = sHLXProxies.begin();
+
+    (void)aContext;
+
+    CFRunLoopTimerInvalidate(aTimerRef);
+    CFRelease(aTimerRef);
+
+    sReapTimerRef = nullptr;
+
+    while (lCurrent != sHLXProxies.end())
     {
-        sHLXProxy->Stop(-errno);
+        if ((*lCurrent)->IsStopped())
+        {
+            if ((*lCurrent)->GetStatus() != kStatus_Success)
+            {
+                sProxiesFailed = true;
+            }
+
+            lCurrent = sHLXProxies.erase(lCurrent);
+        }
+        else
+        {
+            ++lCurrent;
+        }
+    }
+
+    if (sHLXProxies.empty())
+    {
+        CFRunLoopStop(CFRunLoopGetCurrent());
     }
 }
 
+/*
+ *  void ScheduleReapProxies()
+ *
+ *  Description:
+ *    This routine schedules, if it is not already scheduled, the
+ *    reaping of stopped proxies on the next pass of the specified run
+ *    loop, outside of the delegations in which they stopped.
+ *
+ *  Input(s):
+ *    aRunLoopRef - A reference to the run loop on which to reap the
+ *                  stopped proxies.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    N/A
+ *
+ */
+static void
+ScheduleReapProxies(CFRunLoopRef aRunLoopRef)
+{
+    CFRunLoopTimerContext lContext = { 0, nullptr, nullptr, nullptr, nullptr };
+
+    nlEXPECT(sReapTimerRef == nullptr, done);
+
+    sReapTimerRef = CFRunLoopTimerCreate(kCFAllocatorDefault,
+                                         CFAbsoluteTimeGetCurrent(),
+                                         0,
+                                         0,
+                                         0,
+                                         ReapProxies,
+                                         &lContext);
+    nlREQUIRE(sReapTimerRef != nullptr, done);
+
+    CFRunLoopAddTimer(aRunLoopRef, sReapTimerRef, kCFRunLoopCommonModes);
+
+ done:
+    return;
+}
+
 static void SetSignalHandler(int aSignal, void (*aHandler)(int aSignal))
 {
     struct sigaction sa;
@@ -873,6 +1147,276 @@ SetLevel(Log::Level &inLevel, const char *inArgument)
     return (errors);
 }
 
+/*
+ *  unsigned int SetWorkers()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    connection input and output worker count and, if successful,
+ *    sets it.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetWorkers(const char *inArgument)
+{
+    uint32_t     workers;
+    unsigned int errors = 0;
+    Status       status;
+
+    status = Parse(inArgument, workers);
+
+    if (status == kStatus_Success) {
+        status = Server::ConnectionManager::SetWorkers(workers);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid I/O worker count `%s'; please specify a "
+                           "count from 0 to 64.\n",
+                           inArgument);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetLimit()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    proxied object count and, if successful, sets that count as the
+ *    maximum for the object type with the specified setter.
+ *
+ *  Input(s):
+ *    inName     - A pointer to a NULL-terminated C string naming the
+ *                 object type, for diagnostic output.
+ *    inSetter   - The setter for the maximum number of objects of the
+ *                 type.
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetLimit(const char *inName, LimitSetter inSetter, const char *inArgument)
+{
+    Model::IdentifierModel::IdentifierType limit;
+    unsigned int                           errors = 0;
+    Status                                 status;
+
+    status = Parse(inArgument, limit);
+
+    if (status == kStatus_Success) {
+        status = inSetter(limit);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid %s count `%s'; please specify a count "
+                           "from %u to %u.\n",
+                           inName,
+                           inArgument,
+                           Model::IdentifierModel::kIdentifierMin,
+                           Model::IdentifierModel::kIdentifierMax);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetMaxConnections()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    maximum client connection count and, if successful, sets it.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetMaxConnections(const char *inArgument)
+{
+    uint32_t     connections;
+    unsigned int errors = 0;
+    Status       status;
+
+    status = Parse(inArgument, connections);
+
+    if (status == kStatus_Success) {
+        status = Server::ConnectionManager::SetConnectionsMax(connections);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid maximum connection count `%s'.\n",
+                           inArgument);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetIdleTimeout()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    client connection idle timeout, in milliseconds, and, if
+ *    successful, sets it.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the timeout to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetIdleTimeout(const char *inArgument)
+{
+    Timeout::Value milliseconds;
+    unsigned int   errors = 0;
+    Status         status;
+
+    status = Parse(inArgument, milliseconds);
+
+    if (status == kStatus_Success) {
+        status = Server::ConnectionManager::SetIdleTimeout(milliseconds);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid idle timeout `%s'.\n",
+                           inArgument);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetRequestRate()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    client connection request rate, in requests per second,
+ *    optionally followed by a colon-delimited burst size and, if
+ *    successful, sets them.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the rate and optional burst to parse
+ *                 and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetRequestRate(const char *inArgument)
+{
+    const char * const delimiter = strchr(inArgument, ':');
+    uint32_t           rate;
+    uint32_t           burst = 0;
+    unsigned int       errors = 0;
+    Status             status;
+
+    if (delimiter == nullptr) {
+        status = Parse(inArgument, rate);
+
+    } else {
+        status = Parse(inArgument, static_cast<size_t>(delimiter - inArgument), rate);
+
+        if (status == kStatus_Success) {
+            status = Parse(delimiter + 1, burst);
+        }
+
+    }
+
+    if (status == kStatus_Success) {
+        status = Server::ConnectionManager::SetRequestRateLimit(rate, burst);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid request rate `%s'; please specify a "
+                           "rate and, optionally, a colon-delimited "
+                           "burst.\n",
+                           inArgument);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetProcesses()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    worker process count and, if successful, sets it.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetProcesses(const char *inArgument)
+{
+    uint32_t     processes;
+    unsigned int errors = 0;
+    Status       status;
+
+    status = Parse(inArgument, processes);
+
+    if ((status < kStatus_Success) || (processes > kProcessesMax)) {
+        Log::Error().Write("Invalid worker process count `%s'; please "
+                           "specify a count from 0 to %zu.\n",
+                           inArgument, kProcessesMax);
+        errors++;
+
+    } else {
+        sProcesses = processes;
+
+    }
+
+    return (errors);
+}
+
 /*
  *  void PrintUsage()
  *
@@ -980,17 +1524,66 @@ DecodeOptions(const char *inProgram,
         switch (c) {
 
         case OPT_CONNECT:
-            sConnectMaybeURL = optarg;
+            sConnectMaybeURLs.push_back(optarg);
             break;
 
         case OPT_DEBUG:
             error += SetLevel(sDebug, optarg);
             break;
 
+        case OPT_EQUALIZER_PRESETS:
+            error += SetLimit("equalizer preset", Common::EqualizerPresetsControllerBasis::SetEqualizerPresetsMax, optarg);
+            break;
+
+        case OPT_EVENT_LOOP:
+            if (!EventLoop::IsSupported())
+            {
+                Log::Error().Write("The '--event-loop' option is not supported on this platform or configuration.\n");
+                error++;
+            }
+            else
+            {
+                sOptFlags |= kOptEventLoop;
+            }
+            break;
+
+        case OPT_FAVORITES:
+            error += SetLimit("favorite", Common::FavoritesControllerBasis::SetFavoritesMax, optarg);
+            break;
+
+        case OPT_GROUPS:
+            error += SetLimit("group", Common::GroupsControllerBasis::SetGroupsMax, optarg);
+            break;
+
         case OPT_HELP:
             PrintUsage(inProgram, EXIT_SUCCESS);
             break;
 
+        case OPT_IO_URING:
+            if (!EventLoop::IsSupported())
+            {
+                Log::Error().Write("The '--io-uring' option is not supported on this platform or configuration.\n");
+                error++;
+            }
+            else
+            {
+                if (!SocketRing::IsSupported())
+                {
+                    Log::Error().Write("The '--io-uring' option is not supported in this configuration; using '--event-loop' instead.\n");
+                }
+                else
+                {
+                    sOptFlags |= kOptIOURing;
+                }
+
+                sOptFlags |= kOptEventLoop;
+            }
+            break;
+
+        case OPT_IDLE_TIMEOUT:
+            error += SetIdleTimeout(optarg);
+            break;
+
         case OPT_INITIAL_REFRESH:
             if (sOptFlags & kOptNoInitialRefresh)
             {
@@ -1003,6 +1596,10 @@ DecodeOptions(const char *inProgram,
             }
             break;
 
+        case OPT_IO_WORKERS:
+            error += SetWorkers(optarg);
+            break;
+
         case OPT_IPV4_ONLY:
             if (sOptFlags & kOptIPv6Only)
             {
@@ -1028,17 +1625,33 @@ DecodeOptions(const char *inProgram,
             break;
 
         case OPT_LISTEN:
-            sListenMaybeURL = optarg;
+            sListenMaybeURLs.push_back(optarg);
+            break;
+
+        case OPT_MAX_CONNECTIONS:
+            error += SetMaxConnections(optarg);
             break;
 
         case OPT_NO_INITIAL_REFRESH:
             sOptFlags |= kOptNoInitialRefresh;
             break;
 
+        case OPT_PROCESSES:
+            error += SetProcesses(optarg);
+            break;
+
         case OPT_QUIET:
             sOptFlags |= kOptQuiet;
             break;
 
+        case OPT_REQUEST_RATE:
+            error += SetRequestRate(optarg);
+            break;
+
+        case OPT_SOURCES:
+            error += SetLimit("source", Common::SourcesControllerBasis::SetSourcesMax, optarg);
+            break;
+
         case OPT_SYSLOG:
             sOptFlags |= kOptSyslog;
             break;
@@ -1067,6 +1680,10 @@ DecodeOptions(const char *inProgram,
             PrintVersion(inProgram);
             break;
 
+        case OPT_ZONES:
+            error += SetLimit("zone", Common::ZonesControllerBasis::SetZonesMax, optarg);
+            break;
+
         default:
             Log::Error().Write("Unknown option '%d'!\n", optopt);
             error++;
@@ -1116,6 +1733,44 @@ DecodeOptions(const char *inProgram,
 
     }
 
+    // Check that, if more than one server to proxy was specified,
+    // each is paired with a listen address for its clients;
+    // otherwise, every proxied server would contend for the same
+    // default listen address.
+
+    if (sConnectMaybeURLs.size() > 1) {
+        if (sListenMaybeURLs.size() != sConnectMaybeURLs.size()) {
+            Log::Error().Write("%zu servers to connect to were specified "
+                               "with %zu addresses to listen at. Please "
+                               "specify one listen address for each "
+                               "server.\n",
+                               sConnectMaybeURLs.size(),
+                               sListenMaybeURLs.size());
+            error++;
+        }
+    } else if (sListenMaybeURLs.size() > 1) {
+        Log::Error().Write("More than one address to listen at was "
+                           "specified for a single server. Please "
+                           "specify only one listen address.\n");
+        error++;
+    }
+
+    // Check that, if worker processes were requested, no listen
+    // address is a local socket, since only network listeners may be
+    // shared among processes.
+
+    if (sProcesses > 0) {
+        for (const char *listenMaybeURL : sListenMaybeURLs) {
+            if (strncmp(listenMaybeURL, "unix:", 5) == 0) {
+                Log::Error().Write("The '--processes' option cannot be "
+                                   "used with the local socket listen "
+                                   "address `%s'.\n",
+                                   listenMaybeURL);
+                error++;
+            }
+        }
+    }
+
     // If there were any errors parsing the command line arguments,
     // remind the user of proper invocation semantics and return an
     // error to the parent process.
@@ -1223,11 +1878,220 @@ FilterSyslog(Log::Logger &inLogger)
     return (typeid(theWriter) == typeid(Log::Writer::Syslog));
 }
 
+/*
+ *  Status StartProcesses()
+ *
+ *  Description:
+ *    This routine forks the requested number of worker processes,
+ *    each of which accepts and serves clients at the listen addresses
+ *    shared among them with SO_REUSEPORT.
+ *
+ *    The invoking process becomes the primary. It alone connects to
+ *    each HLX server, listening for its workers, rather than for
+ *    clients, at a local socket in a private directory. Each worker,
+ *    in turn, is an ordinary proxy that connects to the primary at
+ *    that local socket, such that it keeps a replica of the proxy
+ *    cache from which it answers queries, receives state changes as
+ *    the primary relays them, and relays mutations through the
+ *    primary to the HLX server.
+ *
+ *    Since workers may not connect until the primary is listening,
+ *    each waits until the primary closes the write end of a pipe
+ *    shared among them.
+ *
+ *  Input(s):
+ *    N/A
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    kStatus_Success if OK, in both the primary and each worker;
+ *    otherwise, a negative error status.
+ *
+ */
+static Status
+StartProcesses(void)
+{
+    char    directory[] = P_tmpdir "/hlxproxyd.XXXXXX";
+    int     descriptors[2] = { -1, -1 };
+    bool    worker = false;
+    char    ready;
+    ssize_t result;
+    int     status;
+    Status  retval = kStatus_Success;
+
+    // Create a directory, accessible only to this user, for the
+    // local sockets at which the primary listens for its workers.
+
+    nlREQUIRE_ACTION(mkdtemp(directory) != nullptr, done, retval = -errno);
+
+    sProcessDirectory = directory;
+
+    for (size_t i = 0; i < sConnectMaybeURLs.size(); i++) {
+        sProcessURLs.push_back("unix://" + sProcessDirectory + "/" + std::to_string(i) + ".sock");
+    }
+
+    status = pipe(descriptors);
+    nlREQUIRE_ACTION(status == 0, done, retval = -errno);
+
+    for (size_t i = 0; i < sProcesses; i++) {
+        const pid_t pid = fork();
+        nlREQUIRE_ACTION(pid != -1, done, retval = -errno);
+
+        if (pid == 0) {
+            worker = true;
+            break;
+        }
+
+        sProcessIdentifiers.push_back(pid);
+    }
+
+    if (worker) {
+        // The workers are neither responsible for their siblings nor
+        // for the private directory, which belong to the primary.
+
+        sProcessIdentifiers.clear();
+        sProcessDirectory.clear();
+
+        close(descriptors[1]);
+        descriptors[1] = -1;
+
+        // Wait for the primary to close the write end of the pipe
+        // once it is listening or once it has exited, whichever
+        // comes first. Any signal while waiting terminates the
+        // worker.
+
+        while ((result = read(descriptors[0], &ready, sizeof (ready))) > 0) {
+            continue;
+        }
+
+        nlREQUIRE_ACTION(result == 0, done, retval = -errno);
+
+        for (size_t i = 0; i < sConnectMaybeURLs.size(); i++) {
+            sConnectMaybeURLs[i] = sProcessURLs[i].c_str();
+        }
+
+        Log::Info().Write("Worker process %d started.\n", getpid());
+
+    } else {
+        sProcessReadyDescriptor = descriptors[1];
+        descriptors[1] = -1;
+
+        sListenMaybeURLs.clear();
+
+        for (const std::string &processURL : sProcessURLs) {
+            sListenMaybeURLs.push_back(processURL.c_str());
+        }
+
+        // Admission control is for clients, which are served by the
+        // workers; the primary must neither refuse, evict, nor limit
+        // the workers themselves.
+
+        Server::ConnectionManager::SetConnectionsMax(0);
+        Server::ConnectionManager::SetIdleTimeout(0);
+        Server::ConnectionManager::SetRequestRateLimit(0, 0);
+
+    }
+
+ done:
+    if (descriptors[0] != -1) {
+        close(descriptors[0]);
+    }
+
+    if (descriptors[1] != -1) {
+        close(descriptors[1]);
+    }
+
+    return (retval);
+}
+
+/*
+ *  void ProcessesDidListen()
+ *
+ *  Description:
+ *    This routine accounts for, in the primary process, a proxy
+ *    listening for its workers and, once all proxies are listening,
+ *    releases the workers to connect.
+ *
+ *  Input(s):
+ *    N/A
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    N/A
+ *
+ */
+static void
+ProcessesDidListen(void)
+{
+    if (sProcessReadyDescriptor != -1) {
+        sProcessesListening++;
+
+        if (sProcessesListening == sConnectMaybeURLs.size()) {
+            close(sProcessReadyDescriptor);
+            sProcessReadyDescriptor = -1;
+
+            Log::Info().Write("Serving clients from %zu worker processes.\n",
+                              sProcessIdentifiers.size());
+        }
+    }
+}
+
+/*
+ *  void StopProcesses()
+ *
+ *  Description:
+ *    This routine, in the primary process, terminates and reaps any
+ *    worker processes and removes the private directory for the
+ *    local sockets at which the primary listened for them. In a
+ *    worker process, it does nothing.
+ *
+ *  Input(s):
+ *    N/A
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    N/A
+ *
+ */
+static void
+StopProcesses(void)
+{
+    int status;
+
+    if (sProcessReadyDescriptor != -1) {
+        close(sProcessReadyDescriptor);
+        sProcessReadyDescriptor = -1;
+    }
+
+    for (const pid_t pid : sProcessIdentifiers) {
+        kill(pid, SIGTERM);
+    }
+
+    for (const pid_t pid : sProcessIdentifiers) {
+        while ((waitpid(pid, &status, 0) == -1) && (errno == EINTR)) {
+            continue;
+        }
+    }
+
+    sProcessIdentifiers.clear();
+
+    if (!sProcessDirectory.empty()) {
+        rmdir(sProcessDirectory.c_str());
+        sProcessDirectory.clear();
+    }
+}
+
 int main(int argc, char * const argv[])
 {
-    HLXProxy     lHLXProxy;
-    Status       lStatus;
+    Status       lStatus = kStatus_Success;
     size_t       n = 0;
+    bool         lFailed = false;
 
     // Cache the program invocation name for later use
 
@@ -1255,26 +2119,75 @@ int main(int argc, char * const argv[])
         FilterSyslog(Log::Info());
     }
 
+    // Preserve the historical behavior, wherein the absence of a
+    // connect option is reported by the proxy itself on start.
+
+    if (sConnectMaybeURLs.empty())
+    {
+        sConnectMaybeURLs.push_back(nullptr);
+    }
+
+    // If worker processes were requested, fork them now, before any
+    // run loop or connection state exists that they might otherwise
+    // inherit.
+
+    if (sProcesses > 0)
+    {
+        lStatus = StartProcesses();
+        nlREQUIRE_SUCCESS_ACTION(lStatus, done, lFailed = true);
+    }
+
     {
         const bool lUseIPv4 = (((sOptFlags & kOptIPv6Only) == kOptIPv6Only) ? false : true);
         const bool lUseIPv6 = (((sOptFlags & kOptIPv4Only) == kOptIPv4Only) ? false : true);
 
-        sHLXProxy = &lHLXProxy;
+        // Instantiate one proxy, with its own server-facing client
+        // connection, data model, and client-facing listener, for each
+        // server to be proxied. All proxies share the current run
+        // loop.
+
+        for (size_t i = 0; i < sConnectMaybeURLs.size(); i++)
+        {
+            const char * lListenMaybeURL = ((i < sListenMaybeURLs.size()) ? sListenMaybeURLs[i] : nullptr);
+            std::unique_ptr<HLXProxy> lHLXProxy(new HLXProxy());
 
-        lStatus = lHLXProxy.Init(sConnectMaybeURL,
-                                 sListenMaybeURL,
-                                 lUseIPv6,
-                                 lUseIPv4);
-        nlREQUIRE_SUCCESS_ACTION(lStatus, done, lHLXProxy.SetStatus(lStatus));
+            sHLXProxies.push_back(std::move(lHLXProxy));
 
-        lStatus = lHLXProxy.Start();
-        nlREQUIRE_SUCCESS_ACTION(lStatus, done, lHLXProxy.SetStatus(lStatus));
+            lStatus = sHLXProxies.back()->Init(sConnectMaybeURLs[i],
+                                               lListenMaybeURL,
+                                               lUseIPv6,
+                                               lUseIPv4);
+            nlREQUIRE_SUCCESS_ACTION(lStatus, done, sHLXProxies.back()->SetStatus(lStatus));
+        }
 
-        Log::Debug().Write("Proxy started with status %d\n", lStatus);
+        for (auto &lHLXProxy : sHLXProxies)
+        {
+            lStatus = lHLXProxy->Start();
+            nlREQUIRE_SUCCESS_ACTION(lStatus, done, lHLXProxy->SetStatus(lStatus));
+        }
+
+        Log::Debug().Write("%zu prox%s started with status %d\n",
+                           sHLXProxies.size(),
+                           ((sHLXProxies.size() == 1) ? "y" : "ies"),
+                           lStatus);
     }
 
     CFRunLoopRun();
 
  done:
-    return((lHLXProxy.GetStatus() == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+    lFailed = (lFailed || sProxiesFailed);
+
+    for (auto &lHLXProxy : sHLXProxies)
+    {
+        if (lHLXProxy->GetStatus() != 0)
+        {
+            lFailed = true;
+        }
+    }
+
+    sHLXProxies.clear();
+
+    StopProcesses();
+
+    return((!lFailed) ? EXIT_SUCCESS : EXIT_FAILURE);
 }
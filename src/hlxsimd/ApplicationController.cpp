@@ -94,6 +94,7 @@ Controller :: Controller(void) :
     mEqualizerPresetsController(),
     mSourcesController(),
     mZonesController(),
+    mFaultInjectionController(),
     mDelegate(nullptr),
     mConfigurationAutoSaveTimer(),
     mConfigurationIsDirty(false)
@@ -115,6 +116,14 @@ Controller :: ~Controller(void)
 
 Status
 Controller :: Init(const RunLoopParameters &aRunLoopParameters, const boost::filesystem::path &aConfigurationPath)
+{
+    const FaultInjectionController::Parameters lFaultInjectionParameters;
+
+    return (Init(aRunLoopParameters, aConfigurationPath, lFaultInjectionParameters));
+}
+
+Status
+Controller :: Init(const RunLoopParameters &aRunLoopParameters, const boost::filesystem::path &aConfigurationPath, const FaultInjectionController::Parameters &aFaultInjectionParameters)
 {
     DeclareScopedFunctionTracer(lTracer);
     Status lRetval = kStatus_Success;
@@ -134,6 +143,13 @@ Controller :: Init(const RunLoopParameters &aRunLoopParameters, const boost::fil
     lRetval = GetConnectionManager().AddDelegate(this);
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    // Initialize the fault injection controller, which interposes on
+    // data sent by the connection manager only if latency or faults
+    // are to be injected.
+
+    lRetval = mFaultInjectionController.Init(aRunLoopParameters, GetConnectionManager(), aFaultInjectionParameters);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
     // Initialize the command manager
 
     lRetval = GetCommandManager().SetDelegate(this);
@@ -395,6 +411,25 @@ Status Controller :: LoadFromBackupConfigurationStorage(ConfigurationController
     return (lRetval);
 }
 
+void Controller :: QueryChangedConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    SimulatorObjectControllerContainer::Controllers::iterator lCurrent;
+    SimulatorObjectControllerContainer::Controllers::iterator lLast;
+
+
+    (void)aController;
+
+    lCurrent = SimulatorObjectControllerContainer::GetControllers().begin();
+    lLast = SimulatorObjectControllerContainer::GetControllers().end();
+
+    while (lCurrent != lLast)
+    {
+        lCurrent->second.mController->QueryChangedConfiguration(aConnection, aSequence, aBuffer);
+
+        lCurrent++;
+    }
+}
+
 void Controller :: QueryCurrentConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
     SimulatorObjectControllerContainer::Controllers::iterator lCurrent;
@@ -48,6 +48,7 @@
 #include "ConfigurationController.hpp"
 #include "ConfigurationControllerDelegate.hpp"
 #include "EqualizerPresetsController.hpp"
+#include "FaultInjectionController.hpp"
 #include "FavoritesController.hpp"
 #include "FrontPanelController.hpp"
 #include "GroupsController.hpp"
@@ -92,6 +93,7 @@ public:
     // Initializer(s)
 
     Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters, const boost::filesystem::path &aConfigurationPath);
+    Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters, const boost::filesystem::path &aConfigurationPath, const FaultInjectionController::Parameters &aFaultInjectionParameters);
 
     ControllerDelegate *GetDelegate(void) const;
 
@@ -103,6 +105,7 @@ public:
 
     Common::Status LoadFromBackupConfiguration(ConfigurationController &aController, CFDictionaryRef aBackupDictionary) final;
     Common::Status LoadFromBackupConfigurationStorage(ConfigurationController &aController, CFDictionaryRef &aBackupDictionary) final;
+    void QueryChangedConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) final;
     void QueryCurrentConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) final;
     void ResetToDefaultConfiguration(ConfigurationController &aController) final;
     void SaveToBackupConfiguration(ConfigurationController &aController, CFMutableDictionaryRef aBackupDictionary) final;
@@ -252,6 +255,7 @@ private:
     EqualizerPresetsController      mEqualizerPresetsController;
     SourcesController               mSourcesController;
     ZonesController                 mZonesController;
+    FaultInjectionController        mFaultInjectionController;
     ControllerDelegate *            mDelegate;
     Common::Timer                   mConfigurationAutoSaveTimer;
     bool                            mConfigurationIsDirty;
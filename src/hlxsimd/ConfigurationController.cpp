@@ -39,6 +39,7 @@
 #include <OpenHLX/Server/CommandManager.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 #include <OpenHLX/Utilities/ElementsOf.hpp>
+#include <OpenHLX/Utilities/Utilities.hpp>
 
 #include "ConfigurationControllerDelegate.hpp"
 
@@ -87,6 +88,11 @@ Status ConfigurationController :: DoRequestHandlers(const bool &aRegister)
             ConfigurationController::LoadFromBackupRequestReceivedHandler
         },
 
+        {
+            kQueryChangedRequest,
+            ConfigurationController::QueryChangedRequestReceivedHandler
+        },
+
         {
             kQueryCurrentRequest,
             ConfigurationController::QueryCurrentRequestReceivedHandler
@@ -253,10 +259,7 @@ void ConfigurationController :: LoadFromBackupRequestReceivedHandler(Server::Con
     lStatus = LoadFromBackup();
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Finally, either send the success or error confirmation back to
@@ -268,7 +271,77 @@ void ConfigurationController :: LoadFromBackupRequestReceivedHandler(Server::Con
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    if (lStatus >= kStatus_Success)
+    {
+        lStatus = SendResponse(aConnection, lResponseBuffer);
+        nlVERIFY_SUCCESS(lStatus);
+    }
+    else
+    {
+        lStatus = SendErrorResponse(aConnection);
+        nlVERIFY_SUCCESS(lStatus);
+    }
+
+    return;
+}
+
+void ConfigurationController :: QueryChangedRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches)
+{
+    Model::ChangeSequence::SequenceType                   lSequence;
+    Server::Command::Configuration::QueryChangedResponse  lResponse;
+    ConnectionBuffer::MutableCountedPointer               lResponseBuffer;
+    Status                                                lStatus;
+    const uint8_t *                                       lBuffer;
+    size_t                                                lSize;
+
+
+    (void)aSize;
+
+    nlREQUIRE_ACTION(aMatches.size() == Server::Command::Configuration::QueryChangedRequest::kExpectedMatches, done, lStatus = kError_BadCommand);
+
+    // Match 2/2: Change Sequence Number
+
+    lStatus = Utilities::Parse(aBuffer + aMatches.at(1).rm_so,
+                               Common::Utilities::Distance(aMatches.at(1)),
+                               lSequence);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    // A change sequence number later than the current one cannot
+    // have been issued by this server instance (for example, it was
+    // issued before a restart). Treat it as though the client had
+    // never synchronized such that all configuration is returned.
+
+    if (lSequence > Model::ChangeSequence::GetSequence())
+    {
+        lSequence = Model::ChangeSequence::kSequenceNone;
+    }
+
+    // First, allocate and initialize the response buffer.
+
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    // Next, invoke the delegate for fanout such that other
+    // participants can insert their changed settings or state to the
+    // representation.
+
+    OnQueryChangedConfiguration(aConnection, lSequence, lResponseBuffer);
+
+    // Finally, conclude with the change sequence number as of the
+    // response. This must be sampled after the fanout since
+    // participants stamp any outstanding changes as they are queried.
+
+    lStatus = lResponse.Init(Model::ChangeSequence::GetSequence());
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lBuffer = lResponse.GetBuffer();
+    lSize = lResponse.GetSize();
+
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -302,10 +375,7 @@ void ConfigurationController :: QueryCurrentRequestReceivedHandler(Server::Conne
 
     // First, allocate and initialize the response buffer.
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Next, invoke the delegate for fanout such that other
@@ -323,7 +393,7 @@ void ConfigurationController :: QueryCurrentRequestReceivedHandler(Server::Conne
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -360,10 +430,7 @@ void ConfigurationController :: ResetToDefaultsRequestReceivedHandler(Server::Co
 
     OnResetToDefaultConfiguration();
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Finally, either send the success or error confirmation back to
@@ -375,7 +442,7 @@ void ConfigurationController :: ResetToDefaultsRequestReceivedHandler(Server::Co
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -414,10 +481,7 @@ void ConfigurationController :: SaveToBackupRequestReceivedHandler(Server::Conne
     // serialization, the actual save to backup "did save" command
     // repsonse "bookend" is sent.
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, send the "will save" notification.
@@ -428,7 +492,7 @@ void ConfigurationController :: SaveToBackupRequestReceivedHandler(Server::Conne
     lBuffer = lSavingToBackupNotification.GetBuffer();
     lSize = lSavingToBackupNotification.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = SendResponse(aConnection, lResponseBuffer);
@@ -442,10 +506,13 @@ void ConfigurationController :: SaveToBackupRequestReceivedHandler(Server::Conne
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Finally, either send the "did save" command response success
-    // "booked" back to the client, flushing the response buffer first
-    // of the prior "will save" notification.
+    // "booked" back to the client in a fresh response buffer. The
+    // buffer holding the prior "will save" notification may yet be
+    // queued for sending on another run loop and, therefore, cannot
+    // simply be flushed and reused.
 
-    lResponseBuffer->Flush();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = lSaveToBackupResponse.Init();
     nlREQUIRE_SUCCESS(lStatus, done);
@@ -453,7 +520,7 @@ void ConfigurationController :: SaveToBackupRequestReceivedHandler(Server::Conne
     lBuffer = lSaveToBackupResponse.GetBuffer();
     lSize = lSaveToBackupResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -506,6 +573,14 @@ Status ConfigurationController :: OnLoadFromBackupConfigurationStorage(CFDiction
     return (lRetval);
 }
 
+void ConfigurationController :: OnQueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    if (mDelegate != nullptr)
+    {
+        mDelegate->QueryChangedConfiguration(*this, aConnection, aSequence, aBuffer);
+    }
+}
+
 void ConfigurationController :: OnQueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer)
 {
     if (mDelegate != nullptr)
@@ -554,6 +629,16 @@ void ConfigurationController :: LoadFromBackupRequestReceivedHandler(Server::Con
     }
 }
 
+void ConfigurationController :: QueryChangedRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches, void *aContext)
+{
+    ConfigurationController *lController = static_cast<ConfigurationController *>(aContext);
+
+    if (lController != nullptr)
+    {
+        lController->QueryChangedRequestReceivedHandler(aConnection, aBuffer, aSize, aMatches);
+    }
+}
+
 void ConfigurationController :: QueryCurrentRequestReceivedHandler(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const Common::RegularExpression::Matches &aMatches, void *aContext)
 {
     ConfigurationController *lController = static_cast<ConfigurationController *>(aContext);
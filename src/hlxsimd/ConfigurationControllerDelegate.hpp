@@ -28,6 +28,8 @@
 
 #include <CoreFoundation/CFDictionary.h>
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
+
 
 namespace HLX
 {
@@ -49,6 +51,8 @@ class ConnectionBasis;
  *
  *    - Loading back up configuration from non-volatile storage.
  *    - Deserializing back up configuration from a backup representation.
+ *    - Querying the configuration changed since a change sequence
+ *      number.
  *    - Querying the current configuration.
  *    - Resetting to default configuration.
  *    - Serialzing back up configuration to a backup representation.
@@ -65,6 +69,7 @@ public:
 
     virtual Common::Status LoadFromBackupConfiguration(ConfigurationController &aController, CFDictionaryRef aBackupConfiguration) = 0;
     virtual Common::Status LoadFromBackupConfigurationStorage(ConfigurationController &aController, CFDictionaryRef &aBackupDictionary) = 0;
+    virtual void           QueryChangedConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) = 0;
     virtual void           QueryCurrentConfiguration(ConfigurationController &aController, Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) = 0;
     virtual void           ResetToDefaultConfiguration(ConfigurationController &aController) = 0;
     virtual void           SaveToBackupConfiguration(ConfigurationController &aController, CFMutableDictionaryRef aBackupDictionary) = 0;
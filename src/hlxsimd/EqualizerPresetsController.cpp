@@ -27,6 +27,7 @@
 #include "EqualizerPresetsController.hpp"
 
 #include <memory>
+#include <string>
 
 #include <errno.h>
 #include <inttypes.h>
@@ -230,6 +231,8 @@ static const EqualizerPresetModelDefaults kEqualizerPresetModelDefaults[10] = {
     }
 };
 
+static const char * const kEqualizerPresetNameFormat = "Preset Name %hhu";
+
 static CFStringRef      kEqualizerPresetsSchemaKey = CFSTR("Equalizer Presets");
 static CFStringRef      kNameSchemaKey = CFSTR("Name");
 static CFStringRef      kEqualizerLevelsPresetSchemaKey = CFSTR("Equalizer Levels");
@@ -237,7 +240,7 @@ static CFStringRef      kEqualizerLevelsPresetSchemaKey = CFSTR("Equalizer Level
 EqualizerPresetsController :: EqualizerPresetsController(void) :
     Common::EqualizerPresetsControllerBasis(),
     Server::EqualizerPresetsControllerBasis(Common::EqualizerPresetsControllerBasis::mEqualizerPresets,
-                                            Common::EqualizerPresetsControllerBasis::kEqualizerPresetsMax),
+                                            Common::EqualizerPresetsControllerBasis::sEqualizerPresetsMax),
     Simulator::ContainerControllerBasis(),
     Simulator::ObjectControllerBasis()
 {
@@ -376,10 +379,7 @@ EqualizerPresetsController :: HandleAdjustBandReceived(Server::ConnectionBasis &
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     lRetval = HandleAdjustBandReceived(aEqualizerPresetIdentifier, aEqualizerBandIdentifier, aBandAdjustment, lResponseBuffer);
@@ -474,6 +474,20 @@ Status EqualizerPresetsController :: HandleSetBandReceived(const IdentifierType
 
 // MARK: Configuration Management Methods
 
+void EqualizerPresetsController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    Status  lStatus;
+
+
+    (void)aConnection;
+
+    lStatus = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    return;
+}
+
 void EqualizerPresetsController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer) const
 {
     Status  lStatus;
@@ -497,14 +511,20 @@ void EqualizerPresetsController :: ResetToDefaultConfiguration(void)
     Status                                   lStatus;
 
 
-    for (lEqualizerPresetIdentifier = IdentifierModel::kIdentifierMin; lEqualizerPresetIdentifier <= kEqualizerPresetsMax; lEqualizerPresetIdentifier++)
+    for (lEqualizerPresetIdentifier = IdentifierModel::kIdentifierMin; lEqualizerPresetIdentifier <= sEqualizerPresetsMax; lEqualizerPresetIdentifier++)
     {
-        const EqualizerPresetModelDefaults &lEqualizerPresetModelDefaults = kEqualizerPresetModelDefaults[lEqualizerPresetIdentifier - 1];
+        const size_t                        lDefaultsIndex                = Simulator::Utilities::Defaults::GetIndex(lEqualizerPresetIdentifier, ElementsOf(kEqualizerPresetModelDefaults));
+        const EqualizerPresetModelDefaults &lEqualizerPresetModelDefaults = kEqualizerPresetModelDefaults[lDefaultsIndex];
+        std::string                         lName;
+
+        lName = ((lEqualizerPresetIdentifier <= ElementsOf(kEqualizerPresetModelDefaults)) ?
+                 lEqualizerPresetModelDefaults.mName.mName :
+                 Simulator::Utilities::Defaults::GetName(kEqualizerPresetNameFormat, lEqualizerPresetIdentifier));
 
         lStatus = mEqualizerPresets.GetEqualizerPreset(lEqualizerPresetIdentifier, lEqualizerPresetModel);
         nlREQUIRE_SUCCESS(lStatus, done);
 
-        lStatus = lEqualizerPresetModel->SetName(lEqualizerPresetModelDefaults.mName.mName);
+        lStatus = lEqualizerPresetModel->SetName(lName.c_str());
         nlREQUIRE_SUCCESS(lStatus, done);
 
         if (lStatus == kStatus_Success)
@@ -626,7 +646,7 @@ Status EqualizerPresetsController :: LoadFromBackupConfiguration(CFDictionaryRef
     Status lRetval = kStatus_Success;
 
     ContainerControllerBasis::LoadFromBackupConfiguration(aBackupDictionary,
-                                                          kEqualizerPresetsMax,
+                                                          sEqualizerPresetsMax,
                                                           kEqualizerPresetsSchemaKey);
     nlREQUIRE(lRetval >= kStatus_Success, done);
 
@@ -723,7 +743,7 @@ Status EqualizerPresetsController :: ElementSaveToBackupConfiguration(CFMutableD
 void EqualizerPresetsController :: SaveToBackupConfiguration(CFMutableDictionaryRef aBackupDictionary)
 {
     ContainerControllerBasis::SaveToBackupConfiguration(aBackupDictionary,
-                                                        kEqualizerPresetsMax,
+                                                        sEqualizerPresetsMax,
                                                         kEqualizerPresetsSchemaKey);
 }
 
@@ -833,10 +853,7 @@ void EqualizerPresetsController :: QueryRequestReceivedHandler(Server::Connectio
                                                 lEqualizerPresetIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -852,7 +869,7 @@ void EqualizerPresetsController :: QueryRequestReceivedHandler(Server::Connectio
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -913,10 +930,7 @@ void EqualizerPresetsController :: SetBandRequestReceivedHandler(Server::Connect
                                       lBandLevel);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleSetBandReceived(lEqualizerPresetIdentifier, lEqualizerBandIdentifier, lBandLevel, lResponseBuffer);
@@ -969,10 +983,7 @@ void EqualizerPresetsController :: SetNameRequestReceivedHandler(Server::Connect
     lName = (reinterpret_cast<const char *>(aBuffer) + aMatches.at(2).rm_so);
     lNameSize = Common::Utilities::Distance(aMatches.at(2));
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Get the equalizer preset model associated with the parsed
@@ -1001,7 +1012,7 @@ void EqualizerPresetsController :: SetNameRequestReceivedHandler(Server::Connect
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
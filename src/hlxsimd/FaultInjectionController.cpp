@@ -0,0 +1,547 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for injecting latency and
+ *      faults into the responses sent by the HLX server simulator to
+ *      its clients.
+ *
+ */
+
+#include "FaultInjectionController.hpp"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <math.h>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Timeout.hpp>
+#include <OpenHLX/Server/CommandErrorResponse.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+namespace HLX
+{
+
+namespace Simulator
+{
+
+static const Timeout::Value kTimerInterval = 1000;
+
+// MARK: Fault Injection Parameters
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ *  This initializes the parameters such that no latency or faults are
+ *  injected.
+ *
+ */
+FaultInjectionController :: Parameters :: Parameters(void) :
+    mDelayMinimum(0),
+    mDelayMaximum(0),
+    mFragmentSize(0),
+    mFragmentInterval(1),
+    mDropProbability(0.0),
+    mErrorProbability(0.0),
+    mSeed(1)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Determine whether the parameters inject any latency or faults.
+ *
+ *  @returns
+ *    True if any latency or faults are to be injected; otherwise,
+ *    false.
+ *
+ */
+bool
+FaultInjectionController :: Parameters :: IsEnabled(void) const
+{
+    return ((mDelayMaximum > 0)       ||
+            (mFragmentSize > 0)       ||
+            (mDropProbability > 0.0)  ||
+            (mErrorProbability > 0.0));
+}
+
+// MARK: Fault Injection Controller
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+FaultInjectionController :: FaultInjectionController(void) :
+    Common::TimerDelegate(),
+    mRunLoopParameters(),
+    mConnectionManager(nullptr),
+    mParameters(),
+    mConnections(),
+    mTimer(),
+    mGenerator()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+FaultInjectionController :: ~FaultInjectionController(void)
+{
+    if (mConnectionManager != nullptr)
+    {
+        mConnectionManager->SetSendHandler(nullptr, nullptr);
+        mConnectionManager->SetDisposeHandler(nullptr, nullptr);
+    }
+
+    mTimer.Destroy();
+}
+
+/**
+ *  @brief
+ *    This is the class initializer.
+ *
+ *  This initializes the controller with the specified parameters
+ *  and, if those parameters inject any latency or faults, interposes
+ *  the controller on all data sent by, and all connections disposed
+ *  of by, the specified connection manager.
+ *
+ *  @param[in]  aRunLoopParameters  An immutable reference to the run
+ *                                  loop parameters to initialize the
+ *                                  controller with.
+ *  @param[in]  aConnectionManager  A mutable reference to the server
+ *                                  connection manager on whose sent
+ *                                  data to inject latency and faults.
+ *  @param[in]  aParameters         An immutable reference to the
+ *                                  parameters governing the latency
+ *                                  and faults to inject.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If the minimum delay exceeds the maximum
+ *                            delay or if the drop and error
+ *                            probabilities are out of range.
+ *  @retval  -ENOMEM          If resources could not be allocated for
+ *                            the timer.
+ *
+ */
+Status
+FaultInjectionController :: Init(const RunLoopParameters &aRunLoopParameters,
+                                 Server::ConnectionManager &aConnectionManager,
+                                 const Parameters &aParameters)
+{
+    Status lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(aParameters.mDelayMinimum <= aParameters.mDelayMaximum, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(aParameters.mDropProbability >= 0.0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(aParameters.mErrorProbability >= 0.0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION((aParameters.mDropProbability + aParameters.mErrorProbability) <= 1.0, done, lRetval = -EINVAL);
+
+    mRunLoopParameters = aRunLoopParameters;
+    mParameters        = aParameters;
+
+    mGenerator.seed(mParameters.mSeed);
+
+    if (mParameters.IsEnabled())
+    {
+        // The timer is initialized once, here, and then only ever
+        // restarted for the earliest pending deadline or stopped. The
+        // interval here is immaterial, so long as it is nonzero and
+        // the timer thus repeats rather than firing only once.
+
+        lRetval = mTimer.Init(mRunLoopParameters, Timeout(kTimerInterval));
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = mTimer.SetDelegate(this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = aConnectionManager.SetSendHandler(SendHandler, this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = aConnectionManager.SetDisposeHandler(DisposeHandler, this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        mConnectionManager = &aConnectionManager;
+    }
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Connection Management
+
+/**
+ *  @brief
+ *    Callback trampoline to handle a connection being disposed of.
+ *
+ *  @param[in]  aConnection  A reference to the connection being
+ *                           disposed of.
+ *  @param[in]  aContext     A pointer to the controller instance that
+ *                           registered this trampoline.
+ *
+ */
+void
+FaultInjectionController :: DisposeHandler(Server::ConnectionBasis &aConnection, void *aContext)
+{
+    FaultInjectionController *lController = static_cast<FaultInjectionController *>(aContext);
+
+    if (lController != nullptr)
+    {
+        lController->ConnectionWillDispose(aConnection);
+    }
+}
+
+/**
+ *  @brief
+ *    Discard any pending data for a connection being disposed of.
+ *
+ *  This discards any delayed or partially-sent data pending for the
+ *  specified client connection, since the connection, once disposed
+ *  of, may no longer be sent upon.
+ *
+ *  @param[in]  aConnection  A reference to the connection being
+ *                           disposed of.
+ *
+ */
+void
+FaultInjectionController :: ConnectionWillDispose(Server::ConnectionBasis &aConnection)
+{
+    Status lStatus;
+
+    nlEXPECT(mConnections.erase(&aConnection) > 0, done);
+
+    lStatus = Schedule();
+    nlVERIFY_SUCCESS(lStatus);
+
+ done:
+    return;
+}
+
+// MARK: Send Handling
+
+/**
+ *  @brief
+ *    Callback trampoline to handle data to be sent to a client.
+ *
+ *  @param[in]  aConnection  A reference to the connection to send the
+ *                           specified buffer to.
+ *  @param[in]  aBuffer      An immutable shared pointer to the
+ *                           buffer to send.
+ *  @param[in]  aContext     A pointer to the controller instance that
+ *                           registered this trampoline.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+FaultInjectionController :: SendHandler(Server::ConnectionBasis &aConnection, ConnectionBuffer::ImmutableCountedPointer aBuffer, void *aContext)
+{
+    FaultInjectionController *lController = static_cast<FaultInjectionController *>(aContext);
+    Status                    lRetval = kStatus_Success;
+
+    if (lController != nullptr)
+    {
+        lRetval = lController->Send(aConnection, aBuffer);
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Drop, corrupt, or queue data to be sent to a client.
+ *
+ *  This decides whether the specified buffer is dropped, replaced
+ *  with an error response, or sent and, in the latter two cases,
+ *  queues it for sending after a delay, behind any data already
+ *  queued for the same client.
+ *
+ *  @param[in]  aConnection  A reference to the connection to send the
+ *                           specified buffer to.
+ *  @param[in]  aBuffer      An immutable shared pointer to the
+ *                           buffer to send.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+FaultInjectionController :: Send(Server::ConnectionBasis &aConnection, ConnectionBuffer::ImmutableCountedPointer aBuffer)
+{
+    std::uniform_real_distribution<double>  lDistribution(0.0, 1.0);
+    const CFAbsoluteTime                    lNow = CFAbsoluteTimeGetCurrent();
+    const double                            lFault = lDistribution(mGenerator);
+    PendingSends &                          lPendingSends = mConnections[&aConnection];
+    PendingSend                             lPendingSend;
+    Status                                  lRetval = kStatus_Success;
+
+
+    if (lFault < mParameters.mDropProbability)
+    {
+        Log::Debug().Write("Dropping %zu byte response.\n", aBuffer->GetChainSize());
+    }
+    else
+    {
+        if (lFault < (mParameters.mDropProbability + mParameters.mErrorProbability))
+        {
+            Server::Command::ErrorResponse lErrorResponse;
+
+            Log::Debug().Write("Replacing %zu byte response with an error response.\n", aBuffer->GetChainSize());
+
+            lRetval = lErrorResponse.Init();
+            nlREQUIRE_SUCCESS(lRetval, done);
+
+            lPendingSend.mData.assign(lErrorResponse.GetBuffer(),
+                                      lErrorResponse.GetBuffer() + lErrorResponse.GetSize());
+        }
+        else
+        {
+            lPendingSend.mData.reserve(aBuffer->GetChainSize());
+
+            for (; aBuffer; aBuffer = aBuffer->GetNext())
+            {
+                lPendingSend.mData.insert(lPendingSend.mData.end(),
+                                          aBuffer->GetHead(),
+                                          aBuffer->GetHead() + aBuffer->GetSize());
+            }
+        }
+
+        // Delay the data but never ahead of any data already queued
+        // for this client, preserving the order in which it was sent.
+
+        lPendingSend.mDeadline = lNow + (static_cast<CFTimeInterval>(GetDelay()) / 1000);
+        lPendingSend.mOffset   = 0;
+
+        if (!lPendingSends.empty())
+        {
+            lPendingSend.mDeadline = std::max(lPendingSend.mDeadline, lPendingSends.back().mDeadline);
+        }
+
+        lPendingSends.push_back(lPendingSend);
+    }
+
+    if (lPendingSends.empty())
+    {
+        mConnections.erase(&aConnection);
+    }
+
+    lRetval = Schedule();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Send the next fragment, or all, of pending data to a client.
+ *
+ *  @param[in]      aConnection   A reference to the connection to send
+ *                                the pending data to.
+ *  @param[in,out]  aPendingSend  A reference to the pending data to
+ *                                send, the offset of which is advanced
+ *                                by the amount sent.
+ *  @param[out]     aOutCompleted A reference to storage set to true if
+ *                                all of the pending data has now been
+ *                                sent; otherwise, false.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If resources for the fragment could not
+ *                            be allocated.
+ *
+ */
+Status
+FaultInjectionController :: Transmit(Server::ConnectionBasis &aConnection, PendingSend &aPendingSend, bool &aOutCompleted)
+{
+    const size_t                             lRemaining = aPendingSend.mData.size() - aPendingSend.mOffset;
+    const size_t                             lSize      = ((mParameters.mFragmentSize > 0) ?
+                                                           std::min(mParameters.mFragmentSize, lRemaining) :
+                                                           lRemaining);
+    ConnectionBuffer::MutableCountedPointer  lBuffer;
+    Status                                   lRetval;
+
+
+    lRetval = ConnectionBuffer::Create(lBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = Common::Utilities::Put(*lBuffer.get(), &aPendingSend.mData[aPendingSend.mOffset], lSize);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    aPendingSend.mOffset += lSize;
+
+    lRetval = aConnection.Send(lBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    aOutCompleted = (aPendingSend.mOffset == aPendingSend.mData.size());
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Arm the timer for the earliest pending data deadline.
+ *
+ *  This restarts the timer to fire at the earliest deadline among
+ *  the data at the head of each client's queue or, if no data is
+ *  pending, stops it.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+FaultInjectionController :: Schedule(void)
+{
+    Connections::const_iterator  lCurrent = mConnections.begin();
+    Connections::const_iterator  lLast    = mConnections.end();
+    bool                         lPending = false;
+    CFAbsoluteTime               lDeadline = 0;
+    Status                       lRetval = kStatus_Success;
+
+
+    while (lCurrent != lLast)
+    {
+        if (!lCurrent->second.empty())
+        {
+            const CFAbsoluteTime &lHeadDeadline = lCurrent->second.front().mDeadline;
+
+            lDeadline = (lPending ? std::min(lDeadline, lHeadDeadline) : lHeadDeadline);
+            lPending  = true;
+        }
+
+        lCurrent++;
+    }
+
+    if (lPending)
+    {
+        const CFTimeInterval lInterval = std::max(0.0, lDeadline - CFAbsoluteTimeGetCurrent());
+        const Timeout        lTimeout(static_cast<Timeout::Value>(ceil(lInterval * 1000)));
+
+        lRetval = mTimer.Start(lTimeout);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+    else
+    {
+        lRetval = mTimer.Stop();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return the delay for the next response.
+ *
+ *  @returns
+ *    The delay for the next response, in milliseconds, drawn uniformly
+ *    from the configured minimum to maximum delay.
+ *
+ */
+uint32_t
+FaultInjectionController :: GetDelay(void)
+{
+    uint32_t lRetval = mParameters.mDelayMinimum;
+
+    if (mParameters.mDelayMaximum > mParameters.mDelayMinimum)
+    {
+        std::uniform_int_distribution<uint32_t> lDistribution(mParameters.mDelayMinimum,
+                                                              mParameters.mDelayMaximum);
+
+        lRetval = lDistribution(mGenerator);
+    }
+
+    return (lRetval);
+}
+
+// MARK: Timer Delegate Method
+
+/**
+ *  @brief
+ *    Delegation from a timer that the timer fired/expired.
+ *
+ *  This sends all pending data whose deadline has passed, one
+ *  fragment at a time when fragmenting, and then rearms the timer
+ *  for the next deadline.
+ *
+ *  @param[in]  aTimer  A reference to the timer that issued the
+ *                      delegation.
+ *
+ */
+void
+FaultInjectionController :: TimerDidFire(Common::Timer &aTimer)
+{
+    const CFAbsoluteTime   lNow     = CFAbsoluteTimeGetCurrent();
+    Connections::iterator  lCurrent = mConnections.begin();
+    Status                 lStatus;
+
+
+    (void)aTimer;
+
+    while (lCurrent != mConnections.end())
+    {
+        PendingSends &lPendingSends = lCurrent->second;
+
+        while (!lPendingSends.empty() && (lPendingSends.front().mDeadline <= lNow))
+        {
+            bool lCompleted;
+
+            lStatus = Transmit(*lCurrent->first, lPendingSends.front(), lCompleted);
+            nlVERIFY_SUCCESS(lStatus);
+
+            if (lCompleted || (lStatus < kStatus_Success))
+            {
+                lPendingSends.pop_front();
+            }
+            else
+            {
+                lPendingSends.front().mDeadline = lNow + (static_cast<CFTimeInterval>(mParameters.mFragmentInterval) / 1000);
+                break;
+            }
+        }
+
+        if (lPendingSends.empty())
+        {
+            lCurrent = mConnections.erase(lCurrent);
+        }
+        else
+        {
+            lCurrent++;
+        }
+    }
+
+    lStatus = Schedule();
+    nlVERIFY_SUCCESS(lStatus);
+}
+
+}; // namespace Simulator
+
+}; // namespace HLX
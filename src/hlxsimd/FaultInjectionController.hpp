@@ -0,0 +1,145 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for injecting latency and faults
+ *      into the responses sent by the HLX server simulator to its
+ *      clients.
+ *
+ */
+
+#ifndef OPENHLXSIMULATORFAULTINJECTIONCONTROLLER_HPP
+#define OPENHLXSIMULATORFAULTINJECTIONCONTROLLER_HPP
+
+#include <deque>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <CoreFoundation/CFDate.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Common/Timer.hpp>
+#include <OpenHLX/Common/TimerDelegate.hpp>
+#include <OpenHLX/Server/ConnectionBasis.hpp>
+#include <OpenHLX/Server/ConnectionManager.hpp>
+
+
+namespace HLX
+{
+
+namespace Simulator
+{
+
+/**
+ *  @brief
+ *    An object for injecting latency and faults into the responses
+ *    sent by the HLX server simulator to its clients.
+ *
+ *  Physical HLX hardware takes tens of milliseconds to respond to
+ *  each command whereas the simulator responds at loopback
+ *  speed. This object, when enabled, interposes on every buffer the
+ *  simulator sends to a client and may delay it, split it into
+ *  fragments sent separately, drop it, or replace it with an error
+ *  response, such that client and proxy pipelining, coalescing, and
+ *  timeout behavior may be exercised without hardware.
+ *
+ *  Buffers sent to any one client are always delivered in the order
+ *  in which they were sent.
+ *
+ *  @ingroup simulator
+ *
+ */
+class FaultInjectionController :
+    public Common::TimerDelegate
+{
+public:
+    /**
+     *  Parameters governing the latency and faults to inject.
+     *
+     */
+    struct Parameters
+    {
+        Parameters(void);
+
+        bool IsEnabled(void) const;
+
+        uint32_t  mDelayMinimum;        //!< The minimum response delay, in milliseconds.
+        uint32_t  mDelayMaximum;        //!< The maximum response delay, in milliseconds.
+        size_t    mFragmentSize;        //!< The maximum response fragment size, in bytes, or zero for no fragmentation.
+        uint32_t  mFragmentInterval;    //!< The interval between response fragments, in milliseconds.
+        double    mDropProbability;     //!< The probability, from zero to one, that a response is dropped.
+        double    mErrorProbability;    //!< The probability, from zero to one, that a response is replaced with an error response.
+        uint32_t  mSeed;                //!< The pseudorandom number generator seed.
+    };
+
+public:
+    FaultInjectionController(void);
+    ~FaultInjectionController(void);
+
+    // Initializer(s)
+
+    Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters,
+                        Server::ConnectionManager &aConnectionManager,
+                        const Parameters &aParameters);
+
+    // Timer Delegate Method
+
+    void TimerDidFire(Common::Timer &aTimer) final;
+
+private:
+    struct PendingSend
+    {
+        CFAbsoluteTime        mDeadline;
+        std::vector<uint8_t>  mData;
+        size_t                mOffset;
+    };
+
+    typedef std::deque<PendingSend>                               PendingSends;
+    typedef std::map<Server::ConnectionBasis *, PendingSends>     Connections;
+
+    static Common::Status SendHandler(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer, void *aContext);
+    static void DisposeHandler(Server::ConnectionBasis &aConnection, void *aContext);
+
+    void ConnectionWillDispose(Server::ConnectionBasis &aConnection);
+
+    Common::Status Send(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer);
+    Common::Status Transmit(Server::ConnectionBasis &aConnection, PendingSend &aPendingSend, bool &aOutCompleted);
+    Common::Status Schedule(void);
+    uint32_t       GetDelay(void);
+
+private:
+    Common::RunLoopParameters    mRunLoopParameters;
+    Server::ConnectionManager *  mConnectionManager;
+    Parameters                   mParameters;
+    Connections                  mConnections;
+    Common::Timer                mTimer;
+    std::mt19937                 mGenerator;
+};
+
+}; // namespace Simulator
+
+}; // namespace HLX
+
+#endif // OPENHLXSIMULATORFAULTINJECTIONCONTROLLER_HPP
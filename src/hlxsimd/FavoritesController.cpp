@@ -26,6 +26,7 @@
 #include "FavoritesController.hpp"
 
 #include <memory>
+#include <string>
 
 #include <errno.h>
 #include <inttypes.h>
@@ -85,6 +86,8 @@ static const FavoriteModelDefaults kFavoriteModelDefaults[10] = {
     { "Favorite Name 10" }
 };
 
+static const char * const kFavoriteNameFormat = "Favorite %hhu";
+
 static CFStringRef      kFavoritesSchemaKey = CFSTR("Favorites");
 static CFStringRef      kNameSchemaKey = CFSTR("Name");
 
@@ -96,7 +99,7 @@ static CFStringRef      kNameSchemaKey = CFSTR("Name");
 FavoritesController :: FavoritesController(void) :
     Common::FavoritesControllerBasis(),
     Server::FavoritesControllerBasis(Common::FavoritesControllerBasis::mFavorites,
-                                     Common::FavoritesControllerBasis::kFavoritesMax),
+                                     Common::FavoritesControllerBasis::sFavoritesMax),
     Simulator::ContainerControllerBasis(),
     Simulator::ObjectControllerBasis()
 {
@@ -188,6 +191,20 @@ done:
 
 // MARK: Configuration Management Methods
 
+void FavoritesController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    Status  lStatus;
+
+
+    (void)aConnection;
+
+    lStatus = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    return;
+}
+
 void FavoritesController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
 {
     Status          lStatus;
@@ -197,7 +214,7 @@ void FavoritesController :: QueryCurrentConfiguration(Server::ConnectionBasis &a
 
     // For each favorite, query the configuration.
 
-    for (auto lFavoriteIdentifier = IdentifierModel::kIdentifierMin; lFavoriteIdentifier <= kFavoritesMax; lFavoriteIdentifier++)
+    for (auto lFavoriteIdentifier = IdentifierModel::kIdentifierMin; lFavoriteIdentifier <= sFavoritesMax; lFavoriteIdentifier++)
     {
         lStatus = HandleQueryReceived(lFavoriteIdentifier, aBuffer);
         nlREQUIRE_SUCCESS(lStatus, done);
@@ -214,12 +231,18 @@ void FavoritesController :: ResetToDefaultConfiguration(void)
     Status           lStatus;
 
 
-    for (lFavoriteIdentifier = IdentifierModel::kIdentifierMin; lFavoriteIdentifier <= kFavoritesMax; lFavoriteIdentifier++)
+    for (lFavoriteIdentifier = IdentifierModel::kIdentifierMin; lFavoriteIdentifier <= sFavoritesMax; lFavoriteIdentifier++)
     {
+        std::string  lName;
+
+        lName = ((lFavoriteIdentifier <= ElementsOf(kFavoriteModelDefaults)) ?
+                 kFavoriteModelDefaults[lFavoriteIdentifier - 1].mName.mName :
+                 Simulator::Utilities::Defaults::GetName(kFavoriteNameFormat, lFavoriteIdentifier));
+
         lStatus = mFavorites.GetFavorite(lFavoriteIdentifier, lFavoriteModel);
         nlREQUIRE_SUCCESS(lStatus, done);
 
-        lStatus = lFavoriteModel->SetName(kFavoriteModelDefaults[lFavoriteIdentifier - 1].mName.mName);
+        lStatus = lFavoriteModel->SetName(lName.c_str());
         nlCHECK_SUCCESS(lStatus);
 
         if (lStatus == kStatus_Success)
@@ -277,7 +300,7 @@ Status FavoritesController :: LoadFromBackupConfiguration(CFDictionaryRef aBacku
     Status lRetval = kStatus_Success;
 
     ContainerControllerBasis::LoadFromBackupConfiguration(aBackupDictionary,
-                                                          kFavoritesMax,
+                                                          sFavoritesMax,
                                                           kFavoritesSchemaKey);
     nlREQUIRE(lRetval >= kStatus_Success, done);
 
@@ -328,7 +351,7 @@ Status FavoritesController :: ElementSaveToBackupConfiguration(CFMutableDictiona
 void FavoritesController :: SaveToBackupConfiguration(CFMutableDictionaryRef aBackupDictionary)
 {
     ContainerControllerBasis::SaveToBackupConfiguration(aBackupDictionary,
-                                                        kFavoritesMax,
+                                                        sFavoritesMax,
                                                         kFavoritesSchemaKey);
 }
 
@@ -358,10 +381,7 @@ void FavoritesController :: QueryRequestReceivedHandler(Server::ConnectionBasis
                                                 lFavoriteIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -377,7 +397,7 @@ void FavoritesController :: QueryRequestReceivedHandler(Server::ConnectionBasis
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -428,10 +448,7 @@ FavoritesController :: SetNameRequestReceivedHandler(Server::ConnectionBasis &aC
     lName = (reinterpret_cast<const char *>(aBuffer) + aMatches.at(2).rm_so);
     lNameSize = Common::Utilities::Distance(aMatches.at(2));
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Get the favorite model associated with the parsed favorite
@@ -460,7 +477,7 @@ FavoritesController :: SetNameRequestReceivedHandler(Server::ConnectionBasis &aC
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -55,6 +55,7 @@
 #include "GroupsController.hpp"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <errno.h>
@@ -131,6 +132,8 @@ static const GroupModelDefaults kGroupModelDefaults[10] = {
     { "Group Name 10" }
 };
 
+static const char * const kGroupNameFormat = "Group Name %hhu";
+
 static CFStringRef      kGroupsSchemaKey = CFSTR("Groups");
 static CFStringRef      kNameSchemaKey   = CFSTR("Name");
 static CFStringRef      kZonesSchemaKey  = CFSTR("Zones");
@@ -144,7 +147,7 @@ static CFStringRef      kZonesSchemaKey  = CFSTR("Zones");
 GroupsController :: GroupsController(void) :
     Common::GroupsControllerBasis(),
     Server::GroupsControllerBasis(Common::GroupsControllerBasis::mGroups,
-                                  Common::GroupsControllerBasis::kGroupsMax),
+                                  Common::GroupsControllerBasis::sGroupsMax),
     Simulator::ContainerControllerBasis(),
     Simulator::ObjectControllerBasis(),
     mDelegate(nullptr)
@@ -327,8 +330,13 @@ Status GroupsController :: HandleAdjustVolumeReceived(const uint8_t *aInputBuffe
     lRetval = mGroups.GetGroup(aGroupIdentifier, lGroupModel);
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    // If the adjustment left the group zones unchanged, for example,
+    // because they were already at the volume limit, the delegate
+    // will have returned kStatus_ValueAlreadySet. The requester
+    // still expects a response; so, one is unconditionally generated.
+
     lRetval = OnAdjustVolume(aGroupIdentifier, *lGroupModel, aAdjustment);
-    nlREQUIRE_SUCCESS(lRetval, done);
+    nlREQUIRE(lRetval >= kStatus_Success, done);
 
     lRetval = HandleAdjustVolumeResponse(aInputBuffer, aInputSize, aOutputBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
@@ -346,8 +354,13 @@ Status GroupsController :: HandleSetVolumeReceived(const IdentifierType &aGroupI
     lRetval = mGroups.GetGroup(aGroupIdentifier, lGroupModel);
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    // If the group zones were already at the requested volume, the
+    // delegate will have returned kStatus_ValueAlreadySet. The
+    // requester still expects a response; so, one is unconditionally
+    // generated.
+
     lRetval = OnSetVolume(aGroupIdentifier, *lGroupModel, aVolume);
-    nlREQUIRE_SUCCESS(lRetval, done);
+    nlREQUIRE(lRetval >= kStatus_Success, done);
 
     lRetval = HandleSetVolumeResponse(aGroupIdentifier, aVolume, aBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
@@ -358,6 +371,21 @@ done:
 
 // MARK: Configuration Management Methods
 
+void
+GroupsController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    Status  lStatus;
+
+
+    (void)aConnection;
+
+    lStatus = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    return;
+}
+
 void
 GroupsController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
 {
@@ -380,14 +408,20 @@ void GroupsController :: ResetToDefaultConfiguration(void)
     Status          lStatus;
 
 
-    for (lGroupIdentifier = IdentifierModel::kIdentifierMin; lGroupIdentifier <= kGroupsMax; lGroupIdentifier++)
+    for (lGroupIdentifier = IdentifierModel::kIdentifierMin; lGroupIdentifier <= sGroupsMax; lGroupIdentifier++)
     {
-        const GroupModelDefaults &lGroupModelDefaults = kGroupModelDefaults[lGroupIdentifier - 1];
+        const size_t              lDefaultsIndex      = Simulator::Utilities::Defaults::GetIndex(lGroupIdentifier, ElementsOf(kGroupModelDefaults));
+        const GroupModelDefaults &lGroupModelDefaults = kGroupModelDefaults[lDefaultsIndex];
+        std::string               lName;
+
+        lName = ((lGroupIdentifier <= ElementsOf(kGroupModelDefaults)) ?
+                 lGroupModelDefaults.mName.mName :
+                 Simulator::Utilities::Defaults::GetName(kGroupNameFormat, lGroupIdentifier));
 
         lStatus = mGroups.GetGroup(lGroupIdentifier, lGroupModel);
         nlREQUIRE_SUCCESS(lStatus, done);
 
-        lStatus = lGroupModel->SetName(lGroupModelDefaults.mName.mName);
+        lStatus = lGroupModel->SetName(lName.c_str());
         nlCHECK_SUCCESS(lStatus);
 
         if (lStatus == kStatus_Success)
@@ -495,7 +529,7 @@ Status GroupsController :: LoadFromBackupConfiguration(CFDictionaryRef aBackupDi
     Status lRetval = kStatus_Success;
 
     ContainerControllerBasis::LoadFromBackupConfiguration(aBackupDictionary,
-                                                          kGroupsMax,
+                                                          sGroupsMax,
                                                           kGroupsSchemaKey);
     nlREQUIRE(lRetval >= kStatus_Success, done);
 
@@ -603,7 +637,7 @@ Status GroupsController :: ElementSaveToBackupConfiguration(CFMutableDictionaryR
 void GroupsController :: SaveToBackupConfiguration(CFMutableDictionaryRef aBackupDictionary)
 {
     ContainerControllerBasis::SaveToBackupConfiguration(aBackupDictionary,
-                                                        kGroupsMax,
+                                                        sGroupsMax,
                                                         kGroupsSchemaKey);
 }
 
@@ -647,10 +681,7 @@ void GroupsController :: AddZoneRequestReceivedHandler(Server::ConnectionBasis &
     lStatus = ZonesController::ValidateIdentifier(lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = mGroups.GetGroup(lGroupIdentifier, lGroupModel);
@@ -670,7 +701,7 @@ void GroupsController :: AddZoneRequestReceivedHandler(Server::ConnectionBasis &
     lBuffer = lAddZoneResponse.GetBuffer();
     lSize = lAddZoneResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -704,13 +735,10 @@ void GroupsController :: ClearZonesRequestReceivedHandler(Server::ConnectionBasi
 
     nlREQUIRE_ACTION(aMatches.size() == Server::Command::Groups::ClearZonesRequest::kExpectedMatches, done, lStatus = kError_BadCommand);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    for (lGroupIdentifier = IdentifierModel::kIdentifierMin; lGroupIdentifier <= kGroupsMax; lGroupIdentifier++)
+    for (lGroupIdentifier = IdentifierModel::kIdentifierMin; lGroupIdentifier <= sGroupsMax; lGroupIdentifier++)
     {
         lStatus = mGroups.GetGroup(lGroupIdentifier, lGroupModel);
         nlREQUIRE_SUCCESS(lStatus, done);
@@ -730,7 +758,7 @@ void GroupsController :: ClearZonesRequestReceivedHandler(Server::ConnectionBasi
     lBuffer = lClearZonesResponse.GetBuffer();
     lSize = lClearZonesResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -790,10 +818,7 @@ void GroupsController :: DecreaseVolumeRequestReceivedHandler(Server::Connection
                                                 lGroupIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleAdjustVolumeReceived(aBuffer, aSize, lGroupIdentifier, kAdjustment, lResponseBuffer);
@@ -856,10 +881,7 @@ void GroupsController :: IncreaseVolumeRequestReceivedHandler(Server::Connection
                                                 lGroupIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleAdjustVolumeReceived(aBuffer, aSize, lGroupIdentifier, kAdjustment, lResponseBuffer);
@@ -930,10 +952,7 @@ void GroupsController :: MuteRequestReceivedHandler(Server::ConnectionBasis &aCo
                                                 lGroupIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleSetMute(lGroupIdentifier, lMute, lResponseBuffer);
@@ -981,10 +1000,7 @@ void GroupsController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aC
     lStatus = lResponse.Init(lGroupIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -997,7 +1013,7 @@ void GroupsController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aC
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -1053,10 +1069,7 @@ void GroupsController :: RemoveZoneRequestReceivedHandler(Server::ConnectionBasi
     lStatus = ZonesController::ValidateIdentifier(lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = mGroups.GetGroup(lGroupIdentifier, lGroupModel);
@@ -1076,7 +1089,7 @@ void GroupsController :: RemoveZoneRequestReceivedHandler(Server::ConnectionBasi
     lBuffer = lRemoveZoneResponse.GetBuffer();
     lSize = lRemoveZoneResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -1126,10 +1139,7 @@ void GroupsController :: SetNameRequestReceivedHandler(Server::ConnectionBasis &
     lName = (reinterpret_cast<const char *>(aBuffer) + aMatches.at(2).rm_so);
     lNameSize = Common::Utilities::Distance(aMatches.at(2));
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Get the group model associated with the parsed group
@@ -1158,7 +1168,7 @@ void GroupsController :: SetNameRequestReceivedHandler(Server::ConnectionBasis &
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -1236,17 +1246,19 @@ void GroupsController :: SetSourceRequestReceivedHandler(Server::ConnectionBasis
     lStatus = SourcesController::ValidateIdentifier(lSourceIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = mGroups.GetGroup(lGroupIdentifier, lGroupModel);
     nlREQUIRE_SUCCESS(lStatus, done);
 
+    // If the group zones were already set to the requested source,
+    // the delegate will have returned kStatus_ValueAlreadySet. The
+    // requester still expects a response; so, one is unconditionally
+    // generated.
+
     lStatus = OnSetSource(lGroupIdentifier, *lGroupModel, lSourceIdentifier);
-    nlREQUIRE_SUCCESS(lStatus, done);
+    nlREQUIRE(lStatus >= kStatus_Success, done);
 
     lStatus = lSourceResponse.Init(lGroupIdentifier, lSourceIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
@@ -1254,7 +1266,7 @@ void GroupsController :: SetSourceRequestReceivedHandler(Server::ConnectionBasis
     lBuffer = lSourceResponse.GetBuffer();
     lSize = lSourceResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -1326,10 +1338,7 @@ void GroupsController :: SetVolumeRequestReceivedHandler(Server::ConnectionBasis
                                       lVolume);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleSetVolumeReceived(lGroupIdentifier, lVolume, lResponseBuffer);
@@ -1392,17 +1401,18 @@ void GroupsController :: ToggleMuteRequestReceivedHandler(Server::ConnectionBasi
                                                 lGroupIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = mGroups.GetGroup(lGroupIdentifier, lGroupModel);
     nlREQUIRE_SUCCESS(lStatus, done);
 
+    // As with the other group requests, kStatus_ValueAlreadySet
+    // from the delegate is not an error and the requester still
+    // expects a response; so, one is unconditionally generated.
+
     lStatus = OnToggleMute(lGroupIdentifier, *lGroupModel);
-    nlREQUIRE_SUCCESS(lStatus, done);
+    nlREQUIRE(lStatus >= kStatus_Success, done);
 
     lStatus = HandleToggleMuteResponse(aBuffer, aSize, lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
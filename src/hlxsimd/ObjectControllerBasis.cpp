@@ -98,6 +98,33 @@ ObjectControllerBasis :: LoadFromBackupConfiguration(CFDictionaryRef aBackupDict
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Query the configuration changed since the specified change
+ *    sequence number.
+ *
+ *  By default, this queries the current configuration in full, which
+ *  is appropriate for controllers without identified objects whose
+ *  changes are tracked.
+ *
+ *  @param[in]      aConnection  A mutable reference to the connection
+ *                               on which the query was received.
+ *  @param[in]      aSequence    An immutable reference to the change
+ *                               sequence number after which changed
+ *                               configuration is to be queried.
+ *  @param[in,out]  aBuffer      A mutable reference to the shared
+ *                               pointer into which the response is to
+ *                               be generated.
+ *
+ */
+void
+ObjectControllerBasis :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    (void)aSequence;
+
+    QueryCurrentConfiguration(aConnection, aBuffer);
+}
+
 void
 ObjectControllerBasis :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
 {
@@ -31,6 +31,7 @@
 #include <OpenHLX/Common/ConnectionBuffer.hpp>
 #include <OpenHLX/Common/Errors.hpp>
 #include <OpenHLX/Common/Timeout.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Server/CommandManager.hpp>
 #include <OpenHLX/Server/ConnectionBasis.hpp>
 
@@ -65,6 +66,7 @@ public:
     // Configuration Management Methods
 
     virtual Common::Status LoadFromBackupConfiguration(CFDictionaryRef aBackupDictionary);
+    virtual void QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
     virtual void QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
     virtual void ResetToDefaultConfiguration(void);
     virtual void SaveToBackupConfiguration(CFMutableDictionaryRef aBackupDictionary);
@@ -25,6 +25,7 @@
 #include "SourcesController.hpp"
 
 #include <memory>
+#include <string>
 
 #include <errno.h>
 #include <inttypes.h>
@@ -82,6 +83,8 @@ static const SourceModelDefaults kSourceModelDefaults[8] = {
     { "Source Name 8" }
 };
 
+static const char * const kSourceNameFormat = "Source Name %hhu";
+
 static CFStringRef      kSourcesSchemaKey = CFSTR("Sources");
 static CFStringRef      kNameSchemaKey = CFSTR("Name");
 
@@ -93,7 +96,7 @@ static CFStringRef      kNameSchemaKey = CFSTR("Name");
 SourcesController :: SourcesController(void) :
     Common::SourcesControllerBasis(),
     Server::SourcesControllerBasis(Common::SourcesControllerBasis::mSources,
-                                   Common::SourcesControllerBasis::kSourcesMax),
+                                   Common::SourcesControllerBasis::sSourcesMax),
     Simulator::ObjectControllerBasis(),
     Simulator::ContainerControllerBasis()
 {
@@ -180,6 +183,21 @@ done:
 
 // MARK: Configuration Management Methods
 
+void
+SourcesController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    Status  lStatus;
+
+
+    (void)aConnection;
+
+    lStatus = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    return;
+}
+
 void
 SourcesController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
 {
@@ -202,12 +220,18 @@ void SourcesController :: ResetToDefaultConfiguration(void)
     Status          lStatus;
 
 
-    for (lSourceIdentifier = IdentifierModel::kIdentifierMin; lSourceIdentifier <= kSourcesMax; lSourceIdentifier++)
+    for (lSourceIdentifier = IdentifierModel::kIdentifierMin; lSourceIdentifier <= sSourcesMax; lSourceIdentifier++)
     {
+        std::string  lName;
+
+        lName = ((lSourceIdentifier <= ElementsOf(kSourceModelDefaults)) ?
+                 kSourceModelDefaults[lSourceIdentifier - 1].mName.mName :
+                 Simulator::Utilities::Defaults::GetName(kSourceNameFormat, lSourceIdentifier));
+
         lStatus = mSources.GetSource(lSourceIdentifier, lSourceModel);
         nlREQUIRE_SUCCESS(lStatus, done);
 
-        lStatus = lSourceModel->SetName(kSourceModelDefaults[lSourceIdentifier - 1].mName.mName);
+        lStatus = lSourceModel->SetName(lName.c_str());
         nlCHECK_SUCCESS(lStatus);
 
         if (lStatus == kStatus_Success)
@@ -265,7 +289,7 @@ Status SourcesController :: LoadFromBackupConfiguration(CFDictionaryRef aBackupD
     Status lRetval = kStatus_Success;
 
     ContainerControllerBasis::LoadFromBackupConfiguration(aBackupDictionary,
-                                                          kSourcesMax,
+                                                          sSourcesMax,
                                                           kSourcesSchemaKey);
     nlREQUIRE(lRetval >= kStatus_Success, done);
 
@@ -316,7 +340,7 @@ Status SourcesController :: ElementSaveToBackupConfiguration(CFMutableDictionary
 void SourcesController :: SaveToBackupConfiguration(CFMutableDictionaryRef aBackupDictionary)
 {
     ContainerControllerBasis::SaveToBackupConfiguration(aBackupDictionary,
-                                                        kSourcesMax,
+                                                        sSourcesMax,
                                                         kSourcesSchemaKey);
 }
 
@@ -354,10 +378,7 @@ void SourcesController :: SetNameRequestReceivedHandler(Server::ConnectionBasis
     lName = (reinterpret_cast<const char *>(aBuffer) + aMatches.at(2).rm_so);
     lNameSize = Common::Utilities::Distance(aMatches.at(2));
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Get the source model associated with the parsed source
@@ -386,7 +407,7 @@ void SourcesController :: SetNameRequestReceivedHandler(Server::ConnectionBasis
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
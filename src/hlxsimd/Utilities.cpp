@@ -24,6 +24,9 @@
 
 #include "Utilities.hpp"
 
+#include <stdio.h>
+
+#include <OpenHLX/Model/NameModel.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
 
@@ -56,6 +59,64 @@ CreateCFString(const uint8_t &aValue)
 
 }; // namespace Configuration
 
+namespace Defaults
+{
+
+/**
+ *  @brief
+ *    Get the default data table index for an object identifier.
+ *
+ *  This returns the index into a default data table of the specified
+ *  number of entries for the specified object identifier. Where the
+ *  simulator has been configured with more objects than there are
+ *  table entries, the table is reused cyclically.
+ *
+ *  @param[in]  aIdentifier      An immutable reference to the object
+ *                               identifier to get the index for.
+ *  @param[in]  aDefaultsCount   An immutable reference to the number
+ *                               of entries in the default data table.
+ *
+ *  @returns
+ *    The default data table index for the identifier.
+ *
+ */
+size_t
+GetIndex(const uint8_t &aIdentifier, const size_t &aDefaultsCount)
+{
+    return (static_cast<size_t>(aIdentifier - 1) % aDefaultsCount);
+}
+
+/**
+ *  @brief
+ *    Format a default object name for an object identifier.
+ *
+ *  This formats a default object name for the specified identifier,
+ *  for objects beyond those with a default data table entry. The
+ *  name is truncated, if necessary, to the maximum name length such
+ *  that it may always be set on the object.
+ *
+ *  @param[in]  aFormat      A pointer to a null-terminated C string
+ *                           format, with a single unsigned 8-bit
+ *                           integer conversion for the identifier.
+ *  @param[in]  aIdentifier  An immutable reference to the object
+ *                           identifier to format the name for.
+ *
+ *  @returns
+ *    The formatted default object name.
+ *
+ */
+std::string
+GetName(const char *aFormat, const uint8_t &aIdentifier)
+{
+    char lBuffer[Model::NameModel::kNameLengthMax + 1];
+
+    snprintf(lBuffer, sizeof (lBuffer), aFormat, aIdentifier);
+
+    return (std::string(lBuffer));
+}
+
+}; // namespace Defaults
+
 }; // namespace Utilities
 
 }; // namespace Simulator
@@ -25,6 +25,9 @@
 #ifndef OPENHLXSIMULATORUTILITIES_HPP
 #define OPENHLXSIMULATORUTILITIES_HPP
 
+#include <string>
+
+#include <stddef.h>
 #include <stdint.h>
 
 #include <CoreFoundation/CFString.h>
@@ -46,6 +49,14 @@ extern CFStringRef CreateCFString(const uint8_t &aValue);
 
 }; // namespace Configuration
 
+namespace Defaults
+{
+
+extern size_t GetIndex(const uint8_t &aIdentifier, const size_t &aDefaultsCount);
+extern std::string GetName(const char *aFormat, const uint8_t &aIdentifier);
+
+}; // namespace Defaults
+
 }; // namespace Utilities
 
 }; // namespace Simulator
@@ -26,6 +26,7 @@
 #include "ZonesController.hpp"
 
 #include <memory>
+#include <string>
 
 #include <errno.h>
 #include <inttypes.h>
@@ -577,6 +578,8 @@ static const ZoneModelDefaults kZoneModelDefaults[24] = {
       kSourceDefault, kMuteDefault, kVolumeDefault, kVolumeFixedDefault }
 };
 
+static const char * const kZoneNameFormat = "Zone Name %hhu";
+
 static CFStringRef kBalanceSchemaKey               = CFSTR("Balance");
 static CFStringRef kBassSchemaKey                  = CFSTR("Bass");
 static CFStringRef kEqualizerLevelsPresetSchemaKey = CFSTR("Equalizer Levels");
@@ -602,7 +605,7 @@ static CFStringRef kZonesSchemaKey                 = CFSTR("Zones");
 ZonesController :: ZonesController(void) :
     Common::ZonesControllerBasis(),
     Server::ZonesControllerBasis(Common::ZonesControllerBasis::mZones,
-                                 Common::ZonesControllerBasis::kZonesMax),
+                                 Common::ZonesControllerBasis::sZonesMax),
     Simulator::ContainerControllerBasis(),
     Simulator::ObjectControllerBasis()
 {
@@ -1006,7 +1009,7 @@ ZonesController :: HandleAdjustBalanceReceived(const Model::ZoneModel::Identifie
     lBuffer = lBalanceResponse.GetBuffer();
     lSize = lBalanceResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1040,7 +1043,7 @@ ZonesController :: HandleSetBalanceReceived(const Model::ZoneModel::IdentifierTy
     lBuffer = lBalanceResponse.GetBuffer();
     lSize = lBalanceResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1056,10 +1059,7 @@ ZonesController :: HandleAdjustBassReceived(Server::ConnectionBasis &aConnection
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // First, ensure that the sound mode is set to tone mode
@@ -1141,10 +1141,7 @@ ZonesController :: HandleAdjustTrebleReceived(Server::ConnectionBasis &aConnecti
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // First, ensure that the sound mode is set to tone mode
@@ -1337,8 +1334,13 @@ ZonesController :: HandleSetVolumeReceived(const Model::ZoneModel::IdentifierTyp
     Status                             lRetval;
 
 
+    // If the volume was unchanged, SetVolume will have returned
+    // kStatus_ValueAlreadySet. Unlike the conditional responses
+    // generated on behalf of other requests, the requester still
+    // expects a response; so, one is unconditionally generated.
+
     lRetval = SetVolume(aZoneIdentifier, aVolume);
-    nlREQUIRE_SUCCESS(lRetval, done);
+    nlREQUIRE(lRetval >= kStatus_Success, done);
 
     lRetval = HandleVolumeResponse(aZoneIdentifier, aVolume, aBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
@@ -1354,10 +1356,7 @@ ZonesController :: HandleAdjustEqualizerBandReceived(Server::ConnectionBasis &aC
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // First, ensure that the sound mode is set to zone equalizer mode
@@ -1463,6 +1462,20 @@ ZonesController :: HandleSetEqualizerBandReceived(const Model::ZoneModel::Identi
 
 // MARK: Configuration Management Methods
 
+void ZonesController :: QueryChangedConfiguration(Server::ConnectionBasis &aConnection, const Model::ChangeSequence::SequenceType &aSequence, ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    Status  lStatus;
+
+
+    (void)aConnection;
+
+    lStatus = HandleQueryChangedReceived(aSequence, aBuffer);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    return;
+}
+
 void ZonesController :: QueryCurrentConfiguration(Server::ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer &aBuffer) const
 {
     static constexpr bool kIsConfiguration = true;
@@ -1486,14 +1499,20 @@ void ZonesController :: ResetToDefaultConfiguration(void)
     Status                              lStatus;
 
 
-    for (auto lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= kZonesMax; lZoneIdentifier++)
+    for (auto lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= sZonesMax; lZoneIdentifier++)
     {
-        const ZoneModelDefaults &lZoneModelDefaults = kZoneModelDefaults[lZoneIdentifier - 1];
+        const size_t             lDefaultsIndex     = Simulator::Utilities::Defaults::GetIndex(lZoneIdentifier, ElementsOf(kZoneModelDefaults));
+        const ZoneModelDefaults &lZoneModelDefaults = kZoneModelDefaults[lDefaultsIndex];
+        std::string              lName;
+
+        lName = ((lZoneIdentifier <= ElementsOf(kZoneModelDefaults)) ?
+                 lZoneModelDefaults.mName.mName :
+                 Simulator::Utilities::Defaults::GetName(kZoneNameFormat, lZoneIdentifier));
 
         lStatus = mZones.GetZone(lZoneIdentifier, lZoneModel);
         nlREQUIRE_SUCCESS(lStatus, done);
 
-        lStatus = lZoneModel->SetName(lZoneModelDefaults.mName.mName);
+        lStatus = lZoneModel->SetName(lName.c_str());
         nlCHECK_SUCCESS(lStatus);
 
         if (lStatus == kStatus_Success)
@@ -1961,7 +1980,7 @@ ZonesController :: LoadFromBackupConfiguration(CFDictionaryRef aBackupDictionary
     Status lRetval = kStatus_Success;
 
     ContainerControllerBasis::LoadFromBackupConfiguration(aBackupDictionary,
-                                                          kZonesMax,
+                                                          sZonesMax,
                                                           kZonesSchemaKey);
     nlREQUIRE(lRetval >= kStatus_Success, done);
 
@@ -2260,7 +2279,7 @@ ZonesController :: ElementSaveToBackupConfiguration(CFMutableDictionaryRef aZone
 void ZonesController :: SaveToBackupConfiguration(CFMutableDictionaryRef aBackupDictionary)
 {
     ContainerControllerBasis::SaveToBackupConfiguration(aBackupDictionary,
-                                                        kZonesMax,
+                                                        sZonesMax,
                                                         kZonesSchemaKey);
 }
 
@@ -2295,10 +2314,7 @@ void ZonesController :: AdjustBalanceRequestReceivedHandler(Server::ConnectionBa
 
     lChannel = *(reinterpret_cast<const char *>(aBuffer) + aMatches.at(2).rm_so);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleAdjustBalanceReceived(lZoneIdentifier, lChannel, lResponseBuffer);
@@ -2534,10 +2550,7 @@ void ZonesController :: DecreaseVolumeRequestReceivedHandler(Server::ConnectionB
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, ensure that the zone is unmuted.
@@ -2591,10 +2604,7 @@ void ZonesController :: IncreaseVolumeRequestReceivedHandler(Server::ConnectionB
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, ensure that the zone is unmuted.
@@ -2653,10 +2663,7 @@ void ZonesController :: MuteRequestReceivedHandler(Server::ConnectionBasis &aCon
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleSetMuteUnconditionally(lZoneIdentifier, lMute, lResponseBuffer);
@@ -2705,10 +2712,7 @@ void ZonesController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aCo
     lStatus = lResponse.Init(lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion, indicating that
@@ -2723,7 +2727,7 @@ void ZonesController :: QueryRequestReceivedHandler(Server::ConnectionBasis &aCo
     lBuffer = lResponse.GetBuffer();
     lSize = lResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -2762,10 +2766,7 @@ void ZonesController :: QueryMuteRequestReceivedHandler(Server::ConnectionBasis
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -2809,10 +2810,7 @@ void ZonesController :: QuerySourceRequestReceivedHandler(Server::ConnectionBasi
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -2856,10 +2854,7 @@ void ZonesController :: QueryVolumeRequestReceivedHandler(Server::ConnectionBasi
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, put the solicited notifications portion.
@@ -2922,10 +2917,7 @@ void ZonesController :: SetBalanceRequestReceivedHandler(Server::ConnectionBasis
                                       lBalance);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Adjust the balance from the HLX's L:{80, 0} to {0, 80}:R tagged
@@ -2998,10 +2990,7 @@ void ZonesController :: SetEqualizerBandRequestReceivedHandler(Server::Connectio
                                       lBandLevel);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, ensure that the sound mode is set to zone equalizer mode
@@ -3067,10 +3056,7 @@ void ZonesController :: SetEqualizerPresetRequestReceivedHandler(Server::Connect
     lStatus = EqualizerPresetsController::ValidateIdentifier(lEqualizerPresetIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = mZones.GetZone(lZoneIdentifier, lZoneModel);
@@ -3145,10 +3131,7 @@ void ZonesController :: SetHighpassCrossoverRequestReceivedHandler(Server::Conne
                                       lHighpassFrequency);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, ensure that the sound mode is set to highpass crossover mode
@@ -3223,10 +3206,7 @@ void ZonesController :: SetLowpassCrossoverRequestReceivedHandler(Server::Connec
                                       lLowpassFrequency);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, ensure that the sound mode is set to lowpass crossover mode
@@ -3300,10 +3280,7 @@ void ZonesController :: SetNameRequestReceivedHandler(Server::ConnectionBasis &a
     lName = (reinterpret_cast<const char *>(aBuffer) + aMatches.at(2).rm_so);
     lNameSize = Common::Utilities::Distance(aMatches.at(2));
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // Get the zone model associated with the parsed zone
@@ -3332,7 +3309,7 @@ void ZonesController :: SetNameRequestReceivedHandler(Server::ConnectionBasis &a
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -3382,10 +3359,7 @@ void ZonesController :: SetSoundModeRequestReceivedHandler(Server::ConnectionBas
                                       lSoundMode);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = HandleSetSoundModeUnconditionally(lZoneIdentifier, lSoundMode, lResponseBuffer);
@@ -3443,10 +3417,7 @@ void ZonesController :: SetSourceRequestReceivedHandler(Server::ConnectionBasis
     lStatus = SourcesController::ValidateIdentifier(lSourceIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = SetSource(lZoneIdentifier, lSourceIdentifier);
@@ -3458,7 +3429,7 @@ void ZonesController :: SetSourceRequestReceivedHandler(Server::ConnectionBasis
     lBuffer = lSourceResponse.GetBuffer();
     lSize = lSourceResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -3503,13 +3474,10 @@ void ZonesController :: SetSourceAllRequestReceivedHandler(Server::ConnectionBas
     lStatus = SourcesController::ValidateIdentifier(lSourceIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    for (lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= kZonesMax; lZoneIdentifier++)
+    for (lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= sZonesMax; lZoneIdentifier++)
     {
         lStatus = SetSource(lZoneIdentifier, lSourceIdentifier);
         nlREQUIRE(lStatus >= kStatus_Success, done);
@@ -3521,7 +3489,7 @@ void ZonesController :: SetSourceAllRequestReceivedHandler(Server::ConnectionBas
     lBuffer = lSourceAllResponse.GetBuffer();
     lSize = lSourceAllResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -3583,10 +3551,7 @@ void ZonesController :: SetToneRequestReceivedHandler(Server::ConnectionBasis &a
                                       lTreble);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, ensure that the sound mode is set to tone mode
@@ -3661,10 +3626,7 @@ void ZonesController :: SetVolumeRequestReceivedHandler(Server::ConnectionBasis
                                       lVolume);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     // First, ensure that the zone is unmuted.
@@ -3721,13 +3683,10 @@ void ZonesController :: SetVolumeAllRequestReceivedHandler(Server::ConnectionBas
                                       lVolume);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    for (lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= kZonesMax; lZoneIdentifier++)
+    for (lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= sZonesMax; lZoneIdentifier++)
     {
         // First, ensure that the zone is unmuted.
         //
@@ -3749,7 +3708,7 @@ void ZonesController :: SetVolumeAllRequestReceivedHandler(Server::ConnectionBas
     lBuffer = lVolumeAllResponse.GetBuffer();
     lSize = lVolumeAllResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*lResponseBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*lResponseBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -3800,10 +3759,7 @@ void ZonesController :: SetVolumeFixedRequestReceivedHandler(Server::ConnectionB
                                       lLocked);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = mZones.GetZone(lZoneIdentifier, lZoneModel);
@@ -3857,10 +3813,7 @@ void ZonesController :: ToggleMuteRequestReceivedHandler(Server::ConnectionBasis
                                                 lZoneIdentifier);
     nlREQUIRE_SUCCESS(lStatus, done);
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lStatus = -ENOMEM);
-
-    lStatus = lResponseBuffer->Init();
+    lStatus = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lStatus, done);
 
     lStatus = ToggleMute(lZoneIdentifier, lMute);
@@ -59,15 +59,22 @@
 
 #include <OpenHLX/Common/ConnectionBuffer.hpp>
 #include <OpenHLX/Common/ConnectionManagerBasis.hpp>
+#include <OpenHLX/Common/EqualizerPresetsControllerBasis.hpp>
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/FavoritesControllerBasis.hpp>
+#include <OpenHLX/Common/GroupsControllerBasis.hpp>
 #include <OpenHLX/Common/RegularExpression.hpp>
 #include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Common/SourcesControllerBasis.hpp>
 #include <OpenHLX/Common/Version.hpp>
+#include <OpenHLX/Common/ZonesControllerBasis.hpp>
 #include <OpenHLX/Model/IdentifierModel.hpp>
 #include <OpenHLX/Server/ConnectionBasisDelegate.hpp>
+#include <OpenHLX/Server/ConnectionManager.hpp>
 #include <OpenHLX/Server/ConnectionTelnet.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 #include <OpenHLX/Utilities/ElementsOf.hpp>
+#include <OpenHLX/Utilities/Parse.hpp>
 #include <OpenHLX/Utilities/Utilities.hpp>
 
 #include "ApplicationController.hpp"
@@ -99,6 +106,18 @@ using namespace std;
 #define OPT_VERSION                  'V'
 
 #define OPT_CONFIGURATION_FILE       (OPT_BASE +  1)
+#define OPT_EQUALIZER_PRESETS        (OPT_BASE +  2)
+#define OPT_FAVORITES                (OPT_BASE +  3)
+#define OPT_GROUPS                   (OPT_BASE +  4)
+#define OPT_SOURCES                  (OPT_BASE +  5)
+#define OPT_ZONES                    (OPT_BASE +  6)
+#define OPT_FAULT_SEED               (OPT_BASE +  7)
+#define OPT_RESPONSE_DELAY           (OPT_BASE +  8)
+#define OPT_RESPONSE_DROP            (OPT_BASE +  9)
+#define OPT_RESPONSE_ERROR           (OPT_BASE + 10)
+#define OPT_RESPONSE_FRAGMENT        (OPT_BASE + 11)
+#define OPT_FRAGMENT_INTERVAL        (OPT_BASE + 12)
+#define OPT_IO_WORKERS               (OPT_BASE + 13)
 
 // Type Declarations
 
@@ -113,6 +132,8 @@ enum OptFlags {
 
 class HLXSimulator;
 
+typedef Status (*LimitSetter)(const IdentifierModel::IdentifierType &aLimit);
+
 // Function Prototypes
 
 // Global Variables
@@ -126,19 +147,33 @@ static const char *         sProgram             = nullptr;
 
 static const char *         sConfigurationFile   = HLXSIMD_DEFAULT_CONFIG_PATH;
 
+static FaultInjectionController::Parameters sFaultInjectionParameters;
+
 static HLXSimulator *       sHLXSimulator        = nullptr;
 
 static const struct option  sOptions[] = {
-    { "configuration-file",      required_argument,  nullptr,   OPT_CONFIGURATION_FILE     },
-    { "debug",                   optional_argument,  nullptr,   OPT_DEBUG                   },
-    { "help",                    no_argument,        nullptr,   OPT_HELP                    },
-    { "ipv4-only",               no_argument,        nullptr,   OPT_IPV4_ONLY               },
-    { "ipv6-only",               no_argument,        nullptr,   OPT_IPV6_ONLY               },
-    { "quiet",                   no_argument,        nullptr,   OPT_QUIET                   },
-    { "verbose",                 optional_argument,  nullptr,   OPT_VERBOSE                 },
-    { "version",                 no_argument,        nullptr,   OPT_VERSION                 },
-
-    { nullptr,                   0,                  nullptr,   0                           }
+    { "configuration-file",          required_argument,  nullptr,   OPT_CONFIGURATION_FILE      },
+    { "debug",                       optional_argument,  nullptr,   OPT_DEBUG                   },
+    { "equalizer-presets",           required_argument,  nullptr,   OPT_EQUALIZER_PRESETS       },
+    { "fault-seed",                  required_argument,  nullptr,   OPT_FAULT_SEED              },
+    { "favorites",                   required_argument,  nullptr,   OPT_FAVORITES               },
+    { "groups",                      required_argument,  nullptr,   OPT_GROUPS                  },
+    { "help",                        no_argument,        nullptr,   OPT_HELP                    },
+    { "io-workers",                  required_argument,  nullptr,   OPT_IO_WORKERS              },
+    { "ipv4-only",                   no_argument,        nullptr,   OPT_IPV4_ONLY               },
+    { "ipv6-only",                   no_argument,        nullptr,   OPT_IPV6_ONLY               },
+    { "quiet",                       no_argument,        nullptr,   OPT_QUIET                   },
+    { "response-delay",              required_argument,  nullptr,   OPT_RESPONSE_DELAY          },
+    { "response-drop",               required_argument,  nullptr,   OPT_RESPONSE_DROP           },
+    { "response-error",              required_argument,  nullptr,   OPT_RESPONSE_ERROR          },
+    { "response-fragment",           required_argument,  nullptr,   OPT_RESPONSE_FRAGMENT       },
+    { "response-fragment-interval",  required_argument,  nullptr,   OPT_FRAGMENT_INTERVAL       },
+    { "sources",                     required_argument,  nullptr,   OPT_SOURCES                 },
+    { "verbose",                     optional_argument,  nullptr,   OPT_VERBOSE                 },
+    { "version",                     no_argument,        nullptr,   OPT_VERSION                 },
+    { "zones",                       required_argument,  nullptr,   OPT_ZONES                   },
+
+    { nullptr,                       0,                  nullptr,   0                           }
 };
 
 static const char * const   sShortUsageString =
@@ -167,6 +202,38 @@ static const char * const   sLongUsageString =
 "  -6, --ipv6-only             Force hlxsimd to use IPv6 addresses only.\n"
 "  --configuration-file=FILE   Use file FILE as the configuration backing store\n"
 "                              (default: " HLXSIMD_DEFAULT_CONFIG_PATH ").\n"
+"  --io-workers=COUNT          Shard client connection input and output\n"
+"                              across COUNT worker threads, from 0 to 64\n"
+"                              (default: 0, on the main thread).\n"
+"\n"
+" Scale Options:\n"
+"\n"
+"  --equalizer-presets=COUNT   Simulate COUNT equalizer presets (default: 10).\n"
+"  --favorites=COUNT           Simulate COUNT favorites (default: 10).\n"
+"  --groups=COUNT              Simulate COUNT groups (default: 10).\n"
+"  --sources=COUNT             Simulate COUNT sources (default: 8).\n"
+"  --zones=COUNT               Simulate COUNT zones (default: 24).\n"
+"\n"
+"                              COUNT may range from 1 to 254. Since a backup\n"
+"                              configuration of a different size is reset to\n"
+"                              defaults, consider using a distinct\n"
+"                              --configuration-file when scaling.\n"
+"\n"
+" Fault Injection Options:\n"
+"\n"
+"  --fault-seed=SEED           Seed the fault injection pseudorandom number\n"
+"                              generator with SEED (default: 1).\n"
+"  --response-delay=MS[-MAX]   Delay each response by MS milliseconds or, if\n"
+"                              MAX is specified, by a uniformly-distributed\n"
+"                              MS to MAX milliseconds (default: 0).\n"
+"  --response-drop=PERCENT     Drop PERCENT percent of responses (default: 0).\n"
+"  --response-error=PERCENT    Replace PERCENT percent of responses with an\n"
+"                              error response (default: 0).\n"
+"  --response-fragment=BYTES   Send each response in separate writes of at\n"
+"                              most BYTES bytes (default: 0, unfragmented).\n"
+"  --response-fragment-interval=MS\n"
+"                              Wait MS milliseconds between response\n"
+"                              fragments (default: 1).\n"
 "\n";
 
 /**
@@ -262,7 +329,7 @@ Status HLXSimulator :: Init(void)
     lRetval = mRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    lRetval = mHLXSimulatorController.Init(mRunLoopParameters, sConfigurationFile);
+    lRetval = mHLXSimulatorController.Init(mRunLoopParameters, sConfigurationFile, sFaultInjectionParameters);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     lRetval = mHLXSimulatorController.SetDelegate(this);
@@ -557,6 +624,240 @@ SetLevel(Log::Level &inLevel, const char *inArgument)
     return (errors);
 }
 
+/*
+ *  unsigned int SetLimit()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    simulated object count and, if successful, sets that count as
+ *    the maximum for the object type with the specified setter.
+ *
+ *  Input(s):
+ *    inName     - A pointer to a NULL-terminated C string naming the
+ *                 object type, for diagnostic output.
+ *    inSetter   - The setter for the maximum number of objects of the
+ *                 type.
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetLimit(const char *inName, LimitSetter inSetter, const char *inArgument)
+{
+    IdentifierModel::IdentifierType limit;
+    unsigned int                    errors = 0;
+    Status                          status;
+
+    status = Parse(inArgument, limit);
+
+    if (status == kStatus_Success) {
+        status = inSetter(limit);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid %s count `%s'; please specify a count "
+                           "from %u to %u.\n",
+                           inName,
+                           inArgument,
+                           IdentifierModel::kIdentifierMin,
+                           IdentifierModel::kIdentifierMax);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetCount()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as an
+ *    unsigned count and, if successful, sets it.
+ *
+ *  Input(s):
+ *    inName     - A pointer to a NULL-terminated C string naming the
+ *                 count, for diagnostic output.
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    outCount   - A reference to the parsed count.
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetCount(const char *inName, uint32_t &outCount, const char *inArgument)
+{
+    unsigned int errors = 0;
+    Status       status;
+
+    status = Parse(inArgument, outCount);
+
+    if (status != kStatus_Success) {
+        Log::Error().Write("Invalid %s `%s'.\n", inName, inArgument);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetWorkers()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    connection input and output worker count and, if successful,
+ *    sets it.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the count to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetWorkers(const char *inArgument)
+{
+    uint32_t     workers;
+    unsigned int errors = 0;
+    Status       status;
+
+    status = Parse(inArgument, workers);
+
+    if (status == kStatus_Success) {
+        status = Server::ConnectionManager::SetWorkers(workers);
+    }
+
+    if (status < kStatus_Success) {
+        Log::Error().Write("Invalid I/O worker count `%s'; please specify a "
+                           "count from 0 to 64.\n",
+                           inArgument);
+        errors++;
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetDelay()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as either
+ *    a fixed response delay, "MS", or a uniformly-distributed response
+ *    delay range, "MIN-MAX", in milliseconds and, if successful, sets
+ *    it.
+ *
+ *  Input(s):
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the delay to parse and set if valid.
+ *
+ *  Output(s):
+ *    N/A
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetDelay(const char *inArgument)
+{
+    const char *   separator = strchr(inArgument, '-');
+    uint32_t       minimum;
+    uint32_t       maximum;
+    unsigned int   errors = 0;
+    Status         status;
+
+    if (separator == nullptr) {
+        status = Parse(inArgument, minimum);
+
+        maximum = minimum;
+
+    } else {
+        status = Parse(inArgument, static_cast<size_t>(separator - inArgument), minimum);
+
+        if (status == kStatus_Success) {
+            status = Parse(separator + 1, maximum);
+        }
+
+    }
+
+    if ((status != kStatus_Success) || (minimum > maximum)) {
+        Log::Error().Write("Invalid response delay `%s'; please specify a "
+                           "delay in milliseconds, MS, or a range, MIN-MAX.\n",
+                           inArgument);
+        errors++;
+
+    } else {
+        sFaultInjectionParameters.mDelayMinimum = minimum;
+        sFaultInjectionParameters.mDelayMaximum = maximum;
+
+    }
+
+    return (errors);
+}
+
+/*
+ *  unsigned int SetPercentage()
+ *
+ *  Description:
+ *    This routine attempts to parse the specified argument as a
+ *    percentage from 0 to 100 and, if successful, sets it as a
+ *    probability from 0 to 1.
+ *
+ *  Input(s):
+ *    inName     - A pointer to a NULL-terminated C string naming the
+ *                 percentage, for diagnostic output.
+ *    inArgument - A pointer to a NULL-terminated C string
+ *                 representing the percentage to parse and set if
+ *                 valid.
+ *
+ *  Output(s):
+ *    outProbability - A reference to the parsed probability.
+ *
+ *  Returns:
+ *    Zero (0) if OK; otherwise, the number of errors encountered.
+ *
+ */
+static unsigned int
+SetPercentage(const char *inName, double &outProbability, const char *inArgument)
+{
+    char *        end;
+    double        percentage;
+    unsigned int  errors = 0;
+
+    errno = 0;
+
+    percentage = strtod(inArgument, &end);
+
+    if ((end == inArgument) || (*end != '\0') || (errno == ERANGE) ||
+        (percentage < 0.0) || (percentage > 100.0)) {
+        Log::Error().Write("Invalid %s percentage `%s'; please specify a "
+                           "percentage from 0 to 100.\n",
+                           inName,
+                           inArgument);
+        errors++;
+
+    } else {
+        outProbability = percentage / 100.0;
+
+    }
+
+    return (errors);
+}
+
 /*
  *  void PrintUsage()
  *
@@ -670,10 +971,34 @@ DecodeOptions(const char *inProgram,
             error += SetLevel(sDebug, optarg);
             break;
 
+        case OPT_EQUALIZER_PRESETS:
+            error += SetLimit("equalizer preset", Common::EqualizerPresetsControllerBasis::SetEqualizerPresetsMax, optarg);
+            break;
+
+        case OPT_FAULT_SEED:
+            error += SetCount("fault seed", sFaultInjectionParameters.mSeed, optarg);
+            break;
+
+        case OPT_FAVORITES:
+            error += SetLimit("favorite", Common::FavoritesControllerBasis::SetFavoritesMax, optarg);
+            break;
+
+        case OPT_FRAGMENT_INTERVAL:
+            error += SetCount("response fragment interval", sFaultInjectionParameters.mFragmentInterval, optarg);
+            break;
+
+        case OPT_GROUPS:
+            error += SetLimit("group", Common::GroupsControllerBasis::SetGroupsMax, optarg);
+            break;
+
         case OPT_HELP:
             PrintUsage(inProgram, EXIT_SUCCESS);
             break;
 
+        case OPT_IO_WORKERS:
+            error += SetWorkers(optarg);
+            break;
+
         case OPT_IPV4_ONLY:
             if (sOptFlags & kOptIPv6Only)
             {
@@ -702,6 +1027,32 @@ DecodeOptions(const char *inProgram,
             sOptFlags |= kOptQuiet;
             break;
 
+        case OPT_RESPONSE_DELAY:
+            error += SetDelay(optarg);
+            break;
+
+        case OPT_RESPONSE_DROP:
+            error += SetPercentage("response drop", sFaultInjectionParameters.mDropProbability, optarg);
+            break;
+
+        case OPT_RESPONSE_ERROR:
+            error += SetPercentage("response error", sFaultInjectionParameters.mErrorProbability, optarg);
+            break;
+
+        case OPT_RESPONSE_FRAGMENT:
+            {
+                uint32_t size;
+
+                error += SetCount("response fragment size", size, optarg);
+
+                sFaultInjectionParameters.mFragmentSize = size;
+            }
+            break;
+
+        case OPT_SOURCES:
+            error += SetLimit("source", Common::SourcesControllerBasis::SetSourcesMax, optarg);
+            break;
+
         case OPT_SYSLOG:
             sOptFlags |= kOptSyslog;
             break;
@@ -714,6 +1065,10 @@ DecodeOptions(const char *inProgram,
             PrintVersion(inProgram);
             break;
 
+        case OPT_ZONES:
+            error += SetLimit("zone", Common::ZonesControllerBasis::SetZonesMax, optarg);
+            break;
+
         default:
             Log::Error().Write("Unknown option '%d'!\n", optopt);
             error++;
@@ -726,6 +1081,13 @@ DecodeOptions(const char *inProgram,
     // any further handling of arguments is likely to fail due to bad
     // user input.
 
+    if ((sFaultInjectionParameters.mDropProbability +
+         sFaultInjectionParameters.mErrorProbability) > 1.0) {
+        Log::Error().Write("The response drop and error percentages may not "
+                           "exceed 100 percent combined.\n");
+        error++;
+    }
+
     if (error) {
         goto exit;
     }
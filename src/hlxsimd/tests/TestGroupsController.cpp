@@ -0,0 +1,205 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the responses of
+ *      HLX::Simulator::GroupsController to requests that leave the
+ *      group state unchanged.
+ *
+ */
+
+#include <string>
+
+#include <string.h>
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Server/CommandManager.hpp>
+#include <OpenHLX/Server/ConnectionBasis.hpp>
+#include <OpenHLX/Server/ConnectionManager.hpp>
+
+#include <GroupsController.hpp>
+#include <GroupsControllerDelegate.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+using namespace HLX::Model;
+using namespace HLX::Server;
+using namespace HLX::Simulator;
+
+
+/**
+ *  A server connection that records what is sent to it rather than
+ *  sending it to a peer.
+ *
+ */
+class TestConnection :
+    public Server::ConnectionBasis
+{
+public:
+    TestConnection(void) :
+        Server::ConnectionBasis(CFSTR("test"))
+    {
+        return;
+    }
+
+    Status Send(ConnectionBuffer::ImmutableCountedPointer aBuffer) final
+    {
+        for (; aBuffer; aBuffer = aBuffer->GetNext())
+        {
+            mSent.append(reinterpret_cast<const char *>(aBuffer->GetHead()), aBuffer->GetSize());
+        }
+
+        return (kStatus_Success);
+    }
+
+    std::string  mSent;
+
+private:
+    size_t ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize) final
+    {
+        (void)aBuffer;
+
+        return (aSize);
+    }
+};
+
+/**
+ *  A groups controller delegate that reports every request as having
+ *  left the state of the group zones unchanged, as the simulator
+ *  application controller does when every zone in the group already
+ *  has the requested value.
+ *
+ */
+class TestGroupsControllerDelegate :
+    public GroupsControllerDelegate
+{
+public:
+    Status ShouldAdjustVolume(GroupsController &, const GroupModel::IdentifierType &, const GroupModel &, const VolumeModel::LevelType &) final { return (kStatus_ValueAlreadySet); }
+    Status ShouldSetMute(GroupsController &, const GroupModel::IdentifierType &, const GroupModel &, const VolumeModel::MuteType &) final { return (kStatus_ValueAlreadySet); }
+    Status ShouldSetSource(GroupsController &, const GroupModel::IdentifierType &, const GroupModel &, const SourceModel::IdentifierType &) final { return (kStatus_ValueAlreadySet); }
+    Status ShouldSetVolume(GroupsController &, const GroupModel::IdentifierType &, const GroupModel &, const VolumeModel::LevelType &) final { return (kStatus_ValueAlreadySet); }
+    Status ShouldToggleMute(GroupsController &, const GroupModel::IdentifierType &, const GroupModel &) final { return (kStatus_ValueAlreadySet); }
+};
+
+static std::string Request(nlTestSuite *inSuite, CommandManager &aCommandManager, ConnectionManager &aConnectionManager, TestConnection &aConnection, const char *aRequest)
+{
+    ConnectionBuffer::MutableCountedPointer  lBuffer;
+    Status                                   lStatus;
+
+
+    aConnection.mSent.clear();
+
+    lStatus = ConnectionBuffer::Create(lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = Common::Utilities::Put(*lBuffer.get(), reinterpret_cast<const uint8_t *>(aRequest), strlen(aRequest));
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    aCommandManager.ConnectionManagerDidReceiveApplicationData(aConnectionManager, aConnection, lBuffer);
+
+    return (aConnection.mSent);
+}
+
+static void TestUnchanged(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters             lRunLoopParameters;
+    ConnectionManager             lConnectionManager;
+    CommandManager                lCommandManager;
+    GroupsController              lGroupsController;
+    TestGroupsControllerDelegate  lDelegate;
+    TestConnection                lConnection;
+    Status                        lStatus;
+
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lConnectionManager.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lCommandManager.Init(lConnectionManager, lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lGroupsController.Init(lCommandManager);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lGroupsController.SetDelegate(&lDelegate);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lGroupsController.ResetToDefaultConfiguration();
+
+    // Each request that leaves the group unchanged is responded to
+    // just as one that changes it rather than being left unanswered.
+
+    // Test 1: Set volume
+
+    NL_TEST_ASSERT(inSuite, Request(inSuite, lCommandManager, lConnectionManager, lConnection, "[VG1R-20]") == "(VG1R-20)\r\n");
+
+    // Test 2: Adjust (increase) volume
+
+    NL_TEST_ASSERT(inSuite, Request(inSuite, lCommandManager, lConnectionManager, lConnection, "[VG1U]") == "(VG1U)\r\n");
+
+    // Test 3: Set source
+
+    NL_TEST_ASSERT(inSuite, Request(inSuite, lCommandManager, lConnectionManager, lConnection, "[CG1I2]") == "(CG1I2)\r\n");
+
+    // Test 4: Toggle mute
+
+    NL_TEST_ASSERT(inSuite, Request(inSuite, lCommandManager, lConnectionManager, lConnection, "[VMTG1]") == "(VMTG1)\r\n");
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Unchanged", TestUnchanged),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Simulator Groups Controller",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
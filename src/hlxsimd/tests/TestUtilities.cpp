@@ -0,0 +1,121 @@
+/*
+ *    Copyright (c) 2021 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the HLX server simulator
+ *      default data utilities.
+ *
+ */
+
+#include <string>
+
+#include <limits.h>
+#include <stdint.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Model/NameModel.hpp>
+
+#include "Utilities.hpp"
+
+
+using namespace HLX::Common;
+using namespace HLX::Model;
+using namespace HLX::Simulator::Utilities::Defaults;
+
+
+static void TestGetIndex(nlTestSuite *inSuite,
+                         void *inContext __attribute__((unused)))
+{
+    // Identifiers within the defaults table map directly to it.
+
+    NL_TEST_ASSERT(inSuite, GetIndex(1, 10) == 0);
+    NL_TEST_ASSERT(inSuite, GetIndex(10, 10) == 9);
+
+    // Identifiers beyond the defaults table reuse it cyclically.
+
+    NL_TEST_ASSERT(inSuite, GetIndex(11, 10) == 0);
+    NL_TEST_ASSERT(inSuite, GetIndex(UINT8_MAX, 10) == 4);
+}
+
+static void TestGetNameUpperLimit(nlTestSuite *inSuite,
+                                  void *inContext __attribute__((unused)))
+{
+    NameModel    lNameModel;
+    std::string  lName;
+    Status       lStatus;
+
+    lStatus = lNameModel.Init();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // The favorite name format, at the largest identifier, formats
+    // in full and may be set.
+
+    lName = GetName("Favorite %hhu", UINT8_MAX);
+    NL_TEST_ASSERT(inSuite, lName == "Favorite 255");
+
+    lStatus = lNameModel.SetName(lName.c_str());
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // A format too long for the largest identifiers is truncated to
+    // the maximum name length and may still be set, rather than
+    // failing to be set.
+
+    lName = GetName("Favorite Name %hhu", UINT8_MAX);
+    NL_TEST_ASSERT(inSuite, lName.size() == NameModel::kNameLengthMax);
+    NL_TEST_ASSERT(inSuite, lName == "Favorite Name 25");
+
+    lStatus = lNameModel.SetName(lName.c_str());
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Get Index",             TestGetIndex),
+    NL_TEST_DEF("Get Name Upper Limit",  TestGetNameUpperLimit),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Simulator Utilities",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
@@ -268,6 +268,147 @@ done:
     return (lRetval);
 }
 
+// MARK: Refresh
+
+/**
+ *  @brief
+ *    Refresh the state of the client controller, restricted to the
+ *    specified scope.
+ *
+ *  Unlike a full refresh, which obtains the state of every object
+ *  from the peer server, this obtains only the state in the
+ *  specified scope, such that a client that observes or mutates only
+ *  a few objects need not wait on and pay for the exchanges for all
+ *  others. The refresh delegate is signalled as for a full refresh,
+ *  including when the scope is empty.
+ *
+ *  Because a scoped refresh may leave zone state incomplete, group
+ *  state is not derived from zone state on its completion or on
+ *  subsequent zone state changes until a full refresh completes.
+ *
+ *  @param[in]  aRefreshScope  An immutable reference to the scope to
+ *                             which the refresh is restricted.
+ *
+ *  @retval  kStatus_Success              If successful.
+ *  @retval  -ERANGE                      If an equalizer preset, group,
+ *                                        or zone identifier in the
+ *                                        scope is larger than supported.
+ *  @retval  -ENOMEM                      If memory could not be allocated
+ *                                        by a controller to perform the
+ *                                        refresh.
+ *
+ */
+Status
+Controller :: Refresh(const RefreshScope &aRefreshScope)
+{
+    const size_t  lControllerCount = aRefreshScope.GetControllerCount();
+    Status        lRetval = kStatus_Success;
+
+
+    WillRefresh(lControllerCount);
+
+    if (lControllerCount == 0)
+    {
+        DidRefresh();
+        goto done;
+    }
+
+    // Source names are only available from the configuration, so a
+    // refresh of the sources is a refresh of the configuration.
+
+    if (aRefreshScope.mSources)
+    {
+        lRetval = static_cast<Client::ObjectControllerBasis &>(mConfigurationController).Refresh();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    if (aRefreshScope.mZones)
+    {
+        lRetval = static_cast<Client::ObjectControllerBasis &>(mZonesController).Refresh();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+    else if (aRefreshScope.mZone != IdentifierModel::kIdentifierInvalid)
+    {
+        lRetval = mZonesController.Refresh(aRefreshScope.mZone);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    if (aRefreshScope.mGroups)
+    {
+        lRetval = static_cast<Client::ObjectControllerBasis &>(mGroupsController).Refresh();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+    else if (aRefreshScope.mGroup != IdentifierModel::kIdentifierInvalid)
+    {
+        lRetval = mGroupsController.Refresh(aRefreshScope.mGroup);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    if (aRefreshScope.mEqualizerPresets)
+    {
+        lRetval = static_cast<Client::ObjectControllerBasis &>(mEqualizerPresetsController).Refresh();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+    else if (aRefreshScope.mEqualizerPreset != IdentifierModel::kIdentifierInvalid)
+    {
+        lRetval = mEqualizerPresetsController.Refresh(aRefreshScope.mEqualizerPreset);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Refresh Scope
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ *  This constructs an empty refresh scope.
+ *
+ */
+Controller :: RefreshScope :: RefreshScope(void) :
+    mEqualizerPresets(false),
+    mEqualizerPreset(IdentifierModel::kIdentifierInvalid),
+    mGroups(false),
+    mGroup(IdentifierModel::kIdentifierInvalid),
+    mSources(false),
+    mZones(false),
+    mZone(IdentifierModel::kIdentifierInvalid)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Return the number of sub-controllers the scope involves.
+ *
+ *  @returns
+ *    The number of sub-controllers that must be refreshed to refresh
+ *    the state in the scope.
+ *
+ */
+size_t
+Controller :: RefreshScope :: GetControllerCount(void) const
+{
+    size_t lRetval = 0;
+
+    if (mEqualizerPresets || (mEqualizerPreset != IdentifierModel::kIdentifierInvalid))
+        lRetval++;
+
+    if (mGroups || (mGroup != IdentifierModel::kIdentifierInvalid))
+        lRetval++;
+
+    if (mSources)
+        lRetval++;
+
+    if (mZones || (mZone != IdentifierModel::kIdentifierInvalid))
+        lRetval++;
+
+    return (lRetval);
+}
+
 // MARK: Equalizer Preset Commands
 
 /**
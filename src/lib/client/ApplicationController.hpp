@@ -86,6 +86,31 @@ class Controller :
     public CommandManagerDelegate,
     public ObjectControllerBasisErrorDelegate
 {
+public:
+    /**
+     *  The server peer state to which a scoped refresh is restricted.
+     *
+     *  For each of equalizer presets, groups, and zones, a scope may
+     *  include all of them, a single one by identifier, or none of
+     *  them. Sources may only be included as a whole since their names
+     *  are only available from the server peer configuration.
+     *
+     */
+    struct RefreshScope
+    {
+        RefreshScope(void);
+
+        size_t GetControllerCount(void) const;
+
+        bool                                         mEqualizerPresets;  //!< Whether to refresh all equalizer presets.
+        Model::EqualizerPresetModel::IdentifierType  mEqualizerPreset;   //!< The single equalizer preset to refresh, if valid.
+        bool                                         mGroups;            //!< Whether to refresh all groups.
+        Model::GroupModel::IdentifierType            mGroup;             //!< The single group to refresh, if valid.
+        bool                                         mSources;           //!< Whether to refresh all sources.
+        bool                                         mZones;             //!< Whether to refresh all zones.
+        Model::ZoneModel::IdentifierType             mZone;              //!< The single zone to refresh, if valid.
+    };
+
 public:
     Controller(void);
     virtual ~Controller(void);
@@ -98,6 +123,12 @@ public:
 
     Common::Status SetDelegate(ControllerDelegate *aDelegate);
 
+    // Refresh
+
+    using Client::Application::ControllerBasis::Refresh;
+
+    Common::Status Refresh(const RefreshScope &aRefreshScope);
+
     // Equalizer Preset Commands
 
     Common::Status EqualizerPresetsGetMax(Model::EqualizerPresetModel::IdentifierType &aEqualizerPresets) const;
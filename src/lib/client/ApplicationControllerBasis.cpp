@@ -156,6 +156,7 @@ ControllerBasis :: ControllerBasis(GroupsControllerBasis &aGroupsControllerBasis
     mConnectionManager(),
     mCommandManager(),
     mControllersDidRefreshCount(0),
+    mControllersWillRefreshCount(0),
     mRefreshDelegate(nullptr),
     mStateChangeDelegate(nullptr),
     mGroupsControllerBasis(aGroupsControllerBasis),
@@ -324,14 +325,7 @@ ControllerBasis :: Refresh(void)
     Status                lRetval = kStatus_Success;
     Controllers::iterator begin, end;
 
-    if (mRefreshDelegate != nullptr)
-    {
-        mRefreshDelegate->ControllerWillRefresh(*this);
-    }
-
-    // Reset the overall refresh count.
-
-    mControllersDidRefreshCount = 0;
+    WillRefresh(GetControllers().size());
 
     // Begin refreshing each controller.
 
@@ -365,7 +359,101 @@ ControllerBasis :: Refresh(void)
 bool
 ControllerBasis :: IsRefreshing(void) const
 {
-    return (mControllersDidRefreshCount != GetControllers().size());
+    return (mControllersDidRefreshCount != mControllersWillRefreshCount);
+}
+
+/**
+ *  @brief
+ *    Returns whether or not the controller has a complete,
+ *    up-to-date view of the server peer state.
+ *
+ *  This returns a Boolean indicating whether (true) or not (false)
+ *  the most recent refresh operation with the peer server controller
+ *  both involved every sub-controller and has completed. This is
+ *  false before any refresh has been requested and following a
+ *  refresh scoped to a subset of the sub-controllers.
+ *
+ *  @returns
+ *    True if the controller has completed a refresh of every
+ *    sub-controller; otherwise, false.
+ *
+ */
+bool
+ControllerBasis :: IsRefreshComplete(void) const
+{
+    return (!IsRefreshing() && (mControllersWillRefreshCount == GetControllers().size()));
+}
+
+/**
+ *  @brief
+ *    Begin a refresh of the specified number of sub-controllers.
+ *
+ *  This signals the refresh delegate, if any, that a refresh is about
+ *  to begin and resets the overall refresh progress such that the
+ *  refresh will be considered complete once the specified number of
+ *  sub-controllers have completed their refreshes.
+ *
+ *  A derived controller performing a refresh scoped to a subset of
+ *  its sub-controllers should call this with the size of that subset
+ *  before refreshing any of them.
+ *
+ *  @param[in]  aControllerCount  An immutable reference to the number
+ *                                of sub-controllers that will be
+ *                                refreshed.
+ *
+ */
+void
+ControllerBasis :: WillRefresh(const size_t &aControllerCount)
+{
+    if (mRefreshDelegate != nullptr)
+    {
+        mRefreshDelegate->ControllerWillRefresh(*this);
+    }
+
+    // Reset the overall refresh count.
+
+    mControllersDidRefreshCount  = 0;
+    mControllersWillRefreshCount = aControllerCount;
+}
+
+/**
+ *  @brief
+ *    Complete a refresh.
+ *
+ *  This signals the refresh delegate, if any, that the current
+ *  refresh is complete.
+ *
+ *  When, and only when, every sub-controller participated in the
+ *  refresh, group state is first derived from the refreshed zone
+ *  state. A refresh scoped to a subset of the sub-controllers may
+ *  leave the zone state incomplete, so no such derivation is
+ *  attempted for it.
+ *
+ */
+void
+ControllerBasis :: DidRefresh(void)
+{
+    if (IsRefreshComplete())
+    {
+        // At this point, all controllers have asynchronously
+        // completed their refresh requests. Before notifying the
+        // delegate of that fact, derive any necessary group
+        // state, dispatching state change notifications in the
+        // process such that it appears to the delegate as though
+        // that group state came with and was bookended by the
+        // overall refresh request.
+
+        DeriveGroupState();
+    }
+
+    // Now that group state has been derived and state change
+    // notifications dispatched, notify the client that the
+    // refresh request is complete.
+
+    if (mRefreshDelegate != nullptr)
+    {
+        mRefreshDelegate->ControllerDidRefresh(*this);
+    }
 }
 
 /**
@@ -692,11 +780,11 @@ ControllerBasis :: ControllerIsRefreshing(Client::ObjectControllerBasis &aContro
 
     if (lControllerIterator != GetControllers().end())
     {
-        static const Percentage kPercentCompletePerController    = CalculatePercentage(1,
-                                                                                       static_cast<uint8_t>(GetControllers().size()));
+        const Percentage        lPercentCompletePerController    = CalculatePercentage(1,
+                                                                                       static_cast<uint8_t>(mControllersWillRefreshCount));
         const Percentage        lOtherControllersPercentComplete = CalculatePercentage(static_cast<uint8_t>(mControllersDidRefreshCount),
-                                                                                       static_cast<uint8_t>(GetControllers().size()));
-        const Percentage        lThisControllerPercentComplete   = ((kPercentCompletePerController * aPercentComplete) / 100);
+                                                                                       static_cast<uint8_t>(mControllersWillRefreshCount));
+        const Percentage        lThisControllerPercentComplete   = ((lPercentCompletePerController * aPercentComplete) / 100);
         const Percentage        lPercentComplete                 = (lOtherControllersPercentComplete + lThisControllerPercentComplete);
 
         if (mRefreshDelegate != nullptr)
@@ -732,31 +820,14 @@ ControllerBasis :: ControllerDidRefresh(Client::ObjectControllerBasis &aControll
         if (mRefreshDelegate != nullptr)
         {
             const Percentage lPercentComplete = CalculatePercentage(static_cast<uint8_t>(mControllersDidRefreshCount),
-                                                                    static_cast<uint8_t>(GetControllers().size()));
+                                                                    static_cast<uint8_t>(mControllersWillRefreshCount));
 
             mRefreshDelegate->ControllerIsRefreshing(*this, lPercentComplete);
         }
 
-        if (mControllersDidRefreshCount == GetControllers().size())
+        if (mControllersDidRefreshCount == mControllersWillRefreshCount)
         {
-            // At this point, all controllers have asynchronously
-            // completed their refresh requests. Before notifying the
-            // delegate of that fact, derive any necessary group
-            // state, dispatching state change notifications in the
-            // process such that it appears to the delegate as though
-            // that group state came with and was bookended by the
-            // overall refresh request.
-
-            DeriveGroupState();
-
-            // Now that group state has been derived and state change
-            // notifications dispatched, notify the client that the
-            // refresh request is complete.
-
-            if (mRefreshDelegate != nullptr)
-            {
-                mRefreshDelegate->ControllerDidRefresh(*this);
-            }
+            DidRefresh();
         }
     }
 
@@ -1103,7 +1174,7 @@ ControllerBasis :: MaybeHandleGroupZoneStateChangeInteractions(Client::ObjectCon
             const StateChange::ZonesNotificationBasis &  lSCN = static_cast<const StateChange::ZonesNotificationBasis &>(aStateChangeNotification);
             const Model::ZoneModel::IdentifierType              lZone = lSCN.GetIdentifier();
 
-            if (!IsRefreshing())
+            if (IsRefreshComplete())
             {
                 Log::Debug().Write("NOT deriving group state and NOT refreshing, handling zone %hhu event %d\n",
                                    lZone, lType);
@@ -136,6 +136,12 @@ protected:
                     ZonesControllerBasis &aZonesControllerBasis);
 
     bool IsRefreshing(void) const;
+    bool IsRefreshComplete(void) const;
+
+    // Scoped Refresh
+
+    void WillRefresh(const size_t &aControllerCount);
+    void DidRefresh(void);
 
 private:
     // Group State Derivation Methods
@@ -179,6 +185,7 @@ private:
     Client::ConnectionManager                             mConnectionManager;
     Client::CommandManager                                mCommandManager;
     size_t                                                mControllersDidRefreshCount;
+    size_t                                                mControllersWillRefreshCount;
     Client::Application::ControllerRefreshDelegate *      mRefreshDelegate;
     Client::Application::ControllerStateChangeDelegate *  mStateChangeDelegate;
     GroupsControllerBasis &                               mGroupsControllerBasis;
@@ -592,10 +592,7 @@ CommandManager :: ServiceCommandQueue(void)
                          "Would send command request of %zu bytes at %p...\n",
                          lSize, lBuffer);
 
-                lConnectionBuffer.reset(new ConnectionBuffer);
-                nlREQUIRE(lConnectionBuffer, done);
-
-                lRetval = lConnectionBuffer->Init();
+                lRetval = ConnectionBuffer::Create(lConnectionBuffer, lSize);
                 nlREQUIRE_SUCCESS(lRetval, done);
 
                 lConnectionBuffer->Put(lBuffer, lSize);
@@ -108,6 +108,32 @@ RequestBasis :: Init(const char *inStart, const char *inEnd)
     return(RoleDelimitedBuffer::Init(kRole, inStart, inEnd));
 }
 
+/**
+ *  @brief
+ *    This is a class initializer.
+ *
+ *  This initializes the client command request buffer by
+ *  gathering, in order, the specified string extents.
+ *
+ *  @param[in]  inVectors  A pointer to the array of string extents
+ *                         to initialize the client command request
+ *                         buffer with.
+ *  @param[in]  inCount    An immutable reference to the number of
+ *                         string extents in @a inVectors.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If @a inVectors was null and @a inCount
+ *                            was non-zero.
+ *
+ */
+Status
+RequestBasis :: Init(const struct iovec *inVectors, const size_t &inCount)
+{
+    static constexpr Role kRole = Role::kRequestor;
+
+    return(RoleDelimitedBuffer::Init(kRole, inVectors, inCount));
+}
+
 }; // namespace Command
 
 }; // namespace Client
@@ -64,6 +64,7 @@ public:
     virtual Common::Status Init(const char *inBuffer);
     virtual Common::Status Init(const char *inBuffer, const size_t &inSize) final;
     virtual Common::Status Init(const char *inStart, const char *inEnd) final;
+    virtual Common::Status Init(const struct iovec *inVectors, const size_t &inCount) final;
 };
 
 }; // namespace Command
@@ -34,7 +34,9 @@
 
 #include <OpenHLX/Utilities/Assert.hpp>
 
+#include "ConnectionTCP.hpp"
 #include "ConnectionTelnet.hpp"
+#include "ConnectionUnix.hpp"
 
 
 using namespace HLX::Common;
@@ -94,12 +96,24 @@ ConnectionFactory :: Init(const RunLoopParameters &aRunLoopParameters)
     Status lRetval = kStatus_Success;
 
     static ConnectionTelnet sConnectionTelnet;
+    static ConnectionTCP    sConnectionTCP;
+    static ConnectionUnix   sConnectionUnix;
 
     lRetval = sConnectionTelnet.Init(aRunLoopParameters);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     mConnections[ConnectionTelnet::kScheme] = &sConnectionTelnet;
 
+    lRetval = sConnectionTCP.Init(aRunLoopParameters);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mConnections[ConnectionTCP::kScheme] = &sConnectionTCP;
+
+    lRetval = sConnectionUnix.Init(aRunLoopParameters);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mConnections[ConnectionUnix::kScheme] = &sConnectionUnix;
+
  done:
     return (lRetval);
 }
@@ -124,7 +138,9 @@ ConnectionFactory :: SupportsScheme(CFStringRef aSchemeRef) const
     const CFString lRequestedScheme(aSchemeRef);
     bool lRetval = false;
 
-    if (lRequestedScheme == ConnectionTelnet::kScheme)
+    if ((lRequestedScheme == ConnectionTelnet::kScheme) ||
+        (lRequestedScheme == ConnectionTCP::kScheme)    ||
+        (lRequestedScheme == ConnectionUnix::kScheme))
     {
         lRetval = true;
     }
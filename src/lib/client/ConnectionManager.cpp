@@ -44,6 +44,7 @@
 #include <OpenHLX/Client/ConnectionBasis.hpp>
 #include <OpenHLX/Client/ConnectionFactory.hpp>
 #include <OpenHLX/Client/ConnectionTelnet.hpp>
+#include <OpenHLX/Client/ConnectionUnix.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
 
@@ -265,7 +266,11 @@ ConnectionManager :: Connect(const char *aMaybeURL, const Timeout &aTimeout)
  *                         and port of the HLX server peer to connect
  *                         to. The URL or host name may be a name to
  *                         be resolved or a literal IP address.
- *                         HLX server peer to connect to.
+ *                         HLX server peer to connect to. A "unix"
+ *                         URL (for example,
+ *                         "unix:///var/run/hlxproxyd.sock") connects
+ *                         to a co-located peer at the local socket
+ *                         with the URL path instead.
  *  @param[in]  aVersions  An immutable references to those IP address
  *                         versions that should be used for resolving
  *                         the host name.
@@ -318,12 +323,23 @@ ConnectionManager :: Connect(const char *aMaybeURL,
         // resolved IP addresses and attempt to connect to a URL
         // formed from them and the scheme until one succeeds.
 
-        lHostName = CFURLCopyHostName(lURLRef);
-        nlREQUIRE_ACTION(lHostName.GetString() != nullptr, done, lRetval = -ENOMEM);
-
         lScheme = CFURLCopyScheme(lURLRef);
         nlREQUIRE_ACTION(lScheme.GetString() != nullptr, done, lRetval = -ENOMEM);
 
+        // A local socket URL has a file system path rather than a
+        // host name to resolve and a port, so connect to it directly.
+
+        if (lScheme == ConnectionUnix::kScheme)
+        {
+            lRetval = Connect(lURLRef, aTimeout);
+            nlREQUIRE_SUCCESS(lRetval, done);
+
+            goto done;
+        }
+
+        lHostName = CFURLCopyHostName(lURLRef);
+        nlREQUIRE_ACTION(lHostName.GetString() != nullptr, done, lRetval = -ENOMEM);
+
         lPossiblePort = CFURLGetPortNumber(lURLRef);
 
         lRetval = Resolve(lHostName.GetCString(),
@@ -338,9 +354,8 @@ ConnectionManager :: Connect(const char *aMaybeURL,
         std::string lHost;
 
         // Otherwise, if the URL decoding was not successful, default
-        // to the only connection scheme currently supported, telnet,
-        // and try parsing out a host or IP address or ohst or IP
-        // address and port.
+        // to the telnet connection scheme and try parsing out a host
+        // or IP address or host or IP address and port.
 
         lScheme = ConnectionTelnet::kScheme;
 
@@ -0,0 +1,927 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a base object for a HLX client
+ *      peer-to-peer network connection that exchanges data over a
+ *      pair of socket streams.
+ *
+ */
+
+#include <ConnectionStreamBasis.hpp>
+
+#include <errno.h>
+#include <stdint.h>
+
+#include <ConnectionBuffer.hpp>
+#include <Timeout.hpp>
+
+#include <CoreFoundation/CFStream.h>
+#include <CoreFoundation/CFString.h>
+#include <CoreFoundation/CFURL.h>
+
+#include <CFUtilities/CFString.hpp>
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+namespace HLX
+{
+
+namespace Client
+{
+
+// Global Variables
+
+// Absent a port in the connection URL, connections are made to the
+// default telnet port, which raw TCP connections share.
+
+static const uint16_t kDefaultPort = 23;
+
+// The fixed capacity, in bytes, of the connection receive buffer. This
+// must accommodate the largest multi-part response from a server.
+
+static const size_t kReceiveBufferCapacity = 65536;
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  This constructs an instance of the class with the specified URL
+ *  scheme.
+ *
+ *  @param[in]  aSchemeRef  A reference to a CoreFoundation string
+ *                          containing the protocol (for example,
+ *                          "telnet") scheme supported by the
+ *                          connection.
+ *
+ */
+ConnectionStreamBasis :: ConnectionStreamBasis(CFStringRef aSchemeRef) :
+    ConnectionBasis(aSchemeRef),
+    mReadStreamRef(nullptr),
+    mWriteStreamRef(nullptr),
+    mReadStreamReady(false),
+    mWriteStreamReady(false),
+    mReceiveBuffer()
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionStreamBasis :: ~ConnectionStreamBasis(void)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Connect to a peer.
+ *
+ *  This attempts to asynchronously connect to the peer at the
+ *  specified URL with the provided timeout.
+ *
+ *  @param[in]  aURLRef   A reference to a CoreFoundation URL for the
+ *                        peer to connect to.
+ *  @param[in]  aTimeout  An immutable reference to the timeout by
+ *                        which the connection should complete.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          The port number for the URL was
+ *                            invalid.
+ *  @retval  -ECONNREFUSED    If the peer refused the connection.
+ *  @retval  -EIO             If read and write streams could not
+ *                            be opened for the connected peer.
+ *
+ */
+Status
+ConnectionStreamBasis :: Connect(CFURLRef aURLRef, const Timeout &aTimeout)
+{
+    DeclareScopedFunctionTracer(lTracer);
+    const State            lCurrentState = GetState();
+    SInt32                 lPossiblePort;
+    uint16_t               lPort;
+    const CFOptionFlags    kCommonStreamEvents = (kCFStreamEventOpenCompleted | kCFStreamEventErrorOccurred | kCFStreamEventEndEncountered);
+    const CFOptionFlags    kReadStreamEvents   = (kCommonStreamEvents | kCFStreamEventHasBytesAvailable);
+    const CFOptionFlags    kWriteStreamEvents  = (kCommonStreamEvents | kCFStreamEventCanAcceptBytes);
+    CFStreamClientContext  lStreamClientContext;
+    CFRunLoopRef           lRunLoop = nullptr;
+    CFRunLoopMode          lRunLoopMode;
+    bool                   lStatus;
+    Status                 lRetval = kStatus_Success;
+
+
+    // Take care of invoking the super class Connect method first.
+
+    lRetval = ConnectionBasis::Connect(aURLRef, aTimeout);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    // If no port was specified, CFURLGetPortNumber will return -1. In
+    // such a case, we default to the default port.
+
+    lPossiblePort = CFURLGetPortNumber(aURLRef);
+    nlREQUIRE_ACTION(lPossiblePort <= UINT16_MAX, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(lPossiblePort >= -1, done, lRetval = -EINVAL);
+
+    if (lPossiblePort == -1)
+        lPort = kDefaultPort;
+    else
+        lPort = static_cast<uint16_t>(lPossiblePort);
+
+    // Signal delegates that the connection will begin.
+
+    OnWillConnect();
+
+    SetState(kState_Connecting);
+
+    OnIsConnecting();
+
+    lRetval = CreateStreams(aURLRef, lPort, mReadStreamRef, mWriteStreamRef);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    if ((mReadStreamRef == nullptr) || (mWriteStreamRef == nullptr))
+    {
+        if (mReadStreamRef)
+        {
+            Log::Error().Write("Failed to create read stream.\n");
+
+            CFReadStreamClose(mReadStreamRef);
+            CFRelease(mReadStreamRef);
+            mReadStreamRef = nullptr;
+        }
+
+        if (mWriteStreamRef)
+        {
+            Log::Error().Write("Failed to create write stream.\n");
+
+            CFWriteStreamClose(mWriteStreamRef);
+            CFRelease(mWriteStreamRef);
+            mWriteStreamRef = nullptr;
+        }
+
+        lRetval = -ECONNREFUSED;
+        goto done;
+    }
+
+    lRunLoop = GetRunLoopParameters().GetRunLoop();
+    lRunLoopMode = GetRunLoopParameters().GetRunLoopMode();
+
+    lStreamClientContext.version         = 0;
+    lStreamClientContext.info            = this;
+    lStreamClientContext.retain          = nullptr;
+    lStreamClientContext.release         = nullptr;
+    lStreamClientContext.copyDescription = nullptr;
+
+#if USE_kCFStreamPropertyShouldCloseNativeSocket
+    CFReadStreamSetProperty(mReadStreamRef,
+                            kCFStreamPropertyShouldCloseNativeSocket,
+                            kCFBooleanFalse);
+#endif
+
+    lStatus = CFReadStreamSetClient(mReadStreamRef,
+                                    kReadStreamEvents,
+                                    &CFReadStreamCallback,
+                                    &lStreamClientContext);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to set read stream client.\n");
+
+        lRetval = -EINVAL;
+        goto done;
+    }
+
+    CFReadStreamScheduleWithRunLoop(mReadStreamRef,
+                                    lRunLoop,
+                                    lRunLoopMode);
+
+#if USE_kCFStreamPropertyShouldCloseNativeSocket
+    CFWriteStreamSetProperty(mWriteStreamRef,
+                             kCFStreamPropertyShouldCloseNativeSocket,
+                             kCFBooleanFalse);
+#endif
+
+    lStatus = CFWriteStreamSetClient(mWriteStreamRef,
+                                     kWriteStreamEvents,
+                                     &CFWriteStreamCallback,
+                                     &lStreamClientContext);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to set write stream client.\n");
+
+        lRetval = -EINVAL;
+        goto done;
+    }
+
+    CFWriteStreamScheduleWithRunLoop(mWriteStreamRef,
+                                     lRunLoop,
+                                     lRunLoopMode);
+
+    lStatus = CFReadStreamOpen(mReadStreamRef);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to open the read stream.\n");
+
+        lRetval = -EIO;
+        goto done;
+    }
+
+    lStatus = CFWriteStreamOpen(mWriteStreamRef);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to open the write stream.\n");
+
+        lRetval = -EIO;
+        goto done;
+    }
+
+ done:
+    // The kState_Connected state should / will only be reached once
+    // we get callbacks that both streams are open.
+
+    if (lRetval != kStatus_Success)
+    {
+        CloseStreams();
+
+        SetState(lCurrentState);
+
+        OnDidNotConnect(lRetval);
+
+        OnError(lRetval);
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Create the read and write streams for a peer.
+ *
+ *  This creates, but does not open, a pair of read and write streams
+ *  for a TCP socket to the host at the specified URL and port.
+ *
+ *  @param[in]   aURLRef          A reference to a CoreFoundation URL
+ *                                for the peer to create streams for.
+ *  @param[in]   aPort            An immutable reference to the port
+ *                                of the peer to create streams for.
+ *  @param[out]  aReadStreamRef   A reference to storage for the
+ *                                created read stream, if any.
+ *  @param[out]  aWriteStreamRef  A reference to storage for the
+ *                                created write stream, if any.
+ *
+ *  @retval  kStatus_Success  Unconditionally. Failure to create
+ *                            either stream is reflected by a null
+ *                            stream.
+ *
+ */
+Status
+ConnectionStreamBasis :: CreateStreams(CFURLRef aURLRef,
+                               const uint16_t &aPort,
+                               CFReadStreamRef &aReadStreamRef,
+                               CFWriteStreamRef &aWriteStreamRef)
+{
+    CFString  lHost;
+    Status    lRetval = kStatus_Success;
+
+
+    lHost = CFURLCopyHostName(aURLRef);
+
+    CFStreamCreatePairWithSocketToHost(kCFAllocatorDefault,
+                                       lHost.GetString(),
+                                       aPort,
+                                       &aReadStreamRef,
+                                       &aWriteStreamRef);
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Close the read and write stream associated with a connected peer.
+ *
+ *  @retval  kStatus_Success  Unconditionally.
+ *
+ */
+Status
+ConnectionStreamBasis :: CloseStreams(void)
+{
+    CFRunLoopRef  lRunLoop = GetRunLoopParameters().GetRunLoop();
+    CFRunLoopMode lRunLoopMode = GetRunLoopParameters().GetRunLoopMode();
+    Status        lRetval = kStatus_Success;
+
+    if (mReadStreamRef != nullptr)
+    {
+        CFReadStreamUnscheduleFromRunLoop(mReadStreamRef, lRunLoop, lRunLoopMode);
+        CFReadStreamSetClient(mReadStreamRef, kCFStreamEventNone, nullptr, nullptr);
+        CFReadStreamClose(mReadStreamRef);
+        CFRelease(mReadStreamRef);
+        mReadStreamRef = nullptr;
+    }
+
+    if (mWriteStreamRef != nullptr)
+    {
+        CFWriteStreamUnscheduleFromRunLoop(mWriteStreamRef, lRunLoop, lRunLoopMode);
+        CFWriteStreamSetClient(mWriteStreamRef, kCFStreamEventNone, nullptr, nullptr);
+        CFWriteStreamClose(mWriteStreamRef);
+        CFRelease(mWriteStreamRef);
+        mWriteStreamRef = nullptr;
+    }
+
+    mReadStreamReady  = false;
+    mWriteStreamReady = false;
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return whether the connection streams are open.
+ *
+ *  @returns True if the read and write streams are open; otherwise,
+ *           false.
+ *
+ */
+bool
+ConnectionStreamBasis :: AreStreamsOpen(void) const
+{
+    return (mWriteStreamRef != nullptr);
+}
+
+/**
+ *  @brief
+ *    Return whether the connection streams are ready.
+ *
+ *  @returns True if the read and write streams have both opened;
+ *           otherwise, false.
+ *
+ */
+bool
+ConnectionStreamBasis :: AreStreamsReady(void) const
+{
+    return (mReadStreamReady && mWriteStreamReady);
+}
+
+/**
+ *  @brief
+ *    Disconnect from the HLX server peer with the specified error.
+ *
+ *  This attempts to asynchronously disconnect from the
+ *  currently-connected HLX server peer, if any, with the specified
+ *  error (that is, reason for disconnection), for example -ETIMEDOUT.
+ *
+ *  @param[in]  aError  A reference to the error associated with the
+ *                      reason for the disconnection.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+ConnectionStreamBasis :: Disconnect(const Common::Error &aError)
+{
+    DeclareScopedFunctionTracer(lTracer);
+    const State  lCurrentState = GetState();
+    Status       lRetval = kStatus_Success;
+
+    OnWillDisconnect();
+
+    SetState(kState_Disconnecting);
+
+    lRetval = CloseStreams();
+
+    if (lRetval == kStatus_Success)
+    {
+        if (mReceiveBuffer != nullptr)
+        {
+            mReceiveBuffer->Flush();
+        }
+
+        ResetSession();
+
+        SetState(kState_Disconnected);
+
+        OnDidDisconnect(aError);
+
+        lRetval = ConnectionBasis::Disconnect(aError);
+    }
+    else
+    {
+        SetState(lCurrentState);
+
+        OnDidNotDisconnect(lRetval);
+
+        OnError(lRetval);
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Reset any session state the connection layers over its streams.
+ *
+ *  This is invoked once the streams have been closed, either on
+ *  disconnection or on a stream error, such that any session layer
+ *  exchange is made anew on the next connection. By default, there
+ *  is no such state.
+ *
+ */
+void
+ConnectionStreamBasis :: ResetSession(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Handle the opening of both connection streams.
+ *
+ *  By default, this completes the connection.
+ *
+ */
+void
+ConnectionStreamBasis :: DidOpenStreams(void)
+{
+    SetState(kState_Connected);
+
+    OnDidConnect();
+}
+
+/**
+ *  @brief
+ *    Handle data read from the connection peer.
+ *
+ *  This is invoked with the data, as read, from the read stream. By
+ *  default, the data is user data and is pushed into the receive
+ *  buffer as-is; derived connections that encode user data (for
+ *  example, with the telnet protocol) decode it and push the decoded
+ *  data with #DidReceiveDataHandler.
+ *
+ *  @param[in]  aBuffer  A pointer to the data read.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data read.
+ *
+ */
+void
+ConnectionStreamBasis :: DidReadDataHandler(const uint8_t *aBuffer, const size_t &aSize)
+{
+    DidReceiveDataHandler(aBuffer, aSize);
+}
+
+/**
+ *  @brief
+ *    Handle the receive buffer having been pushed user data.
+ *
+ *  By default, this dispatches the receive buffer contents upwards.
+ *
+ *  @param[in]  aBuffer  A reference to the shared pointer to the
+ *                       receive buffer.
+ *
+ */
+void
+ConnectionStreamBasis :: DidReceiveApplicationDataHandler(ConnectionBuffer::MutableCountedPointer &aBuffer)
+{
+    OnApplicationDataReceived(aBuffer);
+}
+
+static void
+LogStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription)
+{
+    Log::Error().Write("%s: received %s event type 0x%lx w/ error domain %lu code %d\n",
+                       __func__,
+                       aStreamDescription,
+                       aType,
+                       aStreamError.domain,
+                       static_cast<int>(aStreamError.error));
+}
+
+/**
+ *  @brief
+ *    Handle an error associated with a connection stream.
+ *
+ *  This handles any errors associated with either a read or write
+ *  connection stream.
+ *
+ *  @param[in]  aType               The type of stream error that
+ *                                  triggered the error.
+ *  @param[in]  aStreamError        An immutable reference to the
+ *                                  stream error.
+ *  @param[in]  aStreamDescription  An optional pointer to a null-
+ *                                  terminated C string describing
+ *                                  the stream on which the error
+ *                                  occurred.
+ *
+ */
+void
+ConnectionStreamBasis :: HandleStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription)
+{
+    const State  lState = GetState();
+    Error        lError;
+
+    LogStreamError(aType, aStreamError, aStreamDescription);
+
+    Log::Debug().Write("%s: state is %d\n", __FUNCTION__, lState);
+
+    switch (aStreamError.domain)
+    {
+
+    case kCFStreamErrorDomainPOSIX:
+        lError = -aStreamError.error;
+        break;
+
+    default:
+        lError = kError_Unknown;
+        break;
+
+    }
+
+    switch (lState)
+    {
+
+    case kState_Connecting:
+        {
+            CloseStreams();
+
+            SetState(kState_Disconnected);
+
+            OnDidNotConnect(lError);
+
+            OnError(lError);
+        }
+        break;
+
+    case kState_Connected:
+        {
+            CloseStreams();
+
+            if (mReceiveBuffer != nullptr)
+            {
+                mReceiveBuffer->Flush();
+            }
+
+            ResetSession();
+
+            SetState(kState_Disconnected);
+
+            OnDidDisconnect(lError);
+
+            OnError(lError);
+        }
+        break;
+
+    case kState_Unknown:
+    case kState_Disconnecting:
+    case kState_Disconnected:
+    default:
+        break;
+
+    }
+}
+
+/**
+ *  @brief
+ *    Handle the opening of a connection stream.
+ *
+ *  This marks the opened stream ready and, once both streams are
+ *  ready, completes the connection.
+ *
+ *  @param[in,out]  aStreamReady  A reference to the ready flag of the
+ *                                opened stream.
+ *
+ */
+void
+ConnectionStreamBasis :: DidOpenStream(bool &aStreamReady)
+{
+    if (!aStreamReady)
+    {
+        aStreamReady = true;
+
+        if (AreStreamsReady())
+        {
+            DidOpenStreams();
+        }
+    }
+}
+
+/**
+ *  @brief
+ *    Callback to handle connection read stream activity.
+ *
+ *  This handles any read stream activity associated with the
+ *  connected peer.
+ *
+ *  @param[in]  aStream  A reference to the read stream that
+ *                       triggered the callback.
+ *  @param[in]  aType    The type of event that triggered the
+ *                       callback.
+ *
+ */
+void
+ConnectionStreamBasis :: CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType)
+{
+    Boolean lStatus;
+
+    switch (aType)
+    {
+
+    case kCFStreamEventOpenCompleted:
+        DidOpenStream(mReadStreamReady);
+        break;
+
+    case kCFStreamEventHasBytesAvailable:
+        {
+            DidOpenStream(mReadStreamReady);
+
+            lStatus = CFReadStreamHasBytesAvailable(aStream);
+            if (lStatus)
+            {
+                const CFIndex lRequestedBytes = 4096;
+                uint8_t       lBuffer[lRequestedBytes];
+                CFIndex       lResult;
+
+
+                lResult = CFReadStreamRead(aStream, lBuffer, lRequestedBytes);
+
+                if (lResult > 0)
+                {
+                    DidReadDataHandler(lBuffer, static_cast<size_t>(lResult));
+                }
+            }
+        }
+        break;
+
+    case kCFStreamEventErrorOccurred:
+        {
+            const CFStreamError lStreamError = CFReadStreamGetError(aStream);
+
+            HandleStreamError(aType, lStreamError, "read");
+        }
+        break;
+
+    case kCFStreamEventEndEncountered:
+        {
+            const CFStreamError lStreamError = { kCFStreamErrorDomainPOSIX, ECONNRESET };
+
+            HandleStreamError(aType, lStreamError, "read");
+        }
+        break;
+
+    default:
+        {
+            Log::Error().Write("%s: read event type 0x%lx unhandled\n", __func__, aType);
+        }
+        break;
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Callback to handle connection write stream activity.
+ *
+ *  This handles any write stream activity associated with the
+ *  connected peer.
+ *
+ *  @param[in]  aStream  A reference to the write stream that
+ *                       triggered the callback.
+ *  @param[in]  aType    The type of event that triggered the
+ *                       callback.
+ *
+ */
+void
+ConnectionStreamBasis :: CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType)
+{
+    switch (aType)
+    {
+
+    case kCFStreamEventOpenCompleted:
+    case kCFStreamEventCanAcceptBytes:
+        DidOpenStream(mWriteStreamReady);
+        break;
+
+    case kCFStreamEventErrorOccurred:
+        {
+            const CFStreamError lStreamError = CFWriteStreamGetError(aStream);
+
+            HandleStreamError(aType, lStreamError, "write");
+        }
+        break;
+
+    case kCFStreamEventEndEncountered:
+        {
+            const CFStreamError lStreamError = { kCFStreamErrorDomainPOSIX, ECONNRESET };
+
+            HandleStreamError(aType, lStreamError, "write");
+        }
+        break;
+
+    default:
+        {
+            Log::Error().Write("%s: write event type 0x%lx unhandled\n", __func__, aType);
+        }
+        break;
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Callback trampoline to handle connection read stream activity.
+ *
+ *  @param[in]  aStream   A reference to the read stream that
+ *                        triggered the callback.
+ *  @param[in]  aType     The type of event that triggered the
+ *                        callback.
+ *  @param[in]  aContext  A pointer to the connection class
+ *                        instance that registered this
+ *                        trampoline to call back into from
+ *                        the trampoline.
+ *
+ */
+void
+ConnectionStreamBasis :: CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType, void *aContext)
+{
+    ConnectionStreamBasis *lConnection = static_cast<ConnectionStreamBasis *>(aContext);
+
+    if (lConnection != nullptr)
+    {
+        lConnection->CFReadStreamCallback(aStream, aType);
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Callback trampoline to handle connection write stream activity.
+ *
+ *  @param[in]  aStream   A reference to the write stream that
+ *                        triggered the callback.
+ *  @param[in]  aType     The type of event that triggered the
+ *                        callback.
+ *  @param[in]  aContext  A pointer to the connection class
+ *                        instance that registered this
+ *                        trampoline to call back into from
+ *                        the trampoline.
+ *
+ */
+void
+ConnectionStreamBasis :: CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType, void *aContext)
+{
+    ConnectionStreamBasis *lConnection = static_cast<ConnectionStreamBasis *>(aContext);
+
+    if (lConnection != nullptr)
+    {
+        lConnection->CFWriteStreamCallback(aStream, aType);
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Handle user data received from the connection peer.
+ *
+ *  This pushes the user data received from the peer into the
+ *  fixed-capacity receive buffer, dispatching it upwards as it is
+ *  pushed.
+ *
+ *  @param[in]  aBuffer  A pointer to the data received.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data received.
+ *
+ */
+void
+ConnectionStreamBasis :: DidReceiveDataHandler(const uint8_t *aBuffer, const size_t &aSize)
+{
+    DeclareLogIndentWithValue(lLogIndent, 0);
+    DeclareLogLevelWithValue(lLogLevel, 1);
+    const uint8_t *  lCurrent = aBuffer;
+    size_t           lRemaining = aSize;
+    uint8_t *        lPut;
+    Status           lStatus;
+
+    LogDebug(lLogIndent,
+             lLogLevel,
+             "Received %zu bytes of user data.\n",
+             aSize);
+#if (defined(DEBUG) && DEBUG) && !defined(NDEBUG)
+    Log::Utilities::Memory::Write(lLogIndent,
+                                  lLogLevel,
+                                  aBuffer,
+                                  aSize);
+#endif // (defined(DEBUG) && DEBUG) && !defined(NDEBUG)
+
+    // Allocate and initialize the receive buffer on-demand, if one is
+    // not already in use.
+
+    if (!mReceiveBuffer)
+    {
+        lStatus = ConnectionBuffer::Create(mReceiveBuffer, kReceiveBufferCapacity);
+        nlREQUIRE_SUCCESS(lStatus, done);
+    }
+
+    while (lRemaining > 0)
+    {
+        size_t  lHeadroom = (mReceiveBuffer->GetCapacity() - mReceiveBuffer->GetSize());
+        size_t  lChunk;
+
+        // If the buffer is full and nothing in it could be consumed,
+        // then it contains unterminated data larger than any valid
+        // input. Discard it rather than growing the buffer without
+        // bound.
+
+        if (lHeadroom == 0)
+        {
+            Log::Error().Write("Receive buffer full; discarding %zu bytes of unterminated data.\n",
+                               mReceiveBuffer->GetSize());
+
+            mReceiveBuffer->Flush();
+
+            lHeadroom = mReceiveBuffer->GetCapacity();
+        }
+
+        lChunk = ((lRemaining < lHeadroom) ? lRemaining : lHeadroom);
+
+        lPut = mReceiveBuffer->Put(lCurrent, lChunk);
+        nlREQUIRE_ACTION(lPut != nullptr, done, lStatus = -ENOSPC);
+
+        lCurrent   += lChunk;
+        lRemaining -= lChunk;
+
+        DidReceiveApplicationDataHandler(mReceiveBuffer);
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Write the specified data to the connection peer.
+ *
+ *  @param[in]  aBuffer  A pointer to the data to write.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data to write.
+ *
+ */
+void
+ConnectionStreamBasis :: ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize)
+{
+    CFIndex lResult = 0;
+    CFIndex lStatus = 0;
+
+    lStatus = CFWriteStreamCanAcceptBytes(mWriteStreamRef);
+    if (lStatus)
+    {
+        lResult = CFWriteStreamWrite(mWriteStreamRef,
+                                     aBuffer,
+                                     static_cast<CFIndex>(aSize));
+
+        if (static_cast<size_t>(lResult) != aSize)
+        {
+            Log::Debug().Write("Only wrote %zu of %zu bytes!\n", lResult, aSize);
+        }
+    }
+    else
+    {
+        Log::Debug().Write("Write stream cannot accept data!\n");
+    }
+}
+
+}; // namespace Client
+
+}; // namespace HLX
@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines a base object for a HLX client peer-to-peer
+ *      network connection that exchanges data over a pair of socket
+ *      streams.
+ *
+ */
+
+#ifndef OPENHLXCLIENTCONNECTIONSTREAMBASIS_HPP
+#define OPENHLXCLIENTCONNECTIONSTREAMBASIS_HPP
+
+#include <stdint.h>
+
+#include <CoreFoundation/CFStream.h>
+#include <CoreFoundation/CFString.h>
+#include <CoreFoundation/CFURL.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/Timeout.hpp>
+
+#include <OpenHLX/Client/ConnectionBasis.hpp>
+
+
+namespace HLX
+{
+
+namespace Client
+{
+
+/**
+ *  @brief
+ *    A base object for a HLX client peer-to-peer network connection
+ *    that exchanges data over a pair of socket streams.
+ *
+ *  This creates, schedules, opens, and closes the CoreFoundation read
+ *  and write streams for the connection peer, handles their events
+ *  and errors, and pushes the data received from the peer into a
+ *  fixed-capacity receive buffer, dispatching it upwards as it is
+ *  pushed. The connection is established once both streams are open.
+ *
+ *  Derived connections supply only how data read from the peer is
+ *  decoded and how data is encoded and sent to it (for example, with
+ *  or without the telnet protocol) and any session layer exchange
+ *  that must complete before the connection is established.
+ *
+ *  @ingroup client
+ *
+ */
+class ConnectionStreamBasis :
+    public Client::ConnectionBasis
+{
+public:
+    virtual ~ConnectionStreamBasis(void);
+
+    Common::Status Connect(CFURLRef aURLRef, const Common::Timeout &aTimeout) final;
+    Common::Status Disconnect(const Common::Error &aError) final;
+
+    static void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType, void *aContext);
+    static void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType, void *aContext);
+
+protected:
+    ConnectionStreamBasis(CFStringRef aSchemeRef);
+
+    virtual Common::Status CreateStreams(CFURLRef aURLRef,
+                                         const uint16_t &aPort,
+                                         CFReadStreamRef &aReadStreamRef,
+                                         CFWriteStreamRef &aWriteStreamRef);
+    Common::Status         CloseStreams(void);
+    bool                   AreStreamsOpen(void) const;
+    bool                   AreStreamsReady(void) const;
+
+    virtual void   ResetSession(void);
+    virtual void   DidOpenStreams(void);
+    virtual void   DidReadDataHandler(const uint8_t *aBuffer, const size_t &aSize);
+    virtual void   DidReceiveApplicationDataHandler(Common::ConnectionBuffer::MutableCountedPointer &aBuffer);
+
+    void           DidReceiveDataHandler(const uint8_t *aBuffer, const size_t &aSize);
+    void           ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize);
+    void           HandleStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription);
+
+private:
+    void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType);
+    void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType);
+
+    void DidOpenStream(bool &aStreamReady);
+
+private:
+    CFReadStreamRef                                  mReadStreamRef;
+    CFWriteStreamRef                                 mWriteStreamRef;
+    bool                                             mReadStreamReady;
+    bool                                             mWriteStreamReady;
+    Common::ConnectionBuffer::MutableCountedPointer  mReceiveBuffer;
+};
+
+}; // namespace Client
+
+}; // namespace HLX
+
+#endif // OPENHLXCLIENTCONNECTIONSTREAMBASIS_HPP
@@ -0,0 +1,132 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for a HLX client peer-to-peer
+ *      network connection that uses raw TCP, without telnet protocol
+ *      encoding.
+ *
+ */
+
+#include <ConnectionTCP.hpp>
+
+#include <errno.h>
+
+#include <ConnectionBuffer.hpp>
+
+#include <CoreFoundation/CFString.h>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+namespace HLX
+{
+
+namespace Client
+{
+
+// Static Class Data Members
+
+/**
+ *  @brief
+ *    A CoreFoundation string constant for the URL protocol scheme
+ *    supported by this connection.
+ *
+ */
+CFStringRef ConnectionTCP :: kScheme = CFSTR("tcp");
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+ConnectionTCP :: ConnectionTCP(void) :
+    ConnectionStreamBasis(kScheme)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  This constructs an instance of the class with the specified URL
+ *  scheme, for derived connections that exchange data over a socket
+ *  other than TCP in the same way.
+ *
+ *  @param[in]  aSchemeRef  A reference to a CoreFoundation string
+ *                          containing the protocol (for example,
+ *                          "unix") scheme supported by the
+ *                          connection.
+ *
+ */
+ConnectionTCP :: ConnectionTCP(CFStringRef aSchemeRef) :
+    ConnectionStreamBasis(aSchemeRef)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionTCP :: ~ConnectionTCP(void)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Send the specified data to the connection peer.
+ *
+ *  @param[in]  aBuffer  An immutable shared pointer to the data to send to
+ *                       the connection peer.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOTCONN        If the connection streams are not open.
+ *
+ */
+Status
+ConnectionTCP :: Send(ConnectionBuffer::ImmutableCountedPointer &aBuffer)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION(AreStreamsOpen(), done, lRetval = -ENOTCONN);
+
+    ShouldTransmitDataHandler(aBuffer->GetHead(), aBuffer->GetSize());
+
+ done:
+    return (lRetval);
+}
+
+}; // namespace Client
+
+}; // namespace HLX
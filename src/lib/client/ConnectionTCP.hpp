@@ -0,0 +1,78 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for a HLX client peer-to-peer
+ *      network connection that uses raw TCP, without telnet protocol
+ *      encoding.
+ *
+ */
+
+#ifndef OPENHLXCLIENTCONNECTIONTCP_HPP
+#define OPENHLXCLIENTCONNECTIONTCP_HPP
+
+#include <CoreFoundation/CFString.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+
+#include <OpenHLX/Client/ConnectionStreamBasis.hpp>
+
+
+namespace HLX
+{
+
+namespace Client
+{
+
+/**
+ *  @brief
+ *    An object for a HLX client peer-to-peer network connection that
+ *    uses raw TCP.
+ *
+ *  Unlike #ConnectionTelnet, data is read from and written to the
+ *  connection socket streams directly, without telnet protocol
+ *  encoding or decoding. Because there is no telnet session
+ *  confirmation to wait for, the connection is established as soon
+ *  as both socket streams are open.
+ *
+ *  @ingroup client
+ *
+ */
+class ConnectionTCP :
+    public Client::ConnectionStreamBasis
+{
+public:
+    static CFStringRef kScheme;
+
+public:
+    ConnectionTCP(void);
+    virtual ~ConnectionTCP(void);
+
+    Common::Status Send(Common::ConnectionBuffer::ImmutableCountedPointer &aBuffer) final;
+
+protected:
+    ConnectionTCP(CFStringRef aSchemeRef);
+};
+
+}; // namespace Client
+
+}; // namespace HLX
+
+#endif // OPENHLXCLIENTCONNECTIONTCP_HPP
@@ -26,29 +26,20 @@
 #ifndef OPENHLXCLIENTCONNECTIONTELNET_HPP
 #define OPENHLXCLIENTCONNECTIONTELNET_HPP
 
-#include <CoreFoundation/CFStream.h>
-#include <CoreFoundation/CFURL.h>
+#include <CoreFoundation/CFString.h>
 
 #include <libtelnet.h>
 
 #include <OpenHLX/Common/ConnectionBuffer.hpp>
 #include <OpenHLX/Common/Errors.hpp>
 #include <OpenHLX/Common/RegularExpression.hpp>
-#include <OpenHLX/Common/Timeout.hpp>
 
-#include <OpenHLX/Client/ConnectionBasis.hpp>
+#include <OpenHLX/Client/ConnectionStreamBasis.hpp>
 
 
 namespace HLX
 {
 
-namespace Common
-{
-
-    class ConnectionBuffer;
-
-}; // namespace Common
-
 namespace Client
 {
 
@@ -61,7 +52,7 @@ namespace Client
  *
  */
 class ConnectionTelnet :
-    public Client::ConnectionBasis
+    public Client::ConnectionStreamBasis
 {
 public:
     static CFStringRef kScheme;
@@ -72,36 +63,21 @@ public:
 
     Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters) final;
 
-    Common::Status Connect(CFURLRef aURLRef, const Common::Timeout &aTimeout) final;
-    Common::Status Disconnect(const Common::Error &aError) final;
-
     Common::Status Send(Common::ConnectionBuffer::ImmutableCountedPointer &aBuffer) final;
 
-    static void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType, void *aContext);
-    static void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType, void *aContext);
     static void TelnetEventHandler(telnet_t *aTelnet, telnet_event_t *aEvent, void *aContext);
 
 private:
-    Common::Status CloseStreams(void);
-
-    Common::Status Put(Common::ConnectionBuffer &aBuffer, const uint8_t *aData, const size_t &aSize);
-
-    void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType);
-    void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType);
+    void ResetSession(void) final;
+    void DidOpenStreams(void) final;
+    void DidReadDataHandler(const uint8_t *aBuffer, const size_t &aSize) final;
+    void DidReceiveApplicationDataHandler(Common::ConnectionBuffer::MutableCountedPointer &aBuffer) final;
 
-    void TryClientConfirmationDataReceived(void);
-    void DidReceiveDataHandler(const uint8_t *aBuffer, const size_t &aSize);
-    void ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize);
+    void TryClientConfirmationDataReceived(Common::ConnectionBuffer &aBuffer);
     void TelnetEventHandler(telnet_t *aTelnet, telnet_event_t *aEvent);
-    void HandleStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription);
 
 private:
     telnet_t *                                       mTelnet;
-    CFReadStreamRef                                  mReadStreamRef;
-    CFWriteStreamRef                                 mWriteStreamRef;
-    bool                                             mReadStreamReady;
-    bool                                             mWriteStreamReady;
-    Common::ConnectionBuffer::MutableCountedPointer  mReceiveBuffer;
     bool                                             mWaitingForClientConfirmation;
     Common::RegularExpression                        mClientConfirmationRegexp;
 };
@@ -0,0 +1,207 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file implements an object for a HLX client peer-to-peer
+ *      connection that uses local (Unix domain) sockets, without
+ *      telnet protocol encoding.
+ *
+ */
+
+#include <ConnectionUnix.hpp>
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <CoreFoundation/CFStream.h>
+#include <CoreFoundation/CFString.h>
+#include <CoreFoundation/CFURL.h>
+
+#include <CFUtilities/CFString.hpp>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/SocketAddress.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+// Preprocessor Defintions
+
+/**
+ *  @def SOCK_FLAGS
+ *
+ *  @brief
+ *    A portability mnemonic to address platforms which have or have
+ *    not defined SOCK_CLOEXEC.
+ *
+ */
+#ifdef SOCK_CLOEXEC
+#define SOCK_FLAGS SOCK_CLOEXEC
+#else
+#define SOCK_FLAGS 0
+#endif
+
+
+namespace HLX
+{
+
+namespace Client
+{
+
+// Static Class Data Members
+
+/**
+ *  @brief
+ *    A CoreFoundation string constant for the URL protocol scheme
+ *    supported by this connection.
+ *
+ */
+CFStringRef ConnectionUnix :: kScheme = CFSTR("unix");
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+ConnectionUnix :: ConnectionUnix(void) :
+    ConnectionTCP(kScheme)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionUnix :: ~ConnectionUnix(void)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Create the read and write streams for a peer.
+ *
+ *  This connects a local socket to the peer at the file system path
+ *  of the specified URL and creates, but does not open, a pair of
+ *  read and write streams for it. The streams close the socket when
+ *  they are closed.
+ *
+ *  @param[in]   aURLRef          A reference to a CoreFoundation URL
+ *                                whose path is that of the local
+ *                                socket of the peer.
+ *  @param[in]   aPort            An immutable reference to the port
+ *                                of the peer, which is unused.
+ *  @param[out]  aReadStreamRef   A reference to storage for the
+ *                                created read stream, if any.
+ *  @param[out]  aWriteStreamRef  A reference to storage for the
+ *                                created write stream, if any.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If the URL has no path.
+ *  @retval  -ENAMETOOLONG    If the URL path is too long for a local
+ *                            socket address.
+ *  @retval  -ENOMEM          If memory could not be allocated.
+ *
+ */
+Status
+ConnectionUnix :: CreateStreams(CFURLRef aURLRef,
+                                const uint16_t &aPort,
+                                CFReadStreamRef &aReadStreamRef,
+                                CFWriteStreamRef &aWriteStreamRef)
+{
+    CFString       lPath;
+    size_t         lPathLength;
+    SocketAddress  lSocketAddress;
+    int            lSocket = -1;
+    int            lStatus;
+    Status         lRetval = kStatus_Success;
+
+
+    (void)aPort;
+
+    lPath = CFURLCopyFileSystemPath(aURLRef, kCFURLPOSIXPathStyle);
+    nlREQUIRE_ACTION(lPath.GetString() != nullptr, done, lRetval = -ENOMEM);
+
+    lPathLength = strlen(lPath.GetCString());
+    nlREQUIRE_ACTION(lPathLength > 0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(lPathLength < sizeof (lSocketAddress.uSocketAddressLocal.sun_path), done, lRetval = -ENAMETOOLONG);
+
+    memset(&lSocketAddress, 0, sizeof (lSocketAddress));
+
+    lSocketAddress.uSocketAddress.sa_family = AF_LOCAL;
+
+    memcpy(lSocketAddress.uSocketAddressLocal.sun_path, lPath.GetCString(), lPathLength);
+
+    lSocket = socket(AF_LOCAL, SOCK_STREAM | SOCK_FLAGS, 0);
+    nlREQUIRE_ACTION(lSocket != -1, done, lRetval = -errno);
+
+    // Unlike a TCP connection, a local connection completes (or
+    // fails) immediately, so there is no need to connect
+    // asynchronously.
+
+    lStatus = connect(lSocket,
+                      &lSocketAddress.uSocketAddress,
+                      sizeof (lSocketAddress.uSocketAddressLocal));
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+    CFStreamCreatePairWithSocket(kCFAllocatorDefault,
+                                 lSocket,
+                                 &aReadStreamRef,
+                                 &aWriteStreamRef);
+
+    if ((aReadStreamRef != nullptr) && (aWriteStreamRef != nullptr))
+    {
+        CFReadStreamSetProperty(aReadStreamRef,
+                                kCFStreamPropertyShouldCloseNativeSocket,
+                                kCFBooleanTrue);
+
+        CFWriteStreamSetProperty(aWriteStreamRef,
+                                 kCFStreamPropertyShouldCloseNativeSocket,
+                                 kCFBooleanTrue);
+
+        lSocket = -1;
+    }
+
+ done:
+    if (lSocket != -1)
+    {
+        close(lSocket);
+    }
+
+    return (lRetval);
+}
+
+}; // namespace Client
+
+}; // namespace HLX
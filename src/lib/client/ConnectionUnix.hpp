@@ -0,0 +1,82 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file defines an object for a HLX client peer-to-peer
+ *      connection that uses local (Unix domain) sockets, without
+ *      telnet protocol encoding.
+ *
+ */
+
+#ifndef OPENHLXCLIENTCONNECTIONUNIX_HPP
+#define OPENHLXCLIENTCONNECTIONUNIX_HPP
+
+#include <stdint.h>
+
+#include <CoreFoundation/CFStream.h>
+#include <CoreFoundation/CFURL.h>
+
+#include <OpenHLX/Common/Errors.hpp>
+
+#include <OpenHLX/Client/ConnectionTCP.hpp>
+
+
+namespace HLX
+{
+
+namespace Client
+{
+
+/**
+ *  @brief
+ *    An object for a HLX client peer-to-peer connection that uses
+ *    local (Unix domain) sockets.
+ *
+ *  This connects to a co-located server at the file system path of a
+ *  "unix" URL (for example, "unix:///var/run/hlxproxyd.sock") rather
+ *  than to a host and port. Once connected, the socket is read from
+ *  and written to exactly as a raw TCP one is, with the same command
+ *  protocol.
+ *
+ *  @ingroup client
+ *
+ */
+class ConnectionUnix :
+    public ConnectionTCP
+{
+public:
+    static CFStringRef kScheme;
+
+public:
+    ConnectionUnix(void);
+    virtual ~ConnectionUnix(void);
+
+private:
+    Common::Status CreateStreams(CFURLRef aURLRef,
+                                 const uint16_t &aPort,
+                                 CFReadStreamRef &aReadStreamRef,
+                                 CFWriteStreamRef &aWriteStreamRef) final;
+};
+
+}; // namespace Client
+
+}; // namespace HLX
+
+#endif // OPENHLXCLIENTCONNECTIONUNIX_HPP
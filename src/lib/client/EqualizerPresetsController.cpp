@@ -62,7 +62,7 @@ namespace Client
 EqualizerPresetsController :: EqualizerPresetsController(void) :
     Common::EqualizerPresetsControllerBasis(),
     Client::EqualizerPresetsControllerBasis(Common::EqualizerPresetsControllerBasis::mEqualizerPresets,
-                                            Common::EqualizerPresetsControllerBasis::kEqualizerPresetsMax)
+                                            Common::EqualizerPresetsControllerBasis::sEqualizerPresetsMax)
 {
     return;
 }
@@ -82,7 +82,8 @@ EqualizerPresetsControllerBasis :: EqualizerPresetsControllerBasis(Model::Equali
     Client::ObjectControllerBasis(),
     mEqualizerPresetsModel(aEqualizerPresetsModel),
     mEqualizerPresetsMax(aEqualizerPresetsMax),
-    mEqualizerPresetsDidRefreshCount(0)
+    mEqualizerPresetsDidRefreshCount(0),
+    mEqualizerPresetsWillRefreshCount(0)
 {
     return;
 }
@@ -167,7 +168,8 @@ EqualizerPresetsControllerBasis :: Refresh(const Timeout &aTimeout)
 
     (void)aTimeout;
 
-    mEqualizerPresetsDidRefreshCount = 0;
+    mEqualizerPresetsDidRefreshCount  = 0;
+    mEqualizerPresetsWillRefreshCount = mEqualizerPresetsMax;
 
     // Notify the base controller that we have begun a refresh
     // operation.
@@ -183,6 +185,53 @@ done:
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Refresh or obtain an up-to-date view of the server peer state
+ *    for a single equalizer preset.
+ *
+ *  This attempts to refresh or obtain an up-to-date view of the
+ *  server peer state for only the specified equalizer preset, for clients
+ *  that need not observe or mutate any other equalizer preset.
+ *
+ *  Presently, this controller does so by executing a single
+ *  "query equalizer preset [QEPn]" command with the peer server for
+ *  the equalizer preset.
+ *
+ *  @param[in]  aEqualizerPresetIdentifier  An immutable reference to the identifier
+ *                                          of the equalizer preset to refresh.
+ *
+ *  @retval  kStatus_Success              If successful.
+ *  @retval  -ERANGE                      If the equalizer preset identifier is
+ *                                        smaller or larger than supported.
+ *  @retval  -ENOMEM                      If memory could not be allocated
+ *                                        for the command exchange or
+ *                                        exchange state.
+ *
+ */
+Status
+EqualizerPresetsControllerBasis :: Refresh(const Model::EqualizerPresetModel::IdentifierType &aEqualizerPresetIdentifier)
+{
+    Status lRetval = kStatus_Success;
+
+
+    mEqualizerPresetsDidRefreshCount  = 0;
+    mEqualizerPresetsWillRefreshCount = 1;
+
+    // Notify the base controller that we have begun a refresh
+    // operation.
+
+    SetRefreshRequested(true);
+
+    // Issue a query equalizer preset request for only the specified equalizer preset.
+
+    lRetval = Query(aEqualizerPresetIdentifier);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 // MARK: Implementation
 
 /**
@@ -388,7 +437,7 @@ EqualizerPresetsControllerBasis :: QueryCompleteHandler(Command::ExchangeBasis::
     mEqualizerPresetsDidRefreshCount++;
 
     MaybeUpdateRefreshIfRefreshWasRequested(static_cast<uint8_t>(mEqualizerPresetsDidRefreshCount),
-                                            static_cast<uint8_t>(mEqualizerPresetsMax));
+                                            static_cast<uint8_t>(mEqualizerPresetsWillRefreshCount));
 
  done:
     return;
@@ -40,6 +40,13 @@ namespace HLX
 namespace Client
 {
 
+namespace Application
+{
+
+    class Controller;
+
+}; // namespace Application
+
 /**
  *  @brief
  *    A derivable object for realizing a HLX equalizer presets
@@ -86,6 +93,7 @@ protected:
     virtual Common::Status Init(CommandManager &aCommandManager, const Common::Timeout &aTimeout);
 
     Common::Status Refresh(const Common::Timeout &aTimeout) final;
+    Common::Status Refresh(const Model::EqualizerPresetModel::IdentifierType &aEqualizerPresetIdentifier);
 
     // Observer Methods
 
@@ -129,10 +137,18 @@ private:
 
     Common::Status ResponseInit(void);
 
+private:
+    /**
+     *  Ensure the application controller can access the single-object
+     *  Refresh method for scoped refreshes.
+     */
+    friend class Application::Controller;
+
 private:
     Model::EqualizerPresetsModel &                           mEqualizerPresetsModel;
     const Model::EqualizerPresetModel::IdentifierType &      mEqualizerPresetsMax;
     size_t                                                   mEqualizerPresetsDidRefreshCount;
+    size_t                                                   mEqualizerPresetsWillRefreshCount;
 
 protected:
     static Command::EqualizerPresets::EqualizerBandResponse  kEqualizerBandResponse;
@@ -61,7 +61,7 @@ namespace Client
 FavoritesController :: FavoritesController(void) :
     Common::FavoritesControllerBasis(),
     Client::FavoritesControllerBasis(Common::FavoritesControllerBasis::mFavorites,
-                                     Common::FavoritesControllerBasis::kFavoritesMax)
+                                     Common::FavoritesControllerBasis::sFavoritesMax)
 {
     return;
 }
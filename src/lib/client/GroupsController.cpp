@@ -93,7 +93,7 @@ namespace Client
 GroupsController :: GroupsController(void) :
     Common::GroupsControllerBasis(),
     Client::GroupsControllerBasis(Common::GroupsControllerBasis::mGroups,
-                                  Common::GroupsControllerBasis::kGroupsMax)
+                                  Common::GroupsControllerBasis::sGroupsMax)
 {
     return;
 }
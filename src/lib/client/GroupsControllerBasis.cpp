@@ -100,7 +100,8 @@ GroupsControllerBasis :: GroupsControllerBasis(Model::GroupsModel &aGroupsModel,
     Client::ObjectControllerBasis(),
     mGroupsModel(aGroupsModel),
     mGroupsMax(aGroupsMax),
-    mGroupsDidRefreshCount(0)
+    mGroupsDidRefreshCount(0),
+    mGroupsWillRefreshCount(0)
 {
     return;
 }
@@ -185,7 +186,8 @@ GroupsControllerBasis :: Refresh(const Timeout &aTimeout)
 
     (void)aTimeout;
 
-    mGroupsDidRefreshCount = 0;
+    mGroupsDidRefreshCount  = 0;
+    mGroupsWillRefreshCount = mGroupsMax;
 
     // Notify the base controller that we have begun a refresh
     // operation.
@@ -201,6 +203,52 @@ done:
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Refresh or obtain an up-to-date view of the server peer state
+ *    for a single group.
+ *
+ *  This attempts to refresh or obtain an up-to-date view of the
+ *  server peer state for only the specified group, for clients
+ *  that need not observe or mutate any other group.
+ *
+ *  Presently, this controller does so by executing a single
+ *  "query group [QGn]" command with the peer server for the group.
+ *
+ *  @param[in]  aGroupIdentifier  An immutable reference to the identifier
+ *                                of the group to refresh.
+ *
+ *  @retval  kStatus_Success              If successful.
+ *  @retval  -ERANGE                      If the group identifier is
+ *                                        smaller or larger than supported.
+ *  @retval  -ENOMEM                      If memory could not be allocated
+ *                                        for the command exchange or
+ *                                        exchange state.
+ *
+ */
+Status
+GroupsControllerBasis :: Refresh(const Model::GroupModel::IdentifierType &aGroupIdentifier)
+{
+    Status lRetval = kStatus_Success;
+
+
+    mGroupsDidRefreshCount  = 0;
+    mGroupsWillRefreshCount = 1;
+
+    // Notify the base controller that we have begun a refresh
+    // operation.
+
+    SetRefreshRequested(true);
+
+    // Issue a query group request for only the specified group.
+
+    lRetval = Query(aGroupIdentifier);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 // MARK: Implementation
 
 /**
@@ -691,7 +739,7 @@ GroupsControllerBasis :: QueryCompleteHandler(Command::ExchangeBasis::MutableCou
     mGroupsDidRefreshCount++;
 
     MaybeUpdateRefreshIfRefreshWasRequested(static_cast<uint8_t>(mGroupsDidRefreshCount),
-                                            static_cast<uint8_t>(mGroupsMax));
+                                            static_cast<uint8_t>(mGroupsWillRefreshCount));
 
  done:
     return;
@@ -90,6 +90,7 @@ protected:
     virtual Common::Status Init(CommandManager &aCommandManager, const Common::Timeout &aTimeout);
 
     Common::Status Refresh(const Common::Timeout &aTimeout) final;
+    Common::Status Refresh(const Model::GroupModel::IdentifierType &aGroupIdentifier);
 
     // Observer Methods
 
@@ -157,7 +158,8 @@ private:
     /**
      *  Ensure the application controller and controller basis can
      *  access the Handle*Change methods for cross zone-to-group and
-     *  group-to-zone state synthesis.
+     *  group-to-zone state synthesis and the single-object Refresh
+     *  method for scoped refreshes.
      */
     friend class Application::Controller;
     friend class Application::ControllerBasis;
@@ -185,6 +187,7 @@ private:
     Model::GroupsModel &                            mGroupsModel;
     const Model::GroupModel::IdentifierType &       mGroupsMax;
     size_t                                          mGroupsDidRefreshCount;
+    size_t                                          mGroupsWillRefreshCount;
 
 protected:
     static Command::Groups::SetMuteResponse         kSetMuteResponse;
@@ -61,7 +61,7 @@ namespace Client
 SourcesController :: SourcesController(void) :
     Common::SourcesControllerBasis(),
     Client::SourcesControllerBasis(Common::SourcesControllerBasis::mSources,
-                                   Common::SourcesControllerBasis::kSourcesMax)
+                                   Common::SourcesControllerBasis::sSourcesMax)
 {
     return;
 }
@@ -64,7 +64,7 @@ namespace Client
 ZonesController :: ZonesController(void) :
     Common::ZonesControllerBasis(),
     Client::ZonesControllerBasis(Common::ZonesControllerBasis::mZones,
-                                 Common::ZonesControllerBasis::kZonesMax)
+                                 Common::ZonesControllerBasis::sZonesMax)
 {
     return;
 }
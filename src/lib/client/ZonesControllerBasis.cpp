@@ -166,7 +166,8 @@ ZonesControllerBasis :: ZonesControllerBasis(Model::ZonesModel &aZonesModel,
     Client::ObjectControllerBasis(),
     mZonesModel(aZonesModel),
     mZonesMax(aZonesMax),
-    mZonesDidRefreshCount(0)
+    mZonesDidRefreshCount(0),
+    mZonesWillRefreshCount(0)
 {
     return;
 }
@@ -250,7 +251,8 @@ ZonesControllerBasis :: Refresh(const Timeout &aTimeout)
 
     (void)aTimeout;
 
-    mZonesDidRefreshCount = 0;
+    mZonesDidRefreshCount  = 0;
+    mZonesWillRefreshCount = mZonesMax;
 
     // Notify the base controller that we have begun a refresh
     // operation.
@@ -266,6 +268,52 @@ done:
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Refresh or obtain an up-to-date view of the server peer state
+ *    for a single zone.
+ *
+ *  This attempts to refresh or obtain an up-to-date view of the
+ *  server peer state for only the specified zone, for clients
+ *  that need not observe or mutate any other zone.
+ *
+ *  Presently, this controller does so by executing a single
+ *  "query zone [QOn]" command with the peer server for the zone.
+ *
+ *  @param[in]  aZoneIdentifier  An immutable reference to the identifier
+ *                               of the zone to refresh.
+ *
+ *  @retval  kStatus_Success              If successful.
+ *  @retval  -ERANGE                      If the zone identifier is
+ *                                        smaller or larger than supported.
+ *  @retval  -ENOMEM                      If memory could not be allocated
+ *                                        for the command exchange or
+ *                                        exchange state.
+ *
+ */
+Status
+ZonesControllerBasis :: Refresh(const Model::ZoneModel::IdentifierType &aZoneIdentifier)
+{
+    Status lRetval = kStatus_Success;
+
+
+    mZonesDidRefreshCount  = 0;
+    mZonesWillRefreshCount = 1;
+
+    // Notify the base controller that we have begun a refresh
+    // operation.
+
+    SetRefreshRequested(true);
+
+    // Issue a query zone request for only the specified zone.
+
+    lRetval = Query(aZoneIdentifier);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+done:
+    return (lRetval);
+}
+
 // MARK: Implementation
 
 /**
@@ -681,7 +729,7 @@ ZonesControllerBasis :: QueryCompleteHandler(Command::ExchangeBasis::MutableCoun
     mZonesDidRefreshCount++;
 
     MaybeUpdateRefreshIfRefreshWasRequested(static_cast<uint8_t>(mZonesDidRefreshCount),
-                                            static_cast<uint8_t>(mZonesMax));
+                                            static_cast<uint8_t>(mZonesWillRefreshCount));
 
 done:
     return;
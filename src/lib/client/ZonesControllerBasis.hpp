@@ -88,6 +88,7 @@ protected:
     virtual Common::Status Init(CommandManager &aCommandManager, const Common::Timeout &aTimeout);
 
     Common::Status Refresh(const Common::Timeout &aTimeout) final;
+    Common::Status Refresh(const Model::ZoneModel::IdentifierType &aZoneIdentifier);
 
     // Observer Methods
 
@@ -185,7 +186,8 @@ private:
     /**
      *  Ensure the application controller and controller basis can
      *  access the Handle*Change methods for cross zone-to-group and
-     *  group-to-zone state synthesis.
+     *  group-to-zone state synthesis and the single-object Refresh
+     *  method for scoped refreshes.
      */
     friend class Application::Controller;
     friend class Application::ControllerBasis;
@@ -198,6 +200,7 @@ private:
     Model::ZonesModel &                               mZonesModel;
     const Model::ZoneModel::IdentifierType &          mZonesMax;
     size_t                                            mZonesDidRefreshCount;
+    size_t                                            mZonesWillRefreshCount;
 
 protected:
     static Command::Zones::BalanceResponse            kBalanceResponse;
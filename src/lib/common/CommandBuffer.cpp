@@ -24,8 +24,11 @@
 
 #include "CommandBuffer.hpp"
 
+#include <errno.h>
 #include <string.h>
 
+#include <OpenHLX/Utilities/Assert.hpp>
+
 
 namespace HLX
 {
@@ -101,6 +104,39 @@ Buffer :: Init(const char *inStart, const char *inEnd)
     return (kStatus_Success);
 }
 
+/**
+ *  @brief
+ *    This is a class initializer.
+ *
+ *  This initializes the command buffer by gathering, in order, the
+ *  specified buffer extents such that fragments of a command need
+ *  not first be composed into a temporary buffer.
+ *
+ *  @param[in]  inVectors  A pointer to the array of buffer extents
+ *                         to initialize the command buffer with.
+ *  @param[in]  inCount    An immutable reference to the number of
+ *                         buffer extents in @a inVectors.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If @a inVectors was null and @a inCount
+ *                            was non-zero.
+ *
+ */
+Status
+Buffer :: Init(const struct iovec *inVectors, const size_t &inCount)
+{
+    Status  lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION((inVectors != nullptr) || (inCount == 0), done, lRetval = -EINVAL);
+
+    ResetBuffer(GetVectorsSize(inVectors, inCount));
+
+    AppendBuffer(inVectors, inCount);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Get a pointer to the start of the command buffer contents.
@@ -147,6 +183,78 @@ Buffer :: AppendBuffer(const char *inStart, const char *inEnd)
     mBuffer.insert(mBuffer.end(), inStart, inEnd);
 }
 
+/**
+ *  @brief
+ *    Append content to the command buffer.
+ *
+ *  This appends to the command buffer, in order, the specified
+ *  buffer extents.
+ *
+ *  @param[in]  inVectors  A pointer to the array of buffer extents
+ *                         to append to the command buffer.
+ *  @param[in]  inCount    An immutable reference to the number of
+ *                         buffer extents in @a inVectors.
+ *
+ */
+void
+Buffer :: AppendBuffer(const struct iovec *inVectors, const size_t &inCount)
+{
+    size_t  lVector;
+
+    for (lVector = 0; lVector < inCount; lVector++)
+    {
+        const char *  lStart = static_cast<const char *>(inVectors[lVector].iov_base);
+
+        AppendBuffer(lStart, lStart + inVectors[lVector].iov_len);
+    }
+}
+
+/**
+ *  @brief
+ *    Empty the command buffer contents.
+ *
+ *  This empties the command buffer contents and ensures that it has
+ *  sufficient capacity for the specified size of content such that
+ *  the subsequent appends of that content do not reallocate.
+ *
+ *  @param[in]  inCapacity  An immutable reference to the size, in
+ *                          bytes, of content to be appended.
+ *
+ */
+void
+Buffer :: ResetBuffer(const size_t &inCapacity)
+{
+    mBuffer.clear();
+
+    mBuffer.reserve(inCapacity);
+}
+
+/**
+ *  @brief
+ *    Return the total size of the specified buffer extents.
+ *
+ *  @param[in]  inVectors  A pointer to the array of buffer extents.
+ *  @param[in]  inCount    An immutable reference to the number of
+ *                         buffer extents in @a inVectors.
+ *
+ *  @returns
+ *    The total size, in bytes, of the buffer extents.
+ *
+ */
+size_t
+Buffer :: GetVectorsSize(const struct iovec *inVectors, const size_t &inCount)
+{
+    size_t  lVector;
+    size_t  lRetval = 0;
+
+    for (lVector = 0; lVector < inCount; lVector++)
+    {
+        lRetval += inVectors[lVector].iov_len;
+    }
+
+    return (lRetval);
+}
+
 }; // namespace Command
 
 }; // namespace Common
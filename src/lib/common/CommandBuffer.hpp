@@ -28,6 +28,7 @@
 #include <vector>
 
 #include <stddef.h>
+#include <sys/uio.h>
 
 #include <OpenHLX/Common/Errors.hpp>
 
@@ -56,6 +57,7 @@ public:
     Common::Status Init(const char *inBuffer);
     Common::Status Init(const char *inBuffer, const size_t &inSize);
     Common::Status Init(const char *inStart, const char *inEnd);
+    Common::Status Init(const struct iovec *inVectors, const size_t &inCount);
 
     const uint8_t *GetBuffer(void) const;
     size_t GetSize(void) const;
@@ -63,8 +65,11 @@ public:
 protected:
     Buffer(void) = default;
 
-private:
+    void ResetBuffer(const size_t &inCapacity);
     void AppendBuffer(const char *inStart, const char *inEnd);
+    void AppendBuffer(const struct iovec *inVectors, const size_t &inCount);
+
+    static size_t GetVectorsSize(const struct iovec *inVectors, const size_t &inCount);
 
 private:
     std::vector<char>  mBuffer;
@@ -27,6 +27,7 @@
 #define OPENHLXCOMMONCOMMANDBUFFERBASIS_HPP
 
 #include <stddef.h>
+#include <sys/uio.h>
 
 #include <OpenHLX/Common/Errors.hpp>
 
@@ -86,6 +87,25 @@ public:
      */
     virtual Common::Status Init(const char *inStart, const char *inEnd) = 0;
 
+    /**
+     *  @brief
+     *    This is a class initializer.
+     *
+     *  This initializes the command buffer by gathering, in order,
+     *  the specified buffer extents.
+     *
+     *  @param[in]  inVectors  A pointer to the array of buffer extents
+     *                         to initialize the command buffer with.
+     *  @param[in]  inCount    An immutable reference to the number of
+     *                         buffer extents in @a inVectors.
+     *
+     *  @retval  kStatus_Success  If successful.
+     *  @retval  -EINVAL          If @a inVectors was null and @a
+     *                            inCount was non-zero.
+     *
+     */
+    virtual Common::Status Init(const struct iovec *inVectors, const size_t &inCount) = 0;
+
 protected:
     BufferBasis(void) = default;
 };
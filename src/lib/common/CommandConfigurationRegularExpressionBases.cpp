@@ -48,6 +48,17 @@ namespace Configuration
  */
 const char * const LoadFromBackupRegularExpressionBasis::kRegexp     = "LOAD";
 
+/**
+ *  The configuration query changed command regular expression pattern
+ *  string.
+ *
+ *  @note
+ *    This is an extension to the HLX command set, supported only by
+ *    the HLX proxy and simulator, and not by HLX hardware.
+ *
+ */
+const char * const QueryChangedRegularExpressionBasis::kRegexp       = "QD([[:digit:]]+)";
+
 /**
  *  The configuration query current command regular expression pattern
  *  string.
@@ -69,6 +80,28 @@ const char * const ResetToDefaultsRegularExpressionBasis::kRegexp    = "RESET";
  */
 const char * const SaveToBackupRegularExpressionBasis::kRegexp       = "SAVE";
 
+/**
+ *  The configuration subscribe command regular expression pattern
+ *  string.
+ *
+ *  @note
+ *    This is an extension to the HLX command set, supported only by
+ *    the HLX proxy, and not by HLX hardware.
+ *
+ */
+const char * const SubscribeRegularExpressionBasis::kRegexp          = "SUB(O|G|I|F|EP)([[:digit:]]+(,[[:digit:]]+)*)";
+
+/**
+ *  The configuration subscribe all command regular expression pattern
+ *  string.
+ *
+ *  @note
+ *    This is an extension to the HLX command set, supported only by
+ *    the HLX proxy, and not by HLX hardware.
+ *
+ */
+const char * const SubscribeAllRegularExpressionBasis::kRegexp       = "SUBX";
+
 /**
  *  The configuration load from backup command regular expression
  *  pattern expected substring matches.
@@ -76,6 +109,13 @@ const char * const SaveToBackupRegularExpressionBasis::kRegexp       = "SAVE";
  */
 const size_t LoadFromBackupRegularExpressionBasis::kExpectedMatches  = 1;
 
+/**
+ *  The configuration query changed command regular expression
+ *  pattern expected substring matches.
+ *
+ */
+const size_t QueryChangedRegularExpressionBasis::kExpectedMatches    = 2;
+
 /**
  *  The configuration query current command regular expression
  *  pattern expected substring matches.
@@ -97,6 +137,20 @@ const size_t ResetToDefaultsRegularExpressionBasis::kExpectedMatches = 1;
  */
 const size_t SaveToBackupRegularExpressionBasis::kExpectedMatches    = 1;
 
+/**
+ *  The configuration subscribe command regular expression pattern
+ *  expected substring matches.
+ *
+ */
+const size_t SubscribeRegularExpressionBasis::kExpectedMatches       = 4;
+
+/**
+ *  The configuration subscribe all command regular expression pattern
+ *  expected substring matches.
+ *
+ */
+const size_t SubscribeAllRegularExpressionBasis::kExpectedMatches    = 1;
+
 /**
  *  @brief
  *    This initializes the configuration load from backup command
@@ -116,6 +170,25 @@ LoadFromBackupRegularExpressionBasis :: Init(RegularExpressionBasis &aRegularExp
     return (aRegularExpression.Init(kRegexp, kExpectedMatches));
 }
 
+/**
+ *  @brief
+ *    This initializes the configuration query changed command
+ *    regular expression.
+ *
+ *  @param[in,out]  aRegularExpression  A mutable reference to the
+ *                                      configuration query changed
+ *                                      command regular expression to
+ *                                      initialize.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+QueryChangedRegularExpressionBasis :: Init(RegularExpressionBasis &aRegularExpression)
+{
+    return (aRegularExpression.Init(kRegexp, kExpectedMatches));
+}
+
 /**
  *  @brief
  *    This initializes the configuration query current command
@@ -173,6 +246,44 @@ SaveToBackupRegularExpressionBasis :: Init(RegularExpressionBasis &aRegularExpre
     return (aRegularExpression.Init(kRegexp, kExpectedMatches));
 }
 
+/**
+ *  @brief
+ *    This initializes the configuration subscribe command regular
+ *    expression.
+ *
+ *  @param[in,out]  aRegularExpression  A mutable reference to the
+ *                                      configuration subscribe
+ *                                      command regular expression to
+ *                                      initialize.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+SubscribeRegularExpressionBasis :: Init(RegularExpressionBasis &aRegularExpression)
+{
+    return (aRegularExpression.Init(kRegexp, kExpectedMatches));
+}
+
+/**
+ *  @brief
+ *    This initializes the configuration subscribe all command regular
+ *    expression.
+ *
+ *  @param[in,out]  aRegularExpression  A mutable reference to the
+ *                                      configuration subscribe all
+ *                                      command regular expression to
+ *                                      initialize.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+SubscribeAllRegularExpressionBasis :: Init(RegularExpressionBasis &aRegularExpression)
+{
+    return (aRegularExpression.Init(kRegexp, kExpectedMatches));
+}
+
 }; // namespace Configuration
 
 }; // namespace Command
@@ -75,6 +75,35 @@ private:
     static const char * const kRegexp;
 };
 
+/**
+ *  @brief
+ *    Base regular expression object for HLX configuration query
+ *    changed command.
+ *
+ *  This defines a base, common (that is, independent of requestor or
+ *  responder) regular expression object for HLX configuration query
+ *  changed command.
+ *
+ *  @ingroup common
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class QueryChangedRegularExpressionBasis
+{
+protected:
+    QueryChangedRegularExpressionBasis(void) = default;
+    virtual ~QueryChangedRegularExpressionBasis(void) = default;
+
+    static Common::Status Init(RegularExpressionBasis &aRegularExpression);
+
+public:
+    static const size_t       kExpectedMatches;
+
+private:
+    static const char * const kRegexp;
+};
+
 /**
  *  @brief
  *    Base regular expression object for HLX configuration query
@@ -162,6 +191,64 @@ private:
     static const char * const kRegexp;
 };
 
+/**
+ *  @brief
+ *    Base regular expression object for HLX configuration subscribe
+ *    command.
+ *
+ *  This defines a base, common (that is, independent of requestor or
+ *  responder) regular expression object for HLX configuration subscribe
+ *  command.
+ *
+ *  @ingroup common
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class SubscribeRegularExpressionBasis
+{
+protected:
+    SubscribeRegularExpressionBasis(void) = default;
+    virtual ~SubscribeRegularExpressionBasis(void) = default;
+
+    static Common::Status Init(RegularExpressionBasis &aRegularExpression);
+
+public:
+    static const size_t       kExpectedMatches;
+
+private:
+    static const char * const kRegexp;
+};
+
+/**
+ *  @brief
+ *    Base regular expression object for HLX configuration subscribe all
+ *    command.
+ *
+ *  This defines a base, common (that is, independent of requestor or
+ *  responder) regular expression object for HLX configuration subscribe all
+ *  command.
+ *
+ *  @ingroup common
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class SubscribeAllRegularExpressionBasis
+{
+protected:
+    SubscribeAllRegularExpressionBasis(void) = default;
+    virtual ~SubscribeAllRegularExpressionBasis(void) = default;
+
+    static Common::Status Init(RegularExpressionBasis &aRegularExpression);
+
+public:
+    static const size_t       kExpectedMatches;
+
+private:
+    static const char * const kRegexp;
+};
+
 }; // namespace Configuration
 
 }; // namespace Command
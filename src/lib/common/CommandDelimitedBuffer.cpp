@@ -26,8 +26,7 @@
 
 #include "CommandDelimitedBuffer.hpp"
 
-#include <string>
-
+#include <errno.h>
 #include <string.h>
 
 #include <OpenHLX/Utilities/Assert.hpp>
@@ -111,24 +110,56 @@ DelimitedBuffer :: Init(const Delimiters &inDelimiters,
                         const char *inStart,
                         const char *inEnd)
 {
-    /*
-     * Ideally, the underlying buffer would have an initialization
-     * interface that would allow initialization through an array of
-     * start and end iterators; however, for now, we deal with the
-     * slight inefficiency of composiing a temporary string.
-     */
-    std::string  lTempString;
-    Status       lRetval = kStatus_Success;
+    struct iovec  lVector;
+
+    lVector.iov_base = const_cast<char *>(inStart);
+    lVector.iov_len  = static_cast<size_t>(inEnd - inStart);
+
+    return (Init(inDelimiters, &lVector, 1));
+}
+
+/**
+ *  @brief
+ *    This is a class initializer.
+ *
+ *  This initializes the command buffer with the specified delimiters
+ *  and by gathering, in order, the specified string extents between
+ *  them, such that the delimiters and fragments of a command are
+ *  copied exactly once, without first being composed into a
+ *  temporary string.
+ *
+ *  @param[in]  inDelimiters  An immutable reference to the command
+ *                            delimiters to compose the command
+ *                            buffer with.
+ *  @param[in]  inVectors     A pointer to the array of string extents
+ *                            to initialize the command buffer with.
+ *  @param[in]  inCount       An immutable reference to the number of
+ *                            string extents in @a inVectors.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If @a inVectors was null and @a inCount
+ *                            was non-zero.
+ *
+ */
+Status
+DelimitedBuffer :: Init(const Delimiters &inDelimiters,
+                        const struct iovec *inVectors,
+                        const size_t &inCount)
+{
+    const size_t  lStartSize = strlen(inDelimiters.mStart);
+    const size_t  lEndSize   = strlen(inDelimiters.mEnd);
+    Status        lRetval    = kStatus_Success;
+
 
+    nlREQUIRE_ACTION((inVectors != nullptr) || (inCount == 0), done, lRetval = -EINVAL);
 
-    lTempString += inDelimiters.mStart;
+    ResetBuffer(lStartSize + GetVectorsSize(inVectors, inCount) + lEndSize);
 
-    lTempString.insert(lTempString.end(), inStart, inEnd);
+    AppendBuffer(inDelimiters.mStart, inDelimiters.mStart + lStartSize);
 
-    lTempString += inDelimiters.mEnd;
+    AppendBuffer(inVectors, inCount);
 
-    lRetval = Buffer::Init(lTempString.c_str(), lTempString.size());
-    nlREQUIRE_SUCCESS(lRetval, done);
+    AppendBuffer(inDelimiters.mEnd, inDelimiters.mEnd + lEndSize);
 
  done:
     return (lRetval);
@@ -63,6 +63,7 @@ protected:
     Common::Status Init(const Delimiters &inDelimiters, const char *inBuffer);
     Common::Status Init(const Delimiters &inDelimiters, const char *inBuffer, const size_t &inSize);
     Common::Status Init(const Delimiters &inDelimiters, const char *inStart, const char *inEnd);
+    Common::Status Init(const Delimiters &inDelimiters, const struct iovec *inVectors, const size_t &inCount);
 };
 
 }; // namespace Command
@@ -27,11 +27,15 @@
 
 #include <string>
 
+#include <string.h>
+#include <sys/uio.h>
+
 #include <LogUtilities/LogUtilities.hpp>
 
 #include <OpenHLX/Common/CommandBufferBasis.hpp>
 #include <OpenHLX/Common/OutputStringStream.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
+#include <OpenHLX/Utilities/ElementsOf.hpp>
 
 using namespace HLX::Common;
 using namespace HLX::Model;
@@ -85,7 +89,8 @@ PropertyBufferBasis :: Init(BufferBasis &          aBuffer,
                             const char *           aOperation)
 {
     OutputStringStream  lIdentifierStream;
-    std::string         lBuffer;
+    std::string         lIdentifier;
+    struct iovec        lVectors[4];
 
     // Upcast the identifier to an unsigned integer to ensure it is
     // interpretted as something to be converted rather than a
@@ -93,16 +98,23 @@ PropertyBufferBasis :: Init(BufferBasis &          aBuffer,
 
     lIdentifierStream << aIdentifier;
 
+    lIdentifier = lIdentifierStream.str();
+
     // Compose the buffer with the property, the object the property
     // belongs to, the object identifier, and the property operation
-    // (for example, increment, set, etc.).
+    // (for example, increment, set, etc.), gathering each in place
+    // rather than first concatenating them into a temporary string.
 
-    lBuffer = aProperty;
-    lBuffer += aObject;
-    lBuffer += lIdentifierStream.str();
-    lBuffer += aOperation;
+    lVectors[0].iov_base = &aProperty;
+    lVectors[0].iov_len  = sizeof (aProperty);
+    lVectors[1].iov_base = const_cast<char *>(aObject);
+    lVectors[1].iov_len  = strlen(aObject);
+    lVectors[2].iov_base = const_cast<char *>(lIdentifier.data());
+    lVectors[2].iov_len  = lIdentifier.size();
+    lVectors[3].iov_base = const_cast<char *>(aOperation);
+    lVectors[3].iov_len  = strlen(aOperation);
 
-    return (aBuffer.Init(lBuffer.c_str(), lBuffer.size()));
+    return (aBuffer.Init(&lVectors[0], HLX::Utilities::ElementsOf(lVectors)));
 }
 
 /**
@@ -108,6 +108,31 @@ RoleDelimitedBuffer :: Init(const Role &inRole, const char *inStart, const char
     return (DelimitedBuffer::Init(GetRoleBufferDelimiters(inRole), inStart, inEnd));
 }
 
+/**
+ *  @brief
+ *    This is a class initializer.
+ *
+ *  This initializes the command buffer with the specified role and
+ *  by gathering, in order, the specified string extents.
+ *
+ *  @param[in]  inRole     An immutable reference to the command role
+ *                         to compose the command buffer with.
+ *  @param[in]  inVectors  A pointer to the array of string extents
+ *                         to initialize the command buffer with.
+ *  @param[in]  inCount    An immutable reference to the number of
+ *                         string extents in @a inVectors.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If @a inVectors was null and @a inCount
+ *                            was non-zero.
+ *
+ */
+Status
+RoleDelimitedBuffer :: Init(const Role &inRole, const struct iovec *inVectors, const size_t &inCount)
+{
+    return (DelimitedBuffer::Init(GetRoleBufferDelimiters(inRole), inVectors, inCount));
+}
+
 }; // namespace Command
 
 }; // namespace Common
@@ -66,6 +66,7 @@ protected:
     Common::Status Init(const Role &inRole, const char *inBuffer);
     Common::Status Init(const Role &inRole, const char *inBuffer, const size_t &inSize);
     Common::Status Init(const Role &inRole, const char *inStart, const char *inEnd);
+    Common::Status Init(const Role &inRole, const struct iovec *inVectors, const size_t &inCount);
 };
 
 }; // namespace Command
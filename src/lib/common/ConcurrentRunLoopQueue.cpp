@@ -0,0 +1,481 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a thread-safe, run loop-aware queue for
+ *      handing non-retained and unmanaged object pointers from any
+ *      number of producer threads to a single run loop.
+ *
+ */
+
+#include "ConcurrentRunLoopQueue.hpp"
+
+#include <errno.h>
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/ConcurrentRunLoopQueueDelegate.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+ConcurrentRunLoopQueue :: ConcurrentRunLoopQueue(void) :
+    mRunLoopParameters(),
+    mDelegate(nullptr),
+    mRunLoopSourceRef(nullptr),
+    mSignaled(false),
+    mStub(),
+    mHead(&mStub),
+    mTail(&mStub)
+{
+    mStub.mNext.store(nullptr, std::memory_order_relaxed);
+    mStub.mElement = nullptr;
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ *  Any links still on the queue are destroyed; however, as with
+ *  elements removed with #Pop, the caller remains responsible for the
+ *  life time of the elements they held.
+ *
+ */
+ConcurrentRunLoopQueue :: ~ConcurrentRunLoopQueue(void)
+{
+    Node *  lNext;
+
+    if (mRunLoopSourceRef != nullptr)
+    {
+        CFRunLoopRemoveSource(mRunLoopParameters.GetRunLoop(),
+                              mRunLoopSourceRef,
+                              mRunLoopParameters.GetRunLoopMode());
+
+        CFURelease(mRunLoopSourceRef);
+
+        mRunLoopSourceRef = nullptr;
+    }
+
+    while (mTail != nullptr)
+    {
+        lNext = mTail->mNext.load(std::memory_order_acquire);
+
+        if (mTail != &mStub)
+        {
+            delete mTail;
+        }
+
+        mTail = lNext;
+    }
+}
+
+/**
+ *  @brief
+ *    This is a class initializer.
+ *
+ *  This initializes the run loop queue on a run loop with the
+ *  specified run loop parameters.
+ *
+ *  @param[in]  aRunLoopParameters  An immutable reference to the run
+ *                                  loop parameters to initialize the
+ *                                  queue with.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          Resources for the run loop source could
+ *                            not be allocated.
+ *
+ */
+Status
+ConcurrentRunLoopQueue :: Init(const RunLoopParameters &aRunLoopParameters)
+{
+    Status                  lRetval = kStatus_Success;
+    CFRunLoopSourceContext  lContext;
+    CFRunLoopSourceRef      lRunLoopSourceRef;
+
+    lContext.version         = 0;
+    lContext.info            = this;
+    lContext.retain          = nullptr;
+    lContext.release         = nullptr;
+    lContext.copyDescription = ConcurrentRunLoopQueue::CopyDescription;
+    lContext.equal           = nullptr;
+    lContext.hash            = nullptr;
+    lContext.schedule        = nullptr;
+    lContext.cancel          = nullptr;
+    lContext.perform         = ConcurrentRunLoopQueue::Perform;
+
+    lRunLoopSourceRef = CFRunLoopSourceCreate(kCFAllocatorDefault,
+                                              0,
+                                              &lContext);
+    nlREQUIRE_ACTION(lRunLoopSourceRef != nullptr, done, lRetval = -ENOMEM);
+
+    CFRunLoopAddSource(aRunLoopParameters.GetRunLoop(),
+                       lRunLoopSourceRef,
+                       aRunLoopParameters.GetRunLoopMode());
+
+    mRunLoopParameters = aRunLoopParameters;
+    mRunLoopSourceRef  = lRunLoopSourceRef;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return the delegate for the run loop queue.
+ *
+ *  @returns
+ *    A pointer to the delegate for the run loop queue.
+ *
+ */
+ConcurrentRunLoopQueueDelegate *
+ConcurrentRunLoopQueue :: GetDelegate(void) const
+{
+    return (mDelegate);
+}
+
+/**
+ *  @brief
+ *    Set the delegate for the run loop queue.
+ *
+ *  This attempts to set a delegate for the run loop queue.
+ *
+ *  @note
+ *    This should be set before any element is pushed onto the queue.
+ *
+ *  @param[in]  aDelegate  A pointer to the delegate to set.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the delegate was already set to
+ *                                    the specified value.
+ *
+ */
+Status
+ConcurrentRunLoopQueue :: SetDelegate(ConcurrentRunLoopQueueDelegate *aDelegate)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION(aDelegate != mDelegate, done, lRetval = kStatus_ValueAlreadySet);
+
+    mDelegate = aDelegate;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return whether or not the run loop queue is empty.
+ *
+ *  @note
+ *    This may only be called on the run loop the queue was
+ *    initialized with. An element whose push is still in progress on
+ *    another thread may not yet be observed.
+ *
+ *  @returns
+ *    True if the run loop queue is empty; otherwise, false.
+ *
+ */
+bool
+ConcurrentRunLoopQueue :: IsEmpty(void) const
+{
+    return (mTail->mNext.load(std::memory_order_acquire) == nullptr);
+}
+
+/**
+ *  @brief
+ *    Place an element onto the run loop queue.
+ *
+ *  This places the specified element, by pointer, onto the tail of
+ *  the run loop queue and, if the queue is not already signaled,
+ *  signals and wakes the run loop it was initialized with.
+ *
+ *  @note
+ *    This may be called from any thread.
+ *
+ *  @note
+ *    The caller is responsible for managing the life time of the
+ *    object placed onto the queue.
+ *
+ *  @param[in]  aElement  The element to be added to the queue.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  -EINVAL                If the element is null.
+ *  @retval  -ENOMEM                If resources for the queue link
+ *                                  could not be allocated.
+ *  @retval  kError_NotInitialized  If the run loop queue has not been
+ *                                  initialized.
+ *
+ *  @sa Init
+ *  @sa Pop
+ *
+ */
+Status
+ConcurrentRunLoopQueue :: Push(element_type aElement)
+{
+    Node *  lNode;
+    Node *  lPrevious;
+    bool    lWasSignaled;
+    Status  lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mRunLoopSourceRef != nullptr, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aElement != nullptr, done, lRetval = -EINVAL);
+
+    lNode = new Node;
+    nlREQUIRE_ACTION(lNode != nullptr, done, lRetval = -ENOMEM);
+
+    lNode->mNext.store(nullptr, std::memory_order_relaxed);
+    lNode->mElement = aElement;
+
+    // Claim the head of the queue and then link the prior head to
+    // the new one. Until that link is made, the consumer simply
+    // observes the queue as ending at the prior head.
+
+    lPrevious = mHead.exchange(lNode, std::memory_order_acq_rel);
+
+    lPrevious->mNext.store(lNode, std::memory_order_release);
+
+    // Only the first push since the consumer last cleared the signal
+    // needs to signal and wake the run loop; any others are picked up
+    // by the same delegation.
+
+    lWasSignaled = mSignaled.exchange(true, std::memory_order_acq_rel);
+
+    if (!lWasSignaled)
+    {
+        CFRunLoopSourceSignal(mRunLoopSourceRef);
+        CFRunLoopWakeUp(mRunLoopParameters.GetRunLoop());
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Removes an element from the run loop queue.
+ *
+ *  This attempts to remove, if present, an element, from the head of
+ *  the run loop queue.
+ *
+ *  @note
+ *    This may only be called on the run loop the queue was
+ *    initialized with.
+ *
+ *  @note
+ *    The caller is responsible for managing the life time of the
+ *    object removed from the queue.
+ *
+ *  @returns
+ *    A pointer to the element at the head of the run loop queue, if
+ *    successful; otherwise, a null pointer if the queue is empty.
+ *
+ *  @sa Push
+ *
+ */
+ConcurrentRunLoopQueue::element_type
+ConcurrentRunLoopQueue :: Pop(void)
+{
+    Node *        lTail = mTail;
+    Node *        lNext;
+    element_type  lRetval = nullptr;
+
+    nlREQUIRE(mRunLoopSourceRef != nullptr, done);
+
+    lNext = lTail->mNext.load(std::memory_order_acquire);
+    nlEXPECT(lNext != nullptr, done);
+
+    // The next link becomes the new, now element-less, tail and the
+    // prior tail is discarded.
+
+    lRetval         = lNext->mElement;
+    lNext->mElement = nullptr;
+
+    mTail = lNext;
+
+    if (lTail != &mStub)
+    {
+        delete lTail;
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    This is a class equality operator.
+ *
+ *  This compares the provided run loop queue against this one to
+ *  determine if they are equal to one another.
+ *
+ *  @param[in]  aQueue  An immutable reference to the run loop
+ *                      queue to compare for equality.
+ *
+ *  @returns
+ *    True if this run loop queue is equal to the specified one;
+ *    otherwise, false.
+ *
+ */
+bool
+ConcurrentRunLoopQueue :: operator ==(const ConcurrentRunLoopQueue &aQueue) const
+{
+    const bool lRetval = (this == &aQueue);
+
+    return (lRetval);
+}
+
+// MARK: CoreFoundation Run Loop Handlers
+
+/**
+ *  @brief
+ *    Callback to return a description of this CoreFoundation run loop
+ *    source object.
+ *
+ *  This returns a description of this CoreFoundation run loop source
+ *  object in response to CFCopyDescription on the run loop source.
+ *
+ *  @returns
+ *    An CoreFoundation immutable string reference for the run loop
+ *    source object description.
+ *
+ */
+CFStringRef
+ConcurrentRunLoopQueue :: CopyDescription(void) const
+{
+    return (CFSTR("Open HLX Concurrent Run Loop Queue"));
+}
+
+/**
+ *  @brief
+ *    Callback to perform any work associated with this CoreFoundation
+ *    run loop source object.
+ *
+ *  This clears the queue signal, such that any subsequent push
+ *  signals anew, and then issues a single not-empty delegation for
+ *  all of the elements pushed since the last one.
+ *
+ */
+void
+ConcurrentRunLoopQueue :: Perform(void)
+{
+    bool  lWasSignaled;
+
+    // Clearing the signal with an exchange, rather than a store,
+    // acquires any links made by pushes that found the queue already
+    // signaled and, therefore, did not signal it themselves.
+
+    lWasSignaled = mSignaled.exchange(false, std::memory_order_acq_rel);
+    (void)lWasSignaled;
+
+    if (!IsEmpty())
+    {
+        if (mDelegate != nullptr)
+        {
+            mDelegate->QueueIsNotEmpty(*this);
+        }
+
+        // If the delegate left any elements on the queue, ensure
+        // they are revisited on a later pass through the run loop.
+
+        if (!IsEmpty())
+        {
+            lWasSignaled = mSignaled.exchange(true, std::memory_order_acq_rel);
+
+            if (!lWasSignaled)
+            {
+                CFRunLoopSourceSignal(mRunLoopSourceRef);
+            }
+        }
+    }
+}
+
+// MARK: CoreFoundation Run Loop Handler Trampolines
+
+/**
+ *  @brief
+ *    Callback trampoline to return a description of this
+ *    CoreFoundation run loop source object.
+ *
+ *  @param[in]  aContext  A pointer to the run loop queue class
+ *                        instance that registered this
+ *                        trampoline to call back into from
+ *                        the trampoline.
+ *
+ *  @returns
+ *    An CoreFoundation immutable string reference for the run loop
+ *    source object description.
+ *
+ */
+CFStringRef
+ConcurrentRunLoopQueue :: CopyDescription(const void *aContext)
+{
+    const ConcurrentRunLoopQueue * lRunLoopQueue = static_cast<const ConcurrentRunLoopQueue *>(aContext);
+    CFStringRef                    lRetval = nullptr;
+
+    if (lRunLoopQueue != nullptr)
+    {
+        lRetval = lRunLoopQueue->CopyDescription();
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Callback trampoline to perform any work associated with this
+ *    CoreFoundation run loop source object.
+ *
+ *  @param[in]  aContext  A pointer to the run loop queue class
+ *                        instance that registered this
+ *                        trampoline to call back into from
+ *                        the trampoline.
+ *
+ */
+void
+ConcurrentRunLoopQueue :: Perform(void *aContext)
+{
+    ConcurrentRunLoopQueue *lRunLoopQueue = static_cast<ConcurrentRunLoopQueue *>(aContext);
+
+    if (lRunLoopQueue != nullptr)
+    {
+        lRunLoopQueue->Perform();
+    }
+}
+
+}; // namespace Common
+
+}; // namespace HLX
@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines a thread-safe, run loop-aware queue for
+ *      handing non-retained and unmanaged object pointers from any
+ *      number of producer threads to a single run loop.
+ *
+ */
+
+#ifndef OPENHLXCOMMONCONCURRENTRUNLOOPQUEUE_HPP
+#define OPENHLXCOMMONCONCURRENTRUNLOOPQUEUE_HPP
+
+#include <atomic>
+
+#include <CoreFoundation/CFRunLoop.h>
+
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+class ConcurrentRunLoopQueueDelegate;
+
+/**
+ *  @brief
+ *     A thread-safe, run loop-aware queue for handing non-retained
+ *     and unmanaged object pointers from any number of producer
+ *     threads to a single run loop.
+ *
+ *  Unlike #RunLoopQueue, which may only be used from the thread of
+ *  the run loop it is initialized with, elements may be pushed onto
+ *  this queue from any thread. Elements may only be popped from the
+ *  queue on the run loop it is initialized with.
+ *
+ *  The queue is a lock-free, multiple-producer, single-consumer
+ *  linked queue, such that pushes never contend on a lock with one
+ *  another or with the consumer. Wakeups are batched, such that only
+ *  the first push onto a queue not already signaled signals and wakes
+ *  the run loop, and a burst of pushes results in a single
+ *  not-empty delegation.
+ *
+ *  @ingroup common
+ *
+ */
+class ConcurrentRunLoopQueue
+{
+public:
+    /**
+     *  The type of element stored by the run loop queue.
+     *
+     */
+    typedef void * element_type;
+
+public:
+    ConcurrentRunLoopQueue(void);
+    ~ConcurrentRunLoopQueue(void);
+
+    Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters);
+
+    ConcurrentRunLoopQueueDelegate *GetDelegate(void) const;
+
+    Common::Status SetDelegate(ConcurrentRunLoopQueueDelegate *aDelegate);
+
+    bool            IsEmpty(void) const;
+
+    Common::Status  Push(element_type aElement);
+    element_type    Pop(void);
+
+    bool operator ==(const ConcurrentRunLoopQueue &aQueue) const;
+
+    // CFRunLoop Handler Trampolines
+
+    static CFStringRef CopyDescription(const void *aContext);
+    static void        Perform(void *aContext);
+
+private:
+    /**
+     *  A queue link, holding a single element.
+     *
+     */
+    struct Node
+    {
+        std::atomic<Node *>  mNext;    //!< The next, more recently pushed, link.
+        element_type         mElement; //!< The element held by the link.
+    };
+
+    // CFRunLoop Handlers
+
+    CFStringRef        CopyDescription(void) const;
+    void               Perform(void);
+
+private:
+    Common::RunLoopParameters          mRunLoopParameters;
+    ConcurrentRunLoopQueueDelegate *   mDelegate;
+    CFRunLoopSourceRef                 mRunLoopSourceRef;
+    std::atomic<bool>                  mSignaled;
+    Node                               mStub;
+    std::atomic<Node *>                mHead;
+    Node *                             mTail;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONCONCURRENTRUNLOOPQUEUE_HPP
@@ -0,0 +1,76 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines a delegate interface for a thread-safe, run
+ *      loop-aware queue.
+ *
+ */
+
+#ifndef OPENHLXCOMMONCONCURRENTRUNLOOPQUEUEDELEGATE_HPP
+#define OPENHLXCOMMONCONCURRENTRUNLOOPQUEUEDELEGATE_HPP
+
+#include <OpenHLX/Common/Errors.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+class ConcurrentRunLoopQueue;
+
+/**
+ *  @brief
+ *    Abstract delegate definition for a thread-safe, run loop-aware
+ *    queue.
+ *
+ *  @ingroup common
+ *
+ */
+class ConcurrentRunLoopQueueDelegate
+{
+public:
+    ConcurrentRunLoopQueueDelegate(void) = default;
+    ~ConcurrentRunLoopQueueDelegate(void) = default;
+
+    /**
+     *  @brief
+     *    Delegation from a run loop queue that the queue is not
+     *    empty.
+     *
+     *  This is issued on the run loop the queue was initialized with,
+     *  once for any number of elements pushed since the prior
+     *  delegation. The delegate is expected to pop elements until the
+     *  queue is empty; if it does not, the delegation is reissued on
+     *  a later pass through the run loop.
+     *
+     *  @param[in]  aQueue  A reference to the run loop queue that
+     *                      issued the delegation.
+     *
+     */
+    virtual void QueueIsNotEmpty(ConcurrentRunLoopQueue &aQueue) = 0;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONCONCURRENTRUNLOOPQUEUEDELEGATE_HPP
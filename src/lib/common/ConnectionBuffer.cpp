@@ -29,10 +29,14 @@
  *
  */
 
+#include <algorithm>
 #include <new>
+#include <utility>
 
 #include "ConnectionBuffer.hpp"
 
+#include "ConnectionBufferPool.hpp"
+
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -47,6 +51,8 @@ namespace HLX
 namespace Common
 {
 
+const size_t ConnectionBuffer::kDefaultCapacity;
+
 /**
  *  @brief
  *    This is the class default constructor.
@@ -54,9 +60,11 @@ namespace Common
  */
 ConnectionBuffer :: ConnectionBuffer(void) :
     mData(nullptr),
+    mOffset(0),
     mSize(0),
     mCapacity(0),
-    mDataOwner(false)
+    mDataOwner(false),
+    mNext()
 {
     return;
 }
@@ -76,6 +84,74 @@ ConnectionBuffer :: ~ConnectionBuffer(void)
     Destroy();
 }
 
+/**
+ *  @brief
+ *    Create and initialize a buffer with a default capacity.
+ *
+ *  This is equivalent to #Create(MutableCountedPointer &, const
+ *  size_t &) with a capacity suitable for a typical single command
+ *  request or response.
+ *
+ *  @param[out]  outBuffer  A reference to a shared pointer to be set
+ *                          to the created buffer.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If the buffer or its buffer-owned
+ *                            backing store cannot be allocated.
+ *
+ */
+Status ConnectionBuffer :: Create(MutableCountedPointer &outBuffer)
+{
+    return (Create(outBuffer, kDefaultCapacity));
+}
+
+/**
+ *  @brief
+ *    Create and initialize a buffer with the specified capacity.
+ *
+ *  This creates a buffer with a buffer-owned backing store of the
+ *  specified capacity, allocating the buffer and its shared pointer
+ *  control block together in a single allocation. Both the buffer
+ *  and its backing store are allocated from, and returned to when
+ *  the last shared pointer owner releases them, the size-classed
+ *  buffer pool. As a consequence, creating and releasing a small
+ *  buffer, for example, for a single command response, does not
+ *  ordinarily call into the system allocator.
+ *
+ *  @note
+ *    Buffers that are not expected to grow should be filled with
+ *    Utilities::Put, which reserves additional capacity as needed,
+ *    rather than the in-class Put. Buffers accumulating a response of
+ *    more than one part should be filled with Utilities::Append,
+ *    which chains additional fragments as needed.
+ *
+ *  @param[out]  outBuffer   A reference to a shared pointer to be set
+ *                           to the created buffer.
+ *  @param[in]   inCapacity  The capacity, in bytes, of the buffer-
+ *                           owned backing store.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If the buffer or its buffer-owned
+ *                            backing store cannot be allocated.
+ *
+ */
+Status ConnectionBuffer :: Create(MutableCountedPointer &outBuffer, const size_t &inCapacity)
+{
+    MutableCountedPointer lBuffer;
+    Status lRetval;
+
+    lBuffer = std::allocate_shared<ConnectionBuffer>(ConnectionBufferPool::Allocator<ConnectionBuffer>());
+    nlREQUIRE_ACTION(lBuffer != nullptr, done, lRetval = -ENOMEM);
+
+    lRetval = lBuffer->Init(inCapacity);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    outBuffer = std::move(lBuffer);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    This initializes the buffer with defaults.
@@ -151,16 +227,18 @@ Status ConnectionBuffer :: Init(uint8_t *inData, const size_t &inCapacity)
     if (inData != nullptr)
     {
         mData      = inData;
+        mOffset    = 0;
         mSize      = 0;
         mCapacity  = inCapacity;
         mDataOwner = false;
     }
     else
     {
-        mData      = static_cast<uint8_t *>(malloc(inCapacity));
+        mData      = static_cast<uint8_t *>(ConnectionBufferPool::Allocate(inCapacity));
 
         if (mData != nullptr)
         {
+            mOffset    = 0;
             mSize      = 0;
             mCapacity  = inCapacity;
             mDataOwner = true;
@@ -211,9 +289,18 @@ Status ConnectionBuffer :: Reserve(const size_t &inCapacity)
 
     if (inCapacity > mCapacity)
     {
-        mData = static_cast<uint8_t *>(realloc(mData, inCapacity));
-        nlREQUIRE_ACTION(mData != nullptr, done, lRetval = -ENOMEM);
+        uint8_t *lData;
 
+        // Move any data to the start of the backing store such that
+        // it is preserved by reallocation and so that all of the
+        // additional capacity follows it.
+
+        Compact();
+
+        lData = static_cast<uint8_t *>(ConnectionBufferPool::Reallocate(mData, mCapacity, inCapacity));
+        nlREQUIRE_ACTION(lData != nullptr, done, lRetval = -ENOMEM);
+
+        mData     = lData;
         mCapacity = inCapacity;
     }
 
@@ -252,6 +339,85 @@ size_t ConnectionBuffer :: GetCapacity(void) const
     return (mCapacity);
 }
 
+/**
+ *  @brief
+ *    Return whether the buffer owns its backing store.
+ *
+ *  @returns True if the backing store is buffer-owned; otherwise,
+ *           false if it is caller-owned.
+ *
+ */
+bool ConnectionBuffer :: IsDataOwner(void) const
+{
+    return (mDataOwner);
+}
+
+/**
+ *  @brief
+ *    Return the data size, in bytes, of the buffer and any fragments
+ *    chained to it.
+ *
+ *  @returns The data size, in bytes, of the buffer chain.
+ *
+ *  @sa GetSize
+ *  @sa GetNext
+ *
+ */
+size_t ConnectionBuffer :: GetChainSize(void) const
+{
+    size_t lRetval = mSize;
+
+    for (const ConnectionBuffer *lFragment = mNext.get(); lFragment != nullptr; lFragment = lFragment->mNext.get())
+    {
+        lRetval += lFragment->mSize;
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return the next fragment chained to the buffer.
+ *
+ *  @returns A shared pointer to the mutable next fragment, if any;
+ *           otherwise, null.
+ *
+ */
+ConnectionBuffer::MutableCountedPointer ConnectionBuffer :: GetNext(void)
+{
+    return (mNext);
+}
+
+/**
+ *  @brief
+ *    Return the next fragment chained to the buffer.
+ *
+ *  @returns A shared pointer to the immutable next fragment, if any;
+ *           otherwise, null.
+ *
+ */
+ConnectionBuffer::ImmutableCountedPointer ConnectionBuffer :: GetNext(void) const
+{
+    return (mNext);
+}
+
+/**
+ *  @brief
+ *    Chain the specified fragment to the buffer.
+ *
+ *  This sets the specified fragment, and any fragments chained to it,
+ *  as those following the buffer, releasing any previously chained
+ *  to it.
+ *
+ *  @param[in]  aNext  A shared pointer to the fragment to chain to
+ *                     the buffer, or null to unchain any.
+ *
+ */
+void ConnectionBuffer :: SetNext(MutableCountedPointer aNext)
+{
+    mNext = std::move(aNext);
+}
+
 /**
  *  @brief
  *    Return the pointer to the start, or head, of buffer data.
@@ -263,7 +429,7 @@ size_t ConnectionBuffer :: GetCapacity(void) const
  */
 uint8_t *ConnectionBuffer :: GetHead(void) const
 {
-    return (mData);
+    return (mData + mOffset);
 }
 
 /**
@@ -279,7 +445,7 @@ uint8_t *ConnectionBuffer :: GetHead(void) const
  */
 uint8_t *ConnectionBuffer :: GetTail(void) const
 {
-    return (mData + mSize);
+    return (mData + mOffset + mSize);
 }
 
 /**
@@ -309,6 +475,15 @@ uint8_t *ConnectionBuffer :: Put(const uint8_t *inData, const size_t &inSize)
 
     if (inSize <= (lHeadroom))
     {
+        // If there is sufficient headroom in the buffer but not
+        // following the data, move the data to the start of the
+        // backing store to reclaim the space freed by prior gets.
+
+        if ((mOffset + mSize + inSize) > mCapacity)
+        {
+            Compact();
+        }
+
         lRetval = GetTail();
 
         if (inData != nullptr)
@@ -384,15 +559,21 @@ uint8_t *ConnectionBuffer :: Get(uint8_t *inData, const size_t &inSize)
             memmove(lRetval, lPriorHead, inSize);
         }
 
-        // If there is any data remaining, move it to the head of the
-        // backing store.
+        // Rather than moving any data remaining to the start of the
+        // backing store, simply advance the head past the data
+        // gotten. The space it occupied is reclaimed by Put, if and
+        // when needed, or once the buffer is emptied.
 
-        if (inSize < mSize)
+        mSize -= inSize;
+
+        if (mSize == 0)
         {
-            memmove(lPriorHead, lPriorHead + inSize, mSize - inSize);
+            mOffset = 0;
+        }
+        else
+        {
+            mOffset += inSize;
         }
-
-        mSize -= inSize;
     }
 
     return (lRetval);
@@ -445,7 +626,7 @@ Status ConnectionBuffer :: SetSize(const size_t &inSize)
 {
     Status lRetval = kStatus_Success;
 
-    if (inSize <= mCapacity)
+    if (inSize <= (mCapacity - mOffset))
     {
         mSize = inSize;
     }
@@ -463,7 +644,8 @@ Status ConnectionBuffer :: SetSize(const size_t &inSize)
  *    buffer.
  *
  *  This flushes any data associated with the buffer such that the
- *  data size is zero following this call.
+ *  data size is zero following this call. Any fragments chained to
+ *  the buffer are released.
  *
  *  This call may serve useful between buffer use cycles to reuse the
  *  buffer without otherwise requiring a construct, initialize,
@@ -476,7 +658,10 @@ Status ConnectionBuffer :: SetSize(const size_t &inSize)
  */
 void ConnectionBuffer :: Flush(void)
 {
-    mSize = 0;
+    mOffset = 0;
+    mSize   = 0;
+
+    mNext.reset();
 }
 
 /**
@@ -493,13 +678,42 @@ void ConnectionBuffer :: Destroy(void)
 {
     if (mDataOwner && (mData != nullptr))
     {
-        free(mData);
+        ConnectionBufferPool::Release(mData, mCapacity);
     }
 
     mData      = nullptr;
+    mOffset    = 0;
     mSize      = 0;
     mCapacity  = 0;
     mDataOwner = false;
+
+    mNext.reset();
+}
+
+/**
+ *  @brief
+ *    Move the buffer data to the start of the backing store.
+ *
+ *  This moves any data in the buffer, following prior gets, to the
+ *  start of the backing store such that all of the buffer headroom
+ *  follows the data.
+ *
+ *  @note
+ *    Previously-cached values of GetHead or GetTail may be
+ *    invalidated across this call.
+ *
+ */
+void ConnectionBuffer :: Compact(void)
+{
+    if (mOffset > 0)
+    {
+        if (mSize > 0)
+        {
+            memmove(mData, mData + mOffset, mSize);
+        }
+
+        mOffset = 0;
+    }
 }
 
 /**
@@ -608,6 +822,84 @@ done:
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Append the specified data to the provided buffer chain.
+ *
+ *  This appends (that is, copies in) the specified amount of data to
+ *  the last fragment of the provided buffer chain, if sufficient
+ *  space is available following its data. Otherwise, if the last
+ *  fragment is empty and buffer-owned, its capacity is first
+ *  increased; failing that, a new fragment with twice the capacity
+ *  of the last, or the size of the data, whichever is larger, is
+ *  created and chained to it.
+ *
+ *  Unlike #Put, data already in the chain is never reallocated and
+ *  the data of each append is contiguous within a single
+ *  fragment. Consequently, appending each part of a multi-part
+ *  response costs a single copy of that part, regardless of the size
+ *  the response ultimately reaches.
+ *
+ *  As with the in-class Put interface, if the pointer to the data is
+ *  null, then no data is copied and the size is simply adjusted to
+ *  reflect the requested change in data size.
+ *
+ *  @param[in]  inBuffer  The head of the buffer chain to append the
+ *                        specified data to.
+ *  @param[in]  inData    An optional pointer to the data to be
+ *                        appended (that is, copied) to the buffer
+ *                        chain.
+ *  @param[in]  inSize    The size, in bytes, of data to be appended
+ *                        to the buffer chain.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  -ENOMEM                If a fragment or its backing store
+ *                                  cannot be allocated.
+ *  @retval  -ENOSPC                If the requested size exceeds the
+ *                                  fragment capacity.
+ *
+ */
+Status Append(ConnectionBuffer & inBuffer,
+              const uint8_t *    inData,
+              const size_t &     inSize)
+{
+    ConnectionBuffer *                       lLast = &inBuffer;
+    ConnectionBuffer::MutableCountedPointer  lFragment;
+    const uint8_t *                          lTail;
+    Status                                   lRetval = kStatus_Success;
+
+    for (lFragment = inBuffer.GetNext(); lFragment != nullptr; lFragment = lFragment->GetNext())
+    {
+        lLast = lFragment.get();
+    }
+
+    if (inSize > (lLast->GetCapacity() - lLast->GetSize()))
+    {
+        if ((lLast->GetSize() == 0) && lLast->IsDataOwner())
+        {
+            lRetval = lLast->Reserve(RoundToNextPowerOf2(inSize));
+            nlREQUIRE_SUCCESS(lRetval, done);
+        }
+        else
+        {
+            const size_t lRequestedCapacity = RoundToNextPowerOf2(std::max(lLast->GetCapacity() << 1, inSize));
+
+            lRetval = ConnectionBuffer::Create(lFragment, lRequestedCapacity);
+            nlREQUIRE_SUCCESS(lRetval, done);
+
+            lLast->SetNext(lFragment);
+
+            lLast = lFragment.get();
+        }
+    }
+
+    lTail = lLast->Put(inData, inSize);
+    nlREQUIRE_ACTION(lTail != nullptr, done, lRetval = -ENOSPC);
+
+done:
+    return (lRetval);
+}
+
 }; // namespace Utilities
 
 }; // namespace Common
@@ -43,6 +43,20 @@ namespace Common
  *    An object for sending or receiving data over a peer-to-peer
  *    network connection.
  *
+ *  Data gotten from the head of the buffer is consumed in place by
+ *  advancing the head rather than by moving the data remaining. The
+ *  space so freed is reclaimed, by moving the data remaining to the
+ *  start of the backing store, only when a subsequent put would not
+ *  otherwise fit following the data. Consequently, the data in the
+ *  buffer is always contiguous from #GetHead to #GetTail.
+ *
+ *  A buffer may also be the head of a chain of buffers, or
+ *  fragments, linked with #SetNext and grown with Utilities::Append,
+ *  such that data, for example, a multi-part response, may be
+ *  accumulated without moving or reallocating data already put. The
+ *  data in a chain is the data in each fragment, in turn, from the
+ *  head to the last fragment.
+ *
  *  @ingroup common
  *
  */
@@ -65,16 +79,32 @@ public:
      */
     typedef std::shared_ptr<const ConnectionBuffer> ImmutableCountedPointer;
 
+    /**
+     *  The default capacity, in bytes, of a buffer created with
+     *  #Create.
+     *
+     */
+    static const size_t kDefaultCapacity = 64;
+
 public:
     ConnectionBuffer(void);
     ~ConnectionBuffer(void);
 
+    static Status Create(MutableCountedPointer &aBuffer);
+    static Status Create(MutableCountedPointer &aBuffer, const size_t &aCapacity);
+
     Status    Init(void);
     Status    Init(const size_t &aCapacity);
     Status    Init(uint8_t *aData, const size_t &aCapacity);
 
     size_t    GetSize(void) const;
     size_t    GetCapacity(void) const;
+    bool      IsDataOwner(void) const;
+    size_t    GetChainSize(void) const;
+
+    MutableCountedPointer   GetNext(void);
+    ImmutableCountedPointer GetNext(void) const;
+    void                    SetNext(MutableCountedPointer aNext);
 
     uint8_t * GetHead(void) const;
     uint8_t * GetTail(void) const;
@@ -92,13 +122,16 @@ public:
     void      Destroy(void);
 
 private:
+    void      Compact(void);
     size_t    GetPageSize(void) const;
 
 private:
-    uint8_t * mData;
-    size_t    mSize;
-    size_t    mCapacity;
-    bool      mDataOwner;
+    uint8_t *             mData;
+    size_t                mOffset;
+    size_t                mSize;
+    size_t                mCapacity;
+    bool                  mDataOwner;
+    MutableCountedPointer mNext;
 };
 
 namespace Utilities
@@ -108,6 +141,10 @@ extern Status Put(ConnectionBuffer & inBuffer,
                   const uint8_t *    inData,
                   const size_t &     inSize);
 
+extern Status Append(ConnectionBuffer & inBuffer,
+                     const uint8_t *    inData,
+                     const size_t &     inSize);
+
 }; // namespace Utilities
 
 }; // namespace Common
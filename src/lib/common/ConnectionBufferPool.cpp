@@ -0,0 +1,344 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for allocating and recycling
+ *      the backing stores and objects of buffers for sending or
+ *      receiving data over a peer-to-peer network connection.
+ *
+ */
+
+#include "ConnectionBufferPool.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <OpenHLX/Utilities/Assert.hpp>
+#include <OpenHLX/Utilities/ElementsOf.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+namespace Detail
+{
+
+/**
+ *  A size class, the size to which allocations at or below it are
+ *  rounded up and the maximum number of free blocks of that size
+ *  retained by each thread for reuse.
+ *
+ */
+struct SizeClass
+{
+    size_t  mSize;
+    size_t  mFreeMax;
+};
+
+/**
+ *  The size classes, in increasing order of size. The smallest
+ *  accommodates most single command responses as well as the
+ *  combined control block and object of a shared buffer pointer. The
+ *  largest accommodates a page-sized buffer.
+ *
+ */
+static const SizeClass sSizeClasses[] = {
+    {   64, 256 },
+    {  128, 128 },
+    {  512,  64 },
+    { 4096,  16 }
+};
+
+static const size_t kSizeClasses = HLX::Utilities::ElementsOf(sSizeClasses);
+
+/**
+ *  A free block, linked through its own storage.
+ *
+ */
+struct FreeBlock
+{
+    FreeBlock *  mNext;
+};
+
+/**
+ *  A per-thread free block cache.
+ *
+ *  This is deliberately trivial such that it is never destroyed and
+ *  may be safely accessed by any buffer released after the thread
+ *  cache reaper has drained it at thread exit.
+ *
+ */
+struct FreeCache
+{
+    FreeBlock *  mHeads[kSizeClasses];
+    size_t       mCounts[kSizeClasses];
+    bool         mArmed;
+    bool         mReaped;
+};
+
+/**
+ *  An object that drains and disables the per-thread free block
+ *  cache at thread exit such that its blocks are not leaked.
+ *
+ */
+class FreeCacheReaper
+{
+public:
+    ~FreeCacheReaper(void);
+
+    void Arm(void) { return; }
+};
+
+static thread_local FreeCache        sFreeCache;
+static thread_local FreeCacheReaper  sFreeCacheReaper;
+
+FreeCacheReaper :: ~FreeCacheReaper(void)
+{
+    size_t  lClass;
+
+    for (lClass = 0; lClass < kSizeClasses; lClass++)
+    {
+        FreeBlock *  lCurrent = sFreeCache.mHeads[lClass];
+
+        while (lCurrent != nullptr)
+        {
+            FreeBlock *  lNext = lCurrent->mNext;
+
+            free(lCurrent);
+
+            lCurrent = lNext;
+        }
+
+        sFreeCache.mHeads[lClass]  = nullptr;
+        sFreeCache.mCounts[lClass] = 0;
+    }
+
+    sFreeCache.mReaped = true;
+}
+
+/**
+ *  @brief
+ *    Return the size class for the specified allocation size.
+ *
+ *  @param[in]  aSize  An immutable reference to the allocation size,
+ *                     in bytes.
+ *
+ *  @returns
+ *    The index of the smallest size class accommodating the
+ *    allocation size, if any; otherwise, the number of size classes.
+ *
+ */
+static size_t
+GetSizeClass(const size_t &aSize)
+{
+    size_t  lRetval;
+
+    for (lRetval = 0; lRetval < kSizeClasses; lRetval++)
+    {
+        if (aSize <= sSizeClasses[lRetval].mSize)
+        {
+            break;
+        }
+    }
+
+    return (lRetval);
+}
+
+}; // namespace Detail
+
+/**
+ *  @brief
+ *    Allocate memory from the pool.
+ *
+ *  @param[in]  aSize  An immutable reference to the size, in bytes,
+ *                     of the memory to allocate.
+ *
+ *  @returns
+ *    A pointer to the allocated memory, which is at least @a aSize
+ *    bytes, if successful; otherwise, null.
+ *
+ *  @sa Release
+ *
+ */
+void *
+ConnectionBufferPool :: Allocate(const size_t &aSize)
+{
+    const size_t  lClass = Detail::GetSizeClass(aSize);
+    void *        lRetval;
+
+    if (lClass == Detail::kSizeClasses)
+    {
+        lRetval = malloc(aSize);
+    }
+    else if (Detail::sFreeCache.mHeads[lClass] != nullptr)
+    {
+        Detail::FreeBlock *  lBlock = Detail::sFreeCache.mHeads[lClass];
+
+        Detail::sFreeCache.mHeads[lClass] = lBlock->mNext;
+        Detail::sFreeCache.mCounts[lClass]--;
+
+        lRetval = lBlock;
+    }
+    else
+    {
+        lRetval = malloc(Detail::sSizeClasses[lClass].mSize);
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Change the size of memory previously allocated from the pool.
+ *
+ *  The contents of the memory are preserved up to the lesser of the
+ *  old and new sizes. If the new size falls within the same size
+ *  class as the old size, the memory is returned unmoved.
+ *
+ *  @param[in]  aData     A pointer to the memory to resize.
+ *  @param[in]  aOldSize  An immutable reference to the size, in
+ *                        bytes, with which the memory was allocated.
+ *  @param[in]  aNewSize  An immutable reference to the new size, in
+ *                        bytes, of the memory.
+ *
+ *  @returns
+ *    A pointer to the resized memory if successful; otherwise, null,
+ *    in which case the original memory is unchanged and remains
+ *    allocated.
+ *
+ */
+void *
+ConnectionBufferPool :: Reallocate(void *aData, const size_t &aOldSize, const size_t &aNewSize)
+{
+    const size_t  lOldClass = Detail::GetSizeClass(aOldSize);
+    const size_t  lNewClass = Detail::GetSizeClass(aNewSize);
+    void *        lRetval;
+
+    if (lOldClass == lNewClass)
+    {
+        if (lNewClass == Detail::kSizeClasses)
+        {
+            lRetval = realloc(aData, aNewSize);
+        }
+        else
+        {
+            lRetval = aData;
+        }
+    }
+    else
+    {
+        lRetval = Allocate(aNewSize);
+
+        if (lRetval != nullptr)
+        {
+            memcpy(lRetval, aData, ((aOldSize < aNewSize) ? aOldSize : aNewSize));
+
+            Release(aData, aOldSize);
+        }
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Release memory previously allocated from the pool.
+ *
+ *  @param[in]  aData  A pointer to the memory to release.
+ *  @param[in]  aSize  An immutable reference to the size, in bytes,
+ *                     with which the memory was allocated or most
+ *                     recently reallocated.
+ *
+ *  @sa Allocate
+ *  @sa Reallocate
+ *
+ */
+void
+ConnectionBufferPool :: Release(void *aData, const size_t &aSize)
+{
+    const size_t  lClass = Detail::GetSizeClass(aSize);
+
+    nlEXPECT(aData != nullptr, done);
+
+    if ((lClass == Detail::kSizeClasses) ||
+        Detail::sFreeCache.mReaped ||
+        (Detail::sFreeCache.mCounts[lClass] >= Detail::sSizeClasses[lClass].mFreeMax))
+    {
+        free(aData);
+    }
+    else
+    {
+        Detail::FreeBlock *  lBlock = static_cast<Detail::FreeBlock *>(aData);
+
+        // Ensure the reaper is constructed on this thread such that
+        // the cache is drained when the thread exits.
+
+        if (!Detail::sFreeCache.mArmed)
+        {
+            Detail::sFreeCacheReaper.Arm();
+
+            Detail::sFreeCache.mArmed = true;
+        }
+
+        lBlock->mNext = Detail::sFreeCache.mHeads[lClass];
+
+        Detail::sFreeCache.mHeads[lClass] = lBlock;
+        Detail::sFreeCache.mCounts[lClass]++;
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Return the size actually allocated for the specified size.
+ *
+ *  @param[in]  aSize  An immutable reference to the requested size,
+ *                     in bytes.
+ *
+ *  @returns
+ *    The size of the smallest size class accommodating the requested
+ *    size, if any; otherwise, the requested size.
+ *
+ */
+size_t
+ConnectionBufferPool :: GetAllocationSize(const size_t &aSize)
+{
+    const size_t  lClass = Detail::GetSizeClass(aSize);
+    size_t        lRetval;
+
+    if (lClass == Detail::kSizeClasses)
+    {
+        lRetval = aSize;
+    }
+    else
+    {
+        lRetval = Detail::sSizeClasses[lClass].mSize;
+    }
+
+    return (lRetval);
+}
+
+}; // namespace Common
+
+}; // namespace HLX
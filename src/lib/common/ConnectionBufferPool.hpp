@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for allocating and recycling the
+ *      backing stores and objects of buffers for sending or receiving
+ *      data over a peer-to-peer network connection.
+ *
+ */
+
+#ifndef OPENHLXCOMMONCONNECTIONBUFFERPOOL_HPP
+#define OPENHLXCOMMONCONNECTIONBUFFERPOOL_HPP
+
+#include <new>
+
+#include <stddef.h>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+/**
+ *  @brief
+ *    An object for allocating and recycling the backing stores and
+ *    objects of buffers for sending or receiving data over a
+ *    peer-to-peer network connection.
+ *
+ *  Allocations are rounded up to one of a small number of size
+ *  classes, each of which is recycled through a bounded, per-thread
+ *  free list such that the common case of allocating a small buffer
+ *  for a short response and then releasing it neither takes a lock
+ *  nor calls into the system allocator. Allocations larger than the
+ *  largest size class are passed through to the system allocator.
+ *
+ *  @note
+ *    Memory may be released on a thread other than that which
+ *    allocated it, in which case it is recycled through the free
+ *    list of the releasing thread.
+ *
+ *  @ingroup common
+ *
+ */
+class ConnectionBufferPool
+{
+public:
+    /**
+     *  @brief
+     *    A standard allocator, suitable for use with @a
+     *    std::allocate_shared, that allocates from the pool.
+     *
+     */
+    template <typename T>
+    class Allocator
+    {
+    public:
+        typedef T value_type;
+
+        Allocator(void) = default;
+
+        template <typename U>
+        Allocator(const Allocator<U> &aAllocator __attribute__((unused)))
+        {
+            return;
+        }
+
+        T *allocate(size_t aCount)
+        {
+            void *lRetval = ConnectionBufferPool::Allocate(aCount * sizeof(T));
+
+            if (lRetval == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            return (static_cast<T *>(lRetval));
+        }
+
+        void deallocate(T *aPointer, size_t aCount)
+        {
+            ConnectionBufferPool::Release(aPointer, aCount * sizeof(T));
+        }
+
+        template <typename U>
+        bool operator ==(const Allocator<U> &aAllocator __attribute__((unused))) const
+        {
+            return (true);
+        }
+
+        template <typename U>
+        bool operator !=(const Allocator<U> &aAllocator __attribute__((unused))) const
+        {
+            return (false);
+        }
+    };
+
+public:
+    static void * Allocate(const size_t &aSize);
+    static void * Reallocate(void *aData, const size_t &aOldSize, const size_t &aNewSize);
+    static void   Release(void *aData, const size_t &aSize);
+
+    static size_t GetAllocationSize(const size_t &aSize);
+
+private:
+    ConnectionBufferPool(void) = delete;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONCONNECTIONBUFFERPOOL_HPP
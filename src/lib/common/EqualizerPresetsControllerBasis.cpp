@@ -47,6 +47,16 @@ namespace Common
  */
 const EqualizerPresetsControllerBasis::IdentifierType  EqualizerPresetsControllerBasis::kEqualizerPresetsMax = 10;
 
+/**
+ *  The maximum number of equalizer presets currently in effect.
+ *
+ *  This defaults to the maximum number supported by the HLX server
+ *  controller; however, it may be changed, for example, by a
+ *  simulator scaled beyond a single chassis.
+ *
+ */
+EqualizerPresetsControllerBasis::IdentifierType        EqualizerPresetsControllerBasis::sEqualizerPresetsMax = kEqualizerPresetsMax;
+
 // MARK: Observer Methods
 
 /**
@@ -80,7 +90,85 @@ EqualizerPresetsControllerBasis :: GetEqualizerPresetsMax(IdentifierType &aEqual
 EqualizerPresetsControllerBasis::IdentifierType
 EqualizerPresetsControllerBasis :: GetEqualizerPresetsMax(void)
 {
-    return (kEqualizerPresetsMax);
+    return (sEqualizerPresetsMax);
+}
+
+/**
+ *  @brief
+ *    Get the identifiers of the equalizer presets changed since the
+ *    specified change sequence number.
+ *
+ *  This allows a client or proxy to resynchronize its view of the
+ *  equalizer presets, or a server to resynchronize its clients, with
+ *  only those changed rather than with all of them.
+ *
+ *  @param[in]      aSequence                    An immutable reference
+ *                                               to the change sequence
+ *                                               number after which
+ *                                               changed equalizer
+ *                                               presets are to be
+ *                                               returned.
+ *  @param[in,out]  aEqualizerPresetIdentifiers  A mutable reference to
+ *                                               the identifiers
+ *                                               collection to which the
+ *                                               identifiers of the
+ *                                               changed equalizer
+ *                                               presets are to be
+ *                                               added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+EqualizerPresetsControllerBasis :: GetEqualizerPresetsChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aEqualizerPresetIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mEqualizerPresets.GetEqualizerPresetsChangedSince(aSequence, aEqualizerPresetIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Mutator Methods
+
+/**
+ *  @brief
+ *    Set the maximum number of supported HLX equalizer presets.
+ *
+ *  This sets the maximum number of HLX equalizer presets. This must be
+ *  called before any equalizer presets controller is initialized, as it
+ *  determines the size of the equalizer presets collection model.
+ *
+ *  @param[in]  aEqualizerPresets  The maximum number of HLX equalizer presets to set.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *  @retval  -ERANGE                  If the specified value is
+ *                                    smaller or larger than
+ *                                    supported.
+ *
+ */
+Status
+EqualizerPresetsControllerBasis :: SetEqualizerPresetsMax(const IdentifierType &aEqualizerPresets)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(aEqualizerPresets >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aEqualizerPresets <= IdentifierModel::kIdentifierMax, done, lRetval = -ERANGE);
+
+    nlEXPECT_ACTION(sEqualizerPresetsMax != aEqualizerPresets, done, lRetval = kStatus_ValueAlreadySet);
+
+    sEqualizerPresetsMax = aEqualizerPresets;
+
+ done:
+    return (lRetval);
 }
 
 /**
@@ -129,7 +217,7 @@ EqualizerPresetsControllerBasis :: ValidateIdentifier(const IdentifierType &aEqu
 
 
     nlREQUIRE_ACTION(aEqualizerPresetIdentifier >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
-    nlREQUIRE_ACTION(aEqualizerPresetIdentifier <= kEqualizerPresetsMax, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aEqualizerPresetIdentifier <= sEqualizerPresetsMax, done, lRetval = -ERANGE);
 
  done:
     return (lRetval);
@@ -149,7 +237,7 @@ EqualizerPresetsControllerBasis :: Init(void)
 {
     Status lRetval = kStatus_Success;
 
-    lRetval = mEqualizerPresets.Init(kEqualizerPresetsMax);
+    lRetval = mEqualizerPresets.Init(sEqualizerPresetsMax);
     nlREQUIRE_SUCCESS(lRetval, done);
 
 done:
@@ -26,8 +26,10 @@
 #ifndef OPENHLXCOMMONEQUALIZERPRESETSCONTROLLERBASIS_HPP
 #define OPENHLXCOMMONEQUALIZERPRESETSCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/EqualizerPresetModel.hpp>
 #include <OpenHLX/Model/EqualizerPresetsModel.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 
 
 namespace HLX
@@ -62,6 +64,12 @@ public:
     static Common::Status GetEqualizerPresetsMax(IdentifierType &aEqualizerPresets);
     static IdentifierType GetEqualizerPresetsMax(void);
 
+    Common::Status        GetEqualizerPresetsChangedSince(const Model::ChangeSequence::SequenceType &aSequence, Model::IdentifiersCollection &aEqualizerPresetIdentifiers);
+
+    // Mutator Methods
+
+    static Common::Status SetEqualizerPresetsMax(const IdentifierType &aEqualizerPresets);
+
     static bool           IsValidIdentifier(const IdentifierType &aEqualizerPresetIdentifier);
     static Common::Status ValidateIdentifier(const IdentifierType &aEqualizerPresetIdentifier);
 
@@ -82,6 +90,7 @@ protected:
 
 protected:
     static const IdentifierType  kEqualizerPresetsMax;
+    static IdentifierType        sEqualizerPresetsMax;
 };
 
 }; // namespace Common
@@ -0,0 +1,775 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file implements an object for a native, epoll-based event
+ *      loop nested within a CoreFoundation run loop.
+ *
+ */
+
+#include "EventLoop.hpp"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#if HAVE_CONFIG_H
+#include "openhlx-config.h"
+#endif
+
+#if OPENHLX_WITH_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/EventLoopDelegate.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+namespace Detail
+{
+
+/**
+ *  The maximum number of ready descriptors dispatched in a single
+ *  event loop batch. Any descriptors beyond this remain ready and
+ *  are dispatched in the next batch.
+ *
+ */
+static constexpr size_t kEventsMax = 64;
+
+/**
+ *  The generation of the wake descriptor registration. Descriptor
+ *  registrations are never assigned this generation.
+ *
+ */
+static constexpr uint32_t kWakeGeneration = 0;
+
+#if OPENHLX_WITH_EPOLL
+static uint32_t
+EventsToEpollEvents(const uint32_t &aEvents)
+{
+    uint32_t lRetval = 0;
+
+    if (aEvents & EventLoop::kEventReadable)
+    {
+        lRetval |= (EPOLLIN | EPOLLRDHUP);
+    }
+
+    if (aEvents & EventLoop::kEventWritable)
+    {
+        lRetval |= EPOLLOUT;
+    }
+
+    return (lRetval);
+}
+
+static uint32_t
+EpollEventsToEvents(const uint32_t &aEpollEvents)
+{
+    uint32_t lRetval = EventLoop::kEventNone;
+
+    if (aEpollEvents & EPOLLIN)
+    {
+        lRetval |= EventLoop::kEventReadable;
+    }
+
+    if (aEpollEvents & EPOLLOUT)
+    {
+        lRetval |= EventLoop::kEventWritable;
+    }
+
+    if (aEpollEvents & (EPOLLHUP | EPOLLRDHUP))
+    {
+        lRetval |= EventLoop::kEventHangup;
+    }
+
+    if (aEpollEvents & EPOLLERR)
+    {
+        lRetval |= EventLoop::kEventError;
+    }
+
+    return (lRetval);
+}
+
+static uint64_t
+MakeEventData(const int &aDescriptor, const uint32_t &aGeneration)
+{
+    return ((static_cast<uint64_t>(aGeneration) << 32) |
+            static_cast<uint32_t>(aDescriptor));
+}
+
+static int
+GetEventDescriptor(const uint64_t &aData)
+{
+    return (static_cast<int>(static_cast<uint32_t>(aData)));
+}
+
+static uint32_t
+GetEventGeneration(const uint64_t &aData)
+{
+    return (static_cast<uint32_t>(aData >> 32));
+}
+#endif // OPENHLX_WITH_EPOLL
+
+}; // namespace Detail
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+EventLoop :: EventLoop(void) :
+    mRunLoopParameters(),
+    mEpollDescriptor(-1),
+    mWakeDescriptor(-1),
+    mWakePending(false),
+    mSocketRef(nullptr),
+    mRunLoopSourceRef(nullptr),
+    mGeneration(Detail::kWakeGeneration),
+    mRegistrations(),
+    mSignaledDelegates(),
+    mDispatchingDelegates()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+EventLoop :: ~EventLoop(void)
+{
+    Destroy();
+}
+
+/**
+ *  @brief
+ *    Return whether or not the event loop is supported.
+ *
+ *  @returns
+ *    True if the package was configured with the epoll event loop
+ *    backend; otherwise, false.
+ *
+ */
+/* static */ bool
+EventLoop :: IsSupported(void)
+{
+#if OPENHLX_WITH_EPOLL
+    return (true);
+#else
+    return (false);
+#endif
+}
+
+/**
+ *  @brief
+ *    This is the class initializer.
+ *
+ *  This initializes the event loop and nests it, as a single source,
+ *  within the run loop with the specified run loop parameters.
+ *
+ *  @param[in]  aRunLoopParameters  An immutable reference to the run
+ *                                  loop parameters to initialize the
+ *                                  event loop with.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOSYS          If the package was not configured with
+ *                            the epoll event loop backend.
+ *  @retval  -ENOMEM          If resources could not be allocated for
+ *                            the event loop.
+ *  @retval  -errno           The system error associated with
+ *                            creating the event loop descriptors.
+ *
+ */
+Status
+EventLoop :: Init(const RunLoopParameters &aRunLoopParameters)
+{
+#if OPENHLX_WITH_EPOLL
+    static constexpr CFOptionFlags  kSocketFlags = kCFSocketAutomaticallyReenableReadCallBack;
+    CFSocketContext                 lSocketContext = { 0, this, nullptr, nullptr, nullptr };
+    struct epoll_event              lEvent;
+    int                             lStatus;
+    Status                          lRetval = kStatus_Success;
+
+
+    mEpollDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    nlREQUIRE_ACTION(mEpollDescriptor != -1, done, lRetval = -errno);
+
+    // The wake descriptor coalesces any number of signals into a
+    // single readable event on the epoll descriptor.
+
+    mWakeDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    nlREQUIRE_ACTION(mWakeDescriptor != -1, done, lRetval = -errno);
+
+    lEvent.events   = EPOLLIN;
+    lEvent.data.u64 = Detail::MakeEventData(mWakeDescriptor, Detail::kWakeGeneration);
+
+    lStatus = epoll_ctl(mEpollDescriptor, EPOLL_CTL_ADD, mWakeDescriptor, &lEvent);
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+    // Nest the event loop within the run loop: the epoll descriptor
+    // is readable whenever any descriptor registered with it is
+    // ready. The event loop retains ownership of the descriptor.
+
+    mSocketRef = CFSocketCreateWithNative(kCFAllocatorDefault,
+                                          mEpollDescriptor,
+                                          kCFSocketReadCallBack,
+                                          EventLoop::CFSocketCallback,
+                                          &lSocketContext);
+    nlREQUIRE_ACTION(mSocketRef != nullptr, done, lRetval = -ENOMEM);
+
+    CFSocketSetSocketFlags(mSocketRef, kSocketFlags);
+
+    mRunLoopSourceRef = CFSocketCreateRunLoopSource(kCFAllocatorDefault,
+                                                    mSocketRef,
+                                                    0);
+    nlREQUIRE_ACTION(mRunLoopSourceRef != nullptr, done, lRetval = -ENOMEM);
+
+    CFRunLoopAddSource(aRunLoopParameters.GetRunLoop(),
+                       mRunLoopSourceRef,
+                       aRunLoopParameters.GetRunLoopMode());
+
+    mRunLoopParameters = aRunLoopParameters;
+
+ done:
+    if (lRetval != kStatus_Success)
+    {
+        Destroy();
+    }
+
+    return (lRetval);
+#else
+    (void)aRunLoopParameters;
+
+    return (-ENOSYS);
+#endif // OPENHLX_WITH_EPOLL
+}
+
+/**
+ *  @brief
+ *    Release all resources associated with the event loop.
+ *
+ *  @note
+ *    Descriptors registered with the event loop remain owned by the
+ *    delegates that registered them and are not closed.
+ *
+ */
+void
+EventLoop :: Destroy(void)
+{
+    if (mRunLoopSourceRef != nullptr)
+    {
+        CFRunLoopRemoveSource(mRunLoopParameters.GetRunLoop(),
+                              mRunLoopSourceRef,
+                              mRunLoopParameters.GetRunLoopMode());
+
+        CFURelease(mRunLoopSourceRef);
+
+        mRunLoopSourceRef = nullptr;
+    }
+
+    if (mSocketRef != nullptr)
+    {
+        CFSocketInvalidate(mSocketRef);
+
+        CFURelease(mSocketRef);
+
+        mSocketRef = nullptr;
+    }
+
+    if (mWakeDescriptor != -1)
+    {
+        close(mWakeDescriptor);
+
+        mWakeDescriptor = -1;
+    }
+
+    if (mEpollDescriptor != -1)
+    {
+        close(mEpollDescriptor);
+
+        mEpollDescriptor = -1;
+    }
+
+    mWakePending = false;
+
+    mRegistrations.clear();
+    mSignaledDelegates.clear();
+    mDispatchingDelegates.clear();
+}
+
+// MARK: Descriptor Management
+
+/**
+ *  @brief
+ *    Register a descriptor with the event loop.
+ *
+ *  This registers the specified descriptor with the event loop such
+ *  that the specified delegate is notified whenever any of the
+ *  specified events are ready on it. Hangup and error events are
+ *  always notified.
+ *
+ *  @note
+ *    The descriptor is level-triggered: the delegate is notified on
+ *    each batch for as long as the descriptor remains ready.
+ *
+ *  @param[in]  aDescriptor  An immutable reference to the descriptor
+ *                           to register.
+ *  @param[in]  aEvents      An immutable reference to the events to
+ *                           register for.
+ *  @param[in]  aDelegate    A pointer to the delegate to notify.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the event loop has not been
+ *                                  initialized.
+ *  @retval  -EINVAL                If the descriptor is invalid or
+ *                                  the delegate is null.
+ *  @retval  -EEXIST                If the descriptor is already
+ *                                  registered.
+ *  @retval  -errno                 The system error associated with
+ *                                  registering the descriptor.
+ *
+ *  @sa Modify
+ *  @sa Remove
+ *
+ */
+Status
+EventLoop :: Add(const int &aDescriptor, const uint32_t &aEvents, EventLoopDelegate *aDelegate)
+{
+#if OPENHLX_WITH_EPOLL
+    const size_t        lIndex = static_cast<size_t>(aDescriptor);
+    struct epoll_event  lEvent;
+    int                 lStatus;
+    Status              lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(mEpollDescriptor != -1, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aDescriptor >= 0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(aDelegate != nullptr, done, lRetval = -EINVAL);
+
+    if (lIndex >= mRegistrations.size())
+    {
+        mRegistrations.resize(lIndex + 1, Registration{ nullptr, Detail::kWakeGeneration });
+    }
+
+    nlREQUIRE_ACTION(mRegistrations[lIndex].mDelegate == nullptr, done, lRetval = -EEXIST);
+
+    // Tag the registration with a new generation such that any event
+    // still pending in this batch for an earlier registration of the
+    // same descriptor number is not mistaken for one of this
+    // registration.
+
+    if (++mGeneration == Detail::kWakeGeneration)
+    {
+        ++mGeneration;
+    }
+
+    lEvent.events   = Detail::EventsToEpollEvents(aEvents);
+    lEvent.data.u64 = Detail::MakeEventData(aDescriptor, mGeneration);
+
+    lStatus = epoll_ctl(mEpollDescriptor, EPOLL_CTL_ADD, aDescriptor, &lEvent);
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+    mRegistrations[lIndex].mDelegate   = aDelegate;
+    mRegistrations[lIndex].mGeneration = mGeneration;
+
+ done:
+    return (lRetval);
+#else
+    (void)aDescriptor;
+    (void)aEvents;
+    (void)aDelegate;
+
+    return (kError_NotInitialized);
+#endif // OPENHLX_WITH_EPOLL
+}
+
+/**
+ *  @brief
+ *    Change the events a registered descriptor is registered for.
+ *
+ *  @param[in]  aDescriptor  An immutable reference to the registered
+ *                           descriptor to modify.
+ *  @param[in]  aEvents      An immutable reference to the events to
+ *                           register for.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the event loop has not been
+ *                                  initialized.
+ *  @retval  -ENOENT                If the descriptor is not
+ *                                  registered.
+ *  @retval  -errno                 The system error associated with
+ *                                  modifying the descriptor.
+ *
+ *  @sa Add
+ *  @sa Remove
+ *
+ */
+Status
+EventLoop :: Modify(const int &aDescriptor, const uint32_t &aEvents)
+{
+#if OPENHLX_WITH_EPOLL
+    const size_t        lIndex = static_cast<size_t>(aDescriptor);
+    struct epoll_event  lEvent;
+    int                 lStatus;
+    Status              lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(mEpollDescriptor != -1, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aDescriptor >= 0, done, lRetval = -ENOENT);
+    nlREQUIRE_ACTION(lIndex < mRegistrations.size(), done, lRetval = -ENOENT);
+    nlREQUIRE_ACTION(mRegistrations[lIndex].mDelegate != nullptr, done, lRetval = -ENOENT);
+
+    lEvent.events   = Detail::EventsToEpollEvents(aEvents);
+    lEvent.data.u64 = Detail::MakeEventData(aDescriptor, mRegistrations[lIndex].mGeneration);
+
+    lStatus = epoll_ctl(mEpollDescriptor, EPOLL_CTL_MOD, aDescriptor, &lEvent);
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+ done:
+    return (lRetval);
+#else
+    (void)aDescriptor;
+    (void)aEvents;
+
+    return (kError_NotInitialized);
+#endif // OPENHLX_WITH_EPOLL
+}
+
+/**
+ *  @brief
+ *    Unregister a descriptor from the event loop.
+ *
+ *  This unregisters the specified descriptor from the event loop.
+ *  Once removed, the delegate that registered it is not notified of
+ *  it again, even if it was ready in the batch being dispatched. Nor
+ *  is a delegate that registers the same descriptor number again in
+ *  that batch notified of the events pending for the removed one.
+ *
+ *  @note
+ *    The descriptor must be removed before it is closed.
+ *
+ *  @param[in]  aDescriptor  An immutable reference to the registered
+ *                           descriptor to remove.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the event loop has not been
+ *                                  initialized.
+ *  @retval  -ENOENT                If the descriptor is not
+ *                                  registered.
+ *  @retval  -errno                 The system error associated with
+ *                                  removing the descriptor.
+ *
+ *  @sa Add
+ *  @sa Modify
+ *
+ */
+Status
+EventLoop :: Remove(const int &aDescriptor)
+{
+#if OPENHLX_WITH_EPOLL
+    const size_t  lIndex = static_cast<size_t>(aDescriptor);
+    int           lStatus;
+    Status        lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(mEpollDescriptor != -1, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aDescriptor >= 0, done, lRetval = -ENOENT);
+    nlREQUIRE_ACTION(lIndex < mRegistrations.size(), done, lRetval = -ENOENT);
+    nlREQUIRE_ACTION(mRegistrations[lIndex].mDelegate != nullptr, done, lRetval = -ENOENT);
+
+    // Clear the delegate first, such that any event for the
+    // descriptor already pending in this batch is discarded.
+
+    mRegistrations[lIndex].mDelegate = nullptr;
+
+    lStatus = epoll_ctl(mEpollDescriptor, EPOLL_CTL_DEL, aDescriptor, nullptr);
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+ done:
+    return (lRetval);
+#else
+    (void)aDescriptor;
+
+    return (kError_NotInitialized);
+#endif // OPENHLX_WITH_EPOLL
+}
+
+// MARK: Signal Management
+
+/**
+ *  @brief
+ *    Signal a delegate from the event loop.
+ *
+ *  This schedules the specified delegate to be notified, with the
+ *  kEventSignaled event and a descriptor of -1, in the next event
+ *  loop batch. Any number of signals to the same delegate before that
+ *  batch are coalesced into a single notification.
+ *
+ *  @note
+ *    This may only be called on the thread of the run loop the event
+ *    loop was initialized with.
+ *
+ *  @param[in]  aDelegate  A pointer to the delegate to signal.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the event loop has not been
+ *                                  initialized.
+ *  @retval  -EINVAL                If the delegate is null.
+ *  @retval  -errno                 The system error associated with
+ *                                  waking the event loop.
+ *
+ *  @sa Cancel
+ *
+ */
+Status
+EventLoop :: Signal(EventLoopDelegate *aDelegate)
+{
+#if OPENHLX_WITH_EPOLL
+    static constexpr uint64_t  kWake = 1;
+    Delegates::const_iterator  lResult;
+    ssize_t                    lStatus;
+    Status                     lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(mWakeDescriptor != -1, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aDelegate != nullptr, done, lRetval = -EINVAL);
+
+    lResult = std::find(mSignaledDelegates.begin(), mSignaledDelegates.end(), aDelegate);
+    nlEXPECT(lResult == mSignaledDelegates.end(), done);
+
+    mSignaledDelegates.push_back(aDelegate);
+
+    // Only the first signal since the last batch needs to wake the
+    // event loop.
+
+    if (!mWakePending)
+    {
+        lStatus = write(mWakeDescriptor, &kWake, sizeof (kWake));
+        nlREQUIRE_ACTION(lStatus == sizeof (kWake), done, lRetval = -errno);
+
+        mWakePending = true;
+    }
+
+ done:
+    return (lRetval);
+#else
+    (void)aDelegate;
+
+    return (kError_NotInitialized);
+#endif // OPENHLX_WITH_EPOLL
+}
+
+/**
+ *  @brief
+ *    Cancel any pending signal to a delegate.
+ *
+ *  This cancels any pending signal to the specified delegate,
+ *  including one in the batch being dispatched that has not yet been
+ *  delivered.
+ *
+ *  @note
+ *    A delegate that may have been signaled must cancel any pending
+ *    signal before it is destroyed.
+ *
+ *  @param[in]  aDelegate  A pointer to the delegate for which to
+ *                         cancel any pending signal.
+ *
+ *  @sa Signal
+ *
+ */
+void
+EventLoop :: Cancel(EventLoopDelegate *aDelegate)
+{
+    mSignaledDelegates.erase(std::remove(mSignaledDelegates.begin(),
+                                         mSignaledDelegates.end(),
+                                         aDelegate),
+                             mSignaledDelegates.end());
+
+    std::replace(mDispatchingDelegates.begin(),
+                 mDispatchingDelegates.end(),
+                 aDelegate,
+                 static_cast<EventLoopDelegate *>(nullptr));
+}
+
+// MARK: Dispatch
+
+/**
+ *  @brief
+ *    Dispatch a single batch of ready descriptors and signals.
+ *
+ *  This waits, for up to the specified timeout, for any registered
+ *  descriptors to be ready and notifies their delegates, followed by
+ *  any delegates signaled before the batch began.
+ *
+ *  @param[in]  aTimeoutMilliseconds  An immutable reference to the
+ *                                    time, in milliseconds, to wait
+ *                                    for a descriptor to be ready.
+ *                                    Zero (0) does not wait and -1
+ *                                    waits indefinitely.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the event loop has not been
+ *                                  initialized.
+ *  @retval  -errno                 The system error associated with
+ *                                  waiting for descriptors.
+ *
+ */
+Status
+EventLoop :: Dispatch(const int &aTimeoutMilliseconds)
+{
+#if OPENHLX_WITH_EPOLL
+    struct epoll_event  lEvents[Detail::kEventsMax];
+    int                 lCount;
+    Status              lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(mEpollDescriptor != -1, done, lRetval = kError_NotInitialized);
+
+    do {
+        lCount = epoll_wait(mEpollDescriptor, lEvents, Detail::kEventsMax, aTimeoutMilliseconds);
+    } while ((lCount == -1) && (errno == EINTR));
+
+    nlREQUIRE_ACTION(lCount >= 0, done, lRetval = -errno);
+
+    for (int i = 0; i < lCount; i++)
+    {
+        const int       lDescriptor = Detail::GetEventDescriptor(lEvents[i].data.u64);
+        const uint32_t  lGeneration = Detail::GetEventGeneration(lEvents[i].data.u64);
+        const size_t    lIndex      = static_cast<size_t>(lDescriptor);
+
+        if (lGeneration == Detail::kWakeGeneration)
+        {
+            uint64_t  lValue;
+
+            // Drain the wake descriptor. Signaled delegates are
+            // delivered below, regardless.
+
+            (void)read(mWakeDescriptor, &lValue, sizeof (lValue));
+
+            mWakePending = false;
+        }
+        else if ((lIndex < mRegistrations.size()) &&
+                 (mRegistrations[lIndex].mDelegate != nullptr) &&
+                 (mRegistrations[lIndex].mGeneration == lGeneration))
+        {
+            // The delegate is looked up anew for each event, since an
+            // earlier notification in this batch may have removed the
+            // descriptor or, having removed it, added another with the
+            // same descriptor number, whose generation differs.
+
+            mRegistrations[lIndex].mDelegate->EventLoopIsReady(*this,
+                                                               lDescriptor,
+                                                               Detail::EpollEventsToEvents(lEvents[i].events));
+        }
+    }
+
+    // Deliver the signals pending at the start of delivery. Signals
+    // raised during delivery are deferred to the next batch.
+
+    if (!mSignaledDelegates.empty())
+    {
+        static constexpr int       kNoDescriptor = -1;
+        static constexpr uint32_t  kEvents       = kEventSignaled;
+
+        mDispatchingDelegates.swap(mSignaledDelegates);
+
+        for (size_t i = 0; i < mDispatchingDelegates.size(); i++)
+        {
+            EventLoopDelegate *  lDelegate = mDispatchingDelegates[i];
+
+            if (lDelegate != nullptr)
+            {
+                lDelegate->EventLoopIsReady(*this, kNoDescriptor, kEvents);
+            }
+        }
+
+        mDispatchingDelegates.clear();
+    }
+
+ done:
+    return (lRetval);
+#else
+    (void)aTimeoutMilliseconds;
+
+    return (kError_NotInitialized);
+#endif // OPENHLX_WITH_EPOLL
+}
+
+// MARK: CoreFoundation Socket Handler Trampoline
+
+/**
+ *  @brief
+ *    CoreFoundation socket callback trampoline.
+ *
+ *  This is invoked by the run loop whenever the event loop epoll
+ *  descriptor is readable and dispatches a single batch of ready
+ *  descriptors and signals without waiting.
+ *
+ *  @param[in]  aSocketRef           A reference to the CoreFoundation
+ *                                   socket that triggered the
+ *                                   callback.
+ *  @param[in]  aSocketCallBackType  The type of callback.
+ *  @param[in]  aAddress             Unused.
+ *  @param[in]  aData                Unused.
+ *  @param[in]  aInfo                A pointer to the event loop that
+ *                                   registered this trampoline.
+ *
+ */
+/* static */ void
+EventLoop :: CFSocketCallback(CFSocketRef aSocketRef,
+                              CFSocketCallBackType aSocketCallBackType,
+                              CFDataRef aAddress,
+                              const void *aData,
+                              void *aInfo)
+{
+    static constexpr int  kNoWait = 0;
+    EventLoop *           lEventLoop = static_cast<EventLoop *>(aInfo);
+
+    (void)aSocketRef;
+    (void)aAddress;
+    (void)aData;
+
+    if ((lEventLoop != nullptr) && (aSocketCallBackType == kCFSocketReadCallBack))
+    {
+        lEventLoop->Dispatch(kNoWait);
+    }
+}
+
+}; // namespace Common
+
+}; // namespace HLX
@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file defines an object for a native, epoll-based event
+ *      loop nested within a CoreFoundation run loop.
+ *
+ */
+
+#ifndef OPENHLXCOMMONEVENTLOOP_HPP
+#define OPENHLXCOMMONEVENTLOOP_HPP
+
+#include <vector>
+
+#include <stdint.h>
+
+#include <CoreFoundation/CFRunLoop.h>
+#include <CoreFoundation/CFSocket.h>
+
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+class EventLoopDelegate;
+
+/**
+ *  @brief
+ *    An object for a native, epoll-based event loop nested within a
+ *    CoreFoundation run loop.
+ *
+ *  On Linux, every CoreFoundation run loop source, socket, stream,
+ *  and timer goes through the CoreFoundation compatibility layer,
+ *  which adds allocation, locking, and indirection to each event.
+ *  This event loop instead multiplexes any number of descriptors
+ *  (for example, sockets, timerfd timers, and eventfd wakeups) with
+ *  a single epoll instance and dispatches them to delegates
+ *  directly.
+ *
+ *  So that it may coexist with participants that still require
+ *  CoreFoundation, the event loop is nested: its epoll descriptor is
+ *  itself a single source on the CoreFoundation run loop, such that
+ *  all of the descriptors ready at once are dispatched in one batch
+ *  per run loop iteration.
+ *
+ *  Run loop participants use the event loop, where they support it,
+ *  when it is set in the run loop parameters with which they are
+ *  initialized.
+ *
+ *  The event loop is only available when the package is configured
+ *  with the epoll backend (see --enable-epoll). Otherwise, #Init
+ *  fails and participants continue to use CoreFoundation.
+ *
+ *  @note
+ *    Other than #Init, the event loop may only be used from the
+ *    thread of the run loop it is initialized with.
+ *
+ *  @ingroup common
+ *
+ */
+class EventLoop
+{
+public:
+    /**
+     *  Events for which a descriptor may be registered or with which
+     *  a delegate may be notified.
+     *
+     */
+    enum : uint32_t
+    {
+        kEventNone     = 0x00,  //!< No events.
+        kEventReadable = 0x01,  //!< The descriptor may be read.
+        kEventWritable = 0x02,  //!< The descriptor may be written.
+        kEventHangup   = 0x04,  //!< The descriptor peer hung up.
+        kEventError    = 0x08,  //!< The descriptor has an error.
+        kEventSignaled = 0x10   //!< The delegate was signaled.
+    };
+
+public:
+    EventLoop(void);
+    ~EventLoop(void);
+
+    Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters);
+
+    static bool IsSupported(void);
+
+    Common::Status Add(const int &aDescriptor, const uint32_t &aEvents, EventLoopDelegate *aDelegate);
+    Common::Status Modify(const int &aDescriptor, const uint32_t &aEvents);
+    Common::Status Remove(const int &aDescriptor);
+
+    Common::Status Signal(EventLoopDelegate *aDelegate);
+    void           Cancel(EventLoopDelegate *aDelegate);
+
+    Common::Status Dispatch(const int &aTimeoutMilliseconds);
+
+    // CFSocket Handler Trampoline
+
+    static void CFSocketCallback(CFSocketRef aSocketRef,
+                                 CFSocketCallBackType aSocketCallBackType,
+                                 CFDataRef aAddress,
+                                 const void *aData,
+                                 void *aInfo);
+
+private:
+    void Destroy(void);
+
+private:
+    typedef std::vector<EventLoopDelegate *> Delegates;
+
+    /**
+     *  The registration of a descriptor, tagged with the generation
+     *  with which it was added such that events pending for an
+     *  earlier registration of the same descriptor may be discarded.
+     *
+     */
+    struct Registration
+    {
+        EventLoopDelegate *  mDelegate;
+        uint32_t             mGeneration;
+    };
+
+    typedef std::vector<Registration> Registrations;
+
+    Common::RunLoopParameters  mRunLoopParameters;
+    int                        mEpollDescriptor;
+    int                        mWakeDescriptor;
+    bool                       mWakePending;
+    CFSocketRef                mSocketRef;
+    CFRunLoopSourceRef         mRunLoopSourceRef;
+    uint32_t                   mGeneration;
+    Registrations              mRegistrations;
+    Delegates                  mSignaledDelegates;
+    Delegates                  mDispatchingDelegates;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONEVENTLOOP_HPP
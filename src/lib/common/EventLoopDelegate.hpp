@@ -0,0 +1,77 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file defines an abstract delegate to a native event loop.
+ *
+ */
+
+#ifndef OPENHLXCOMMONEVENTLOOPDELEGATE_HPP
+#define OPENHLXCOMMONEVENTLOOPDELEGATE_HPP
+
+#include <stdint.h>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+class EventLoop;
+
+/**
+ *  @brief
+ *    Abstract delegate definition for a native event loop.
+ *
+ *  @ingroup common
+ *
+ */
+class EventLoopDelegate
+{
+public:
+    EventLoopDelegate(void) = default;
+    ~EventLoopDelegate(void) = default;
+
+    /**
+     *  @brief
+     *    Delegation from a native event loop that a descriptor the
+     *    delegate registered is ready or that the delegate was
+     *    signaled.
+     *
+     *  @param[in]  aEventLoop   A reference to the native event loop
+     *                           that issued the delegation.
+     *  @param[in]  aDescriptor  An immutable reference to the
+     *                           descriptor that is ready, or -1 if
+     *                           the delegate was signaled.
+     *  @param[in]  aEvents      An immutable reference to the events
+     *                           (for example,
+     *                           EventLoop::kEventReadable) that are
+     *                           ready.
+     *
+     */
+    virtual void EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) = 0;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONEVENTLOOPDELEGATE_HPP
@@ -47,6 +47,16 @@ namespace Common
  */
 const FavoritesControllerBasis::IdentifierType  FavoritesControllerBasis::kFavoritesMax = 10;
 
+/**
+ *  The maximum number of favorites currently in effect.
+ *
+ *  This defaults to the maximum number supported by the HLX server
+ *  controller; however, it may be changed, for example, by a
+ *  simulator scaled beyond a single chassis.
+ *
+ */
+FavoritesControllerBasis::IdentifierType        FavoritesControllerBasis::sFavoritesMax = kFavoritesMax;
+
 // MARK: Observer Methods
 
 /**
@@ -79,7 +89,81 @@ FavoritesControllerBasis :: GetFavoritesMax(IdentifierType &aFavorites)
 FavoritesControllerBasis::IdentifierType
 FavoritesControllerBasis :: GetFavoritesMax(void)
 {
-    return (kFavoritesMax);
+    return (sFavoritesMax);
+}
+
+/**
+ *  @brief
+ *    Get the identifiers of the favorites changed since the specified
+ *    change sequence number.
+ *
+ *  This allows a client or proxy to resynchronize its view of the
+ *  favorites, or a server to resynchronize its clients, with only those
+ *  changed rather than with all of them.
+ *
+ *  @param[in]      aSequence             An immutable reference to the
+ *                                        change sequence number after
+ *                                        which changed favorites are to
+ *                                        be returned.
+ *  @param[in,out]  aFavoriteIdentifiers  A mutable reference to the
+ *                                        identifiers collection to
+ *                                        which the identifiers of the
+ *                                        changed favorites are to be
+ *                                        added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+FavoritesControllerBasis :: GetFavoritesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aFavoriteIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mFavorites.GetFavoritesChangedSince(aSequence, aFavoriteIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Mutator Methods
+
+/**
+ *  @brief
+ *    Set the maximum number of supported HLX favorites.
+ *
+ *  This sets the maximum number of HLX favorites. This must be
+ *  called before any favorites controller is initialized, as it
+ *  determines the size of the favorites collection model.
+ *
+ *  @param[in]  aFavorites  The maximum number of HLX favorites to set.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *  @retval  -ERANGE                  If the specified value is
+ *                                    smaller or larger than
+ *                                    supported.
+ *
+ */
+Status
+FavoritesControllerBasis :: SetFavoritesMax(const IdentifierType &aFavorites)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(aFavorites >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aFavorites <= IdentifierModel::kIdentifierMax, done, lRetval = -ERANGE);
+
+    nlEXPECT_ACTION(sFavoritesMax != aFavorites, done, lRetval = kStatus_ValueAlreadySet);
+
+    sFavoritesMax = aFavorites;
+
+ done:
+    return (lRetval);
 }
 
 /**
@@ -126,7 +210,7 @@ FavoritesControllerBasis :: ValidateIdentifier(const IdentifierType &aFavoriteId
 
 
     nlREQUIRE_ACTION(aFavoriteIdentifier >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
-    nlREQUIRE_ACTION(aFavoriteIdentifier <= kFavoritesMax, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aFavoriteIdentifier <= sFavoritesMax, done, lRetval = -ERANGE);
 
  done:
     return (lRetval);
@@ -146,7 +230,7 @@ FavoritesControllerBasis :: Init(void)
 {
     Status lRetval = kStatus_Success;
 
-    lRetval = mFavorites.Init(kFavoritesMax);
+    lRetval = mFavorites.Init(sFavoritesMax);
     nlREQUIRE_SUCCESS(lRetval, done);
 
 done:
@@ -26,8 +26,10 @@
 #ifndef OPENHLXCOMMONDFAVORITESCONTROLLERBASIS_HPP
 #define OPENHLXCOMMONDFAVORITESCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/FavoriteModel.hpp>
 #include <OpenHLX/Model/FavoritesModel.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 
 
 namespace HLX
@@ -61,6 +63,12 @@ public:
     static Common::Status GetFavoritesMax(IdentifierType &aFavorites);
     static IdentifierType GetFavoritesMax(void);
 
+    Common::Status        GetFavoritesChangedSince(const Model::ChangeSequence::SequenceType &aSequence, Model::IdentifiersCollection &aFavoriteIdentifiers);
+
+    // Mutator Methods
+
+    static Common::Status SetFavoritesMax(const IdentifierType &aFavorites);
+
     static bool           IsValidIdentifier(const IdentifierType &aFavoriteIdentifier);
     static Common::Status ValidateIdentifier(const IdentifierType &aFavoriteIdentifier);
 
@@ -81,6 +89,7 @@ protected:
 
 protected:
     static const IdentifierType  kFavoritesMax;
+    static IdentifierType        sFavoritesMax;
 };
 
 }; // namespace Common
@@ -47,6 +47,16 @@ namespace Common
  */
 const GroupsControllerBasis::IdentifierType  GroupsControllerBasis::kGroupsMax = 10;
 
+/**
+ *  The maximum number of groups currently in effect.
+ *
+ *  This defaults to the maximum number supported by the HLX server
+ *  controller; however, it may be changed, for example, by a
+ *  simulator scaled beyond a single chassis.
+ *
+ */
+GroupsControllerBasis::IdentifierType        GroupsControllerBasis::sGroupsMax = kGroupsMax;
+
 // MARK: Observer Methods
 
 /**
@@ -79,7 +89,80 @@ GroupsControllerBasis :: GetGroupsMax(IdentifierType &aGroups)
 GroupsControllerBasis::IdentifierType
 GroupsControllerBasis :: GetGroupsMax(void)
 {
-    return (kGroupsMax);
+    return (sGroupsMax);
+}
+
+/**
+ *  @brief
+ *    Get the identifiers of the groups changed since the specified
+ *    change sequence number.
+ *
+ *  This allows a client or proxy to resynchronize its view of the
+ *  groups, or a server to resynchronize its clients, with only those
+ *  changed rather than with all of them.
+ *
+ *  @param[in]      aSequence          An immutable reference to the
+ *                                     change sequence number after
+ *                                     which changed groups are to be
+ *                                     returned.
+ *  @param[in,out]  aGroupIdentifiers  A mutable reference to the
+ *                                     identifiers collection to which
+ *                                     the identifiers of the changed
+ *                                     groups are to be added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+GroupsControllerBasis :: GetGroupsChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aGroupIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mGroups.GetGroupsChangedSince(aSequence, aGroupIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Mutator Methods
+
+/**
+ *  @brief
+ *    Set the maximum number of supported HLX groups.
+ *
+ *  This sets the maximum number of HLX groups. This must be
+ *  called before any groups controller is initialized, as it
+ *  determines the size of the groups collection model.
+ *
+ *  @param[in]  aGroups  The maximum number of HLX groups to set.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *  @retval  -ERANGE                  If the specified value is
+ *                                    smaller or larger than
+ *                                    supported.
+ *
+ */
+Status
+GroupsControllerBasis :: SetGroupsMax(const IdentifierType &aGroups)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(aGroups >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aGroups <= IdentifierModel::kIdentifierMax, done, lRetval = -ERANGE);
+
+    nlEXPECT_ACTION(sGroupsMax != aGroups, done, lRetval = kStatus_ValueAlreadySet);
+
+    sGroupsMax = aGroups;
+
+ done:
+    return (lRetval);
 }
 
 /**
@@ -126,7 +209,7 @@ GroupsControllerBasis :: ValidateIdentifier(const IdentifierType &aGroupIdentifi
 
 
     nlREQUIRE_ACTION(aGroupIdentifier >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
-    nlREQUIRE_ACTION(aGroupIdentifier <= kGroupsMax, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aGroupIdentifier <= sGroupsMax, done, lRetval = -ERANGE);
 
  done:
     return (lRetval);
@@ -146,7 +229,7 @@ GroupsControllerBasis :: Init(void)
 {
     Status lRetval = kStatus_Success;
 
-    lRetval = mGroups.Init(kGroupsMax);
+    lRetval = mGroups.Init(sGroupsMax);
     nlREQUIRE_SUCCESS(lRetval, done);
 
 done:
@@ -26,8 +26,10 @@
 #ifndef OPENHLXCOMMONGROUPSCONTROLLERBASIS_HPP
 #define OPENHLXCOMMONGROUPSCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/GroupModel.hpp>
 #include <OpenHLX/Model/GroupsModel.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 
 
 namespace HLX
@@ -61,6 +63,12 @@ public:
     static Common::Status GetGroupsMax(IdentifierType &aGroups);
     static IdentifierType GetGroupsMax(void);
 
+    Common::Status        GetGroupsChangedSince(const Model::ChangeSequence::SequenceType &aSequence, Model::IdentifiersCollection &aGroupIdentifiers);
+
+    // Mutator Methods
+
+    static Common::Status SetGroupsMax(const IdentifierType &aGroups);
+
     static bool           IsValidIdentifier(const IdentifierType &aGroupIdentifier);
     static Common::Status ValidateIdentifier(const IdentifierType &aGroupIdentifier);
 
@@ -86,6 +94,7 @@ protected:
 
 protected:
     static const IdentifierType  kGroupsMax;
+    static IdentifierType        sGroupsMax;
 };
 
 }; // namespace Common
@@ -120,6 +120,16 @@ HostURLAddress :: Init(const char *aScheme,
         }
         break;
 
+    case AF_LOCAL:
+        // Local (Unix domain) socket addresses have no host or port,
+        // just a file system path, which may be empty for an unnamed
+        // (for example, a connecting client) socket.
+
+        lResult = aAddress.uSocketAddressLocal.sun_path;
+
+        lURLStream << aScheme << "://" << ((lResult[0] != '\0') ? lResult : "/");
+        break;
+
     default:
         break;
     }
@@ -43,7 +43,8 @@ namespace Common
 /**
  *  @brief
  *    An object for working with and managing an IETF RFC 1738-style
- *    Internet host URL and a resolved IPv4 or IPv6 socket address.
+ *    Internet host URL and a resolved IPv4 or IPv6 or local (Unix
+ *    domain) socket address.
  *
  *  @ingroup common
  *
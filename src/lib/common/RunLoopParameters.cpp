@@ -47,7 +47,9 @@ namespace Common
  */
 RunLoopParameters :: RunLoopParameters(void) :
     mRunLoopRef(nullptr),
-    mRunLoopMode(kCFRunLoopDefaultMode)
+    mRunLoopMode(kCFRunLoopDefaultMode),
+    mEventLoop(nullptr),
+    mSocketRing(nullptr)
 {
     return;
 }
@@ -147,6 +149,8 @@ RunLoopParameters :: operator =(const RunLoopParameters &aRunLoopParameters)
 
     mRunLoopRef  = aRunLoopParameters.mRunLoopRef;
     mRunLoopMode = aRunLoopParameters.mRunLoopMode;
+    mEventLoop   = aRunLoopParameters.mEventLoop;
+    mSocketRing  = aRunLoopParameters.mSocketRing;
 
  done:
     return (*this);
@@ -180,6 +184,102 @@ RunLoopParameters :: GetRunLoopMode(void) const
     return (mRunLoopMode);
 }
 
+/**
+ *  @brief
+ *    Return the native event loop, if any.
+ *
+ *  @returns
+ *    A pointer to the native event loop that run loop participants
+ *    should use in place of CoreFoundation run loop sources, if one
+ *    has been set; otherwise, null.
+ *
+ */
+EventLoop *
+RunLoopParameters :: GetEventLoop(void) const
+{
+    return (mEventLoop);
+}
+
+/**
+ *  @brief
+ *    Set the native event loop.
+ *
+ *  This sets the native event loop that run loop participants
+ *  initialized with these parameters should use, where they support
+ *  it, in place of CoreFoundation run loop sources. The event loop
+ *  must itself have been initialized on the same run loop as these
+ *  parameters.
+ *
+ *  @param[in]  aEventLoop  A pointer to the native event loop to set,
+ *                          or null to use CoreFoundation run loop
+ *                          sources.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the event loop was already set
+ *                                    to the specified value.
+ *
+ */
+Status
+RunLoopParameters :: SetEventLoop(EventLoop *aEventLoop)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION(aEventLoop != mEventLoop, done, lRetval = kStatus_ValueAlreadySet);
+
+    mEventLoop = aEventLoop;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return the native socket ring, if any.
+ *
+ *  @returns
+ *    A pointer to the native socket ring that socket run loop
+ *    participants should use in place of the native event loop, if
+ *    one has been set; otherwise, null.
+ *
+ */
+SocketRing *
+RunLoopParameters :: GetSocketRing(void) const
+{
+    return (mSocketRing);
+}
+
+/**
+ *  @brief
+ *    Set the native socket ring.
+ *
+ *  This sets the native socket ring that socket run loop participants
+ *  initialized with these parameters should use, where they support
+ *  it, to accept, receive, and send in place of the native event
+ *  loop. The socket ring must itself have been initialized with these
+ *  parameters, including their native event loop.
+ *
+ *  @param[in]  aSocketRing  A pointer to the native socket ring to
+ *                           set, or null to use the native event loop
+ *                           or CoreFoundation run loop sources.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the socket ring was already
+ *                                    set to the specified value.
+ *
+ */
+Status
+RunLoopParameters :: SetSocketRing(SocketRing *aSocketRing)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION(aSocketRing != mSocketRing, done, lRetval = kStatus_ValueAlreadySet);
+
+    mSocketRing = aSocketRing;
+
+ done:
+    return (lRetval);
+}
+
 }; // namespace Common
 
 }; // namespace HLX
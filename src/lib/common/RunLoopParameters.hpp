@@ -51,6 +51,9 @@ namespace HLX
 namespace Common
 {
 
+class EventLoop;
+class SocketRing;
+
 /**
  *  @brief
  *    An object for managing the parameters common to all run loop
@@ -58,7 +61,9 @@ namespace Common
  *
  *  This defines an object for managing the common paramters for all
  *  run loop participants, including a reference to the run loop
- *  itself as well as the run loop mode.
+ *  itself as well as the run loop mode and, optionally, a native
+ *  event loop nested within that run loop and a native socket ring
+ *  nested within that event loop.
  *
  *  @ingroup common
  *
@@ -78,9 +83,17 @@ public:
     CFRunLoopRef GetRunLoop(void) const;
     CFRunLoopMode GetRunLoopMode(void) const;
 
+    EventLoop *GetEventLoop(void) const;
+    Status SetEventLoop(EventLoop *aEventLoop);
+
+    SocketRing *GetSocketRing(void) const;
+    Status SetSocketRing(SocketRing *aSocketRing);
+
 private:
     CFRunLoopRef            mRunLoopRef;
     CFRunLoopMode           mRunLoopMode;
+    EventLoop *             mEventLoop;
+    SocketRing *            mSocketRing;
 };
 
 }; // namespace Common
@@ -31,6 +31,7 @@
 
 #include <LogUtilities/LogUtilities.hpp>
 
+#include <OpenHLX/Common/EventLoop.hpp>
 #include <OpenHLX/Common/RunLoopQueueDelegate.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
@@ -66,6 +67,11 @@ RunLoopQueue :: RunLoopQueue(void) :
  */
 RunLoopQueue :: ~RunLoopQueue(void)
 {
+    if (mRunLoopParameters.GetEventLoop() != nullptr)
+    {
+        mRunLoopParameters.GetEventLoop()->Cancel(this);
+    }
+
     if (mRunLoopSourceRef != nullptr)
     {
         CFRunLoopRemoveSource(mRunLoopParameters.GetRunLoop(),
@@ -101,6 +107,15 @@ RunLoopQueue :: Init(const RunLoopParameters &aRunLoopParameters)
     CFRunLoopSourceContext  lContext;
     CFRunLoopSourceRef      lRunLoopSourceRef;
 
+    // With a native event loop, the queue is signaled through it and
+    // there is no run loop source to create.
+
+    if (aRunLoopParameters.GetEventLoop() != nullptr)
+    {
+        mRunLoopParameters = aRunLoopParameters;
+        goto done;
+    }
+
     lContext.version         = 0;
     lContext.info            = this;
     lContext.retain          = nullptr;
@@ -222,11 +237,11 @@ RunLoopQueue :: Push(element_type aElement)
 {
     Status lRetval = kStatus_Success;
 
-    nlREQUIRE_ACTION(mRunLoopSourceRef != nullptr, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(IsInitialized(), done, lRetval = kError_NotInitialized);
 
     mQueue.push(aElement);
 
-    CFRunLoopSourceSignal(mRunLoopSourceRef);
+    Signal();
 
  done:
     return (lRetval);
@@ -255,13 +270,13 @@ RunLoopQueue :: Pop(void)
 {
     element_type  lRetval = nullptr;
 
-    nlREQUIRE(mRunLoopSourceRef != nullptr, done);
+    nlREQUIRE(IsInitialized(), done);
 
     lRetval = mQueue.front();
 
     mQueue.pop();
 
-    CFRunLoopSourceSignal(mRunLoopSourceRef);
+    Signal();
 
  done:
     return (lRetval);
@@ -307,6 +322,40 @@ RunLoopQueue :: operator ==(const RunLoopQueue &aQueue) const
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Return whether or not the run loop queue has been initialized.
+ *
+ *  @returns
+ *    True if the run loop queue has been initialized; otherwise,
+ *    false.
+ *
+ */
+bool
+RunLoopQueue :: IsInitialized(void) const
+{
+    return ((mRunLoopSourceRef != nullptr) || (mRunLoopParameters.GetEventLoop() != nullptr));
+}
+
+/**
+ *  @brief
+ *    Signal the run loop queue such that its delegate is issued a
+ *    queue status delegation on the next run loop iteration.
+ *
+ */
+void
+RunLoopQueue :: Signal(void)
+{
+    if (mRunLoopParameters.GetEventLoop() != nullptr)
+    {
+        mRunLoopParameters.GetEventLoop()->Signal(this);
+    }
+    else
+    {
+        CFRunLoopSourceSignal(mRunLoopSourceRef);
+    }
+}
+
 // MARK: CoreFoundation Run Loop Handlers
 
 /**
@@ -405,6 +454,32 @@ RunLoopQueue :: Perform(void *aContext)
     }
 }
 
+// MARK: Event Loop Delegate Method
+
+/**
+ *  @brief
+ *    Delegation from a native event loop that the run loop queue was
+ *    signaled.
+ *
+ *  This issues queue status delegations, as #Perform does for a
+ *  CoreFoundation run loop source.
+ *
+ *  @param[in]  aEventLoop   A reference to the native event loop that
+ *                           issued the delegation.
+ *  @param[in]  aDescriptor  Unused.
+ *  @param[in]  aEvents      Unused.
+ *
+ */
+void
+RunLoopQueue :: EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents)
+{
+    (void)aEventLoop;
+    (void)aDescriptor;
+    (void)aEvents;
+
+    Perform();
+}
+
 }; // namespace Common
 
 }; // namespace HLX
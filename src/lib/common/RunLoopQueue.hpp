@@ -31,6 +31,7 @@
 #include <CoreFoundation/CFRunLoop.h>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoopDelegate.hpp>
 #include <OpenHLX/Common/RunLoopParameters.hpp>
 
 
@@ -47,10 +48,15 @@ class RunLoopQueueDelegate;
  *     A run loop-aware queue for managing a queue of non-retained and
  *     unmanaged object pointers.
  *
+ *  When the run loop parameters the queue is initialized with have a
+ *  native event loop, the queue is signaled through that event loop
+ *  rather than through a CoreFoundation run loop source.
+ *
  *  @ingroup common
  *
  */
-class RunLoopQueue
+class RunLoopQueue :
+    public EventLoopDelegate
 {
 public:
     /**
@@ -89,7 +95,14 @@ public:
     static CFStringRef CopyDescription(const void *aContext);
     static void        Perform(void *aContext);
 
+    // Event Loop Delegate Method
+
+    void EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) final;
+
 private:
+    bool               IsInitialized(void) const;
+    void               Signal(void);
+
     // CFRunLoop Handlers
 
     CFStringRef        CopyDescription(void) const;
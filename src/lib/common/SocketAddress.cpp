@@ -74,6 +74,12 @@ operator ==(const SocketAddress &aFirst, const SocketAddress &aSecond)
                               sizeof (sockaddr_in6)) == 0);
             break;
 
+        case AF_LOCAL:
+            lRetval = (strncmp(aFirst.uSocketAddressLocal.sun_path,
+                               aSecond.uSocketAddressLocal.sun_path,
+                               sizeof (aFirst.uSocketAddressLocal.sun_path)) == 0);
+            break;
+
         default:
             lRetval = (memcmp(&aFirst,
                               &aSecond,
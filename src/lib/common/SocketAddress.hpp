@@ -28,6 +28,7 @@
 
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/un.h>
 
 namespace HLX
 {
@@ -37,7 +38,8 @@ namespace Common
 
 /**
  *  @brief
- *    Type for managing IPv4 or IPv6 socket addresses.
+ *    Type for managing IPv4, IPv6, or local (Unix domain) socket
+ *    addresses.
  *
  *  @ingroup common
  *
@@ -47,6 +49,7 @@ union SocketAddress
     sockaddr      uSocketAddress;      //!< Abstract socket address.
     sockaddr_in   uSocketAddressIPv4;  //!< IPv4 socket address.
     sockaddr_in6  uSocketAddressIPv6;  //!< IPv6 socket address.
+    sockaddr_un   uSocketAddressLocal; //!< Local (Unix domain) socket address.
 };
 
 extern bool operator ==(const SocketAddress &aFirst, const SocketAddress &aSecond);
@@ -0,0 +1,1217 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file implements an object for a native, io_uring-based
+ *      socket ring nested within a native event loop.
+ *
+ */
+
+#include "SocketRing.hpp"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+
+#if HAVE_CONFIG_H
+#include "openhlx-config.h"
+#endif
+
+#if OPENHLX_WITH_IO_URING
+#include <liburing.h>
+#include <sys/eventfd.h>
+#endif
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/EventLoop.hpp>
+#include <OpenHLX/Common/SocketRingDelegate.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+namespace Detail
+{
+
+/**
+ *  The number of submission queue entries in the ring. The completion
+ *  queue is twice this.
+ *
+ */
+static constexpr unsigned int kRingEntries      = 256;
+
+/**
+ *  The number, which must be a power of two, of receive buffers
+ *  provided to the kernel for multishot receives across all sockets.
+ *
+ */
+static constexpr unsigned int kReceiveBuffers   = 128;
+
+/**
+ *  The size, in bytes, of each receive buffer provided to the kernel.
+ *  This matches the read size of the CoreFoundation and native event
+ *  loop connection paths.
+ *
+ */
+static constexpr unsigned int kReceiveBufferSize = 4096;
+
+/**
+ *  The provided buffer group identifier for receive buffers.
+ *
+ */
+static constexpr int kReceiveBufferGroup        = 0;
+
+/**
+ *  The maximum number of sends for a single socket submitted as a
+ *  single linked chain.
+ *
+ */
+static constexpr size_t kSendChainMax           = 16;
+
+/**
+ *  The maximum number of completions reaped at once.
+ *
+ */
+static constexpr unsigned int kCompletionsMax   = 64;
+
+// Submission user data is encoded as the operation in the upper 8
+// bits, the socket generation in the next 24 bits, and the socket
+// descriptor in the lower 32 bits.
+
+static uint64_t
+EncodeData(const uint8_t &aOperation, const uint32_t &aGeneration, const int &aSocket)
+{
+    return ((static_cast<uint64_t>(aOperation) << 56) |
+            (static_cast<uint64_t>(aGeneration & 0xFFFFFF) << 32) |
+            static_cast<uint32_t>(aSocket));
+}
+
+static uint8_t
+DecodeOperation(const uint64_t &aData)
+{
+    return (static_cast<uint8_t>(aData >> 56));
+}
+
+static uint32_t
+DecodeGeneration(const uint64_t &aData)
+{
+    return (static_cast<uint32_t>(aData >> 32) & 0xFFFFFF);
+}
+
+static int
+DecodeSocket(const uint64_t &aData)
+{
+    return (static_cast<int>(static_cast<uint32_t>(aData)));
+}
+
+}; // namespace Detail
+
+// MARK: Socket Ring Delegate Default Methods
+
+/**
+ *  @brief
+ *    Delegation from a native socket ring that a connection was
+ *    accepted on a listening socket the delegate registered.
+ *
+ *  The default implementation closes the accepted connection.
+ *
+ *  @param[in]  aSocketRing        A reference to the native socket
+ *                                 ring that issued the delegation.
+ *  @param[in]  aListeningSocket   An immutable reference to the
+ *                                 listening socket.
+ *  @param[in]  aConnectedSocket   An immutable reference to the
+ *                                 accepted socket, ownership of
+ *                                 which passes to the delegate.
+ *
+ */
+void
+SocketRingDelegate :: SocketRingDidAccept(SocketRing &aSocketRing, const int &aListeningSocket, const int &aConnectedSocket)
+{
+    (void)aSocketRing;
+    (void)aListeningSocket;
+
+    close(aConnectedSocket);
+}
+
+/**
+ *  @brief
+ *    Delegation from a native socket ring that data was received on
+ *    a connected socket the delegate registered.
+ *
+ *  The default implementation discards the data.
+ *
+ *  @param[in]  aSocketRing  A reference to the native socket ring
+ *                           that issued the delegation.
+ *  @param[in]  aSocket      An immutable reference to the socket on
+ *                           which the data was received.
+ *  @param[in]  aBuffer      A pointer to the data received, valid
+ *                           only for the duration of the delegation.
+ *  @param[in]  aSize        An immutable reference to the size, in
+ *                           bytes, of the data received.
+ *
+ */
+void
+SocketRingDelegate :: SocketRingDidReceive(SocketRing &aSocketRing, const int &aSocket, const uint8_t *aBuffer, const size_t &aSize)
+{
+    (void)aSocketRing;
+    (void)aSocket;
+    (void)aBuffer;
+    (void)aSize;
+}
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+SocketRing :: SocketRing(void) :
+    mRunLoopParameters(),
+    mRing(nullptr),
+    mBufferRing(nullptr),
+    mBuffers(),
+    mCompletionDescriptor(-1),
+    mSubmitPending(false),
+    mSockets(),
+    mSendable()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+SocketRing :: ~SocketRing(void)
+{
+    Destroy();
+}
+
+/**
+ *  @brief
+ *    Return whether or not the socket ring is supported.
+ *
+ *  @note
+ *    Even if supported, the running kernel may not support the
+ *    socket ring, in which case #Init fails.
+ *
+ *  @returns
+ *    True if the package was configured with the io_uring socket ring
+ *    backend; otherwise, false.
+ *
+ */
+/* static */ bool
+SocketRing :: IsSupported(void)
+{
+#if OPENHLX_WITH_IO_URING
+    return (true);
+#else
+    return (false);
+#endif
+}
+
+/**
+ *  @brief
+ *    This is the class initializer.
+ *
+ *  This initializes the socket ring, provides its receive buffers to
+ *  the kernel, and nests it within the native event loop of the
+ *  specified run loop parameters.
+ *
+ *  @param[in]  aRunLoopParameters  An immutable reference to the run
+ *                                  loop parameters, with a native
+ *                                  event loop, to initialize the
+ *                                  socket ring with.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOSYS          If the package was not configured with
+ *                            the io_uring socket ring backend.
+ *  @retval  -EINVAL          If the run loop parameters have no
+ *                            native event loop.
+ *  @retval  -ENOMEM          If resources could not be allocated for
+ *                            the socket ring.
+ *  @retval  -errno           The system error associated with
+ *                            creating the socket ring, for example,
+ *                            if the running kernel does not support
+ *                            it.
+ *
+ */
+Status
+SocketRing :: Init(const RunLoopParameters &aRunLoopParameters)
+{
+#if OPENHLX_WITH_IO_URING
+    EventLoop *  lEventLoop = aRunLoopParameters.GetEventLoop();
+    int          lStatus;
+    Status       lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(lEventLoop != nullptr, done, lRetval = -EINVAL);
+
+    mRing = new struct io_uring;
+    nlREQUIRE_ACTION(mRing != nullptr, done, lRetval = -ENOMEM);
+
+    lStatus = io_uring_queue_init(Detail::kRingEntries, mRing, 0);
+    if (lStatus != 0)
+    {
+        delete mRing;
+        mRing = nullptr;
+    }
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = lStatus);
+
+    // Provide the receive buffers to the kernel, from which it
+    // selects one per multishot receive completion.
+
+    mBuffers.reset(new uint8_t[Detail::kReceiveBuffers * Detail::kReceiveBufferSize]);
+    nlREQUIRE_ACTION(mBuffers != nullptr, done, lRetval = -ENOMEM);
+
+    mBufferRing = io_uring_setup_buf_ring(mRing,
+                                          Detail::kReceiveBuffers,
+                                          Detail::kReceiveBufferGroup,
+                                          0,
+                                          &lStatus);
+    nlREQUIRE_ACTION(mBufferRing != nullptr, done, lRetval = lStatus);
+
+    for (unsigned int i = 0; i < Detail::kReceiveBuffers; i++)
+    {
+        io_uring_buf_ring_add(mBufferRing,
+                              &mBuffers[i * Detail::kReceiveBufferSize],
+                              Detail::kReceiveBufferSize,
+                              static_cast<unsigned short>(i),
+                              io_uring_buf_ring_mask(Detail::kReceiveBuffers),
+                              static_cast<int>(i));
+    }
+
+    io_uring_buf_ring_advance(mBufferRing, Detail::kReceiveBuffers);
+
+    // Nest the socket ring within the event loop: the kernel signals
+    // the completion descriptor whenever completions are posted.
+
+    mCompletionDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    nlREQUIRE_ACTION(mCompletionDescriptor != -1, done, lRetval = -errno);
+
+    lStatus = io_uring_register_eventfd(mRing, mCompletionDescriptor);
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = lStatus);
+
+    lRetval = lEventLoop->Add(mCompletionDescriptor, EventLoop::kEventReadable, this);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mRunLoopParameters = aRunLoopParameters;
+
+ done:
+    if (lRetval != kStatus_Success)
+    {
+        Destroy();
+    }
+
+    return (lRetval);
+#else
+    (void)aRunLoopParameters;
+
+    return (-ENOSYS);
+#endif // OPENHLX_WITH_IO_URING
+}
+
+/**
+ *  @brief
+ *    Release all resources associated with the socket ring.
+ *
+ *  Any operations still in flight are canceled by the kernel and any
+ *  buffers queued for send are released.
+ *
+ */
+void
+SocketRing :: Destroy(void)
+{
+#if OPENHLX_WITH_IO_URING
+    EventLoop *  lEventLoop = mRunLoopParameters.GetEventLoop();
+
+    if (mCompletionDescriptor != -1)
+    {
+        if (lEventLoop != nullptr)
+        {
+            lEventLoop->Remove(mCompletionDescriptor);
+            lEventLoop->Cancel(this);
+        }
+
+        close(mCompletionDescriptor);
+
+        mCompletionDescriptor = -1;
+    }
+
+    if (mRing != nullptr)
+    {
+        if (mBufferRing != nullptr)
+        {
+            io_uring_free_buf_ring(mRing,
+                                   mBufferRing,
+                                   Detail::kReceiveBuffers,
+                                   Detail::kReceiveBufferGroup);
+
+            mBufferRing = nullptr;
+        }
+
+        io_uring_queue_exit(mRing);
+
+        delete mRing;
+
+        mRing = nullptr;
+    }
+#endif // OPENHLX_WITH_IO_URING
+
+    mBuffers.reset();
+
+    mSubmitPending = false;
+
+    mSockets.clear();
+    mSendable.clear();
+}
+
+// MARK: Socket Management
+
+/**
+ *  @brief
+ *    Return the state for the specified socket, creating it if
+ *    necessary.
+ *
+ *  @param[in]  aSocket  An immutable reference to the socket for
+ *                       which to return the state.
+ *
+ *  @returns
+ *    A reference to the state for the socket.
+ *
+ */
+SocketRing::Socket &
+SocketRing :: GetSocket(const int &aSocket)
+{
+    const size_t  lIndex = static_cast<size_t>(aSocket);
+
+    if (lIndex >= mSockets.size())
+    {
+        mSockets.resize(lIndex + 1, Socket{ nullptr, 0, false, 0, Buffers(), Buffers() });
+    }
+
+    return (mSockets[lIndex]);
+}
+
+/**
+ *  @brief
+ *    Register a listening socket with the socket ring.
+ *
+ *  This registers the specified listening socket with a multishot
+ *  accept, such that the specified delegate is notified of each
+ *  connection accepted on it.
+ *
+ *  @param[in]  aListeningSocket  An immutable reference to the
+ *                                listening socket to register.
+ *  @param[in]  aDelegate         A pointer to the delegate to notify.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the socket ring has not been
+ *                                  initialized.
+ *  @retval  -EINVAL                If the socket is invalid or the
+ *                                  delegate is null.
+ *  @retval  -EEXIST                If the socket is already
+ *                                  registered.
+ *  @retval  -EBUSY                 If the socket ring submission
+ *                                  queue is full.
+ *
+ *  @sa Remove
+ *
+ */
+Status
+SocketRing :: Accept(const int &aListeningSocket, SocketRingDelegate *aDelegate)
+{
+    Status  lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mRing != nullptr, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aListeningSocket >= 0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(aDelegate != nullptr, done, lRetval = -EINVAL);
+
+    {
+        Socket &  lSocket = GetSocket(aListeningSocket);
+
+        nlREQUIRE_ACTION(lSocket.mDelegate == nullptr, done, lRetval = -EEXIST);
+
+        lRetval = Arm(kOperationAccept, aListeningSocket);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lSocket.mDelegate = aDelegate;
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Register a connected socket with the socket ring.
+ *
+ *  This registers the specified connected socket with a multishot
+ *  receive, such that the specified delegate is notified of all data
+ *  received on it.
+ *
+ *  @param[in]  aSocket    An immutable reference to the connected
+ *                         socket to register.
+ *  @param[in]  aDelegate  A pointer to the delegate to notify.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the socket ring has not been
+ *                                  initialized.
+ *  @retval  -EINVAL                If the socket is invalid or the
+ *                                  delegate is null.
+ *  @retval  -EEXIST                If the socket is already
+ *                                  registered.
+ *  @retval  -EBUSY                 If the socket ring submission
+ *                                  queue is full.
+ *
+ *  @sa Send
+ *  @sa Remove
+ *
+ */
+Status
+SocketRing :: Receive(const int &aSocket, SocketRingDelegate *aDelegate)
+{
+    Status  lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mRing != nullptr, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aSocket >= 0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(aDelegate != nullptr, done, lRetval = -EINVAL);
+
+    {
+        Socket &  lSocket = GetSocket(aSocket);
+
+        nlREQUIRE_ACTION(lSocket.mDelegate == nullptr, done, lRetval = -EEXIST);
+
+        lRetval = Arm(kOperationReceive, aSocket);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lSocket.mDelegate = aDelegate;
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Queue data to send on a registered, connected socket.
+ *
+ *  This queues the specified buffer, by reference and without
+ *  copying, to send on the specified socket. Queued sends across all
+ *  sockets are submitted together in the next event loop batch.
+ *
+ *  Since the buffer is sent after this returns, a buffer that does
+ *  not own its data, which may be consumed or reused by its owner in
+ *  the meantime, is instead copied and the copy queued.
+ *
+ *  @param[in]  aSocket  An immutable reference to the registered,
+ *                       connected socket to send on.
+ *  @param[in]  aBuffer  An immutable shared pointer to the data to
+ *                       send.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the socket ring has not been
+ *                                  initialized.
+ *  @retval  -ENOTCONN              If the socket is not registered.
+ *  @retval  -EINVAL                If the buffer is null.
+ *  @retval  -ENOMEM                If resources for a copy of the
+ *                                  buffer could not be allocated.
+ *
+ *  @sa Receive
+ *
+ */
+Status
+SocketRing :: Send(const int &aSocket, ConnectionBuffer::ImmutableCountedPointer aBuffer)
+{
+    const size_t                             lIndex = static_cast<size_t>(aSocket);
+    ConnectionBuffer::MutableCountedPointer  lCopy;
+    Status                                   lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mRing != nullptr, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aSocket >= 0, done, lRetval = -ENOTCONN);
+    nlREQUIRE_ACTION(lIndex < mSockets.size(), done, lRetval = -ENOTCONN);
+    nlREQUIRE_ACTION(mSockets[lIndex].mDelegate != nullptr, done, lRetval = -ENOTCONN);
+    nlREQUIRE_ACTION(aBuffer != nullptr, done, lRetval = -EINVAL);
+
+    if (!aBuffer->IsDataOwner())
+    {
+        lRetval = ConnectionBuffer::Create(lCopy, aBuffer->GetSize());
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = Utilities::Put(*lCopy.get(), aBuffer->GetHead(), aBuffer->GetSize());
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        aBuffer = lCopy;
+    }
+
+    mSockets[lIndex].mPending.push_back(aBuffer);
+
+    ScheduleSend(aSocket);
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Schedule the data queued on a socket for submission, if it is
+ *    not already scheduled.
+ *
+ *  Sends on a socket are submitted as one chain at a time, such that
+ *  they are sent in order. If a chain is already in flight, or the
+ *  completions of one that was cut short are still outstanding, its
+ *  last completion schedules the data instead.
+ *
+ *  @param[in]  aSocket  An immutable reference to the socket to
+ *                       schedule.
+ *
+ */
+void
+SocketRing :: ScheduleSend(const int &aSocket)
+{
+    Socket &  lSocket = mSockets[static_cast<size_t>(aSocket)];
+
+    if (lSocket.mSending.empty() && (lSocket.mCanceled == 0) &&
+        !lSocket.mPending.empty() && !lSocket.mSendable)
+    {
+        lSocket.mSendable = true;
+
+        mSendable.push_back(aSocket);
+
+        ScheduleSubmit();
+    }
+}
+
+/**
+ *  @brief
+ *    Unregister a socket from the socket ring.
+ *
+ *  This cancels all operations on the specified socket and discards
+ *  any data queued, but not yet submitted, to send on it. Once
+ *  removed, the delegate that registered it is not notified of it
+ *  again.
+ *
+ *  @note
+ *    The socket must be removed before it is closed.
+ *
+ *  @param[in]  aSocket  An immutable reference to the socket to
+ *                       remove.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the socket ring has not been
+ *                                  initialized.
+ *  @retval  -ENOENT                If the socket is not registered.
+ *  @retval  -errno                 The system error associated with
+ *                                  submitting the cancellation.
+ *
+ */
+Status
+SocketRing :: Remove(const int &aSocket)
+{
+    const size_t  lIndex = static_cast<size_t>(aSocket);
+    Status        lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mRing != nullptr, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(aSocket >= 0, done, lRetval = -ENOENT);
+    nlREQUIRE_ACTION(lIndex < mSockets.size(), done, lRetval = -ENOENT);
+    nlREQUIRE_ACTION(mSockets[lIndex].mDelegate != nullptr, done, lRetval = -ENOENT);
+
+    {
+        Socket &  lSocket = mSockets[lIndex];
+
+        // Any completions still to come for operations already
+        // submitted carry the prior generation and are discarded,
+        // though buffers already submitted for send are retained
+        // until they complete.
+
+        lSocket.mDelegate = nullptr;
+        lSocket.mGeneration++;
+        lSocket.mPending.clear();
+
+        lRetval = Arm(kOperationCancel, aSocket);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        // Submit immediately, rather than with the next batch, since
+        // the caller closes the socket on return and every submission
+        // must resolve its socket while it is still open.
+
+        lRetval = Submit();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Submission
+
+/**
+ *  @brief
+ *    Prepare, but do not submit, an operation on a socket.
+ *
+ *  @param[in]  aOperation  An immutable reference to the operation to
+ *                          prepare.
+ *  @param[in]  aSocket     An immutable reference to the socket to
+ *                          prepare the operation on.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EBUSY           If the submission queue is full.
+ *
+ */
+Status
+SocketRing :: Arm(const Operation &aOperation, const int &aSocket)
+{
+#if OPENHLX_WITH_IO_URING
+    Socket &               lSocket = GetSocket(aSocket);
+    struct io_uring_sqe *  lSubmission;
+    Status                 lRetval = kStatus_Success;
+
+    lSubmission = io_uring_get_sqe(mRing);
+
+    if (lSubmission == nullptr)
+    {
+        // The submission queue is full; submit what is there and try
+        // again.
+
+        io_uring_submit(mRing);
+
+        lSubmission = io_uring_get_sqe(mRing);
+        nlREQUIRE_ACTION(lSubmission != nullptr, done, lRetval = -EBUSY);
+    }
+
+    switch (aOperation)
+    {
+
+    case kOperationAccept:
+        io_uring_prep_multishot_accept(lSubmission, aSocket, nullptr, nullptr, SOCK_CLOEXEC);
+        break;
+
+    case kOperationReceive:
+        io_uring_prep_recv_multishot(lSubmission, aSocket, nullptr, 0, 0);
+        lSubmission->flags     |= IOSQE_BUFFER_SELECT;
+        lSubmission->buf_group  = Detail::kReceiveBufferGroup;
+        break;
+
+    case kOperationCancel:
+        io_uring_prep_cancel_fd(lSubmission, aSocket, IORING_ASYNC_CANCEL_ALL);
+        break;
+
+    default:
+        nlASSERT(false);
+        break;
+
+    }
+
+    io_uring_sqe_set_data64(lSubmission, Detail::EncodeData(aOperation, lSocket.mGeneration, aSocket));
+
+    if (aOperation != kOperationCancel)
+    {
+        ScheduleSubmit();
+    }
+
+ done:
+    return (lRetval);
+#else
+    (void)aOperation;
+    (void)aSocket;
+
+    return (kError_NotInitialized);
+#endif // OPENHLX_WITH_IO_URING
+}
+
+/**
+ *  @brief
+ *    Schedule a submission with the next event loop batch, if one is
+ *    not already scheduled.
+ *
+ */
+void
+SocketRing :: ScheduleSubmit(void)
+{
+    if (!mSubmitPending)
+    {
+        mSubmitPending = true;
+
+        mRunLoopParameters.GetEventLoop()->Signal(this);
+    }
+}
+
+/**
+ *  @brief
+ *    Prepare any queued sends and submit all prepared operations.
+ *
+ *  For each socket with data queued to send and no sends in flight,
+ *  this prepares up to a chain of linked sends, such that they are
+ *  sent in order and any failure cancels the rest of the chain. All
+ *  prepared operations, across all sockets, are then submitted with
+ *  a single system call.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -errno           The system error associated with the
+ *                            submission.
+ *
+ */
+Status
+SocketRing :: Submit(void)
+{
+#if OPENHLX_WITH_IO_URING
+    static constexpr int  kSendFlags = (MSG_NOSIGNAL | MSG_WAITALL);
+    int                   lStatus;
+    Status                lRetval = kStatus_Success;
+
+    mSubmitPending = false;
+
+    for (size_t i = 0; i < mSendable.size(); i++)
+    {
+        const int     lSocketDescriptor = mSendable[i];
+        Socket &      lSocket = mSockets[static_cast<size_t>(lSocketDescriptor)];
+        const size_t  lCount  = std::min(lSocket.mPending.size(), Detail::kSendChainMax);
+
+        lSocket.mSendable = false;
+
+        if (!lSocket.mSending.empty() || (lSocket.mCanceled != 0) || (lCount == 0))
+        {
+            continue;
+        }
+
+        // A linked chain must be submitted whole, so make room for it
+        // first if necessary.
+
+        if (io_uring_sq_space_left(mRing) < lCount)
+        {
+            io_uring_submit(mRing);
+        }
+
+        for (size_t j = 0; j < lCount; j++)
+        {
+            const ConnectionBuffer::ImmutableCountedPointer &  lBuffer = lSocket.mPending.front();
+            struct io_uring_sqe *                              lSubmission = io_uring_get_sqe(mRing);
+
+            // All but the last send in a chain are flagged as having
+            // more to follow, such that the chain goes out in full
+            // segments rather than one partial segment per send.
+
+            io_uring_prep_send(lSubmission,
+                               lSocketDescriptor,
+                               lBuffer->GetHead(),
+                               lBuffer->GetSize(),
+                               ((j < (lCount - 1)) ? (kSendFlags | MSG_MORE) : kSendFlags));
+
+            io_uring_sqe_set_data64(lSubmission, Detail::EncodeData(kOperationSend, lSocket.mGeneration, lSocketDescriptor));
+
+            if (j < (lCount - 1))
+            {
+                lSubmission->flags |= IOSQE_IO_LINK;
+            }
+
+            lSocket.mSending.push_back(lBuffer);
+            lSocket.mPending.pop_front();
+        }
+    }
+
+    mSendable.clear();
+
+    lStatus = io_uring_submit(mRing);
+    nlREQUIRE_ACTION(lStatus >= 0, done, lRetval = lStatus);
+
+ done:
+    return (lRetval);
+#else
+    return (kError_NotInitialized);
+#endif // OPENHLX_WITH_IO_URING
+}
+
+// MARK: Completion
+
+/**
+ *  @brief
+ *    Return a receive buffer to the kernel.
+ *
+ *  @param[in]  aBufferIdentifier  An immutable reference to the
+ *                                 identifier of the receive buffer
+ *                                 to return.
+ *
+ */
+void
+SocketRing :: RecycleBuffer(const uint16_t &aBufferIdentifier)
+{
+#if OPENHLX_WITH_IO_URING
+    io_uring_buf_ring_add(mBufferRing,
+                          &mBuffers[aBufferIdentifier * Detail::kReceiveBufferSize],
+                          Detail::kReceiveBufferSize,
+                          aBufferIdentifier,
+                          io_uring_buf_ring_mask(Detail::kReceiveBuffers),
+                          0);
+
+    io_uring_buf_ring_advance(mBufferRing, 1);
+#else
+    (void)aBufferIdentifier;
+#endif // OPENHLX_WITH_IO_URING
+}
+
+/**
+ *  @brief
+ *    Handle a single completion.
+ *
+ *  @param[in]  aData    An immutable reference to the user data of
+ *                       the completed submission.
+ *  @param[in]  aResult  An immutable reference to the result of the
+ *                       completion.
+ *  @param[in]  aFlags   An immutable reference to the flags of the
+ *                       completion.
+ *
+ */
+void
+SocketRing :: Complete(const uint64_t &aData, const int &aResult, const uint32_t &aFlags)
+{
+    const int       lSocketDescriptor = Detail::DecodeSocket(aData);
+    const Socket &  lSocket           = GetSocket(lSocketDescriptor);
+    const bool      lIsCurrent        = ((lSocket.mDelegate != nullptr) &&
+                                         ((lSocket.mGeneration & 0xFFFFFF) == Detail::DecodeGeneration(aData)));
+
+    switch (Detail::DecodeOperation(aData))
+    {
+
+    case kOperationAccept:
+        CompleteAccept(lSocketDescriptor, lIsCurrent, aResult, aFlags);
+        break;
+
+    case kOperationReceive:
+        CompleteReceive(lSocketDescriptor, lIsCurrent, aResult, aFlags);
+        break;
+
+    case kOperationSend:
+        CompleteSend(lSocketDescriptor, lIsCurrent, aResult);
+        break;
+
+    case kOperationCancel:
+    default:
+        break;
+
+    }
+}
+
+/**
+ *  @brief
+ *    Handle a multishot accept completion.
+ *
+ *  @param[in]  aSocket     An immutable reference to the listening
+ *                          socket.
+ *  @param[in]  aIsCurrent  An immutable reference to whether the
+ *                          listening socket is still registered.
+ *  @param[in]  aResult     An immutable reference to the accepted
+ *                          socket or a negative error.
+ *  @param[in]  aFlags      An immutable reference to the flags of the
+ *                          completion.
+ *
+ */
+void
+SocketRing :: CompleteAccept(const int &aSocket, const bool &aIsCurrent, const int &aResult, const uint32_t &aFlags)
+{
+#if OPENHLX_WITH_IO_URING
+    if (!aIsCurrent)
+    {
+        if (aResult >= 0)
+        {
+            close(aResult);
+        }
+    }
+    else if (aResult >= 0)
+    {
+        mSockets[static_cast<size_t>(aSocket)].mDelegate->SocketRingDidAccept(*this, aSocket, aResult);
+    }
+    else if (aResult != -ECANCELED)
+    {
+        mSockets[static_cast<size_t>(aSocket)].mDelegate->SocketRingError(*this, aSocket, aResult);
+    }
+
+    // The kernel may end a multishot accept, for example, when the
+    // completion queue overflows. If the socket is still registered,
+    // rearm it.
+
+    if (((aFlags & IORING_CQE_F_MORE) == 0) && (aResult != -ECANCELED) &&
+        (static_cast<size_t>(aSocket) < mSockets.size()) &&
+        (mSockets[static_cast<size_t>(aSocket)].mDelegate != nullptr))
+    {
+        Arm(kOperationAccept, aSocket);
+    }
+#else
+    (void)aSocket;
+    (void)aIsCurrent;
+    (void)aResult;
+    (void)aFlags;
+#endif // OPENHLX_WITH_IO_URING
+}
+
+/**
+ *  @brief
+ *    Handle a multishot receive completion.
+ *
+ *  @param[in]  aSocket     An immutable reference to the connected
+ *                          socket.
+ *  @param[in]  aIsCurrent  An immutable reference to whether the
+ *                          connected socket is still registered.
+ *  @param[in]  aResult     An immutable reference to the number of
+ *                          bytes received, zero (0) if the peer
+ *                          closed the connection, or a negative
+ *                          error.
+ *  @param[in]  aFlags      An immutable reference to the flags of the
+ *                          completion.
+ *
+ */
+void
+SocketRing :: CompleteReceive(const int &aSocket, const bool &aIsCurrent, const int &aResult, const uint32_t &aFlags)
+{
+#if OPENHLX_WITH_IO_URING
+    bool  lRearm = ((aFlags & IORING_CQE_F_MORE) == 0);
+
+    if (aFlags & IORING_CQE_F_BUFFER)
+    {
+        const uint16_t  lBufferIdentifier = static_cast<uint16_t>(aFlags >> IORING_CQE_BUFFER_SHIFT);
+
+        if (aIsCurrent && (aResult > 0))
+        {
+            mSockets[static_cast<size_t>(aSocket)].mDelegate->SocketRingDidReceive(*this,
+                                                                                 aSocket,
+                                                                                 &mBuffers[lBufferIdentifier * Detail::kReceiveBufferSize],
+                                                                                 static_cast<size_t>(aResult));
+        }
+
+        RecycleBuffer(lBufferIdentifier);
+    }
+    else if (aIsCurrent && (aResult == 0))
+    {
+        lRearm = false;
+
+        mSockets[static_cast<size_t>(aSocket)].mDelegate->SocketRingError(*this, aSocket, -ECONNRESET);
+    }
+    else if (aIsCurrent && (aResult < 0) && (aResult != -ENOBUFS) && (aResult != -ECANCELED))
+    {
+        lRearm = false;
+
+        mSockets[static_cast<size_t>(aSocket)].mDelegate->SocketRingError(*this, aSocket, aResult);
+    }
+
+    // The kernel ends a multishot receive when, for example, it runs
+    // out of provided buffers. The buffers are recycled as each
+    // completion is handled, so, if the socket is still registered,
+    // simply rearm it.
+
+    if (lRearm && (aResult != -ECANCELED) &&
+        (static_cast<size_t>(aSocket) < mSockets.size()) &&
+        (mSockets[static_cast<size_t>(aSocket)].mDelegate != nullptr))
+    {
+        Arm(kOperationReceive, aSocket);
+    }
+#else
+    (void)aSocket;
+    (void)aIsCurrent;
+    (void)aResult;
+    (void)aFlags;
+#endif // OPENHLX_WITH_IO_URING
+}
+
+/**
+ *  @brief
+ *    Requeue the unsent remainder of a chain cut short by a partial
+ *    send.
+ *
+ *  This requeues, ahead of any data already queued, the unsent tail
+ *  of the oldest buffer in flight followed by every buffer linked
+ *  behind it, which the kernel cancels with the partial send. The
+ *  completions of those canceled sends are discarded as they arrive.
+ *
+ *  @param[in]  aSocket  A reference to the state for the socket.
+ *  @param[in]  aSent    An immutable reference to the number of
+ *                       bytes of the oldest buffer in flight that
+ *                       were sent.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If resources for the unsent tail could
+ *                            not be allocated.
+ *
+ */
+Status
+SocketRing :: RequeueSend(Socket &aSocket, const size_t &aSent)
+{
+    const ConnectionBuffer::ImmutableCountedPointer  lBuffer = aSocket.mSending.front();
+    ConnectionBuffer::MutableCountedPointer          lRemainder;
+    Status                                           lRetval;
+
+    aSocket.mSending.pop_front();
+
+    lRetval = ConnectionBuffer::Create(lRemainder, lBuffer->GetSize() - aSent);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = Utilities::Put(*lRemainder.get(),
+                             lBuffer->GetHead() + aSent,
+                             lBuffer->GetSize() - aSent);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    aSocket.mCanceled = aSocket.mSending.size();
+
+    aSocket.mPending.insert(aSocket.mPending.begin(),
+                            aSocket.mSending.begin(),
+                            aSocket.mSending.end());
+    aSocket.mPending.push_front(lRemainder);
+
+    aSocket.mSending.clear();
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Handle a send completion.
+ *
+ *  A send that is cut short, which the kernel may do despite
+ *  MSG_WAITALL (for example, when the socket send buffer is full),
+ *  cancels the rest of its chain. Rather than dropping the unsent
+ *  data, it is requeued, in order, ahead of any other data queued on
+ *  the socket and sent with the next chain.
+ *
+ *  @param[in]  aSocket     An immutable reference to the connected
+ *                          socket.
+ *  @param[in]  aIsCurrent  An immutable reference to whether the
+ *                          connected socket is still registered.
+ *  @param[in]  aResult     An immutable reference to the number of
+ *                          bytes sent or a negative error.
+ *
+ */
+void
+SocketRing :: CompleteSend(const int &aSocket, const bool &aIsCurrent, const int &aResult)
+{
+    Socket &  lSocket = mSockets[static_cast<size_t>(aSocket)];
+    Status    lError  = ((aResult < 0) ? aResult : kStatus_Success);
+
+    if (lSocket.mCanceled > 0)
+    {
+        // This completes a send, already requeued, that was linked
+        // behind one cut short.
+
+        lSocket.mCanceled--;
+    }
+    else if (!lSocket.mSending.empty())
+    {
+        // Sends on a socket complete in the order they were linked,
+        // so this completion is for the oldest buffer in flight.
+
+        const size_t  lSize = lSocket.mSending.front()->GetSize();
+
+        if (aIsCurrent && (aResult >= 0) && (static_cast<size_t>(aResult) < lSize))
+        {
+            lError = RequeueSend(lSocket, static_cast<size_t>(aResult));
+        }
+        else
+        {
+            lSocket.mSending.pop_front();
+        }
+    }
+
+    // With the chain complete, queue any data that has accumulated
+    // behind it.
+
+    ScheduleSend(aSocket);
+
+    // Delegate any failure last, since the delegate will likely
+    // remove the socket in response.
+
+    if (aIsCurrent && (lError < 0) && (lError != -ECANCELED))
+    {
+        lSocket.mDelegate->SocketRingError(*this, aSocket, lError);
+    }
+}
+
+// MARK: Event Loop Delegate Method
+
+/**
+ *  @brief
+ *    Delegation from a native event loop that completions are
+ *    available or that a submission was scheduled.
+ *
+ *  This reaps and handles all available completions and then submits
+ *  any operations they, or anything else since the last batch,
+ *  prepared.
+ *
+ *  @param[in]  aEventLoop   A reference to the native event loop that
+ *                           issued the delegation.
+ *  @param[in]  aDescriptor  An immutable reference to the completion
+ *                           descriptor or -1 if signaled.
+ *  @param[in]  aEvents      An immutable reference to the events that
+ *                           are ready.
+ *
+ */
+void
+SocketRing :: EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents)
+{
+#if OPENHLX_WITH_IO_URING
+    struct io_uring_cqe *  lCompletions[Detail::kCompletionsMax];
+    unsigned int           lCount;
+    uint64_t               lValue;
+
+    (void)aEventLoop;
+    (void)aEvents;
+
+    if (aDescriptor == mCompletionDescriptor)
+    {
+        (void)read(mCompletionDescriptor, &lValue, sizeof (lValue));
+
+        do {
+            lCount = io_uring_peek_batch_cqe(mRing, lCompletions, Detail::kCompletionsMax);
+
+            for (unsigned int i = 0; i < lCount; i++)
+            {
+                const uint64_t  lData   = io_uring_cqe_get_data64(lCompletions[i]);
+                const int       lResult = lCompletions[i]->res;
+                const uint32_t  lFlags  = lCompletions[i]->flags;
+
+                Complete(lData, lResult, lFlags);
+            }
+
+            io_uring_cq_advance(mRing, lCount);
+
+        } while (lCount == Detail::kCompletionsMax);
+    }
+
+    Submit();
+#else
+    (void)aEventLoop;
+    (void)aDescriptor;
+    (void)aEvents;
+#endif // OPENHLX_WITH_IO_URING
+}
+
+}; // namespace Common
+
+}; // namespace HLX
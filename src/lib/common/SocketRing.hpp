@@ -0,0 +1,169 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file defines an object for a native, io_uring-based
+ *      socket ring nested within a native event loop.
+ *
+ */
+
+#ifndef OPENHLXCOMMONSOCKETRING_HPP
+#define OPENHLXCOMMONSOCKETRING_HPP
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <stdint.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoopDelegate.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+
+
+struct io_uring;
+struct io_uring_buf_ring;
+
+namespace HLX
+{
+
+namespace Common
+{
+
+class SocketRingDelegate;
+
+/**
+ *  @brief
+ *    An object for a native, io_uring-based socket ring nested within
+ *    a native event loop.
+ *
+ *  Where the native event loop notifies a delegate that a socket is
+ *  ready, after which the delegate makes one system call per read or
+ *  write, the socket ring instead submits socket operations to the
+ *  kernel in batches and delivers their completions:
+ *
+ *    - A listening socket is registered with a single multishot
+ *      accept that completes once per accepted connection.
+ *
+ *    - A connected socket is registered with a single multishot
+ *      receive that completes, into a ring of buffers provided to the
+ *      kernel up front, once per received chunk.
+ *
+ *    - Sends are queued per socket, retaining their buffers without
+ *      copying, and are submitted once per event loop batch as linked
+ *      chains, such that a burst of sends, for example, a
+ *      notification fanned out to every connected client, is a single
+ *      system call. A buffer that does not own its data, which its
+ *      owner may reuse before the batch is submitted, is copied.
+ *
+ *  The ring is nested within the native event loop through an eventfd
+ *  the kernel signals on completion.
+ *
+ *  The socket ring is only available when the package is configured
+ *  with the io_uring backend (see --enable-io-uring) and the running
+ *  kernel supports it. Otherwise, #Init fails and participants should
+ *  continue to use the native event loop.
+ *
+ *  @note
+ *    Other than #Init, the socket ring may only be used from the
+ *    thread of the run loop it is initialized with.
+ *
+ *  @ingroup common
+ *
+ */
+class SocketRing :
+    public EventLoopDelegate
+{
+public:
+    SocketRing(void);
+    ~SocketRing(void);
+
+    Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters);
+
+    static bool IsSupported(void);
+
+    Common::Status Accept(const int &aListeningSocket, SocketRingDelegate *aDelegate);
+    Common::Status Receive(const int &aSocket, SocketRingDelegate *aDelegate);
+    Common::Status Send(const int &aSocket, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer);
+    Common::Status Remove(const int &aSocket);
+
+    // Event Loop Delegate Method
+
+    void EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) final;
+
+private:
+    /**
+     *  Socket ring operations, as encoded in submission user data.
+     *
+     */
+    enum Operation : uint8_t
+    {
+        kOperationAccept  = 1,  //!< A multishot accept.
+        kOperationReceive = 2,  //!< A multishot receive.
+        kOperationSend    = 3,  //!< A send.
+        kOperationCancel  = 4   //!< A cancellation.
+    };
+
+    typedef std::deque<Common::ConnectionBuffer::ImmutableCountedPointer> Buffers;
+
+    /**
+     *  Per-socket state, indexed by socket descriptor.
+     *
+     */
+    struct Socket
+    {
+        SocketRingDelegate *  mDelegate;   //!< The registered delegate, if any.
+        uint32_t              mGeneration; //!< Incremented on each removal.
+        bool                  mSendable;   //!< Whether the socket is awaiting a send submission.
+        size_t                mCanceled;   //!< Sends in flight, already requeued, whose completions are to be discarded.
+        Buffers               mPending;    //!< Buffers queued, but not yet submitted, for send.
+        Buffers               mSending;    //!< Buffers submitted for send, in order.
+    };
+
+    void           Destroy(void);
+    Common::Status Arm(const Operation &aOperation, const int &aSocket);
+    Common::Status Submit(void);
+    void           ScheduleSubmit(void);
+    void           Complete(const uint64_t &aData, const int &aResult, const uint32_t &aFlags);
+    void           CompleteAccept(const int &aSocket, const bool &aIsCurrent, const int &aResult, const uint32_t &aFlags);
+    void           CompleteReceive(const int &aSocket, const bool &aIsCurrent, const int &aResult, const uint32_t &aFlags);
+    void           CompleteSend(const int &aSocket, const bool &aIsCurrent, const int &aResult);
+    Common::Status RequeueSend(Socket &aSocket, const size_t &aSent);
+    void           ScheduleSend(const int &aSocket);
+    void           RecycleBuffer(const uint16_t &aBufferIdentifier);
+    Socket &       GetSocket(const int &aSocket);
+
+private:
+    Common::RunLoopParameters   mRunLoopParameters;
+    struct io_uring *           mRing;
+    struct io_uring_buf_ring *  mBufferRing;
+    std::unique_ptr<uint8_t[]>  mBuffers;
+    int                         mCompletionDescriptor;
+    bool                        mSubmitPending;
+    std::vector<Socket>         mSockets;
+    std::vector<int>            mSendable;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONSOCKETRING_HPP
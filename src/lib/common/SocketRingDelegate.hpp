@@ -0,0 +1,86 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file defines an abstract delegate to a native socket
+ *      ring.
+ *
+ */
+
+#ifndef OPENHLXCOMMONSOCKETRINGDELEGATE_HPP
+#define OPENHLXCOMMONSOCKETRINGDELEGATE_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <OpenHLX/Common/Errors.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+class SocketRing;
+
+/**
+ *  @brief
+ *    Abstract delegate definition for a native socket ring.
+ *
+ *  Since a given socket is typically either a listening socket or a
+ *  connected one, the accept and receive delegations each have a
+ *  default implementation.
+ *
+ *  @ingroup common
+ *
+ */
+class SocketRingDelegate
+{
+public:
+    SocketRingDelegate(void) = default;
+    ~SocketRingDelegate(void) = default;
+
+    virtual void SocketRingDidAccept(SocketRing &aSocketRing, const int &aListeningSocket, const int &aConnectedSocket);
+    virtual void SocketRingDidReceive(SocketRing &aSocketRing, const int &aSocket, const uint8_t *aBuffer, const size_t &aSize);
+
+    /**
+     *  @brief
+     *    Delegation from a native socket ring that an operation on a
+     *    socket the delegate registered failed.
+     *
+     *  @param[in]  aSocketRing  A reference to the native socket ring
+     *                           that issued the delegation.
+     *  @param[in]  aSocket      An immutable reference to the socket
+     *                           on which the operation failed.
+     *  @param[in]  aError       An immutable reference to the error
+     *                           associated with the failure. A peer
+     *                           that closed the connection is
+     *                           -ECONNRESET.
+     *
+     */
+    virtual void SocketRingError(SocketRing &aSocketRing, const int &aSocket, const Common::Error &aError) = 0;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONSOCKETRINGDELEGATE_HPP
@@ -46,6 +46,16 @@ namespace Common
  */
 const SourcesControllerBasis::IdentifierType  SourcesControllerBasis::kSourcesMax = 8;
 
+/**
+ *  The maximum number of sources currently in effect.
+ *
+ *  This defaults to the maximum number supported by the HLX server
+ *  controller; however, it may be changed, for example, by a
+ *  simulator scaled beyond a single chassis.
+ *
+ */
+SourcesControllerBasis::IdentifierType        SourcesControllerBasis::sSourcesMax = kSourcesMax;
+
 // MARK: Observer Methods
 
 /**
@@ -78,7 +88,80 @@ SourcesControllerBasis :: GetSourcesMax(IdentifierType &aSources)
 SourcesControllerBasis::IdentifierType
 SourcesControllerBasis :: GetSourcesMax(void)
 {
-    return (kSourcesMax);
+    return (sSourcesMax);
+}
+
+/**
+ *  @brief
+ *    Get the identifiers of the sources changed since the specified
+ *    change sequence number.
+ *
+ *  This allows a client or proxy to resynchronize its view of the
+ *  sources, or a server to resynchronize its clients, with only those
+ *  changed rather than with all of them.
+ *
+ *  @param[in]      aSequence           An immutable reference to the
+ *                                      change sequence number after
+ *                                      which changed sources are to be
+ *                                      returned.
+ *  @param[in,out]  aSourceIdentifiers  A mutable reference to the
+ *                                      identifiers collection to which
+ *                                      the identifiers of the changed
+ *                                      sources are to be added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+SourcesControllerBasis :: GetSourcesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aSourceIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mSources.GetSourcesChangedSince(aSequence, aSourceIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Mutator Methods
+
+/**
+ *  @brief
+ *    Set the maximum number of supported HLX sources.
+ *
+ *  This sets the maximum number of HLX sources. This must be
+ *  called before any sources controller is initialized, as it
+ *  determines the size of the sources collection model.
+ *
+ *  @param[in]  aSources  The maximum number of HLX sources to set.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *  @retval  -ERANGE                  If the specified value is
+ *                                    smaller or larger than
+ *                                    supported.
+ *
+ */
+Status
+SourcesControllerBasis :: SetSourcesMax(const IdentifierType &aSources)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(aSources >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aSources <= IdentifierModel::kIdentifierMax, done, lRetval = -ERANGE);
+
+    nlEXPECT_ACTION(sSourcesMax != aSources, done, lRetval = kStatus_ValueAlreadySet);
+
+    sSourcesMax = aSources;
+
+ done:
+    return (lRetval);
 }
 
 /**
@@ -125,7 +208,7 @@ SourcesControllerBasis :: ValidateIdentifier(const IdentifierType &aSourceIdenti
 
 
     nlREQUIRE_ACTION(aSourceIdentifier >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
-    nlREQUIRE_ACTION(aSourceIdentifier <= kSourcesMax, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aSourceIdentifier <= sSourcesMax, done, lRetval = -ERANGE);
 
  done:
     return (lRetval);
@@ -145,7 +228,7 @@ SourcesControllerBasis :: Init(void)
 {
     Status lRetval = kStatus_Success;
 
-    lRetval = mSources.Init(kSourcesMax);
+    lRetval = mSources.Init(sSourcesMax);
     nlREQUIRE_SUCCESS(lRetval, done);
 
 done:
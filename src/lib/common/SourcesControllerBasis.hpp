@@ -26,6 +26,8 @@
 #ifndef OPENHLXCOMMONSOURCESCONTROLLERBASIS_HPP
 #define OPENHLXCOMMONSOURCESCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 #include <OpenHLX/Model/SourceModel.hpp>
 #include <OpenHLX/Model/SourcesModel.hpp>
 
@@ -61,6 +63,12 @@ public:
     static Common::Status GetSourcesMax(IdentifierType &aSources);
     static IdentifierType GetSourcesMax(void);
 
+    Common::Status        GetSourcesChangedSince(const Model::ChangeSequence::SequenceType &aSequence, Model::IdentifiersCollection &aSourceIdentifiers);
+
+    // Mutator Methods
+
+    static Common::Status SetSourcesMax(const IdentifierType &aSources);
+
     static bool           IsValidIdentifier(const IdentifierType &aSourceIdentifier);
     static Common::Status ValidateIdentifier(const IdentifierType &aSourceIdentifier);
 
@@ -81,6 +89,7 @@ protected:
 
 protected:
     static const IdentifierType  kSourcesMax;
+    static IdentifierType        sSourcesMax;
 };
 
 }; // namespace Common
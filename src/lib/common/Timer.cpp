@@ -26,9 +26,21 @@
 #include "Timer.hpp"
 
 #include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#if HAVE_CONFIG_H
+#include "openhlx-config.h"
+#endif
+
+#if OPENHLX_WITH_EPOLL
+#include <sys/timerfd.h>
+#endif
 
 #include <LogUtilities/LogUtilities.hpp>
 
+#include <OpenHLX/Common/EventLoop.hpp>
 #include <OpenHLX/Common/Timeout.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
@@ -53,6 +65,8 @@ namespace Common
 Timer :: Timer(void) :
     mRunLoopParameters(),
     mTimerRef(nullptr),
+    mDescriptor(-1),
+    mTimeout(),
     mDelegate(nullptr)
 {
     return;
@@ -93,6 +107,9 @@ Timer :: ~Timer(void)
  *  @retval  kStatus_Success  If successful.
  *  @retval  -ENOMEM          If resources could not be allocated for
  *                            the timer.
+ *  @retval  -errno           The system error associated with
+ *                            creating the timer on a native event
+ *                            loop.
  *
  *  @sa SetDelegate
  *  @sa Start
@@ -105,12 +122,24 @@ Timer :: Init(const Common::RunLoopParameters &aRunLoopParameters,
 {
     static constexpr CFOptionFlags  kFlags           = 0;
     static constexpr CFIndex        kOrder           = 0;
-    const CFTimeInterval            lIntervalSeconds = aTimeout.GetMilliseconds() / 1000;
+    const CFTimeInterval            lIntervalSeconds = static_cast<CFTimeInterval>(aTimeout.GetMilliseconds()) / 1000;
     const CFAbsoluteTime            lFirstFireDate   = CFAbsoluteTimeGetCurrent() + lIntervalSeconds;
     CFRunLoopTimerContext           lTimerContext    = { 0, this, 0, 0, 0 };
     Status                          lRetval          = kStatus_Success;
 
 
+#if OPENHLX_WITH_EPOLL
+    if (aRunLoopParameters.GetEventLoop() != nullptr)
+    {
+        mDescriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        nlREQUIRE_ACTION(mDescriptor != -1, done, lRetval = -errno);
+
+        mTimeout = aTimeout;
+
+        goto initialized;
+    }
+#endif // OPENHLX_WITH_EPOLL
+
     mTimerRef = CFRunLoopTimerCreate(kCFAllocatorDefault,
                                      lFirstFireDate,
                                      lIntervalSeconds,
@@ -120,6 +149,9 @@ Timer :: Init(const Common::RunLoopParameters &aRunLoopParameters,
                                      &lTimerContext);
     nlREQUIRE_ACTION(mTimerRef != nullptr, done, lRetval = -ENOMEM);
 
+#if OPENHLX_WITH_EPOLL
+ initialized:
+#endif
     mRunLoopParameters = aRunLoopParameters;
 
 done:
@@ -157,6 +189,10 @@ Timer :: operator ==(const Timer &aTimer) const
     {
         lRetval = CFEqual(mTimerRef, aTimer.mTimerRef);
     }
+    else if ((mDescriptor != -1) && (aTimer.mDescriptor != -1))
+    {
+        lRetval = (mDescriptor == aTimer.mDescriptor);
+    }
 
     return (lRetval);
 }
@@ -225,6 +261,45 @@ Timer :: Start(void)
     Status  lRetval = kStatus_Success;
 
 
+#if OPENHLX_WITH_EPOLL
+    if (mDescriptor != -1)
+    {
+        const Timeout::Value  lMilliseconds = mTimeout.GetMilliseconds();
+        struct itimerspec  lSpecification;
+        int                   lStatus;
+
+        // As with a CoreFoundation run loop timer, the timer repeats
+        // at its interval unless that interval is zero (0), in which
+        // case it fires once, as soon as possible. A timerfd with a
+        // zero (0) initial expiration is disarmed rather than
+        // immediately expired, so one nanosecond is used instead.
+
+        memset(&lSpecification, 0, sizeof (lSpecification));
+
+        lSpecification.it_interval.tv_sec  = static_cast<time_t>(lMilliseconds / 1000);
+        lSpecification.it_interval.tv_nsec = static_cast<long>((lMilliseconds % 1000) * 1000000);
+
+        lSpecification.it_value = lSpecification.it_interval;
+
+        if (lMilliseconds == 0)
+        {
+            lSpecification.it_value.tv_nsec = 1;
+        }
+
+        lStatus = timerfd_settime(mDescriptor, 0, &lSpecification, nullptr);
+        nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+        lRetval = mRunLoopParameters.GetEventLoop()->Add(mDescriptor, EventLoop::kEventReadable, this);
+        if (lRetval == -EEXIST)
+        {
+            lRetval = kStatus_Success;
+        }
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        goto done;
+    }
+#endif // OPENHLX_WITH_EPOLL
+
     nlREQUIRE_ACTION(mTimerRef != nullptr, done, lRetval = kError_NotInitialized);
 
     CFRunLoopAddTimer(mRunLoopParameters.GetRunLoop(),
@@ -235,6 +310,61 @@ Timer :: Start(void)
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Start, or restart, the timer with the specified timeout.
+ *
+ *  This starts the timer, or restarts it if it is already started,
+ *  such that it next fires at the specified millisecond timeout in
+ *  the future, without destroying and reinitializing it.
+ *
+ *  @note
+ *    Where the timer is backed by a native event loop, the specified
+ *    timeout also becomes its interval.
+ *
+ *  @param[in]  aTimeout  An immutable reference to a millisecond
+ *                        timeout containing when the timer should
+ *                        next fire, in milliseconds.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the timer has not yet been
+ *                                  initialized.
+ *
+ *  @sa Start
+ *  @sa Stop
+ *
+ */
+Status
+Timer :: Start(const Timeout &aTimeout)
+{
+    const CFTimeInterval  lIntervalSeconds = static_cast<CFTimeInterval>(aTimeout.GetMilliseconds()) / 1000;
+    Status                lRetval = kStatus_Success;
+
+
+#if OPENHLX_WITH_EPOLL
+    if (mDescriptor != -1)
+    {
+        mTimeout = aTimeout;
+
+        lRetval = Start();
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        goto done;
+    }
+#endif // OPENHLX_WITH_EPOLL
+
+    nlREQUIRE_ACTION(mTimerRef != nullptr, done, lRetval = kError_NotInitialized);
+
+    CFRunLoopTimerSetNextFireDate(mTimerRef,
+                                  CFAbsoluteTimeGetCurrent() + lIntervalSeconds);
+
+    lRetval = Start();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Stop the timer.
@@ -255,6 +385,21 @@ Timer :: Stop(void)
     Status  lRetval = kStatus_Success;
 
 
+#if OPENHLX_WITH_EPOLL
+    if (mDescriptor != -1)
+    {
+        struct itimerspec  lSpecification;
+
+        memset(&lSpecification, 0, sizeof (lSpecification));
+
+        (void)timerfd_settime(mDescriptor, 0, &lSpecification, nullptr);
+
+        (void)mRunLoopParameters.GetEventLoop()->Remove(mDescriptor);
+
+        goto done;
+    }
+#endif // OPENHLX_WITH_EPOLL
+
     nlREQUIRE_ACTION(mTimerRef != nullptr, done, lRetval = kError_NotInitialized);
 
     CFRunLoopRemoveTimer(mRunLoopParameters.GetRunLoop(),
@@ -287,6 +432,15 @@ Timer :: Destroy(void)
         mTimerRef = nullptr;
     }
 
+    if (mDescriptor != -1)
+    {
+        (void)Stop();
+
+        close(mDescriptor);
+
+        mDescriptor = -1;
+    }
+
     mDelegate = nullptr;
 }
 
@@ -313,6 +467,52 @@ Timer :: TimerFiredCallBack(CFRunLoopTimerRef aTimerRef)
     }
 }
 
+// MARK: Event Loop Delegate Method
+
+/**
+ *  @brief
+ *    Delegation from a native event loop that the timer descriptor is
+ *    ready.
+ *
+ *  This acknowledges the timer expiration and handles any activity
+ *  associated with it.
+ *
+ *  @param[in]  aEventLoop   A reference to the native event loop that
+ *                           issued the delegation.
+ *  @param[in]  aDescriptor  An immutable reference to the timer
+ *                           descriptor that is ready.
+ *  @param[in]  aEvents      An immutable reference to the events that
+ *                           are ready.
+ *
+ */
+void
+Timer :: EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents)
+{
+    uint64_t  lExpirations;
+    ssize_t   lStatus;
+
+    (void)aEventLoop;
+
+    nlEXPECT((aEvents & EventLoop::kEventReadable) != 0, done);
+
+    // The timer descriptor remains readable until its expirations
+    // are read and a burst of expirations is coalesced into a single
+    // delegation, as a CoreFoundation run loop timer would.
+
+    lStatus = read(aDescriptor, &lExpirations, sizeof (lExpirations));
+    nlEXPECT(lStatus == sizeof (lExpirations), done);
+
+    if (mTimeout.GetMilliseconds() == 0)
+    {
+        (void)Stop();
+    }
+
+    TimerFiredCallBack(nullptr);
+
+ done:
+    return;
+}
+
 // MARK: Timer Fired Handler Trampoline
 
 /**
@@ -30,6 +30,7 @@
 #include <CoreFoundation/CFRunLoop.h>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoopDelegate.hpp>
 #include <OpenHLX/Common/RunLoopParameters.hpp>
 #include <OpenHLX/Common/Timeout.hpp>
 
@@ -47,10 +48,15 @@ class TimerDelegate;
  *  @brief
  *    An object for a run loop-based repeating interval timer.
  *
+ *  When the run loop parameters the timer is initialized with have a
+ *  native event loop, the timer is a timerfd registered with that
+ *  event loop rather than a CoreFoundation run loop timer.
+ *
  *  @ingroup common
  *
  */
-class Timer
+class Timer :
+    public EventLoopDelegate
 {
 public:
     // Con/destructor
@@ -75,6 +81,7 @@ public:
     // Timer Management
 
     Common::Status Start(void);
+    Common::Status Start(const Common::Timeout &aTimeout);
     Common::Status Stop(void);
     void           Destroy(void);
 
@@ -82,6 +89,10 @@ public:
 
     static void TimerFiredCallBack(CFRunLoopTimerRef aTimerRef, void *aContext);
 
+    // Event Loop Delegate Method
+
+    void EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) final;
+
 private:
     // Timer Fired Handler
 
@@ -90,6 +101,8 @@ private:
 private:
     Common::RunLoopParameters  mRunLoopParameters;
     CFRunLoopTimerRef          mTimerRef;
+    int                        mDescriptor;
+    Common::Timeout            mTimeout;
     TimerDelegate *            mDelegate;
 };
 
@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for limiting the rate of events
+ *      with a token bucket.
+ *
+ */
+
+#include "TokenBucket.hpp"
+
+#include <errno.h>
+
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+// Global Variables
+
+// The number of accounting units in a single token.
+
+static const uint64_t kUnitsPerToken = 1000;
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+TokenBucket :: TokenBucket(void) :
+    mRate(0),
+    mCapacity(0),
+    mTokens(0),
+    mLastRefill(0)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class initializer.
+ *
+ *  This initializes the token bucket, full, with the specified rate
+ *  and burst size.
+ *
+ *  @param[in]  aRate   An immutable reference to the rate, in tokens
+ *                      per second, at which the bucket is refilled.
+ *  @param[in]  aBurst  An immutable reference to the maximum number
+ *                      of tokens the bucket holds.
+ *  @param[in]  aNow    An immutable reference to the current time, in
+ *                      milliseconds.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If @a aRate or @a aBurst is zero (0).
+ *
+ */
+Status
+TokenBucket :: Init(const CountType &aRate, const CountType &aBurst, const TimeType &aNow)
+{
+    Status lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(aRate > 0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(aBurst > 0, done, lRetval = -EINVAL);
+
+    // A rate in tokens per second is the same rate in units per
+    // millisecond.
+
+    mRate       = aRate;
+    mCapacity   = aBurst * kUnitsPerToken;
+    mTokens     = mCapacity;
+    mLastRefill = aNow;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Attempt to take a token from the bucket.
+ *
+ *  This refills the bucket for the time elapsed since it was last
+ *  refilled and then, if a token is available, takes it.
+ *
+ *  @param[in]  aNow  An immutable reference to the current time, in
+ *                    milliseconds.
+ *
+ *  @returns
+ *    True if a token was available and taken; otherwise, false, if
+ *    the event for which it was requested should be refused.
+ *
+ */
+bool
+TokenBucket :: Take(const TimeType &aNow)
+{
+    bool lRetval = false;
+
+    Refill(aNow);
+
+    if (mTokens >= kUnitsPerToken)
+    {
+        mTokens -= kUnitsPerToken;
+
+        lRetval = true;
+    }
+
+    return (lRetval);
+}
+
+void
+TokenBucket :: Refill(const TimeType &aNow)
+{
+    const TimeType  lElapsed = ((aNow > mLastRefill) ? (aNow - mLastRefill) : 0);
+
+    nlEXPECT(mRate > 0, done);
+
+    // Saturate, rather than multiply, for any interval long enough to
+    // fill the bucket such that a long idle interval cannot overflow.
+
+    if (lElapsed >= (((mCapacity - mTokens) / mRate) + 1))
+    {
+        mTokens = mCapacity;
+    }
+    else
+    {
+        mTokens += (lElapsed * mRate);
+    }
+
+    if (mTokens > mCapacity)
+    {
+        mTokens = mCapacity;
+    }
+
+    if (aNow > mLastRefill)
+    {
+        mLastRefill = aNow;
+    }
+
+ done:
+    return;
+}
+
+}; // namespace Common
+
+}; // namespace HLX
@@ -0,0 +1,99 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for limiting the rate of events
+ *      with a token bucket.
+ *
+ */
+
+#ifndef OPENHLXCOMMONTOKENBUCKET_HPP
+#define OPENHLXCOMMONTOKENBUCKET_HPP
+
+#include <stdint.h>
+
+#include <OpenHLX/Common/Errors.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+/**
+ *  @brief
+ *    An object for limiting the rate of events with a token bucket.
+ *
+ *  The bucket holds up to a burst of tokens and is refilled at a
+ *  steady rate. Each event takes a token and events for which no
+ *  token is available are refused, such that events are limited to
+ *  the rate over time while bursts of up to the burst size are
+ *  admitted at once.
+ *
+ *  Time is supplied by the caller, in milliseconds from any fixed,
+ *  monotonic epoch, such that the bucket is independent of any
+ *  particular clock.
+ *
+ *  @ingroup common
+ *
+ */
+class TokenBucket
+{
+public:
+    /**
+     *  A type for a time, in milliseconds from a fixed, monotonic
+     *  epoch.
+     *
+     */
+    typedef uint64_t TimeType;
+
+    /**
+     *  A type for a count of tokens or a rate, in tokens per second.
+     *
+     */
+    typedef uint32_t CountType;
+
+public:
+    TokenBucket(void);
+    ~TokenBucket(void) = default;
+
+    Status Init(const CountType &aRate, const CountType &aBurst, const TimeType &aNow);
+
+    bool Take(const TimeType &aNow);
+
+private:
+    void Refill(const TimeType &aNow);
+
+private:
+    // Tokens are accounted for in thousandths such that a refill at a
+    // rate in tokens per second over an interval in milliseconds is
+    // exact.
+
+    uint64_t  mRate;
+    uint64_t  mCapacity;
+    uint64_t  mTokens;
+    TimeType  mLastRefill;
+};
+
+}; // namespace Common
+
+}; // namespace HLX
+
+#endif // OPENHLXCOMMONTOKENBUCKET_HPP
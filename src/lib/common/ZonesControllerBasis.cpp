@@ -47,6 +47,16 @@ namespace Common
  */
 const ZonesControllerBasis::IdentifierType  ZonesControllerBasis::kZonesMax = 24;
 
+/**
+ *  The maximum number of zones currently in effect.
+ *
+ *  This defaults to the maximum number supported by the HLX server
+ *  controller; however, it may be changed, for example, by a
+ *  simulator scaled beyond a single chassis.
+ *
+ */
+ZonesControllerBasis::IdentifierType        ZonesControllerBasis::sZonesMax = kZonesMax;
+
 // MARK: Observer Methods
 
 /**
@@ -79,7 +89,79 @@ ZonesControllerBasis :: GetZonesMax(IdentifierType &aZones)
 ZonesControllerBasis::IdentifierType
 ZonesControllerBasis :: GetZonesMax(void)
 {
-    return (kZonesMax);
+    return (sZonesMax);
+}
+
+/**
+ *  @brief
+ *    Get the identifiers of the zones changed since the specified
+ *    change sequence number.
+ *
+ *  This allows a client or proxy to resynchronize its view of the
+ *  zones, or a server to resynchronize its clients, with only those
+ *  changed rather than with all of them.
+ *
+ *  @param[in]      aSequence         An immutable reference to the
+ *                                    change sequence number after which
+ *                                    changed zones are to be returned.
+ *  @param[in,out]  aZoneIdentifiers  A mutable reference to the
+ *                                    identifiers collection to which
+ *                                    the identifiers of the changed
+ *                                    zones are to be added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+ZonesControllerBasis :: GetZonesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aZoneIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mZones.GetZonesChangedSince(aSequence, aZoneIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Mutator Methods
+
+/**
+ *  @brief
+ *    Set the maximum number of supported HLX zones.
+ *
+ *  This sets the maximum number of HLX zones. This must be
+ *  called before any zones controller is initialized, as it
+ *  determines the size of the zones collection model.
+ *
+ *  @param[in]  aZones  The maximum number of HLX zones to set.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *  @retval  -ERANGE                  If the specified value is
+ *                                    smaller or larger than
+ *                                    supported.
+ *
+ */
+Status
+ZonesControllerBasis :: SetZonesMax(const IdentifierType &aZones)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(aZones >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aZones <= IdentifierModel::kIdentifierMax, done, lRetval = -ERANGE);
+
+    nlEXPECT_ACTION(sZonesMax != aZones, done, lRetval = kStatus_ValueAlreadySet);
+
+    sZonesMax = aZones;
+
+ done:
+    return (lRetval);
 }
 
 /**
@@ -126,7 +208,7 @@ ZonesControllerBasis :: ValidateIdentifier(const IdentifierType &aZoneIdentifier
 
 
     nlREQUIRE_ACTION(aZoneIdentifier >= IdentifierModel::kIdentifierMin, done, lRetval = -ERANGE);
-    nlREQUIRE_ACTION(aZoneIdentifier <= kZonesMax, done, lRetval = -ERANGE);
+    nlREQUIRE_ACTION(aZoneIdentifier <= sZonesMax, done, lRetval = -ERANGE);
 
  done:
     return (lRetval);
@@ -146,7 +228,7 @@ ZonesControllerBasis :: Init(void)
 {
     Status lRetval = kStatus_Success;
 
-    lRetval = mZones.Init(kZonesMax);
+    lRetval = mZones.Init(sZonesMax);
     nlREQUIRE_SUCCESS(lRetval, done);
 
 done:
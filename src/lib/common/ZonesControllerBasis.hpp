@@ -26,6 +26,8 @@
 #ifndef OPENHLXCOMMONZONESCONTROLLERBASIS_HPP
 #define OPENHLXCOMMONZONESCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 #include <OpenHLX/Model/ZoneModel.hpp>
 #include <OpenHLX/Model/ZonesModel.hpp>
 
@@ -61,6 +63,12 @@ public:
     static Common::Status GetZonesMax(IdentifierType &aZones);
     static IdentifierType GetZonesMax(void);
 
+    Common::Status        GetZonesChangedSince(const Model::ChangeSequence::SequenceType &aSequence, Model::IdentifiersCollection &aZoneIdentifiers);
+
+    // Mutator Methods
+
+    static Common::Status SetZonesMax(const IdentifierType &aZones);
+
     static bool           IsValidIdentifier(const IdentifierType &aZoneIdentifier);
     static Common::Status ValidateIdentifier(const IdentifierType &aZoneIdentifier);
 
@@ -81,6 +89,7 @@ protected:
 
 protected:
     static const IdentifierType  kZonesMax;
+    static IdentifierType        sZonesMax;
 };
 
 }; // namespace Common
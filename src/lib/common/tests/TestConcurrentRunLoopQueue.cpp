@@ -0,0 +1,266 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for
+ *      HLX::Common::ConcurrentRunLoopQueue.
+ *
+ */
+
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <stddef.h>
+
+#include <CoreFoundation/CFRunLoop.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/ConcurrentRunLoopQueue.hpp>
+#include <OpenHLX/Common/ConcurrentRunLoopQueueDelegate.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+
+
+static const size_t kProducers = 4;
+static const size_t kElements  = 10000;
+
+struct Element
+{
+    size_t  mProducer;
+    size_t  mSequence;
+};
+
+class Consumer :
+    public ConcurrentRunLoopQueueDelegate
+{
+public:
+    Consumer(void) :
+        mDelegations(0),
+        mPopped(0),
+        mOrdered(true),
+        mNext(kProducers, 0)
+    {
+        return;
+    }
+
+    void QueueIsNotEmpty(ConcurrentRunLoopQueue &aQueue) final
+    {
+        ConcurrentRunLoopQueue::element_type  lElement;
+
+        mDelegations++;
+
+        while ((lElement = aQueue.Pop()) != nullptr)
+        {
+            const Element *lCurrent = static_cast<const Element *>(lElement);
+
+            // Elements from any one producer must be popped in the
+            // order that producer pushed them.
+
+            if (lCurrent->mSequence != mNext[lCurrent->mProducer])
+            {
+                mOrdered = false;
+            }
+
+            mNext[lCurrent->mProducer] = lCurrent->mSequence + 1;
+
+            mPopped++;
+        }
+    }
+
+    size_t               mDelegations;
+    size_t               mPopped;
+    bool                 mOrdered;
+    std::vector<size_t>  mNext;
+};
+
+static Element sElements[kProducers][kElements];
+
+static void Produce(ConcurrentRunLoopQueue *aQueue, size_t aProducer, Status *aStatus)
+{
+    size_t  lSequence;
+    Status  lStatus = kStatus_Success;
+
+    for (lSequence = 0; lSequence < kElements; lSequence++)
+    {
+        sElements[aProducer][lSequence].mProducer = aProducer;
+        sElements[aProducer][lSequence].mSequence = lSequence;
+
+        lStatus = aQueue->Push(&sElements[aProducer][lSequence]);
+
+        if (lStatus != kStatus_Success)
+        {
+            break;
+        }
+    }
+
+    *aStatus = lStatus;
+}
+
+static void TestConstruction(nlTestSuite *inSuite __attribute__((unused)),
+                             void *inContext __attribute__((unused)))
+{
+    ConcurrentRunLoopQueue lQueue;
+
+    (void)lQueue;
+}
+
+static void TestUninitialized(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    ConcurrentRunLoopQueue  lQueue;
+    Element                 lElement = { 0, 0 };
+    Status                  lStatus;
+
+    lStatus = lQueue.Push(&lElement);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    NL_TEST_ASSERT(inSuite, lQueue.Pop() == nullptr);
+}
+
+static void TestSingleProducer(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters       lRunLoopParameters;
+    ConcurrentRunLoopQueue  lQueue;
+    Consumer                lConsumer;
+    size_t                  lSequence;
+    Status                  lStatus;
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lQueue.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lQueue.SetDelegate(&lConsumer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, lQueue.IsEmpty());
+
+    // Null elements are reserved to indicate an empty queue.
+
+    lStatus = lQueue.Push(nullptr);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    for (lSequence = 0; lSequence < kElements; lSequence++)
+    {
+        sElements[0][lSequence].mProducer = 0;
+        sElements[0][lSequence].mSequence = lSequence;
+
+        lStatus = lQueue.Push(&sElements[0][lSequence]);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, !lQueue.IsEmpty());
+
+    // The burst of pushes should be delivered in a single delegation.
+
+    CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0, true);
+
+    NL_TEST_ASSERT(inSuite, lConsumer.mDelegations == 1);
+    NL_TEST_ASSERT(inSuite, lConsumer.mPopped == kElements);
+    NL_TEST_ASSERT(inSuite, lConsumer.mOrdered);
+    NL_TEST_ASSERT(inSuite, lQueue.IsEmpty());
+}
+
+static void TestMultipleProducers(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters         lRunLoopParameters;
+    ConcurrentRunLoopQueue    lQueue;
+    Consumer                  lConsumer;
+    std::vector<std::thread>  lProducers;
+    std::vector<Status>       lStatuses(kProducers, kStatus_Success);
+    size_t                    lProducer;
+    Status                    lStatus;
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lQueue.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lQueue.SetDelegate(&lConsumer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    for (lProducer = 0; lProducer < kProducers; lProducer++)
+    {
+        lProducers.push_back(std::thread(Produce, &lQueue, lProducer, &lStatuses[lProducer]));
+    }
+
+    // Consume concurrently with the producers until every element
+    // has been popped.
+
+    while (lConsumer.mPopped < (kProducers * kElements))
+    {
+        CFRunLoopRunInMode(kCFRunLoopDefaultMode, 1.0, true);
+    }
+
+    for (lProducer = 0; lProducer < kProducers; lProducer++)
+    {
+        lProducers[lProducer].join();
+
+        NL_TEST_ASSERT(inSuite, lStatuses[lProducer] == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, lConsumer.mPopped == (kProducers * kElements));
+    NL_TEST_ASSERT(inSuite, lConsumer.mOrdered);
+    NL_TEST_ASSERT(inSuite, lConsumer.mDelegations <= (kProducers * kElements));
+    NL_TEST_ASSERT(inSuite, lQueue.IsEmpty());
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Construction",         TestConstruction),
+    NL_TEST_DEF("Uninitialized",        TestUninitialized),
+    NL_TEST_DEF("Single Producer",      TestSingleProducer),
+    NL_TEST_DEF("Multiple Producers",   TestMultipleProducers),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Concurrent Run Loop Queue",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
@@ -99,6 +99,7 @@ static void TestValueInitialization(nlTestSuite *inSuite, void *inContext __attr
 
     lStatus = lConnectionBuffer_4.Init(lOurData, lCapacity);
     NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_4.IsDataOwner());
 
     // 2.2: Test non-null (our owned buffer) pointer and capacity.
 
@@ -117,6 +118,7 @@ static void TestValueInitialization(nlTestSuite *inSuite, void *inContext __attr
 
     lStatus = lConnectionBuffer_6.Init(lOurData, lCapacity);
     NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, !lConnectionBuffer_6.IsDataOwner());
 }
 
 static void TestInitialization(nlTestSuite *inSuite, void *inContext)
@@ -146,6 +148,75 @@ static void TestObservation(const ConnectionBuffer &inBuffer, nlTestSuite *inSui
 }
 
 
+static void TestCreation(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    constexpr size_t                         kCapacity       = 257;
+    const char * const                       kTestData       = "This is a test.";
+    const size_t                             kTestDataLength = strlen(kTestData);
+    ConnectionBuffer::MutableCountedPointer  lConnectionBuffer_1;
+    ConnectionBuffer::MutableCountedPointer  lConnectionBuffer_2;
+    const ConnectionBuffer *                 lPriorBuffer;
+    const uint8_t *                          lPriorHead;
+    const uint8_t *                          lOurData;
+    size_t                                   lOurSize;
+    uint8_t *                                lHead;
+    size_t                                   lCapacity;
+    int                                      lComparison;
+    Status                                   lStatus;
+
+
+    lOurData = reinterpret_cast<const uint8_t *>(kTestData);
+    lOurSize = kTestDataLength;
+
+    // 1: Test creation with the default capacity
+
+    lStatus = ConnectionBuffer::Create(lConnectionBuffer_1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_1 != nullptr);
+
+    TestObservation(*lConnectionBuffer_1, inSuite, ConnectionBuffer::kDefaultCapacity);
+
+    // 2: Test creation with an explicit capacity
+
+    lStatus = ConnectionBuffer::Create(lConnectionBuffer_2, kCapacity);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_2 != nullptr);
+
+    TestObservation(*lConnectionBuffer_2, inSuite, kCapacity);
+
+    // 3: Test that a created buffer may grow beyond its initial size
+    //    class with its contents preserved.
+
+    lStatus = Utilities::Put(*lConnectionBuffer_1, lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lConnectionBuffer_1->Reserve(kCapacity << 4);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lCapacity = lConnectionBuffer_1->GetCapacity();
+    NL_TEST_ASSERT(inSuite, lCapacity == (kCapacity << 4));
+
+    lHead = lConnectionBuffer_1->GetHead();
+    NL_TEST_ASSERT(inSuite, lHead != nullptr);
+
+    lComparison = memcmp(lHead, lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lComparison == 0);
+
+    // 4: Test that a released buffer and its backing store are
+    //    recycled by a subsequent creation on the same thread.
+
+    lPriorBuffer = lConnectionBuffer_2.get();
+    lPriorHead   = lConnectionBuffer_2->GetHead();
+
+    lConnectionBuffer_2.reset();
+
+    lStatus = ConnectionBuffer::Create(lConnectionBuffer_2, kCapacity);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_2.get() == lPriorBuffer);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_2->GetHead() == lPriorHead);
+}
+
 static void TestObservation(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
 {
     constexpr size_t   kCapacity       = 257;
@@ -876,6 +947,114 @@ static void TestReserve(nlTestSuite *inSuite, void *inContext __attribute__((unu
     NL_TEST_ASSERT(inSuite, lComparison == 0);
 }
 
+static void TestConsumption(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    constexpr size_t   kCapacity       = 32;
+    const char * const kTestData       = "This is a test.";
+    const size_t       kTestDataLength = strlen(kTestData);
+    ConnectionBuffer   lConnectionBuffer;
+    const uint8_t *    lOurData;
+    size_t             lOurSize;
+    uint8_t            lBackingBuffer[kCapacity];
+    uint8_t            lCopyBuffer[16];
+    uint8_t *          lHead;
+    uint8_t *          lResult;
+    size_t             lSize;
+    int                lComparison;
+    Status             lStatus;
+
+
+    lOurData = reinterpret_cast<const uint8_t *>(kTestData);
+    lOurSize = kTestDataLength;
+
+    lStatus = lConnectionBuffer.Init(&lBackingBuffer[0], kCapacity);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // 1: Test that a partial get advances the head in place rather
+    //    than moving the remaining data.
+
+    lResult = lConnectionBuffer.Put(lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lResult == &lBackingBuffer[0]);
+
+    lResult = lConnectionBuffer.Get(lCopyBuffer, 5);
+    NL_TEST_ASSERT(inSuite, lResult != nullptr);
+
+    lHead = lConnectionBuffer.GetHead();
+    NL_TEST_ASSERT(inSuite, lHead == &lBackingBuffer[5]);
+
+    lSize = lConnectionBuffer.GetSize();
+    NL_TEST_ASSERT(inSuite, lSize == lOurSize - 5);
+
+    lComparison = memcmp(lHead, lOurData + 5, lOurSize - 5);
+    NL_TEST_ASSERT(inSuite, lComparison == 0);
+
+    // 2: Test that a put that fits following the data is appended in
+    //    place.
+
+    lResult = lConnectionBuffer.Put(lOurData, 5);
+    NL_TEST_ASSERT(inSuite, lResult == &lBackingBuffer[lOurSize]);
+
+    lHead = lConnectionBuffer.GetHead();
+    NL_TEST_ASSERT(inSuite, lHead == &lBackingBuffer[5]);
+
+    // 3: Test that a put that does not fit following the data, but
+    //    that fits in the buffer headroom, reclaims the space freed by
+    //    prior gets and preserves the data.
+
+    lResult = lConnectionBuffer.Put(lOurData, kCapacity - lOurSize);
+    NL_TEST_ASSERT(inSuite, lResult != nullptr);
+
+    lHead = lConnectionBuffer.GetHead();
+    NL_TEST_ASSERT(inSuite, lHead == &lBackingBuffer[0]);
+
+    lSize = lConnectionBuffer.GetSize();
+    NL_TEST_ASSERT(inSuite, lSize == kCapacity);
+
+    lComparison = memcmp(lHead, lOurData + 5, lOurSize - 5);
+    NL_TEST_ASSERT(inSuite, lComparison == 0);
+
+    lComparison = memcmp(lHead + lOurSize - 5, lOurData, 5);
+    NL_TEST_ASSERT(inSuite, lComparison == 0);
+
+    lComparison = memcmp(lHead + lOurSize, lOurData, kCapacity - lOurSize);
+    NL_TEST_ASSERT(inSuite, lComparison == 0);
+
+    // 4: Test that a put beyond the buffer headroom still fails.
+
+    lResult = lConnectionBuffer.Put(lOurData, 1);
+    NL_TEST_ASSERT(inSuite, lResult == nullptr);
+
+    // 5: Test that a complete get rewinds the head to the start of
+    //    the backing store.
+
+    lResult = lConnectionBuffer.Get(lCopyBuffer, 5);
+    NL_TEST_ASSERT(inSuite, lResult != nullptr);
+
+    lResult = lConnectionBuffer.Get(nullptr, kCapacity - 5);
+    NL_TEST_ASSERT(inSuite, lResult == nullptr);
+
+    lSize = lConnectionBuffer.GetSize();
+    NL_TEST_ASSERT(inSuite, lSize == 0);
+
+    lHead = lConnectionBuffer.GetHead();
+    NL_TEST_ASSERT(inSuite, lHead == &lBackingBuffer[0]);
+
+    // 6: Test that the size may not be set beyond the end of the
+    //    backing store following a partial get.
+
+    lResult = lConnectionBuffer.Put(lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lResult != nullptr);
+
+    lResult = lConnectionBuffer.Get(lCopyBuffer, 5);
+    NL_TEST_ASSERT(inSuite, lResult != nullptr);
+
+    lStatus = lConnectionBuffer.SetSize(kCapacity);
+    NL_TEST_ASSERT(inSuite, lStatus == -ENOSPC);
+
+    lStatus = lConnectionBuffer.SetSize(kCapacity - 5);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+}
+
 static void TestMutation(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
 {
     TestDestroy(inSuite, inContext);
@@ -884,6 +1063,7 @@ static void TestMutation(nlTestSuite *inSuite, void *inContext __attribute__((un
     TestSetSize(inSuite, inContext);
     TestFlush(inSuite, inContext);
     TestReserve(inSuite, inContext);
+    TestConsumption(inSuite, inContext);
 }
 
 static void TestUtilities(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
@@ -964,15 +1144,127 @@ static void TestUtilities(nlTestSuite *inSuite, void *inContext __attribute__((u
     NL_TEST_ASSERT(inSuite, lCapacity == kCapacity);
 }
 
+static void TestChaining(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    constexpr size_t                         kCapacity       = 257;
+    const char * const                       kTestData       = "This is a test.";
+    const size_t                             kTestDataLength = strlen(kTestData);
+    ConnectionBuffer                         lConnectionBuffer_1;
+    ConnectionBuffer                         lConnectionBuffer_2;
+    ConnectionBuffer                         lConnectionBuffer_3;
+    ConnectionBuffer                         lConnectionBuffer_4;
+    ConnectionBuffer::MutableCountedPointer  lFragment;
+    const uint8_t *                          lOurData;
+    size_t                                   lOurSize;
+    uint8_t                                  lBackingBuffer[kCapacity];
+    const uint8_t *                          lHead;
+    Status                                   lStatus;
+
+
+    lOurData = reinterpret_cast<const uint8_t *>(kTestData);
+    lOurSize = kTestDataLength;
+
+    // 1.1: Test append on a caller-owned backing store
+
+    // 1.1.1: Test append with sufficient head room
+
+    lStatus = lConnectionBuffer_1.Init(&lBackingBuffer[0], kCapacity);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = Utilities::Append(lConnectionBuffer_1, lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_1.GetSize() == lOurSize);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_1.GetNext() == nullptr);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_1.GetChainSize() == lOurSize);
+
+    // 1.1.2: Test append with insufficient head room, which, unlike
+    //        put, chains a buffer-owned fragment rather than failing.
+
+    lStatus = lConnectionBuffer_2.Init(&lBackingBuffer[0], kTestDataLength >> 1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = Utilities::Append(lConnectionBuffer_2, lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_2.GetSize() == 0);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_2.GetChainSize() == lOurSize);
+
+    lFragment = lConnectionBuffer_2.GetNext();
+    NL_TEST_ASSERT(inSuite, lFragment != nullptr);
+    NL_TEST_ASSERT(inSuite, lFragment->IsDataOwner());
+    NL_TEST_ASSERT(inSuite, lFragment->GetSize() == lOurSize);
+    NL_TEST_ASSERT(inSuite, memcmp(lFragment->GetHead(), lOurData, lOurSize) == 0);
+
+    // 1.2: Test append on a buffer-owned backing store
+
+    // 1.2.1: Test append with insufficient head room to an empty
+    //        buffer, which is grown rather than chained.
+
+    lStatus = lConnectionBuffer_3.Init(nullptr, kTestDataLength >> 1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = Utilities::Append(lConnectionBuffer_3, lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_3.GetSize() == lOurSize);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_3.GetCapacity() == 16);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_3.GetNext() == nullptr);
+
+    // 1.2.2: Test append with insufficient head room to a non-empty
+    //        buffer, which chains fragments, each twice the capacity
+    //        of the last, without moving the data already appended.
+
+    lStatus = lConnectionBuffer_4.Init(nullptr, 16);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = Utilities::Append(lConnectionBuffer_4, lOurData, lOurSize);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lHead = lConnectionBuffer_4.GetHead();
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        lStatus = Utilities::Append(lConnectionBuffer_4, lOurData, lOurSize);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_4.GetHead() == lHead);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_4.GetSize() == lOurSize);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_4.GetChainSize() == (lOurSize * 4));
+
+    lFragment = lConnectionBuffer_4.GetNext();
+    NL_TEST_ASSERT(inSuite, lFragment != nullptr);
+    NL_TEST_ASSERT(inSuite, lFragment->GetCapacity() == 32);
+    NL_TEST_ASSERT(inSuite, lFragment->GetSize() == (lOurSize * 2));
+    NL_TEST_ASSERT(inSuite, memcmp(lFragment->GetHead(), lOurData, lOurSize) == 0);
+    NL_TEST_ASSERT(inSuite, memcmp(lFragment->GetHead() + lOurSize, lOurData, lOurSize) == 0);
+
+    lFragment = lFragment->GetNext();
+    NL_TEST_ASSERT(inSuite, lFragment != nullptr);
+    NL_TEST_ASSERT(inSuite, lFragment->GetCapacity() == 64);
+    NL_TEST_ASSERT(inSuite, lFragment->GetSize() == lOurSize);
+    NL_TEST_ASSERT(inSuite, lFragment->GetNext() == nullptr);
+
+    // 1.3: Test that flush releases any chained fragments.
+
+    lConnectionBuffer_4.Flush();
+
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_4.GetNext() == nullptr);
+    NL_TEST_ASSERT(inSuite, lConnectionBuffer_4.GetChainSize() == 0);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 static const nlTest sTests[] = {
     NL_TEST_DEF("Construction",   TestConstruction),
     NL_TEST_DEF("Initialization", TestInitialization),
+    NL_TEST_DEF("Creation",       TestCreation),
     NL_TEST_DEF("Observation",    TestObservation),
     NL_TEST_DEF("Mutation",       TestMutation),
     NL_TEST_DEF("Utilities",      TestUtilities),
+    NL_TEST_DEF("Chaining",       TestChaining),
 
     NL_TEST_SENTINEL()
 };
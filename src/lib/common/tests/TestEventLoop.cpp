@@ -0,0 +1,557 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for HLX::Common::EventLoop
+ *      and for HLX::Common::Timer when nested within it.
+ *
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+
+#include <CoreFoundation/CFRunLoop.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoop.hpp>
+#include <OpenHLX/Common/EventLoopDelegate.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Common/Timeout.hpp>
+#include <OpenHLX/Common/Timer.hpp>
+#include <OpenHLX/Common/TimerDelegate.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+
+
+/**
+ *  An event loop delegate that records the delegations it receives.
+ *
+ */
+class Recorder :
+    public EventLoopDelegate
+{
+public:
+    Recorder(void) :
+        mDelegations(0),
+        mDescriptor(-1),
+        mEvents(EventLoop::kEventNone)
+    {
+        return;
+    }
+
+    void EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) override
+    {
+        (void)aEventLoop;
+
+        mDelegations++;
+        mDescriptor = aDescriptor;
+        mEvents     = aEvents;
+    }
+
+    size_t    mDelegations;
+    int       mDescriptor;
+    uint32_t  mEvents;
+};
+
+/**
+ *  An event loop delegate that, on its first delegation, removes the
+ *  other of the two descriptors it was registered for and registers
+ *  a new, idle descriptor with the same number in its place, all
+ *  within the batch being dispatched.
+ *
+ */
+class Replacer :
+    public Recorder
+{
+public:
+    Replacer(const int &aFirst, const int &aSecond, const int &aIdle, EventLoopDelegate &aReplacement) :
+        Recorder(),
+        mFirst(aFirst),
+        mSecond(aSecond),
+        mIdle(aIdle),
+        mReplacement(aReplacement),
+        mStatus(kStatus_Success)
+    {
+        return;
+    }
+
+    void EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) final
+    {
+        const int  lOther = ((aDescriptor == mFirst) ? mSecond : mFirst);
+
+        Recorder::EventLoopIsReady(aEventLoop, aDescriptor, aEvents);
+
+        if (mDelegations == 1)
+        {
+            mStatus = aEventLoop.Remove(lOther);
+
+            if (mStatus == kStatus_Success)
+            {
+                mStatus = ((dup2(mIdle, lOther) == lOther) ? kStatus_Success : -errno);
+            }
+
+            if (mStatus == kStatus_Success)
+            {
+                mStatus = aEventLoop.Add(lOther, EventLoop::kEventReadable, &mReplacement);
+            }
+        }
+    }
+
+    const int            mFirst;
+    const int            mSecond;
+    const int            mIdle;
+    EventLoopDelegate &  mReplacement;
+    Status               mStatus;
+};
+
+/**
+ *  A timer delegate that counts the times its timer fires.
+ *
+ */
+class Counter :
+    public TimerDelegate
+{
+public:
+    Counter(void) :
+        mFired(0)
+    {
+        return;
+    }
+
+    void TimerDidFire(Timer &aTimer) final
+    {
+        (void)aTimer;
+
+        mFired++;
+    }
+
+    size_t  mFired;
+};
+
+static void Write(const int &aDescriptor)
+{
+    static const uint8_t  kByte = 0;
+    ssize_t               lStatus;
+
+    lStatus = write(aDescriptor, &kByte, sizeof (kByte));
+    (void)lStatus;
+}
+
+static void TestUninitialized(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    EventLoop  lEventLoop;
+    Recorder   lRecorder;
+    Status     lStatus;
+
+    lStatus = lEventLoop.Add(0, EventLoop::kEventReadable, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    lStatus = lEventLoop.Modify(0, EventLoop::kEventWritable);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    lStatus = lEventLoop.Remove(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    lStatus = lEventLoop.Signal(&lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+}
+
+static void TestUnsupported(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters  lRunLoopParameters;
+    EventLoop          lEventLoop;
+    Status             lStatus;
+
+    if (EventLoop::IsSupported())
+    {
+        return;
+    }
+
+    // Without the epoll backend, initialization fails such that
+    // participants fall back to CoreFoundation.
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == -ENOSYS);
+}
+
+static void TestDescriptors(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters  lRunLoopParameters;
+    EventLoop          lEventLoop;
+    Recorder           lRecorder;
+    int                lSockets[2] = { -1, -1 };
+    Status             lStatus;
+
+    if (!EventLoop::IsSupported())
+    {
+        return;
+    }
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, socketpair(AF_UNIX, SOCK_STREAM, 0, lSockets) == 0);
+
+    // Invalid registrations are rejected.
+
+    lStatus = lEventLoop.Add(-1, EventLoop::kEventReadable, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    lStatus = lEventLoop.Add(lSockets[0], EventLoop::kEventReadable, nullptr);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    lStatus = lEventLoop.Modify(lSockets[0], EventLoop::kEventReadable);
+    NL_TEST_ASSERT(inSuite, lStatus == -ENOENT);
+
+    lStatus = lEventLoop.Remove(lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lStatus == -ENOENT);
+
+    // An idle, readable registration is not notified until there is
+    // data to read.
+
+    lStatus = lEventLoop.Add(lSockets[0], EventLoop::kEventReadable, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Add(lSockets[0], EventLoop::kEventReadable, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == -EEXIST);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 0);
+
+    Write(lSockets[1]);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 1);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDescriptor == lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lRecorder.mEvents == EventLoop::kEventReadable);
+
+    // Registrations are level-triggered: the unread data is notified
+    // again in the next batch.
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 2);
+
+    // Modified to writable alone, the unread data is no longer
+    // notified, but the writable socket is.
+
+    lStatus = lEventLoop.Modify(lSockets[0], EventLoop::kEventWritable);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 3);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDescriptor == lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lRecorder.mEvents == EventLoop::kEventWritable);
+
+    // Once removed, the socket is no longer notified.
+
+    lStatus = lEventLoop.Remove(lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 3);
+
+    // A peer hangup is notified regardless of the events registered
+    // for.
+
+    lStatus = lEventLoop.Add(lSockets[0], EventLoop::kEventReadable, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    close(lSockets[1]);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 4);
+    NL_TEST_ASSERT(inSuite, (lRecorder.mEvents & EventLoop::kEventHangup) != 0);
+
+    lStatus = lEventLoop.Remove(lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    close(lSockets[0]);
+}
+
+static void TestReaddWithinBatch(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters  lRunLoopParameters;
+    EventLoop          lEventLoop;
+    Recorder           lReplacement;
+    int                lFirst[2]  = { -1, -1 };
+    int                lSecond[2] = { -1, -1 };
+    int                lIdle[2]   = { -1, -1 };
+    Status             lStatus;
+
+    if (!EventLoop::IsSupported())
+    {
+        return;
+    }
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, socketpair(AF_UNIX, SOCK_STREAM, 0, lFirst) == 0);
+    NL_TEST_ASSERT(inSuite, socketpair(AF_UNIX, SOCK_STREAM, 0, lSecond) == 0);
+    NL_TEST_ASSERT(inSuite, socketpair(AF_UNIX, SOCK_STREAM, 0, lIdle) == 0);
+
+    {
+        Replacer  lReplacer(lFirst[0], lSecond[0], lIdle[0], lReplacement);
+
+        // Make both registered sockets ready, such that both are in
+        // the same batch. Whichever is notified first replaces the
+        // other with an idle socket of the same descriptor number.
+
+        lStatus = lEventLoop.Add(lFirst[0], EventLoop::kEventReadable, &lReplacer);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lStatus = lEventLoop.Add(lSecond[0], EventLoop::kEventReadable, &lReplacer);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        Write(lFirst[1]);
+        Write(lSecond[1]);
+
+        lStatus = lEventLoop.Dispatch(0);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+        NL_TEST_ASSERT(inSuite, lReplacer.mStatus == kStatus_Success);
+
+        // The event pending for the replaced socket belongs to its
+        // removed registration and is delivered to neither delegate.
+
+        NL_TEST_ASSERT(inSuite, lReplacer.mDelegations == 1);
+        NL_TEST_ASSERT(inSuite, lReplacement.mDelegations == 0);
+
+        // The replacement is idle and remains so in later batches.
+
+        lStatus = lEventLoop.Remove(lReplacer.mDescriptor);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lStatus = lEventLoop.Dispatch(0);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+        NL_TEST_ASSERT(inSuite, lReplacement.mDelegations == 0);
+
+        // Once the replacement is ready, it is notified, under its
+        // own registration.
+
+        Write(lIdle[1]);
+
+        lStatus = lEventLoop.Dispatch(0);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+        NL_TEST_ASSERT(inSuite, lReplacement.mDelegations == 1);
+        NL_TEST_ASSERT(inSuite, lReplacement.mEvents == EventLoop::kEventReadable);
+        NL_TEST_ASSERT(inSuite, lReplacer.mDelegations == 1);
+
+        lStatus = lEventLoop.Remove(lReplacement.mDescriptor);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    close(lFirst[0]);
+    close(lFirst[1]);
+    close(lSecond[0]);
+    close(lSecond[1]);
+    close(lIdle[0]);
+    close(lIdle[1]);
+}
+
+static void TestSignals(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters  lRunLoopParameters;
+    EventLoop          lEventLoop;
+    Recorder           lRecorder;
+    Status             lStatus;
+
+    if (!EventLoop::IsSupported())
+    {
+        return;
+    }
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Signal(nullptr);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    // Signals before a batch are coalesced into one notification.
+
+    lStatus = lEventLoop.Signal(&lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Signal(&lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 1);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDescriptor == -1);
+    NL_TEST_ASSERT(inSuite, lRecorder.mEvents == EventLoop::kEventSignaled);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 1);
+
+    // A canceled signal is not notified.
+
+    lStatus = lEventLoop.Signal(&lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lEventLoop.Cancel(&lRecorder);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lRecorder.mDelegations == 1);
+}
+
+static void TestTimer(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    static const Timeout::Value  kIntervalMilliseconds = 10;
+    static const size_t          kIterationsMax        = 50;
+    RunLoopParameters            lRunLoopParameters;
+    EventLoop                    lEventLoop;
+    Timer                        lTimer;
+    Counter                      lCounter;
+    size_t                       lFired;
+    Status                       lStatus;
+
+    if (!EventLoop::IsSupported())
+    {
+        return;
+    }
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lEventLoop.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lRunLoopParameters.SetEventLoop(&lEventLoop);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lTimer.Init(lRunLoopParameters, Timeout(kIntervalMilliseconds));
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lTimer.SetDelegate(&lCounter);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // The timer, a timerfd nested in the event loop, fires
+    // repeatedly at its interval once started.
+
+    lStatus = lTimer.Start();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    for (size_t i = 0; (i < kIterationsMax) && (lCounter.mFired < 2); i++)
+    {
+        lStatus = lEventLoop.Dispatch(100);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, lCounter.mFired >= 2);
+
+    // Once stopped, it no longer fires.
+
+    lStatus = lTimer.Stop();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lFired = lCounter.mFired;
+
+    lStatus = lEventLoop.Dispatch(static_cast<int>(kIntervalMilliseconds * 3));
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCounter.mFired == lFired);
+
+    // A zero interval fires once, as soon as possible.
+
+    lStatus = lTimer.Start(Timeout(0));
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    for (size_t i = 0; (i < kIterationsMax) && (lCounter.mFired == lFired); i++)
+    {
+        lStatus = lEventLoop.Dispatch(100);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, lCounter.mFired == (lFired + 1));
+
+    lStatus = lEventLoop.Dispatch(static_cast<int>(kIntervalMilliseconds * 3));
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCounter.mFired == (lFired + 1));
+
+    lTimer.Destroy();
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Uninitialized",      TestUninitialized),
+    NL_TEST_DEF("Unsupported",        TestUnsupported),
+    NL_TEST_DEF("Descriptors",        TestDescriptors),
+    NL_TEST_DEF("Re-add Within Batch", TestReaddWithinBatch),
+    NL_TEST_DEF("Signals",            TestSignals),
+    NL_TEST_DEF("Timer",              TestTimer),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Common Event Loop",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
@@ -54,6 +54,8 @@ static void TestEquality(nlTestSuite *inSuite, void *inContext __attribute__((un
     SocketAddress  lSocketAddress_4;
     SocketAddress  lSocketAddress_5;
     SocketAddress  lSocketAddress_6;
+    SocketAddress  lSocketAddress_7;
+    SocketAddress  lSocketAddress_8;
     int            lStatus;
     bool           lAreEqual;
 
@@ -67,6 +69,8 @@ static void TestEquality(nlTestSuite *inSuite, void *inContext __attribute__((un
     memset(&lSocketAddress_3, 0, sizeof (lSocketAddress_3));
     memset(&lSocketAddress_4, 0, sizeof (lSocketAddress_4));
     memset(&lSocketAddress_5, 0, sizeof (lSocketAddress_5));
+    memset(&lSocketAddress_7, 0, sizeof (lSocketAddress_7));
+    memset(&lSocketAddress_8, 0, sizeof (lSocketAddress_8));
 
     lSocketAddress_3.uSocketAddress.sa_family = AF_INET;
     lStatus = inet_pton(AF_INET,
@@ -89,6 +93,16 @@ static void TestEquality(nlTestSuite *inSuite, void *inContext __attribute__((un
                         "2601:647:4901:5dc0:419:95e6:a382:2a2f",
                         &lSocketAddress_6.uSocketAddressIPv6.sin6_addr);
 
+    lSocketAddress_7.uSocketAddress.sa_family = AF_LOCAL;
+    strncpy(lSocketAddress_7.uSocketAddressLocal.sun_path,
+            "/var/run/hlxproxyd.sock",
+            sizeof (lSocketAddress_7.uSocketAddressLocal.sun_path) - 1);
+
+    lSocketAddress_8.uSocketAddress.sa_family = AF_LOCAL;
+    strncpy(lSocketAddress_8.uSocketAddressLocal.sun_path,
+            "/tmp/hlxsimd.sock",
+            sizeof (lSocketAddress_8.uSocketAddressLocal.sun_path) - 1);
+
     // 1: Test that any arbitrary socket address is equal to itself,
     //    initialized or not.
 
@@ -136,7 +150,16 @@ static void TestEquality(nlTestSuite *inSuite, void *inContext __attribute__((un
     lAreEqual = (lSocketAddress_6 == lSocketAddress_6);
     NL_TEST_ASSERT(inSuite, lAreEqual == true);
 
-    // 6: Test that two initialized socket addresses with different
+    lAreEqual = (lSocketAddress_7 == lSocketAddress_7);
+    NL_TEST_ASSERT(inSuite, lAreEqual == true);
+
+    // 6: Test that two initialized local socket addresses with
+    //    different paths are NOT equal.
+
+    lAreEqual = (lSocketAddress_7 == lSocketAddress_8);
+    NL_TEST_ASSERT(inSuite, lAreEqual == false);
+
+    // 7: Test that two initialized socket addresses with different
     //    families are not equal.
 
     lAreEqual = (lSocketAddress_3 == lSocketAddress_5);
@@ -150,6 +173,12 @@ static void TestEquality(nlTestSuite *inSuite, void *inContext __attribute__((un
 
     lAreEqual = (lSocketAddress_4 == lSocketAddress_6);
     NL_TEST_ASSERT(inSuite, lAreEqual == false);
+
+    lAreEqual = (lSocketAddress_3 == lSocketAddress_7);
+    NL_TEST_ASSERT(inSuite, lAreEqual == false);
+
+    lAreEqual = (lSocketAddress_5 == lSocketAddress_8);
+    NL_TEST_ASSERT(inSuite, lAreEqual == false);
 }
 
 /**
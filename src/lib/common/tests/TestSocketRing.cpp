@@ -0,0 +1,420 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for HLX::Common::SocketRing.
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+
+#include <CoreFoundation/CFRunLoop.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoop.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Common/SocketRing.hpp>
+#include <OpenHLX/Common/SocketRingDelegate.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+
+
+/**
+ *  A socket ring delegate that records the data received and the
+ *  errors delegated.
+ *
+ */
+class Recorder :
+    public SocketRingDelegate
+{
+public:
+    Recorder(void) :
+        mReceived(),
+        mErrors(0)
+    {
+        return;
+    }
+
+    void SocketRingDidReceive(SocketRing &aSocketRing, const int &aSocket, const uint8_t *aBuffer, const size_t &aSize) final
+    {
+        (void)aSocketRing;
+        (void)aSocket;
+
+        mReceived.insert(mReceived.end(), aBuffer, aBuffer + aSize);
+    }
+
+    void SocketRingError(SocketRing &aSocketRing, const int &aSocket, const Error &aError) final
+    {
+        (void)aSocketRing;
+        (void)aSocket;
+        (void)aError;
+
+        mErrors++;
+    }
+
+    std::vector<uint8_t>  mReceived;
+    size_t                mErrors;
+};
+
+/**
+ *  Initialize the run loop parameters, event loop, and socket ring
+ *  for a test, returning whether the socket ring is available.
+ *
+ *  Where the package was not configured with the native event loop or
+ *  socket ring backends, or where the running kernel does not support
+ *  the socket ring, participants fall back to the native event loop
+ *  and so does the test, by skipping the socket ring.
+ *
+ */
+static bool Init(nlTestSuite *inSuite, RunLoopParameters &aRunLoopParameters, EventLoop &aEventLoop, SocketRing &aSocketRing)
+{
+    Status  lStatus;
+
+    if (!EventLoop::IsSupported() || !SocketRing::IsSupported())
+    {
+        return (false);
+    }
+
+    lStatus = aRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = aEventLoop.Init(aRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = aRunLoopParameters.SetEventLoop(&aEventLoop);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = aSocketRing.Init(aRunLoopParameters);
+
+    return (lStatus == kStatus_Success);
+}
+
+static void TestUninitialized(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    SocketRing                               lSocketRing;
+    Recorder                                 lRecorder;
+    ConnectionBuffer::MutableCountedPointer  lBuffer;
+    Status                                   lStatus;
+
+    lStatus = ConnectionBuffer::Create(lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lSocketRing.Accept(0, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    lStatus = lSocketRing.Receive(0, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    lStatus = lSocketRing.Send(0, lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+
+    lStatus = lSocketRing.Remove(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+}
+
+static void TestFallback(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters  lRunLoopParameters;
+    SocketRing         lSocketRing;
+    Recorder           lRecorder;
+    Status             lStatus;
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lSocketRing.Init(lRunLoopParameters);
+
+    if (!SocketRing::IsSupported())
+    {
+        // Without the io_uring backend, initialization fails such that
+        // participants fall back to the native event loop.
+
+        NL_TEST_ASSERT(inSuite, lStatus == -ENOSYS);
+    }
+    else
+    {
+        // Without a native event loop to nest within, initialization
+        // fails.
+
+        NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+    }
+
+    // In either case, a failed socket ring remains uninitialized.
+
+    lStatus = lSocketRing.Receive(0, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kError_NotInitialized);
+}
+
+static void TestRegistration(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    RunLoopParameters                        lRunLoopParameters;
+    EventLoop                                lEventLoop;
+    SocketRing                               lSocketRing;
+    Recorder                                 lRecorder;
+    ConnectionBuffer::MutableCountedPointer  lBuffer;
+    int                                      lSockets[2] = { -1, -1 };
+    Status                                   lStatus;
+
+    if (!Init(inSuite, lRunLoopParameters, lEventLoop, lSocketRing))
+    {
+        return;
+    }
+
+    NL_TEST_ASSERT(inSuite, socketpair(AF_UNIX, SOCK_STREAM, 0, lSockets) == 0);
+
+    lStatus = ConnectionBuffer::Create(lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Invalid registrations are rejected.
+
+    lStatus = lSocketRing.Receive(-1, &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    lStatus = lSocketRing.Receive(lSockets[0], nullptr);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    lStatus = lSocketRing.Remove(lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lStatus == -ENOENT);
+
+    // Sends are only accepted on a registered socket.
+
+    lStatus = lSocketRing.Send(lSockets[0], lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == -ENOTCONN);
+
+    lStatus = lSocketRing.Receive(lSockets[0], &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lSocketRing.Receive(lSockets[0], &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == -EEXIST);
+
+    lStatus = lSocketRing.Send(lSockets[0], nullptr);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    lStatus = lSocketRing.Remove(lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lSocketRing.Send(lSockets[0], lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == -ENOTCONN);
+
+    lStatus = lEventLoop.Dispatch(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    close(lSockets[0]);
+    close(lSockets[1]);
+}
+
+static void TestReceive(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    static const uint8_t  kData[]        = { 'p', 'i', 'n', 'g' };
+    static const size_t   kIterationsMax = 50;
+    RunLoopParameters     lRunLoopParameters;
+    EventLoop             lEventLoop;
+    SocketRing            lSocketRing;
+    Recorder              lRecorder;
+    int                   lSockets[2] = { -1, -1 };
+    Status                lStatus;
+
+    if (!Init(inSuite, lRunLoopParameters, lEventLoop, lSocketRing))
+    {
+        return;
+    }
+
+    NL_TEST_ASSERT(inSuite, socketpair(AF_UNIX, SOCK_STREAM, 0, lSockets) == 0);
+
+    lStatus = lSocketRing.Receive(lSockets[0], &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, write(lSockets[1], kData, sizeof (kData)) == sizeof (kData));
+
+    for (size_t i = 0; (i < kIterationsMax) && (lRecorder.mReceived.size() < sizeof (kData)); i++)
+    {
+        lStatus = lEventLoop.Dispatch(100);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, lRecorder.mReceived == std::vector<uint8_t>(kData, kData + sizeof (kData)));
+    NL_TEST_ASSERT(inSuite, lRecorder.mErrors == 0);
+
+    // A peer that closes the connection is delegated as an error.
+
+    close(lSockets[1]);
+
+    for (size_t i = 0; (i < kIterationsMax) && (lRecorder.mErrors == 0); i++)
+    {
+        lStatus = lEventLoop.Dispatch(100);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, lRecorder.mErrors == 1);
+
+    lStatus = lSocketRing.Remove(lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    close(lSockets[0]);
+}
+
+static void TestSendOrdering(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    // Enough buffers that the sends span several linked chains.
+
+    static const size_t  kBuffers       = 64;
+    static const size_t  kBufferSize    = 100;
+    static const size_t  kIterationsMax = 50;
+    RunLoopParameters    lRunLoopParameters;
+    EventLoop            lEventLoop;
+    SocketRing           lSocketRing;
+    Recorder             lRecorder;
+    uint8_t              lBacking[kBufferSize];
+    std::vector<uint8_t> lExpected;
+    std::vector<uint8_t> lReceived;
+    int                  lSockets[2] = { -1, -1 };
+    Status               lStatus;
+
+    if (!Init(inSuite, lRunLoopParameters, lEventLoop, lSocketRing))
+    {
+        return;
+    }
+
+    NL_TEST_ASSERT(inSuite, socketpair(AF_UNIX, SOCK_STREAM, 0, lSockets) == 0);
+
+    lStatus = lSocketRing.Receive(lSockets[0], &lRecorder);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Queue the sends, alternating buffers that own their data with
+    // ones that wrap caller-owned data. The caller-owned data is
+    // reused for each of the latter, as a caller would once the send
+    // returns, so it is only sent intact if the socket ring copied it.
+
+    for (size_t i = 0; i < kBuffers; i++)
+    {
+        const uint8_t                            lValue = static_cast<uint8_t>(i);
+        ConnectionBuffer::MutableCountedPointer  lBuffer;
+
+        if ((i % 2) == 0)
+        {
+            uint8_t *  lData;
+
+            lStatus = ConnectionBuffer::Create(lBuffer, kBufferSize);
+            NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+            lData = lBuffer->Put(kBufferSize);
+            NL_TEST_ASSERT(inSuite, lData != nullptr);
+
+            memset(lData, lValue, kBufferSize);
+        }
+        else
+        {
+            lBuffer = std::make_shared<ConnectionBuffer>();
+            NL_TEST_ASSERT(inSuite, lBuffer != nullptr);
+
+            memset(lBacking, lValue, kBufferSize);
+
+            lStatus = lBuffer->Init(lBacking, kBufferSize);
+            NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+            lStatus = lBuffer->SetSize(kBufferSize);
+            NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+        }
+
+        lStatus = lSocketRing.Send(lSockets[0], lBuffer);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lExpected.insert(lExpected.end(), kBufferSize, lValue);
+    }
+
+    memset(lBacking, 0xFF, kBufferSize);
+
+    // Dispatch the event loop, which submits the queued sends chain
+    // by chain, draining the peer as it goes.
+
+    for (size_t i = 0; (i < kIterationsMax) && (lReceived.size() < lExpected.size()); i++)
+    {
+        uint8_t  lChunk[kBufferSize * 4];
+        ssize_t  lSize;
+
+        lStatus = lEventLoop.Dispatch(100);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        while ((lSize = recv(lSockets[1], lChunk, sizeof (lChunk), MSG_DONTWAIT)) > 0)
+        {
+            lReceived.insert(lReceived.end(), lChunk, lChunk + lSize);
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, lReceived == lExpected);
+    NL_TEST_ASSERT(inSuite, lRecorder.mErrors == 0);
+
+    lStatus = lSocketRing.Remove(lSockets[0]);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    close(lSockets[0]);
+    close(lSockets[1]);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Uninitialized",   TestUninitialized),
+    NL_TEST_DEF("Fallback",        TestFallback),
+    NL_TEST_DEF("Registration",    TestRegistration),
+    NL_TEST_DEF("Receive",         TestReceive),
+    NL_TEST_DEF("Send Ordering",   TestSendOrdering),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Common Socket Ring",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
@@ -0,0 +1,175 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for HLX::Common::TokenBucket.
+ *
+ */
+
+#include <errno.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/TokenBucket.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+
+
+static void TestConstruction(nlTestSuite *inSuite __attribute__((unused)),
+                             void *inContext __attribute__((unused)))
+{
+    TokenBucket lTokenBucket;
+}
+
+static void TestInitialization(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    const TokenBucket::TimeType  lNow = 0;
+    TokenBucket                  lTokenBucket;
+    Status                       lStatus;
+
+    lStatus = lTokenBucket.Init(0, 1, lNow);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    lStatus = lTokenBucket.Init(1, 0, lNow);
+    NL_TEST_ASSERT(inSuite, lStatus == -EINVAL);
+
+    lStatus = lTokenBucket.Init(1, 1, lNow);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+}
+
+static void TestBurst(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    const TokenBucket::CountType  lRate  = 10;
+    const TokenBucket::CountType  lBurst = 5;
+    const TokenBucket::TimeType   lNow   = 1000;
+    TokenBucket                   lTokenBucket;
+    bool                          lTaken;
+    Status                        lStatus;
+
+    lStatus = lTokenBucket.Init(lRate, lBurst, lNow);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // The bucket starts full, so a full burst is admitted at once,
+    // after which further events are refused.
+
+    for (TokenBucket::CountType i = 0; i < lBurst; i++)
+    {
+        lTaken = lTokenBucket.Take(lNow);
+        NL_TEST_ASSERT(inSuite, lTaken == true);
+    }
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == false);
+}
+
+static void TestRefill(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    const TokenBucket::CountType  lRate  = 10;
+    const TokenBucket::CountType  lBurst = 2;
+    TokenBucket::TimeType         lNow   = 0;
+    TokenBucket                   lTokenBucket;
+    bool                          lTaken;
+    Status                        lStatus;
+
+    lStatus = lTokenBucket.Init(lRate, lBurst, lNow);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == true);
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == true);
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == false);
+
+    // At ten tokens per second, a token is refilled every 100 ms, but
+    // not before.
+
+    lNow += 99;
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == false);
+
+    lNow += 1;
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == true);
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == false);
+
+    // However long the bucket is idle, it refills to no more than a
+    // burst.
+
+    lNow += 60 * 60 * 1000;
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == true);
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == true);
+
+    lTaken = lTokenBucket.Take(lNow);
+    NL_TEST_ASSERT(inSuite, lTaken == false);
+
+    // Time that appears to move backwards refills nothing.
+
+    lTaken = lTokenBucket.Take(lNow - 1000);
+    NL_TEST_ASSERT(inSuite, lTaken == false);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Construction",   TestConstruction),
+    NL_TEST_DEF("Initialization", TestInitialization),
+    NL_TEST_DEF("Burst",          TestBurst),
+    NL_TEST_DEF("Refill",         TestRefill),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Token Bucket",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
@@ -0,0 +1,82 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for generating the
+ *      monotonically increasing sequence numbers with which HLX
+ *      object model changes are stamped.
+ *
+ */
+
+#include "ChangeSequence.hpp"
+
+#include <atomic>
+
+
+namespace HLX
+{
+
+namespace Model
+{
+
+constexpr ChangeSequence::SequenceType ChangeSequence::kSequenceNone;
+
+/**
+ *  The most recently generated change sequence number.
+ *
+ */
+static std::atomic<ChangeSequence::SequenceType> sSequence(ChangeSequence::kSequenceNone);
+
+/**
+ *  @brief
+ *    Get the most recently generated change sequence number.
+ *
+ *  @returns
+ *    The most recently generated change sequence number, or
+ *    #kSequenceNone if none has yet been generated.
+ *
+ */
+ChangeSequence::SequenceType
+ChangeSequence :: GetSequence(void)
+{
+    return (sSequence.load());
+}
+
+/**
+ *  @brief
+ *    Generate the next change sequence number.
+ *
+ *  @note
+ *    At 32 bits, the sequence will not wrap for over a decade even
+ *    at a sustained ten changes per second.
+ *
+ *  @returns
+ *    The next change sequence number, which is greater than any
+ *    previously generated.
+ *
+ */
+ChangeSequence::SequenceType
+ChangeSequence :: GetNextSequence(void)
+{
+    return (++sSequence);
+}
+
+}; // namespace Model
+
+}; // namespace HLX
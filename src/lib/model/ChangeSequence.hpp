@@ -0,0 +1,76 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for generating the monotonically
+ *      increasing sequence numbers with which HLX object model
+ *      changes are stamped.
+ *
+ */
+
+#ifndef OPENHLXMMODELCHANGESEQUENCE_HPP
+#define OPENHLXMMODELCHANGESEQUENCE_HPP
+
+#include <stdint.h>
+
+
+namespace HLX
+{
+
+namespace Model
+{
+
+/**
+ *  @brief
+ *    An object for generating the monotonically increasing sequence
+ *    numbers with which HLX object model changes are stamped.
+ *
+ *  A single sequence is shared by all object model collections in
+ *  the process, such that a sequence number observed from any one of
+ *  them may be used to determine which objects in any of them have
+ *  changed since.
+ *
+ *  @ingroup model
+ *
+ */
+class ChangeSequence
+{
+public:
+    /**
+     *  The type of a change sequence number.
+     *
+     */
+    typedef uint32_t SequenceType;
+
+    /**
+     *  The sequence number that precedes any change.
+     *
+     */
+    static constexpr SequenceType kSequenceNone = 0;
+
+public:
+    static SequenceType GetSequence(void);
+    static SequenceType GetNextSequence(void);
+};
+
+}; // namespace Model
+
+}; // namespace HLX
+
+#endif // OPENHLXMMODELCHANGESEQUENCE_HPP
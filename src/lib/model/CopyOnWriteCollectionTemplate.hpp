@@ -0,0 +1,451 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines a templated, copy-on-write collection object
+ *      for storing HLX object models by identifier.
+ *
+ */
+
+#ifndef OPENHLXMMODELCOPYONWRITECOLLECTIONTEMPLATE_HPP
+#define OPENHLXMMODELCOPYONWRITECOLLECTIONTEMPLATE_HPP
+
+#include <map>
+#include <memory>
+
+#include <stddef.h>
+
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
+
+
+namespace HLX
+{
+
+namespace Model
+{
+
+/**
+ *  @brief
+ *    A templated, copy-on-write collection object for storing HLX
+ *    object models by identifier.
+ *
+ *  Copies of the collection share their storage, such that taking a
+ *  copy, or snapshot, of the collection costs the same regardless of
+ *  the number or size of the objects in it.
+ *
+ *  Storage is unshared only when a copy is mutated: the mutated copy
+ *  first takes its own index of the objects and then its own copy of
+ *  the object being mutated. Objects that are not mutated remain
+ *  shared among all copies.
+ *
+ *  Each object is also stamped with the change sequence number of
+ *  its last change, such that the objects changed since any given
+ *  sequence number may be determined. A change made in place through
+ *  a mutable object pointer is detected, and stamped, the next time
+ *  the object is accessed for mutation or changes are requested, by
+ *  comparing the object against the version of it last stamped; a
+ *  mutable object that is not in fact changed is, therefore, not
+ *  stamped. Since each change is stamped before the next one is
+ *  made, a change that is later reverted, for example, from A to B
+ *  and back to A, is still stamped as a change.
+ *
+ *  Because sharing is tracked with reference counts that are safely
+ *  updated from any thread, a copy taken on the thread that owns the
+ *  collection may be read from another thread while the owning thread
+ *  continues to mutate the original. However, a pointer to a mutable
+ *  object must not be held across the taking of a copy, since
+ *  mutations through it would then also be visible in that copy. For
+ *  the same reason, such a pointer must not be held across a request
+ *  for changes.
+ *
+ *  @tparam  T  The object model type to store, which must declare an
+ *              @a IdentifierType.
+ *
+ *  @ingroup model
+ *
+ */
+template <typename T>
+class CopyOnWriteCollectionTemplate
+{
+public:
+    /**
+     *  A local convenience type for the template parameter, @a T.
+     *
+     */
+    typedef T                               ObjectType;
+
+    /**
+     *  A local convenience type for the identifier type of the
+     *  template parameter, @a T.
+     *
+     */
+    typedef typename T::IdentifierType      IdentifierType;
+
+    /**
+     *  A local convenience type for a change sequence number.
+     *
+     */
+    typedef ChangeSequence::SequenceType    SequenceType;
+
+    /**
+     *  A collection entry for an object.
+     *
+     */
+    struct Entry
+    {
+        std::shared_ptr<ObjectType>  mObject;     //!< The current version of the object.
+        std::shared_ptr<ObjectType>  mStamped;    //!< The version of the object when last stamped.
+        SequenceType                 mSequence;   //!< The change sequence number with which the object was last stamped.
+    };
+
+private:
+    typedef std::map<IdentifierType, Entry> Objects;
+
+public:
+    /**
+     *  A convenience type for iterating, in identifier order, over
+     *  the identifier and entry pairs in the collection.
+     *
+     */
+    typedef typename Objects::const_iterator  const_iterator;
+
+public:
+    /**
+     *  @brief
+     *    This is the class default constructor.
+     *
+     */
+    CopyOnWriteCollectionTemplate(void) :
+        mObjects(std::make_shared<Objects>())
+    {
+        return;
+    }
+
+    CopyOnWriteCollectionTemplate(const CopyOnWriteCollectionTemplate &aCollection) = default;
+    ~CopyOnWriteCollectionTemplate(void) = default;
+
+    CopyOnWriteCollectionTemplate &operator =(const CopyOnWriteCollectionTemplate &aCollection) = default;
+
+    /**
+     *  @brief
+     *    Return the beginning of the collection.
+     *
+     *  @returns
+     *    An immutable iterator to the first identifier and entry
+     *    pair in the collection.
+     *
+     */
+    const_iterator begin(void) const
+    {
+        return (mObjects->begin());
+    }
+
+    /**
+     *  @brief
+     *    Return the end of the collection.
+     *
+     *  @returns
+     *    An immutable iterator past the last identifier and entry
+     *    pair in the collection.
+     *
+     */
+    const_iterator end(void) const
+    {
+        return (mObjects->end());
+    }
+
+    /**
+     *  @brief
+     *    Attempt to get the object with the specified identifier.
+     *
+     *  @param[in]  aIdentifier  An immutable reference to the
+     *                           identifier of the object to get.
+     *
+     *  @returns
+     *    A pointer to the immutable object, if present; otherwise,
+     *    null.
+     *
+     */
+    const ObjectType *GetObject(const IdentifierType &aIdentifier) const
+    {
+        typename Objects::const_iterator lObject = mObjects->find(aIdentifier);
+
+        return ((lObject != mObjects->end()) ? lObject->second.mObject.get() : nullptr);
+    }
+
+    /**
+     *  @brief
+     *    Attempt to get the object with the specified identifier for
+     *    mutation.
+     *
+     *  This first stamps any change made to the object in place
+     *  since it was last stamped, such that the change is not lost
+     *  should the mutation through the returned pointer revert it.
+     *
+     *  If the object is shared with any copy of the collection, this
+     *  then unshares it, such that mutations through the returned
+     *  pointer are visible in this collection only.
+     *
+     *  @param[in]  aIdentifier  An immutable reference to the
+     *                           identifier of the object to get.
+     *
+     *  @returns
+     *    A pointer to the mutable object, if present; otherwise,
+     *    null.
+     *
+     */
+    ObjectType *GetMutableObject(const IdentifierType &aIdentifier)
+    {
+        typename Objects::iterator lObject;
+        ObjectType *               lRetval = nullptr;
+
+        if (mObjects->find(aIdentifier) == mObjects->end())
+            goto done;
+
+        Unshare();
+
+        lObject = mObjects->find(aIdentifier);
+
+        Stamp(lObject->second);
+
+        // The current version of the object is shared either with a
+        // copy of the collection or, having just been stamped, with
+        // the stamped version. In either case, the current version
+        // must become a copy of its own.
+
+        if (lObject->second.mObject.use_count() != 1)
+        {
+            lObject->second.mObject = std::make_shared<ObjectType>(*lObject->second.mObject);
+        }
+
+        lRetval = lObject->second.mObject.get();
+
+     done:
+        return (lRetval);
+    }
+
+    /**
+     *  @brief
+     *    Set the object with the specified identifier.
+     *
+     *  This sets the object with the specified identifier to a copy
+     *  of the specified object, stamped with the next change sequence
+     *  number, leaving any copy of the collection that shares the
+     *  previous object unaffected.
+     *
+     *  @param[in]  aIdentifier  An immutable reference to the
+     *                           identifier of the object to set.
+     *  @param[in]  aObject      An immutable reference to the
+     *                           object to set.
+     *
+     */
+    void SetObject(const IdentifierType &aIdentifier, const ObjectType &aObject)
+    {
+        Entry lEntry;
+
+        lEntry.mObject   = std::make_shared<ObjectType>(aObject);
+        lEntry.mStamped  = lEntry.mObject;
+        lEntry.mSequence = ChangeSequence::GetNextSequence();
+
+        Unshare();
+
+        (*mObjects)[aIdentifier] = lEntry;
+    }
+
+    /**
+     *  @brief
+     *    Get the identifiers of the objects changed since the
+     *    specified change sequence number.
+     *
+     *  This first stamps any object changed in place since it was
+     *  last stamped and then adds to the specified identifiers
+     *  collection the identifier of each object stamped with a
+     *  sequence number later than the one specified.
+     *
+     *  @param[in]      aSequence     An immutable reference to the
+     *                                change sequence number after
+     *                                which changed objects are to be
+     *                                returned.
+     *  @param[in,out]  aIdentifiers  A mutable reference to the
+     *                                identifiers collection to which
+     *                                the identifiers of the changed
+     *                                objects are to be added.
+     *
+     *  @retval  kStatus_Success        If successful.
+     *  @retval  kError_NotInitialized  If the identifiers collection
+     *                                  has not been initialized.
+     *
+     */
+    Common::Status GetChangedSince(const SequenceType &aSequence, IdentifiersCollection &aIdentifiers)
+    {
+        typename Objects::const_iterator lObject;
+        Common::Status                   lRetval = Common::kStatus_Success;
+
+        Stamp();
+
+        for (lObject = mObjects->begin(); lObject != mObjects->end(); lObject++)
+        {
+            if (lObject->second.mSequence > aSequence)
+            {
+                lRetval = aIdentifiers.AddIdentifier(lObject->first);
+                if (lRetval < Common::kStatus_Success)
+                    break;
+
+                lRetval = Common::kStatus_Success;
+            }
+        }
+
+        return (lRetval);
+    }
+
+    /**
+     *  @brief
+     *    This is a class equality operator.
+     *
+     *  Objects that are shared between the two collections are
+     *  equal without being compared.
+     *
+     *  @param[in]  aCollection  An immutable reference to the
+     *                           collection to compare for equality.
+     *
+     *  @returns
+     *    True if this collection has the same identifiers and equal
+     *    objects as the specified one; otherwise, false.
+     *
+     */
+    bool operator ==(const CopyOnWriteCollectionTemplate &aCollection) const
+    {
+        const_iterator lFirst  = mObjects->begin();
+        const_iterator lSecond = aCollection.mObjects->begin();
+        bool           lRetval = true;
+
+        if (mObjects == aCollection.mObjects)
+            goto done;
+
+        lRetval = (mObjects->size() == aCollection.mObjects->size());
+
+        while (lRetval && (lFirst != mObjects->end()))
+        {
+            lRetval = ((lFirst->first == lSecond->first) &&
+                       ((lFirst->second.mObject == lSecond->second.mObject) ||
+                        (*lFirst->second.mObject == *lSecond->second.mObject)));
+
+            lFirst++;
+            lSecond++;
+        }
+
+     done:
+        return (lRetval);
+    }
+
+private:
+    /**
+     *  @brief
+     *    Stamp any objects changed in place since last stamped.
+     *
+     *  This stamps, with the next change sequence number, each object
+     *  accessed for mutation since it was last stamped that differs
+     *  from the version of it last stamped.
+     *
+     */
+    void Stamp(void)
+    {
+        typename Objects::iterator lObject;
+        bool                       lUnshared = false;
+
+        for (lObject = mObjects->begin(); lObject != mObjects->end(); lObject++)
+        {
+            if (lObject->second.mObject == lObject->second.mStamped)
+                continue;
+
+            // The stamps in the index must not change under any copy
+            // of the collection sharing it; unshare it and find the
+            // object again in the copy.
+
+            if (!lUnshared)
+            {
+                const IdentifierType lIdentifier = lObject->first;
+
+                Unshare();
+
+                lObject   = mObjects->find(lIdentifier);
+                lUnshared = true;
+            }
+
+            Stamp(lObject->second);
+        }
+    }
+
+    /**
+     *  @brief
+     *    Stamp an object entry if changed in place since last stamped.
+     *
+     *  This stamps, with the next change sequence number, the object
+     *  of the specified entry if it differs from the version of it
+     *  last stamped and makes its current version the stamped one.
+     *
+     *  @note
+     *    The index containing the entry must not be shared with any
+     *    copy of the collection.
+     *
+     *  @param[in,out]  aEntry  A mutable reference to the entry to
+     *                          stamp.
+     *
+     */
+    static void Stamp(Entry &aEntry)
+    {
+        if (aEntry.mObject != aEntry.mStamped)
+        {
+            if (!(*aEntry.mObject == *aEntry.mStamped))
+            {
+                aEntry.mSequence = ChangeSequence::GetNextSequence();
+            }
+
+            aEntry.mStamped = aEntry.mObject;
+        }
+    }
+
+    /**
+     *  @brief
+     *    Take sole ownership of the collection index.
+     *
+     *  If the index of objects is shared with any copy of the
+     *  collection, this replaces it with a copy of the index, the
+     *  objects themselves remaining shared.
+     *
+     */
+    void Unshare(void)
+    {
+        if (mObjects.use_count() != 1)
+        {
+            mObjects = std::make_shared<Objects>(*mObjects);
+        }
+    }
+
+private:
+    std::shared_ptr<Objects>  mObjects;
+};
+
+}; // namespace Model
+
+}; // namespace HLX
+
+#endif // OPENHLXMMODELCOPYONWRITECOLLECTIONTEMPLATE_HPP
@@ -69,7 +69,8 @@ static const EqualizerBandModel::FrequencyType kFrequencyMap[EqualizerBandsModel
  *
  */
 EqualizerBandsModel :: EqualizerBandsModel(const EqualizerBandsModel &aEqualizerBandsModel) :
-    mEqualizerBands(aEqualizerBandsModel.mEqualizerBands)
+    mEqualizerBands(aEqualizerBandsModel.mEqualizerBands),
+    mEqualizerBandsSet(aEqualizerBandsModel.mEqualizerBandsSet)
 {
     return;
 }
@@ -117,8 +118,6 @@ EqualizerBandsModel :: Init(void)
  *                                    initialize with.
  *
  *  @retval  kStatus_Success  If successful.
- *  @retval  -EINVAL          The number of bands in @a aEqualizerBandsModel
- *                            exceeds kEqualizerBandsMax.
  *
  */
 Status
@@ -126,11 +125,8 @@ EqualizerBandsModel :: Init(const EqualizerBandsModel &aEqualizerBandsModel)
 {
     Status lRetval = kStatus_Success;
 
-    nlREQUIRE_ACTION(aEqualizerBandsModel.mEqualizerBands.size() <= kEqualizerBandsMax, done, lRetval = -EINVAL);
-
     *this = aEqualizerBandsModel;
 
- done:
     return (lRetval);
 }
 
@@ -154,7 +150,8 @@ EqualizerBandsModel :: Init(const EqualizerBandsModel &aEqualizerBandsModel)
 EqualizerBandsModel &
 EqualizerBandsModel :: operator =(const EqualizerBandsModel &aEqualizerBandsModel)
 {
-    mEqualizerBands = aEqualizerBandsModel.mEqualizerBands;
+    mEqualizerBands    = aEqualizerBandsModel.mEqualizerBands;
+    mEqualizerBandsSet = aEqualizerBandsModel.mEqualizerBandsSet;
 
     return (*this);
 }
@@ -242,12 +239,12 @@ EqualizerBandsModel :: GetEqualizerBand(const IdentifierType &aEqualizerBandIden
     Status lRetval = kStatus_Success;
 
 
-    nlREQUIRE_ACTION(mEqualizerBands.size() == kEqualizerBandsMax, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(mEqualizerBandsSet.all(), done, lRetval = kError_NotInitialized);
 
     lRetval = ValidateIdentifier(aEqualizerBandIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aEqualizerBandModel = &mEqualizerBands.at(aEqualizerBandIdentifier);
+    aEqualizerBandModel = &mEqualizerBands[GetIndex(aEqualizerBandIdentifier)];
 
  done:
     return (lRetval);
@@ -285,12 +282,12 @@ EqualizerBandsModel :: GetEqualizerBand(const IdentifierType &aEqualizerBandIden
     Status lRetval = kStatus_Success;
 
 
-    nlREQUIRE_ACTION(mEqualizerBands.size() == kEqualizerBandsMax, done, lRetval = kError_NotInitialized);
+    nlREQUIRE_ACTION(mEqualizerBandsSet.all(), done, lRetval = kError_NotInitialized);
 
     lRetval = ValidateIdentifier(aEqualizerBandIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aEqualizerBandModel = &mEqualizerBands.at(aEqualizerBandIdentifier);
+    aEqualizerBandModel = &mEqualizerBands[GetIndex(aEqualizerBandIdentifier)];
 
  done:
     return (lRetval);
@@ -328,13 +325,18 @@ EqualizerBandsModel :: SetEqualizerBand(const IdentifierType &aEqualizerBandIden
     lRetval = ValidateIdentifier(aEqualizerBandIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    if (mEqualizerBands[aEqualizerBandIdentifier] == aEqualizerBandModel)
-    {
-        lRetval = kStatus_ValueAlreadySet;
-    }
-    else
     {
-        mEqualizerBands[aEqualizerBandIdentifier] = aEqualizerBandModel;
+        const size_t lIndex = GetIndex(aEqualizerBandIdentifier);
+
+        if (mEqualizerBandsSet.test(lIndex) && (mEqualizerBands[lIndex] == aEqualizerBandModel))
+        {
+            lRetval = kStatus_ValueAlreadySet;
+        }
+        else
+        {
+            mEqualizerBands[lIndex] = aEqualizerBandModel;
+            mEqualizerBandsSet.set(lIndex);
+        }
     }
 
  done:
@@ -359,7 +361,27 @@ EqualizerBandsModel :: SetEqualizerBand(const IdentifierType &aEqualizerBandIden
  */
 bool EqualizerBandsModel :: operator ==(const EqualizerBandsModel &aEqualizerBandsModel) const
 {
-    return (mEqualizerBands == aEqualizerBandsModel.mEqualizerBands);
+    return ((mEqualizerBandsSet == aEqualizerBandsModel.mEqualizerBandsSet) &&
+            (mEqualizerBands == aEqualizerBandsModel.mEqualizerBands));
+}
+
+/**
+ *  @brief
+ *    Get the storage index for an equalizer band identifier.
+ *
+ *  @param[in]  aEqualizerBandIdentifier  An immutable reference to the
+ *                                        valid equalizer band
+ *                                        identifier for which to get
+ *                                        the storage index.
+ *
+ *  @returns
+ *    The zero-based storage index for the equalizer band identifier.
+ *
+ */
+size_t
+EqualizerBandsModel :: GetIndex(const IdentifierType &aEqualizerBandIdentifier)
+{
+    return (static_cast<size_t>(aEqualizerBandIdentifier - IdentifierModel::kIdentifierMin));
 }
 
 }; // namespace Model
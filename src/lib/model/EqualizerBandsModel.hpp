@@ -26,7 +26,8 @@
 #ifndef OPENHLXMMODELEQUALIZERBANDSMODEL_HPP
 #define OPENHLXMMODELEQUALIZERBANDSMODEL_HPP
 
-#include <map>
+#include <array>
+#include <bitset>
 
 #include <stddef.h>
 
@@ -85,9 +86,14 @@ public:
     bool operator ==(const EqualizerBandsModel &aEqualizerBandsModel) const;
 
 private:
-    typedef std::map<IdentifierType, EqualizerBandModel> EqualizerBands;
+    static size_t GetIndex(const IdentifierType &aEqualizerBandIdentifier);
 
-    EqualizerBands  mEqualizerBands;
+private:
+    typedef std::array<EqualizerBandModel, kEqualizerBandsMax> EqualizerBands;
+    typedef std::bitset<kEqualizerBandsMax>                    EqualizerBandsSet;
+
+    EqualizerBands     mEqualizerBands;
+    EqualizerBandsSet  mEqualizerBandsSet;
 };
 
 }; // namespace Model
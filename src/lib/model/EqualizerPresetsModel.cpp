@@ -221,7 +221,8 @@ EqualizerPresetsModel :: GetEqualizerPreset(const IdentifierType &aEqualizerPres
     lRetval = ValidateIdentifier(aEqualizerPresetIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aEqualizerPresetModel = &mEqualizerPresets.at(aEqualizerPresetIdentifier);
+    aEqualizerPresetModel = mEqualizerPresets.GetMutableObject(aEqualizerPresetIdentifier);
+    nlREQUIRE_ACTION(aEqualizerPresetModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -264,7 +265,8 @@ EqualizerPresetsModel :: GetEqualizerPreset(const IdentifierType &aEqualizerPres
     lRetval = ValidateIdentifier(aEqualizerPresetIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aEqualizerPresetModel = &mEqualizerPresets.at(aEqualizerPresetIdentifier);
+    aEqualizerPresetModel = mEqualizerPresets.GetObject(aEqualizerPresetIdentifier);
+    nlREQUIRE_ACTION(aEqualizerPresetModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -310,12 +312,12 @@ EqualizerPresetsModel :: GetEqualizerPreset(const char *aName, const EqualizerPr
         Status        lStatus;
 
 
-        lStatus = current->second.GetName(lName);
+        lStatus = current->second.mObject->GetName(lName);
         nlREQUIRE_SUCCESS(lStatus, next);
 
         if (strcmp(lName, aName) == 0)
         {
-            aEqualizerPresetModel = &current->second;
+            aEqualizerPresetModel = current->second.mObject.get();
             lRetval               = kStatus_Success;
             break;
         }
@@ -328,6 +330,47 @@ EqualizerPresetsModel :: GetEqualizerPreset(const char *aName, const EqualizerPr
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Get the identifiers of the equalizer presets changed since the
+ *    specified change sequence number.
+ *
+ *  This adds to the specified identifiers collection the identifier of
+ *  each equalizer preset whose last change was stamped with a change
+ *  sequence number later than the one specified.
+ *
+ *  @param[in]      aSequence                    An immutable reference
+ *                                               to the change sequence
+ *                                               number after which
+ *                                               changed equalizer
+ *                                               presets are to be
+ *                                               returned.
+ *  @param[in,out]  aEqualizerPresetIdentifiers  A mutable reference to
+ *                                               the identifiers
+ *                                               collection to which the
+ *                                               identifiers of the
+ *                                               changed equalizer
+ *                                               presets are to be
+ *                                               added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+EqualizerPresetsModel :: GetEqualizerPresetsChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aEqualizerPresetIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mEqualizerPresets.GetChangedSince(aSequence, aEqualizerPresetIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    This sets the model equalizer preset for the specified identifier.
@@ -355,19 +398,22 @@ EqualizerPresetsModel :: GetEqualizerPreset(const char *aName, const EqualizerPr
 Status
 EqualizerPresetsModel :: SetEqualizerPreset(const IdentifierType &aEqualizerPresetIdentifier, const EqualizerPresetModel &aEqualizerPresetModel)
 {
+    const EqualizerPresetModel * lEqualizerPresetModel;
     Status lRetval = kStatus_Success;
 
 
     lRetval = ValidateIdentifier(aEqualizerPresetIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    if (mEqualizerPresets[aEqualizerPresetIdentifier] == aEqualizerPresetModel)
+    lEqualizerPresetModel = mEqualizerPresets.GetObject(aEqualizerPresetIdentifier);
+
+    if ((lEqualizerPresetModel != nullptr) && (*lEqualizerPresetModel == aEqualizerPresetModel))
     {
         lRetval = kStatus_ValueAlreadySet;
     }
     else
     {
-        mEqualizerPresets[aEqualizerPresetIdentifier] = aEqualizerPresetModel;
+        mEqualizerPresets.SetObject(aEqualizerPresetIdentifier, aEqualizerPresetModel);
     }
 
  done:
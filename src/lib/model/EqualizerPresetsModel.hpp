@@ -26,12 +26,13 @@
 #ifndef OPENHLXMMODELEQUALIZERPRESETSMODEL_HPP
 #define OPENHLXMMODELEQUALIZERPRESETSMODEL_HPP
 
-#include <map>
-
 #include <stddef.h>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/CopyOnWriteCollectionTemplate.hpp>
 #include <OpenHLX/Model/EqualizerPresetModel.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 
 
 namespace HLX
@@ -71,6 +72,8 @@ public:
     Common::Status GetEqualizerPreset(const IdentifierType &aEqualizerPresetIdentifier, const EqualizerPresetModel *&aEqualizerPresetModel) const;
     Common::Status GetEqualizerPreset(const char *aName, const EqualizerPresetModel *&aEqualizerPresetModel) const;
 
+    Common::Status GetEqualizerPresetsChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aEqualizerPresetIdentifiers);
+
     Common::Status SetEqualizerPreset(const IdentifierType &aEqualizerPresetIdentifier, const EqualizerPresetModel &aEqualizerPresetModel);
 
     bool operator ==(const EqualizerPresetsModel &aEqualizerPresetsModel) const;
@@ -79,7 +82,7 @@ private:
     Common::Status ValidateIdentifier(const IdentifierType &aEqualizerPresetIdentifier) const;
 
 private:
-    typedef std::map<IdentifierType, EqualizerPresetModel> EqualizerPresets;
+    typedef CopyOnWriteCollectionTemplate<EqualizerPresetModel> EqualizerPresets;
 
     IdentifierType    mEqualizerPresetsMax;
     EqualizerPresets  mEqualizerPresets;
@@ -66,6 +66,7 @@ FavoritesModel :: FavoritesModel(void) :
  *
  */
 FavoritesModel :: FavoritesModel(const FavoritesModel &aFavoritesModel) :
+    mFavoritesMax(aFavoritesModel.mFavoritesMax),
     mFavorites(aFavoritesModel.mFavorites)
 {
     return;
@@ -156,7 +157,8 @@ FavoritesModel :: Init(const FavoritesModel &aFavoritesModel)
 FavoritesModel &
 FavoritesModel :: operator =(const FavoritesModel &aFavoritesModel)
 {
-    mFavorites = aFavoritesModel.mFavorites;
+    mFavoritesMax = aFavoritesModel.mFavoritesMax;
+    mFavorites    = aFavoritesModel.mFavorites;
 
     return (*this);
 }
@@ -224,7 +226,8 @@ FavoritesModel :: GetFavorite(const IdentifierType &aFavoriteIdentifier, Favorit
     lRetval = ValidateIdentifier(aFavoriteIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aFavoriteModel = &mFavorites.at(aFavoriteIdentifier);
+    aFavoriteModel = mFavorites.GetMutableObject(aFavoriteIdentifier);
+    nlREQUIRE_ACTION(aFavoriteModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -265,7 +268,8 @@ FavoritesModel :: GetFavorite(const IdentifierType &aFavoriteIdentifier, const F
     lRetval = ValidateIdentifier(aFavoriteIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aFavoriteModel = &mFavorites.at(aFavoriteIdentifier);
+    aFavoriteModel = mFavorites.GetObject(aFavoriteIdentifier);
+    nlREQUIRE_ACTION(aFavoriteModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -311,12 +315,12 @@ FavoritesModel :: GetFavorite(const char *aName, const FavoriteModel *&aFavorite
         Status        lStatus;
 
 
-        lStatus = current->second.GetName(lName);
+        lStatus = current->second.mObject->GetName(lName);
         nlREQUIRE_SUCCESS(lStatus, next);
 
         if (strcmp(lName, aName) == 0)
         {
-            aFavoriteModel = &current->second;
+            aFavoriteModel = current->second.mObject.get();
             lRetval        = kStatus_Success;
             break;
         }
@@ -329,6 +333,43 @@ FavoritesModel :: GetFavorite(const char *aName, const FavoriteModel *&aFavorite
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Get the identifiers of the favorites changed since the specified
+ *    change sequence number.
+ *
+ *  This adds to the specified identifiers collection the identifier of
+ *  each favorite whose last change was stamped with a change sequence
+ *  number later than the one specified.
+ *
+ *  @param[in]      aSequence             An immutable reference to the
+ *                                        change sequence number after
+ *                                        which changed favorites are to
+ *                                        be returned.
+ *  @param[in,out]  aFavoriteIdentifiers  A mutable reference to the
+ *                                        identifiers collection to
+ *                                        which the identifiers of the
+ *                                        changed favorites are to be
+ *                                        added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+FavoritesModel :: GetFavoritesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aFavoriteIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mFavorites.GetChangedSince(aSequence, aFavoriteIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    This sets the model favorite for the specified identifier.
@@ -354,19 +395,22 @@ FavoritesModel :: GetFavorite(const char *aName, const FavoriteModel *&aFavorite
 Status
 FavoritesModel :: SetFavorite(const IdentifierType &aFavoriteIdentifier, const FavoriteModel &aFavoriteModel)
 {
+    const FavoriteModel * lFavoriteModel;
     Status lRetval = kStatus_Success;
 
 
     lRetval = ValidateIdentifier(aFavoriteIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    if (mFavorites[aFavoriteIdentifier] == aFavoriteModel)
+    lFavoriteModel = mFavorites.GetObject(aFavoriteIdentifier);
+
+    if ((lFavoriteModel != nullptr) && (*lFavoriteModel == aFavoriteModel))
     {
         lRetval = kStatus_ValueAlreadySet;
     }
     else
     {
-        mFavorites[aFavoriteIdentifier] = aFavoriteModel;
+        mFavorites.SetObject(aFavoriteIdentifier, aFavoriteModel);
     }
 
  done:
@@ -26,12 +26,13 @@
 #ifndef OPENHLXMMODELFAVORITESMODEL_HPP
 #define OPENHLXMMODELFAVORITESMODEL_HPP
 
-#include <map>
-
 #include <stddef.h>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/CopyOnWriteCollectionTemplate.hpp>
 #include <OpenHLX/Model/FavoriteModel.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 
 
 namespace HLX
@@ -71,6 +72,8 @@ public:
     Common::Status GetFavorite(const IdentifierType &aFavoriteIdentifier, const FavoriteModel *&aFavoriteModel) const;
     Common::Status GetFavorite(const char *aName, const FavoriteModel *&aFavoriteModel) const;
 
+    Common::Status GetFavoritesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aFavoriteIdentifiers);
+
     Common::Status SetFavorite(const IdentifierType &aFavoriteIdentifier, const FavoriteModel &aFavoriteModel);
 
     bool operator ==(const FavoritesModel &aFavoritesModel) const;
@@ -79,7 +82,7 @@ private:
     Common::Status ValidateIdentifier(const IdentifierType &aFavoriteIdentifier) const;
 
 private:
-    typedef std::map<IdentifierType, FavoriteModel> Favorites;
+    typedef CopyOnWriteCollectionTemplate<FavoriteModel> Favorites;
 
     IdentifierType  mFavoritesMax;
     Favorites       mFavorites;
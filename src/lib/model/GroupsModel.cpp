@@ -67,6 +67,7 @@ GroupsModel :: GroupsModel(void) :
  *
  */
 GroupsModel :: GroupsModel(const GroupsModel &aGroupsModel) :
+    mGroupsMax(aGroupsModel.mGroupsMax),
     mGroups(aGroupsModel.mGroups)
 {
     return;
@@ -156,7 +157,8 @@ GroupsModel :: Init(const GroupsModel &aGroupsModel)
 GroupsModel &
 GroupsModel :: operator =(const GroupsModel &aGroupsModel)
 {
-    mGroups = aGroupsModel.mGroups;
+    mGroupsMax = aGroupsModel.mGroupsMax;
+    mGroups    = aGroupsModel.mGroups;
 
     return (*this);
 }
@@ -221,7 +223,8 @@ GroupsModel :: GetGroup(const IdentifierType &aGroupIdentifier, GroupModel *&aGr
     lRetval = ValidateIdentifier(aGroupIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aGroupModel = &mGroups.at(aGroupIdentifier);
+    aGroupModel = mGroups.GetMutableObject(aGroupIdentifier);
+    nlREQUIRE_ACTION(aGroupModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -262,7 +265,8 @@ GroupsModel :: GetGroup(const IdentifierType &aGroupIdentifier, const GroupModel
     lRetval = ValidateIdentifier(aGroupIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aGroupModel = &mGroups.at(aGroupIdentifier);
+    aGroupModel = mGroups.GetObject(aGroupIdentifier);
+    nlREQUIRE_ACTION(aGroupModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -308,12 +312,12 @@ GroupsModel :: GetGroup(const char *aName, const GroupModel *&aGroupModel) const
         Status        lStatus;
 
 
-        lStatus = current->second.GetName(lName);
+        lStatus = current->second.mObject->GetName(lName);
         nlREQUIRE_SUCCESS(lStatus, next);
 
         if (strcmp(lName, aName) == 0)
         {
-            aGroupModel = &current->second;
+            aGroupModel = current->second.mObject.get();
             lRetval     = kStatus_Success;
             break;
         }
@@ -326,6 +330,42 @@ GroupsModel :: GetGroup(const char *aName, const GroupModel *&aGroupModel) const
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Get the identifiers of the groups changed since the specified
+ *    change sequence number.
+ *
+ *  This adds to the specified identifiers collection the identifier of
+ *  each group whose last change was stamped with a change sequence
+ *  number later than the one specified.
+ *
+ *  @param[in]      aSequence          An immutable reference to the
+ *                                     change sequence number after
+ *                                     which changed groups are to be
+ *                                     returned.
+ *  @param[in,out]  aGroupIdentifiers  A mutable reference to the
+ *                                     identifiers collection to which
+ *                                     the identifiers of the changed
+ *                                     groups are to be added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+GroupsModel :: GetGroupsChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aGroupIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mGroups.GetChangedSince(aSequence, aGroupIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    This sets the model group for the specified identifier.
@@ -351,19 +391,22 @@ GroupsModel :: GetGroup(const char *aName, const GroupModel *&aGroupModel) const
 Status
 GroupsModel :: SetGroup(const IdentifierType &aGroupIdentifier, const GroupModel &aGroupModel)
 {
+    const GroupModel * lGroupModel;
     Status lRetval = kStatus_Success;
 
 
     lRetval = ValidateIdentifier(aGroupIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    if (mGroups[aGroupIdentifier] == aGroupModel)
+    lGroupModel = mGroups.GetObject(aGroupIdentifier);
+
+    if ((lGroupModel != nullptr) && (*lGroupModel == aGroupModel))
     {
         lRetval = kStatus_ValueAlreadySet;
     }
     else
     {
-        mGroups[aGroupIdentifier] = aGroupModel;
+        mGroups.SetObject(aGroupIdentifier, aGroupModel);
     }
 
  done:
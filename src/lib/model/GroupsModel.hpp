@@ -26,12 +26,13 @@
 #ifndef OPENHLXMMODELGROUPSMODEL_HPP
 #define OPENHLXMMODELGROUPSMODEL_HPP
 
-#include <map>
-
 #include <stddef.h>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/CopyOnWriteCollectionTemplate.hpp>
 #include <OpenHLX/Model/GroupModel.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 
 
 namespace HLX
@@ -71,6 +72,8 @@ public:
     Common::Status GetGroup(const IdentifierType &aGroupIdentifier, const GroupModel *&aGroupModel) const;
     Common::Status GetGroup(const char *aName, const GroupModel *&aGroupModel) const;
 
+    Common::Status GetGroupsChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aGroupIdentifiers);
+
     Common::Status SetGroup(const IdentifierType &aGroupIdentifier, const GroupModel &aGroupModel);
 
     bool operator ==(const GroupsModel &aGroupsModel) const;
@@ -79,7 +82,7 @@ private:
     Common::Status ValidateIdentifier(const IdentifierType &aGroupIdentifier) const;
 
 private:
-    typedef std::map<IdentifierType, GroupModel> Groups;
+    typedef CopyOnWriteCollectionTemplate<GroupModel> Groups;
 
     IdentifierType  mGroupsMax;
     Groups          mGroups;
@@ -59,6 +59,17 @@ const IdentifierModel::IdentifierType IdentifierModel::kIdentifierInvalid = 0;
  */
 const IdentifierModel::IdentifierType IdentifierModel::kIdentifierMin     = 1;
 
+/**
+ *  The maximum or highest object identifier.
+ *
+ *  Object collections are iterated inclusively from the minimum
+ *  through their maximum identifier; consequently, this is one less
+ *  than the largest value representable by the identifier type such
+ *  that such iteration terminates.
+ *
+ */
+const IdentifierModel::IdentifierType IdentifierModel::kIdentifierMax     = UINT8_MAX - 1;
+
 /**
  *  @brief
  *    This is the class default constructor.
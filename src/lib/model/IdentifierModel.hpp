@@ -61,6 +61,7 @@ public:
 
     static const IdentifierType kIdentifierInvalid;
     static const IdentifierType kIdentifierMin;
+    static const IdentifierType kIdentifierMax;
 
 public:
     IdentifierModel(void);
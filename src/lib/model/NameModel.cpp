@@ -41,11 +41,7 @@ namespace HLX
 namespace Model
 {
 
-/**
- *  The maximum allowed length, in bytes, of a name.
- *
- */
-const size_t NameModel::kNameLengthMax = 16;
+constexpr size_t NameModel::kNameLengthMax;
 
 /**
  *  @brief
@@ -54,6 +50,7 @@ const size_t NameModel::kNameLengthMax = 16;
  */
 NameModel :: NameModel(void) :
     mNameIsNull(true),
+    mNameLength(0),
     mName()
 {
     return;
@@ -75,8 +72,8 @@ NameModel :: Init(void)
 {
     Status lRetval = kStatus_Success;
 
-    mName.clear();
-
+    mName[0]    = '\0';
+    mNameLength = 0;
     mNameIsNull = true;
 
     return (lRetval);
@@ -129,14 +126,15 @@ Status
 NameModel :: Init(const char *aName, const size_t &aNameLength)
 {
     Status lRetval = kStatus_Success;
-    std::string lName;
 
     nlREQUIRE_ACTION(aName != nullptr, done, lRetval = -EINVAL);
     nlREQUIRE_ACTION(aNameLength <= NameModel::kNameLengthMax, done, lRetval = -ENAMETOOLONG);
 
-    mName.assign(aName, aNameLength);
+    memcpy(mName, aName, aNameLength);
 
-    mNameIsNull = false;
+    mName[aNameLength] = '\0';
+    mNameLength        = static_cast<uint8_t>(aNameLength);
+    mNameIsNull        = false;
 
  done:
     return (lRetval);
@@ -162,8 +160,7 @@ NameModel :: Init(const std::string &aName)
 
     nlREQUIRE_ACTION(aName.size() <= NameModel::kNameLengthMax, done, lRetval = -ENAMETOOLONG);
 
-    mName       = aName;
-    mNameIsNull = false;
+    lRetval = Init(aName.data(), aName.size());
 
  done:
     return (lRetval);
@@ -210,7 +207,11 @@ NameModel :: Init(const NameModel &aNameModel)
 NameModel &
 NameModel :: operator =(const NameModel &aNameModel)
 {
-    mName       = aNameModel.mName;
+    // Only the name and its null terminator need be copied.
+
+    memcpy(mName, aNameModel.mName, aNameModel.mNameLength + 1);
+
+    mNameLength = aNameModel.mNameLength;
     mNameIsNull = aNameModel.mNameIsNull;
 
     return (*this);
@@ -243,7 +244,7 @@ NameModel :: GetName(const char *&aName) const
 
     if (lRetval == kStatus_Success)
     {
-        aName = mName.c_str();
+        aName = mName;
     }
 
     return (lRetval);
@@ -303,7 +304,7 @@ NameModel :: SetName(const char *aName, const size_t &aNameLength)
 
     nlREQUIRE_ACTION(aName != nullptr, done, lRetval = -EINVAL);
 
-    if (strncmp(mName.c_str(), aName, aNameLength) == 0)
+    if (!mNameIsNull && (aNameLength == mNameLength) && (memcmp(mName, aName, aNameLength) == 0))
     {
         lRetval = kStatus_ValueAlreadySet;
     }
@@ -332,7 +333,7 @@ NameModel :: SetName(const char *aName, const size_t &aNameLength)
 bool
 NameModel :: operator ==(const char *aName) const
 {
-    return (!mNameIsNull && (mName == aName));
+    return (!mNameIsNull && (strcmp(mName, aName) == 0));
 }
 
 /**
@@ -351,7 +352,7 @@ NameModel :: operator ==(const char *aName) const
 bool
 NameModel :: operator ==(const std::string &aName) const
 {
-    return (!mNameIsNull && (mName == aName));
+    return (!mNameIsNull && (aName.size() == mNameLength) && (memcmp(mName, aName.data(), mNameLength) == 0));
 }
 
 /**
@@ -373,7 +374,8 @@ bool
 NameModel :: operator ==(const NameModel &aNameModel) const
 {
     return ((mNameIsNull == aNameModel.mNameIsNull) &&
-            (mName       == aNameModel.mName));
+            (mNameLength == aNameModel.mNameLength) &&
+            (memcmp(mName, aNameModel.mName, mNameLength) == 0));
 }
 
 }; // namespace Model
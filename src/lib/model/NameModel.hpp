@@ -29,6 +29,7 @@
 #include <string>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <OpenHLX/Common/Errors.hpp>
 
@@ -45,13 +46,20 @@ namespace Model
  *  This defines an object for managing HLX object names such as those
  *  used for equalizer presets, favorites, groups, sources, and zones.
  *
+ *  Since names are bounded in length, the name is stored inline,
+ *  such that copying or comparing a name never allocates.
+ *
  *  @ingroup model
  *
  */
 class NameModel
 {
 public:
-    static const size_t kNameLengthMax;
+    /**
+     *  The maximum allowed length, in bytes, of a name.
+     *
+     */
+    static constexpr size_t kNameLengthMax = 16;
 
 public:
     NameModel(void);
@@ -74,8 +82,9 @@ public:
     bool operator ==(const NameModel &aNameModel) const;
 
 private:
-    bool        mNameIsNull;
-    std::string mName;
+    bool     mNameIsNull;
+    uint8_t  mNameLength;
+    char     mName[kNameLengthMax + 1];
 };
 
 }; // namespace Model
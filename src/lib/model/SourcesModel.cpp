@@ -66,6 +66,7 @@ SourcesModel :: SourcesModel(void) :
  *
  */
 SourcesModel :: SourcesModel(const SourcesModel &aSourcesModel) :
+    mSourcesMax(aSourcesModel.mSourcesMax),
     mSources(aSourcesModel.mSources)
 {
     return;
@@ -153,7 +154,8 @@ SourcesModel :: Init(const SourcesModel &aSourcesModel)
 SourcesModel &
 SourcesModel :: operator =(const SourcesModel &aSourcesModel)
 {
-    mSources = aSourcesModel.mSources;
+    mSourcesMax = aSourcesModel.mSourcesMax;
+    mSources    = aSourcesModel.mSources;
 
     return (*this);
 }
@@ -220,7 +222,8 @@ SourcesModel :: GetSource(const IdentifierType &aSourceIdentifier, SourceModel *
     lRetval = ValidateIdentifier(aSourceIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aSourceModel = &mSources.at(aSourceIdentifier);
+    aSourceModel = mSources.GetMutableObject(aSourceIdentifier);
+    nlREQUIRE_ACTION(aSourceModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -261,7 +264,8 @@ SourcesModel :: GetSource(const IdentifierType &aSourceIdentifier, const SourceM
     lRetval = ValidateIdentifier(aSourceIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aSourceModel = &mSources.at(aSourceIdentifier);
+    aSourceModel = mSources.GetObject(aSourceIdentifier);
+    nlREQUIRE_ACTION(aSourceModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -307,12 +311,12 @@ SourcesModel :: GetSource(const char *aName, const SourceModel *&aSourceModel) c
         Status        lStatus;
 
 
-        lStatus = current->second.GetName(lName);
+        lStatus = current->second.mObject->GetName(lName);
         nlREQUIRE_SUCCESS(lStatus, next);
 
         if (strcmp(lName, aName) == 0)
         {
-            aSourceModel = &current->second;
+            aSourceModel = current->second.mObject.get();
             lRetval      = kStatus_Success;
             break;
         }
@@ -325,6 +329,42 @@ SourcesModel :: GetSource(const char *aName, const SourceModel *&aSourceModel) c
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Get the identifiers of the sources changed since the specified
+ *    change sequence number.
+ *
+ *  This adds to the specified identifiers collection the identifier of
+ *  each source whose last change was stamped with a change sequence
+ *  number later than the one specified.
+ *
+ *  @param[in]      aSequence           An immutable reference to the
+ *                                      change sequence number after
+ *                                      which changed sources are to be
+ *                                      returned.
+ *  @param[in,out]  aSourceIdentifiers  A mutable reference to the
+ *                                      identifiers collection to which
+ *                                      the identifiers of the changed
+ *                                      sources are to be added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+SourcesModel :: GetSourcesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aSourceIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mSources.GetChangedSince(aSequence, aSourceIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    This sets the model source for the specified identifier.
@@ -350,19 +390,22 @@ SourcesModel :: GetSource(const char *aName, const SourceModel *&aSourceModel) c
 Status
 SourcesModel :: SetSource(const IdentifierType &aSourceIdentifier, const SourceModel &aSourceModel)
 {
+    const SourceModel * lSourceModel;
     Status lRetval = kStatus_Success;
 
 
     lRetval = ValidateIdentifier(aSourceIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    if (mSources[aSourceIdentifier] == aSourceModel)
+    lSourceModel = mSources.GetObject(aSourceIdentifier);
+
+    if ((lSourceModel != nullptr) && (*lSourceModel == aSourceModel))
     {
         lRetval = kStatus_ValueAlreadySet;
     }
     else
     {
-        mSources[aSourceIdentifier] = aSourceModel;
+        mSources.SetObject(aSourceIdentifier, aSourceModel);
     }
 
  done:
@@ -26,11 +26,12 @@
 #ifndef OPENHLXMMODELSOURCESMODEL_HPP
 #define OPENHLXMMODELSOURCESMODEL_HPP
 
-#include <map>
-
 #include <stddef.h>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/CopyOnWriteCollectionTemplate.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 #include <OpenHLX/Model/SourceModel.hpp>
 
 
@@ -71,6 +72,8 @@ public:
     Common::Status GetSource(const IdentifierType &aSource, const SourceModel *&aSourceModel) const;
     Common::Status GetSource(const char *aName, const SourceModel *&aSourceModel) const;
 
+    Common::Status GetSourcesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aSourceIdentifiers);
+
     Common::Status SetSource(const IdentifierType &aSource, const SourceModel &aSourceModel);
 
     bool operator ==(const SourcesModel &aSourcesModel) const;
@@ -79,7 +82,7 @@ private:
     Common::Status ValidateIdentifier(const IdentifierType &aSourceIdentifier) const;
 
 private:
-    typedef std::map<IdentifierType, SourceModel> Sources;
+    typedef CopyOnWriteCollectionTemplate<SourceModel> Sources;
 
     IdentifierType  mSourcesMax;
     Sources         mSources;
@@ -66,6 +66,7 @@ ZonesModel :: ZonesModel(void) :
  *
  */
 ZonesModel :: ZonesModel(const ZonesModel &aZonesModel) :
+    mZonesMax(aZonesModel.mZonesMax),
     mZones(aZonesModel.mZones)
 {
     return;
@@ -156,7 +157,8 @@ ZonesModel :: Init(const ZonesModel &aZonesModel)
 ZonesModel &
 ZonesModel :: operator =(const ZonesModel &aZonesModel)
 {
-    mZones = aZonesModel.mZones;
+    mZonesMax = aZonesModel.mZonesMax;
+    mZones    = aZonesModel.mZones;
 
     return (*this);
 }
@@ -223,7 +225,8 @@ ZonesModel :: GetZone(const IdentifierType &aZoneIdentifier, ZoneModel *&aZoneMo
     lRetval = ValidateIdentifier(aZoneIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aZoneModel = &mZones.at(aZoneIdentifier);
+    aZoneModel = mZones.GetMutableObject(aZoneIdentifier);
+    nlREQUIRE_ACTION(aZoneModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -264,7 +267,8 @@ ZonesModel :: GetZone(const IdentifierType &aZoneIdentifier, const ZoneModel *&a
     lRetval = ValidateIdentifier(aZoneIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    aZoneModel = &mZones.at(aZoneIdentifier);
+    aZoneModel = mZones.GetObject(aZoneIdentifier);
+    nlREQUIRE_ACTION(aZoneModel != nullptr, done, lRetval = kError_NotInitialized);
 
  done:
     return (lRetval);
@@ -310,12 +314,12 @@ ZonesModel :: GetZone(const char *aName, const ZoneModel *&aZoneModel) const
         Status        lStatus;
 
 
-        lStatus = current->second.GetName(lName);
+        lStatus = current->second.mObject->GetName(lName);
         nlREQUIRE_SUCCESS(lStatus, next);
 
         if (strcmp(lName, aName) == 0)
         {
-            aZoneModel = &current->second;
+            aZoneModel = current->second.mObject.get();
             lRetval    = kStatus_Success;
             break;
         }
@@ -328,6 +332,41 @@ ZonesModel :: GetZone(const char *aName, const ZoneModel *&aZoneModel) const
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Get the identifiers of the zones changed since the specified
+ *    change sequence number.
+ *
+ *  This adds to the specified identifiers collection the identifier of
+ *  each zone whose last change was stamped with a change sequence
+ *  number later than the one specified.
+ *
+ *  @param[in]      aSequence         An immutable reference to the
+ *                                    change sequence number after which
+ *                                    changed zones are to be returned.
+ *  @param[in,out]  aZoneIdentifiers  A mutable reference to the
+ *                                    identifiers collection to which
+ *                                    the identifiers of the changed
+ *                                    zones are to be added.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the identifiers collection has
+ *                                  not been initialized.
+ *
+ */
+Status
+ZonesModel :: GetZonesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aZoneIdentifiers)
+{
+    Status lRetval;
+
+
+    lRetval = mZones.GetChangedSince(aSequence, aZoneIdentifiers);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    This sets the model zone for the specified identifier.
@@ -353,19 +392,22 @@ ZonesModel :: GetZone(const char *aName, const ZoneModel *&aZoneModel) const
 Status
 ZonesModel :: SetZone(const IdentifierType &aZoneIdentifier, const ZoneModel &aZoneModel)
 {
+    const ZoneModel * lZoneModel;
     Status lRetval = kStatus_Success;
 
 
     lRetval = ValidateIdentifier(aZoneIdentifier);
     nlREQUIRE_SUCCESS(lRetval, done);
 
-    if (mZones[aZoneIdentifier] == aZoneModel)
+    lZoneModel = mZones.GetObject(aZoneIdentifier);
+
+    if ((lZoneModel != nullptr) && (*lZoneModel == aZoneModel))
     {
         lRetval = kStatus_ValueAlreadySet;
     }
     else
     {
-        mZones[aZoneIdentifier] = aZoneModel;
+        mZones.SetObject(aZoneIdentifier, aZoneModel);
     }
 
  done:
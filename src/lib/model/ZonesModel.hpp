@@ -26,11 +26,12 @@
 #ifndef OPENHLXMMODELZONESMODEL_HPP
 #define OPENHLXMMODELZONESMODEL_HPP
 
-#include <map>
-
 #include <stddef.h>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/CopyOnWriteCollectionTemplate.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
 #include <OpenHLX/Model/ZoneModel.hpp>
 
 
@@ -71,6 +72,8 @@ public:
     Common::Status GetZone(const IdentifierType &aZoneIdentifier, const ZoneModel *&aZoneModel) const;
     Common::Status GetZone(const char *aName, const ZoneModel *&aZoneModel) const;
 
+    Common::Status GetZonesChangedSince(const ChangeSequence::SequenceType &aSequence, IdentifiersCollection &aZoneIdentifiers);
+
     Common::Status SetZone(const IdentifierType &aZoneIdentifier, const ZoneModel &aZoneModel);
 
     bool operator ==(const ZonesModel &aZonesModel) const;
@@ -79,7 +82,7 @@ private:
     Common::Status ValidateIdentifier(const IdentifierType &aZoneIdentifier) const;
 
 private:
-    typedef std::map<IdentifierType, ZoneModel> Zones;
+    typedef CopyOnWriteCollectionTemplate<ZoneModel> Zones;
 
     IdentifierType  mZonesMax;
     Zones           mZones;
@@ -242,6 +242,218 @@ static void TestAssignment(nlTestSuite *inSuite, void *inContext __attribute__((
     NL_TEST_ASSERT(inSuite, lAreEqual == true);
 }
 
+static void TestSnapshot(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    const char *                       lNameConstant = "Test Name";
+    ZonesModel                         lZonesModel_1;
+    const ZoneModel *                  lImmutableZoneModel_1;
+    const ZoneModel *                  lImmutableZoneModel_2;
+    ZoneModel *                        lMutableZoneModel;
+    Status                             lStatus;
+    bool                               lAreEqual;
+
+    lStatus = lZonesModel_1.Init(kZonesMax);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    {
+        const ZonesModel               lZonesModel_2(lZonesModel_1);
+        const ZonesModel               lZonesModel_3(lZonesModel_1);
+
+        // Test 1: Test that a copy shares, rather than copies, each
+        //         zone with the original.
+
+        lStatus = lZonesModel_1.GetZone(IdentifierModel::kIdentifierMin, lImmutableZoneModel_1);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lStatus = lZonesModel_2.GetZone(IdentifierModel::kIdentifierMin, lImmutableZoneModel_2);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        NL_TEST_ASSERT(inSuite, lImmutableZoneModel_1 == lImmutableZoneModel_2);
+
+        // Test 2: Test that mutating a zone in the original does not
+        //         mutate the copy.
+
+        lStatus = lZonesModel_1.GetZone(IdentifierModel::kIdentifierMin, lMutableZoneModel);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lStatus = lMutableZoneModel->SetName(lNameConstant);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lAreEqual = (lZonesModel_1 == lZonesModel_2);
+        NL_TEST_ASSERT(inSuite, lAreEqual == false);
+
+        lAreEqual = (lZonesModel_2 == lZonesModel_3);
+        NL_TEST_ASSERT(inSuite, lAreEqual == true);
+
+        lStatus = lZonesModel_2.GetZone(lNameConstant, lImmutableZoneModel_2);
+        NL_TEST_ASSERT(inSuite, lStatus == -ENOENT);
+
+        // Test 3: Test that zones not mutated in the original remain
+        //         shared with the copy.
+
+        lStatus = lZonesModel_1.GetZone(kZonesMax, lImmutableZoneModel_1);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lStatus = lZonesModel_2.GetZone(kZonesMax, lImmutableZoneModel_2);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        NL_TEST_ASSERT(inSuite, lImmutableZoneModel_1 == lImmutableZoneModel_2);
+    }
+
+    // Test 4: Test that the mutation persists in the original once
+    //         the copies are gone.
+
+    lStatus = lZonesModel_1.GetZone(lNameConstant, lImmutableZoneModel_1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+}
+
+static void TestChangedSince(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    const char *                       lNameConstant = "Test Name";
+    const char *                       lOtherNameConstant = "Other Name";
+    ZonesModel                         lZonesModel;
+    ZoneModel                          lZoneModel;
+    ZoneModel *                        lMutableZoneModel;
+    const ZoneModel *                  lImmutableZoneModel;
+    IdentifiersCollection              lZoneIdentifiers;
+    ChangeSequence::SequenceType       lSequence;
+    size_t                             lCount;
+    Status                             lStatus;
+
+    lStatus = lZonesModel.Init(kZonesMax);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.Init();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Test 1: Test that all zones have changed since before
+    //         initialization.
+
+    lStatus = lZonesModel.GetZonesChangedSince(ChangeSequence::kSequenceNone, lZoneIdentifiers);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.GetCount(lCount);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCount == kZonesMax);
+
+    // Test 2: Test that no zones have changed since initialization.
+
+    lSequence = ChangeSequence::GetSequence();
+
+    lStatus = lZoneIdentifiers.ClearIdentifiers();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZonesChangedSince(lSequence, lZoneIdentifiers);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.GetCount(lCount);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCount == 0);
+
+    // Test 3: Test that a zone accessed for mutation but not
+    //         changed has not changed.
+
+    lStatus = lZonesModel.GetZone(IdentifierModel::kIdentifierMin, lMutableZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZonesChangedSince(lSequence, lZoneIdentifiers);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.GetCount(lCount);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCount == 0);
+
+    // Test 4: Test that a zone changed in place has changed and
+    //         that only it has.
+
+    lStatus = lZonesModel.GetZone(kZonesMax, lMutableZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lMutableZoneModel->SetName(lNameConstant);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZonesChangedSince(lSequence, lZoneIdentifiers);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.GetCount(lCount);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCount == 1);
+    NL_TEST_ASSERT(inSuite, lZoneIdentifiers.ContainsIdentifier(kZonesMax));
+    NL_TEST_ASSERT(inSuite, ChangeSequence::GetSequence() > lSequence);
+
+    // Test 5: Test that the change is not reported again since the
+    //         sequence at which it was stamped.
+
+    lSequence = ChangeSequence::GetSequence();
+
+    lStatus = lZoneIdentifiers.ClearIdentifiers();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZonesChangedSince(lSequence, lZoneIdentifiers);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.GetCount(lCount);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCount == 0);
+
+    // Test 6: Test that a zone changed in place and then changed
+    //         back, from A to B and back to A, between requests for
+    //         changes has changed.
+
+    lStatus = lZonesModel.GetZone(kZonesMax, lMutableZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lMutableZoneModel->SetName(lOtherNameConstant);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZone(kZonesMax, lMutableZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lMutableZoneModel->SetName(lNameConstant);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZonesChangedSince(lSequence, lZoneIdentifiers);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.GetCount(lCount);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCount == 1);
+    NL_TEST_ASSERT(inSuite, lZoneIdentifiers.ContainsIdentifier(kZonesMax));
+
+    // Test 7: Test that the same revert through a set of the whole
+    //         zone has changed.
+
+    lSequence = ChangeSequence::GetSequence();
+
+    lStatus = lZoneIdentifiers.ClearIdentifiers();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZone(kZonesMax, lImmutableZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lZoneModel = *lImmutableZoneModel;
+
+    lStatus = lZoneModel.SetName(lOtherNameConstant);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.SetZone(kZonesMax, lZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneModel.SetName(lNameConstant);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.SetZone(kZonesMax, lZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZonesChangedSince(lSequence, lZoneIdentifiers);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneIdentifiers.GetCount(lCount);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lCount == 1);
+    NL_TEST_ASSERT(inSuite, lZoneIdentifiers.ContainsIdentifier(kZonesMax));
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -252,6 +464,8 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Mutation",       TestMutation),
     NL_TEST_DEF("Equality",       TestEquality),
     NL_TEST_DEF("Assignment",     TestAssignment),
+    NL_TEST_DEF("Snapshot",       TestSnapshot),
+    NL_TEST_DEF("Changed Since",  TestChangedSince),
 
     NL_TEST_SENTINEL()
 };
@@ -263,10 +263,7 @@ CommandManager :: SendErrorResponse(ConnectionBasis &aConnection) const
     Status                                   lRetval;
 
 
-    lResponseBuffer.reset(new ConnectionBuffer);
-    nlREQUIRE_ACTION(lResponseBuffer, done, lRetval = -ENOMEM);
-
-    lRetval = lResponseBuffer->Init();
+    lRetval = ConnectionBuffer::Create(lResponseBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     lRetval = SendErrorResponse(aConnection, lResponseBuffer);
@@ -309,7 +306,7 @@ CommandManager :: SendErrorResponse(ConnectionBasis &aConnection,
     lBuffer = lErrorResponse.GetBuffer();
     lSize = lErrorResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     lRetval = SendResponse(aConnection, aBuffer);
@@ -486,6 +483,15 @@ CommandManager :: DispatchRequest(ConnectionBasis &aConnection, const uint8_t *a
             std::set<RequestHandlerState>::iterator lCurrentRequestHandler = lFirstRequestHandler;
             Status lStatus = 1;
 
+            // A request in excess of the connection request rate
+            // limit is dropped, without a response, rather than
+            // dispatched.
+
+            if ((mConnectionManager != nullptr) && !mConnectionManager->AdmitRequest(aConnection))
+            {
+                goto next;
+            }
+
             LogDebug(lLogIndent,
                      lLogLevel,
                      "Dispatching request for:\n");
@@ -525,6 +531,7 @@ CommandManager :: DispatchRequest(ConnectionBasis &aConnection, const uint8_t *a
                 nlREQUIRE_SUCCESS(lRetval, done);
             }
 
+        next:
             lRequestStart += lRequestSize;
             lRequestSearchSize -= lRequestSize;
         }
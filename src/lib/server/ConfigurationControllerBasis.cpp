@@ -50,6 +50,13 @@ namespace Server
  */
 Server::Command::Configuration::LoadFromBackupRequest   ConfigurationControllerBasis::kLoadFromBackupRequest;
 
+/**
+ *  Class-scoped server query changed configuration command request regular
+ *  expression.
+ *
+ */
+Server::Command::Configuration::QueryChangedRequest     ConfigurationControllerBasis::kQueryChangedRequest;
+
 /**
  *  Class-scoped server query current configuration command request regular
  *  expression.
@@ -71,6 +78,19 @@ Server::Command::Configuration::ResetToDefaultsRequest  ConfigurationControllerB
  */
 Server::Command::Configuration::SaveToBackupRequest     ConfigurationControllerBasis::kSaveToBackupRequest;
 
+/**
+ *  Class-scoped server subscribe command request regular expression.
+ *
+ */
+Server::Command::Configuration::SubscribeRequest        ConfigurationControllerBasis::kSubscribeRequest;
+
+/**
+ *  Class-scoped server subscribe all command request regular
+ *  expression.
+ *
+ */
+Server::Command::Configuration::SubscribeAllRequest     ConfigurationControllerBasis::kSubscribeAllRequest;
+
 /**
  *  @brief
  *    This is the class default constructor.
@@ -141,6 +161,9 @@ ConfigurationControllerBasis :: RequestInit(void)
     lRetval = kLoadFromBackupRequest.Init();
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    lRetval = kQueryChangedRequest.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
     lRetval = kQueryCurrentRequest.Init();
     nlREQUIRE_SUCCESS(lRetval, done);
 
@@ -150,6 +173,12 @@ ConfigurationControllerBasis :: RequestInit(void)
     lRetval = kSaveToBackupRequest.Init();
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    lRetval = kSubscribeRequest.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = kSubscribeAllRequest.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
 done:
     return (lRetval);
 }
@@ -65,9 +65,12 @@ private:
 
 protected:
     static Server::Command::Configuration::LoadFromBackupRequest   kLoadFromBackupRequest;
+    static Server::Command::Configuration::QueryChangedRequest     kQueryChangedRequest;
     static Server::Command::Configuration::QueryCurrentRequest     kQueryCurrentRequest;
     static Server::Command::Configuration::ResetToDefaultsRequest  kResetToDefaultsRequest;
     static Server::Command::Configuration::SaveToBackupRequest     kSaveToBackupRequest;
+    static Server::Command::Configuration::SubscribeRequest        kSubscribeRequest;
+    static Server::Command::Configuration::SubscribeAllRequest     kSubscribeAllRequest;
 };
 
 }; // namespace Server
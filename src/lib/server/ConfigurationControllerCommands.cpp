@@ -25,6 +25,9 @@
 
 #include "ConfigurationControllerCommands.hpp"
 
+#include <string>
+
+#include <OpenHLX/Common/OutputStringStream.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
 
@@ -46,6 +49,53 @@ namespace Configuration
 
 // MARK: Observer Requests, Responses, and Commands
 
+/**
+ *  @brief
+ *    This is the class default initializer.
+ *
+ *  This initializes the query changed command request regular
+ *  expression.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+QueryChangedRequest :: Init(void)
+{
+    return (QueryChangedRegularExpressionBasis::Init(*this));
+}
+
+/**
+ *  @brief
+ *    This is the class initializer.
+ *
+ *  This initializes the query changed command response buffer with
+ *  the change sequence number as of the response.
+ *
+ *  @param[in]  aSequence  An immutable reference to the change
+ *                         sequence number as of the response.
+ *
+ *  @retval  kStatus_Success              If successful.
+ *  @retval  -ENOMEM                      If memory could not be allocated.
+ *  @retval  kError_InitializationFailed  If initialization otherwise failed.
+ *
+ */
+Status
+QueryChangedResponse :: Init(const Model::ChangeSequence::SequenceType &aSequence)
+{
+    static const char * const kQueryChangedOperation = "QD";
+    OutputStringStream        lSequenceStream;
+    std::string               lBuffer;
+
+
+    lSequenceStream << aSequence;
+
+    lBuffer = kQueryChangedOperation;
+    lBuffer += lSequenceStream.str();
+
+    return (ResponseBasis::Init(lBuffer.c_str(), lBuffer.size()));
+}
+
 /**
  *  @brief
  *    This is the class default initializer.
@@ -207,6 +257,97 @@ SavingToBackupResponse :: Init(void)
     return (ResponseBasis::Init(kBuffer));
 }
 
+// MARK: Subscription Mutator Requests, Responses, and Commands
+
+/**
+ *  @brief
+ *    This is the class default initializer.
+ *
+ *  This initializes the subscribe command request regular expression.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+SubscribeRequest :: Init(void)
+{
+    return (SubscribeRegularExpressionBasis::Init(*this));
+}
+
+/**
+ *  @brief
+ *    This is the class initializer.
+ *
+ *  This initializes the subscribe command response buffer with the
+ *  specified object designator and identifiers.
+ *
+ *  @param[in]  aObject             A pointer to the start of the
+ *                                  object designator (for example,
+ *                                  "O").
+ *  @param[in]  aObjectLength       An immutable reference to the
+ *                                  length, in bytes, of the object
+ *                                  designator.
+ *  @param[in]  aIdentifiers        A pointer to the start of the
+ *                                  comma-separated object identifiers
+ *                                  (for example, "1,7").
+ *  @param[in]  aIdentifiersLength  An immutable reference to the
+ *                                  length, in bytes, of the object
+ *                                  identifiers.
+ *
+ *  @retval  kStatus_Success              If successful.
+ *  @retval  -ENOMEM                      If memory could not be allocated.
+ *  @retval  kError_InitializationFailed  If initialization otherwise failed.
+ *
+ */
+Status
+SubscribeResponse :: Init(const char *aObject, const size_t &aObjectLength, const char *aIdentifiers, const size_t &aIdentifiersLength)
+{
+    static const char * const kSubscribeOperation = "SUB";
+    std::string               lBuffer;
+
+
+    lBuffer = kSubscribeOperation;
+    lBuffer.append(aObject, aObjectLength);
+    lBuffer.append(aIdentifiers, aIdentifiersLength);
+
+    return (ResponseBasis::Init(lBuffer.c_str(), lBuffer.size()));
+}
+
+/**
+ *  @brief
+ *    This is the class default initializer.
+ *
+ *  This initializes the subscribe all command request regular
+ *  expression.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+SubscribeAllRequest :: Init(void)
+{
+    return (SubscribeAllRegularExpressionBasis::Init(*this));
+}
+
+/**
+ *  @brief
+ *    This is the class default initializer.
+ *
+ *  This initializes the subscribe all command response buffer.
+ *
+ *  @retval  kStatus_Success              If successful.
+ *  @retval  -ENOMEM                      If memory could not be allocated.
+ *  @retval  kError_InitializationFailed  If initialization otherwise failed.
+ *
+ */
+Status
+SubscribeAllResponse :: Init(void)
+{
+    static const char * const kBuffer = "SUBX";
+
+    return (ResponseBasis::Init(kBuffer));
+}
+
 }; // namespace Configuration
 
 }; // namespace Command
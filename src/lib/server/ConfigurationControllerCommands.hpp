@@ -28,9 +28,11 @@
 
 #include <OpenHLX/Common/CommandConfigurationRegularExpressionBases.hpp>
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
 
 #include "CommandQueryResponseBasis.hpp"
 #include "CommandRequestBasis.hpp"
+#include "CommandResponseBasis.hpp"
 
 
 namespace HLX
@@ -47,6 +49,57 @@ namespace Configuration
 
 // MARK: Observer Requests, Responses, and Commands
 
+/**
+ *  @brief
+ *    A object for a HLX server query changed configuration command
+ *    request regular expression.
+ *
+ *  @ingroup server
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class QueryChangedRequest :
+    public RequestBasis,
+    public Common::Command::Configuration::QueryChangedRegularExpressionBasis
+{
+public:
+    QueryChangedRequest(void) = default;
+    virtual ~QueryChangedRequest(void) = default;
+
+    Common::Status Init(void);
+
+private:
+    // Explicitly hide base class initializers
+
+    using RequestBasis::Init;
+};
+
+/**
+ *  @brief
+ *    An object for a HLX server query changed configuration command
+ *    response buffer.
+ *
+ *  @ingroup server
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class QueryChangedResponse :
+    public ResponseBasis
+{
+public:
+    QueryChangedResponse(void) = default;
+    virtual ~QueryChangedResponse(void) = default;
+
+    Common::Status Init(const Model::ChangeSequence::SequenceType &aSequence);
+
+private:
+    // Explicitly hide base class initializers
+
+    using ResponseBasis::Init;
+};
+
 /**
  *  @brief
  *    A object for a HLX server query current configuration command
@@ -278,6 +331,108 @@ private:
     using ResponseBasis::Init;
 };
 
+// MARK: Subscription Mutator Requests, Responses, and Commands
+
+/**
+ *  @brief
+ *    A object for a HLX server subscribe command request regular
+ *    expression.
+ *
+ *  @ingroup server
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class SubscribeRequest :
+    public RequestBasis,
+    public Common::Command::Configuration::SubscribeRegularExpressionBasis
+{
+public:
+    SubscribeRequest(void) = default;
+    virtual ~SubscribeRequest(void) = default;
+
+    Common::Status Init(void);
+
+private:
+    // Explicitly hide base class initializers
+
+    using RequestBasis::Init;
+};
+
+/**
+ *  @brief
+ *    A object for a HLX server subscribe command response buffer.
+ *
+ *  @ingroup server
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class SubscribeResponse :
+    public ResponseBasis
+{
+public:
+    SubscribeResponse(void) = default;
+    virtual ~SubscribeResponse(void) = default;
+
+    Common::Status Init(const char *aObject, const size_t &aObjectLength, const char *aIdentifiers, const size_t &aIdentifiersLength);
+
+private:
+    // Explicitly hide base class initializers
+
+    using ResponseBasis::Init;
+};
+
+/**
+ *  @brief
+ *    A object for a HLX server subscribe all command request regular
+ *    expression.
+ *
+ *  @ingroup server
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class SubscribeAllRequest :
+    public RequestBasis,
+    public Common::Command::Configuration::SubscribeAllRegularExpressionBasis
+{
+public:
+    SubscribeAllRequest(void) = default;
+    virtual ~SubscribeAllRequest(void) = default;
+
+    Common::Status Init(void);
+
+private:
+    // Explicitly hide base class initializers
+
+    using RequestBasis::Init;
+};
+
+/**
+ *  @brief
+ *    A object for a HLX server subscribe all command response buffer.
+ *
+ *  @ingroup server
+ *  @ingroup command
+ *  @ingroup configuration
+ *
+ */
+class SubscribeAllResponse :
+    public ResponseBasis
+{
+public:
+    SubscribeAllResponse(void) = default;
+    virtual ~SubscribeAllResponse(void) = default;
+
+    Common::Status Init(void);
+
+private:
+    // Explicitly hide base class initializers
+
+    using ResponseBasis::Init;
+};
+
 }; // namespace Configuration
 
 }; // namespace Command
@@ -48,8 +48,12 @@
 #include <netlink/route/route.h>
 #endif
 
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
 #include <sys/types.h>
 
+#include <CoreFoundation/CFRunLoop.h>
 #include <CoreFoundation/CFURL.h>
 
 #include <CFUtilities/CFUtilities.hpp>
@@ -69,12 +73,42 @@ using namespace HLX::Utilities;
 using namespace Nuovations;
 
 
+// Preprocessor Defintions
+
+/**
+ *  @def CORK_OPTION
+ *
+ *  @brief
+ *    A portability mnemonic to address platforms which name the TCP
+ *    socket option for holding back partial segments differently
+ *    (TCP_CORK on Linux, TCP_NOPUSH on BSD and Darwin) or do not
+ *    have it at all.
+ *
+ */
+#if defined(TCP_CORK)
+#define CORK_OPTION TCP_CORK
+#elif defined(TCP_NOPUSH)
+#define CORK_OPTION TCP_NOPUSH
+#endif
+
+
 namespace HLX
 {
 
 namespace Server
 {
 
+// Global Variables
+
+// The initial capacity, in bytes, of the connection transmit buffer
+// in which data transmitted within a single run loop iteration is
+// coalesced. Data beyond this within a single iteration is written
+// early, with the socket corked such that it still goes out in full
+// segments. The buffer only grows beyond this to hold data the peer
+// could not yet accept.
+
+static const size_t kTransmitBufferCapacity = 4096;
+
 namespace Detail
 {
 
@@ -748,7 +782,15 @@ ConnectionBasis :: ConnectionBasis(CFStringRef aSchemeRef) :
     mIdentifier(0),
     mConnectedSocket(-1),
     mState(kState_Unknown),
-    mDelegate(nullptr)
+    mDelegate(nullptr),
+    mSubscriptionFilter(),
+    mWorker(nullptr),
+    mCoalescing(true),
+    mTransmitCorked(false),
+    mTransmitBlocked(false),
+    mTransmitScheduled(false),
+    mTransmitObserverRef(nullptr),
+    mTransmitBuffer()
 {
     return;
 }
@@ -764,6 +806,18 @@ ConnectionBasis :: ~ConnectionBasis(void)
 
     mDelegate = nullptr;
 
+    // Invalidating the transmit observer also removes it from any
+    // run loop it is still scheduled on.
+
+    if (mTransmitObserverRef != nullptr)
+    {
+        CFRunLoopObserverInvalidate(mTransmitObserverRef);
+
+        CFURelease(mTransmitObserverRef);
+
+        mTransmitObserverRef = nullptr;
+    }
+
     SetState(kState_Unknown);
 
     return;
@@ -796,6 +850,9 @@ ConnectionBasis :: Init(const RunLoopParameters &aRunLoopParameters, const Ident
     lRetval = Common::ConnectionBasis::Init(aRunLoopParameters);
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    lRetval = mSubscriptionFilter.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
     mIdentifier        = aIdentifier;
     mState             = kState_Ready;
 
@@ -847,6 +904,23 @@ ConnectionBasis :: Connect(const int &aSocket, const Common::SocketAddress &aPee
 
     mConnectedSocket = aSocket;
 
+    // Since transmitted data is coalesced per run loop iteration,
+    // Nagle's algorithm would only further delay each coalesced write
+    // pending acknowledgement of the prior one, so disable it on TCP
+    // connections. This is advisory and failure is not fatal.
+
+    if (mCoalescing &&
+        ((aPeerAddress.uSocketAddress.sa_family == AF_INET) ||
+         (aPeerAddress.uSocketAddress.sa_family == AF_INET6)))
+    {
+        const Status lStatus = SetNoDelay(true);
+
+        if (lStatus != kStatus_Success)
+        {
+            Log::Debug().Write("Could not disable Nagle on socket %d: %d\n", aSocket, lStatus);
+        }
+    }
+
  done:
     return (lRetval);
 }
@@ -875,12 +949,26 @@ ConnectionBasis :: Disconnect(void)
  *    Attempt to close the socket associated with the HLX client peer.
  *
  *  If the socket associated with the HLX client peer is open, this
- *  closes it.
+ *  closes it. Any data coalesced for transmission but not yet written
+ *  is discarded.
  *
  */
 void
 ConnectionBasis :: Close(void)
 {
+    // Any data still coalesced for transmission can no longer be
+    // written, so discard it.
+
+    UnscheduleFlushTransmit();
+
+    if (mTransmitBuffer != nullptr)
+    {
+        mTransmitBuffer->Flush();
+    }
+
+    mTransmitCorked  = false;
+    mTransmitBlocked = false;
+
     if (mConnectedSocket != -1)
     {
         close(mConnectedSocket);
@@ -1127,6 +1215,607 @@ ConnectionBasis :: GetIdentifier(void) const
     return (mIdentifier);
 }
 
+/**
+ *  @brief
+ *    Returns the subscription filter for the connection.
+ *
+ *  @returns
+ *    A mutable reference to the filter by which the server command
+ *    responses and state change notifications sent to the connection
+ *    are limited to the objects to which it subscribes.
+ *
+ */
+SubscriptionFilter &
+ConnectionBasis :: GetSubscriptionFilter(void)
+{
+    return (mSubscriptionFilter);
+}
+
+/**
+ *  @brief
+ *    Returns the subscription filter for the connection.
+ *
+ *  @returns
+ *    An immutable reference to the filter by which the server command
+ *    responses and state change notifications sent to the connection
+ *    are limited to the objects to which it subscribes.
+ *
+ */
+const SubscriptionFilter &
+ConnectionBasis :: GetSubscriptionFilter(void) const
+{
+    return (mSubscriptionFilter);
+}
+
+/**
+ *  @brief
+ *    Returns the worker, if any, to which the connection is sharded.
+ *
+ *  @returns
+ *    A pointer to the worker on whose run loop the input and output
+ *    of the connection is performed, if the connection is sharded;
+ *    otherwise, null.
+ *
+ */
+ConnectionWorker *
+ConnectionBasis :: GetWorker(void) const
+{
+    return (mWorker);
+}
+
+/**
+ *  @brief
+ *    Set the worker to which the connection is sharded.
+ *
+ *  This sets the worker on whose run loop the input and output of
+ *  the connection is performed and to which any data sent from
+ *  another thread is posted.
+ *
+ *  @note
+ *    This must be set, if at all, before the connection is connected.
+ *
+ *  @param[in]  aWorker  A pointer to the worker to set.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the worker was already set to
+ *                                    the specified value.
+ *
+ */
+Status
+ConnectionBasis :: SetWorker(ConnectionWorker *aWorker)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION(aWorker != mWorker, done, lRetval = kStatus_ValueAlreadySet);
+
+    mWorker = aWorker;
+
+done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Determine whether the connection coalesces transmitted data.
+ *
+ *  @returns
+ *    True if data transmitted within a single run loop iteration is
+ *    coalesced and written once at the end of that iteration;
+ *    otherwise, false, if it is written immediately.
+ *
+ */
+bool
+ConnectionBasis :: IsCoalescing(void) const
+{
+    return (mCoalescing);
+}
+
+/**
+ *  @brief
+ *    Set whether the connection coalesces transmitted data.
+ *
+ *  When coalescing is disabled, any data already coalesced is written
+ *  immediately.
+ *
+ *  @note
+ *    This does not change whether Nagle's algorithm is disabled for
+ *    the connection; use #SetNoDelay to do so explicitly.
+ *
+ *  @param[in]  aCoalescing  An immutable reference indicating whether
+ *                           data transmitted within a single run loop
+ *                           iteration should be coalesced and written
+ *                           once at the end of that iteration.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If coalescing was already set to
+ *                                    the specified value.
+ *
+ */
+Status
+ConnectionBasis :: SetCoalescing(const bool &aCoalescing)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION(aCoalescing != mCoalescing, done, lRetval = kStatus_ValueAlreadySet);
+
+    if (!aCoalescing)
+    {
+        FlushTransmit();
+    }
+
+    mCoalescing = aCoalescing;
+
+done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Set whether Nagle's algorithm is disabled for the connection.
+ *
+ *  @param[in]  aNoDelay  An immutable reference indicating whether
+ *                        Nagle's algorithm should be disabled (that
+ *                        is, TCP_NODELAY set) such that partial
+ *                        segments are sent without waiting for the
+ *                        acknowledgement of prior ones.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOTCONN        If the connection is not connected.
+ *  @retval  -errno           The system error associated with setting
+ *                            the option, for example, if the
+ *                            connection socket is not a TCP socket.
+ *
+ */
+Status
+ConnectionBasis :: SetNoDelay(const bool &aNoDelay)
+{
+    const int  lValue = aNoDelay;
+    int        lStatus;
+    Status     lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mConnectedSocket != -1, done, lRetval = -ENOTCONN);
+
+    lStatus = setsockopt(mConnectedSocket, IPPROTO_TCP, TCP_NODELAY, &lValue, sizeof (lValue));
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Set whether partial segments are held back for the connection.
+ *
+ *  While corked (that is, TCP_CORK or TCP_NOPUSH set), partial
+ *  segments are held back until either a full segment is available
+ *  or the connection is uncorked, at which point any remaining
+ *  partial segment is sent immediately.
+ *
+ *  @param[in]  aCork  An immutable reference indicating whether
+ *                     partial segments should be held back.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOTCONN        If the connection is not connected.
+ *  @retval  -ENOTSUP         If the platform does not support
+ *                            holding back partial segments.
+ *  @retval  -errno           The system error associated with setting
+ *                            the option, for example, if the
+ *                            connection socket is not a TCP socket.
+ *
+ */
+Status
+ConnectionBasis :: SetCork(const bool &aCork)
+{
+    Status     lRetval = kStatus_Success;
+#if defined(CORK_OPTION)
+    const int  lValue = aCork;
+    int        lStatus;
+
+    nlREQUIRE_ACTION(mConnectedSocket != -1, done, lRetval = -ENOTCONN);
+
+    lStatus = setsockopt(mConnectedSocket, IPPROTO_TCP, CORK_OPTION, &lValue, sizeof (lValue));
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+#else
+    (void)aCork;
+
+    nlREQUIRE_ACTION(mConnectedSocket != -1, done, lRetval = -ENOTCONN);
+
+    lRetval = -ENOTSUP;
+#endif // defined(CORK_OPTION)
+
+done:
+    return (lRetval);
+}
+
+// MARK: Transmit Coalescing
+
+/**
+ *  @brief
+ *    Transmit the specified data to the connection peer.
+ *
+ *  If the connection is coalescing, the data is copied to the
+ *  transmit buffer and written, together with any other data
+ *  transmitted within the current run loop iteration, at the end of
+ *  that iteration. Otherwise, the data is written immediately.
+ *
+ *  If the data does not fit in the transmit buffer, the buffer is
+ *  written early, with the connection corked until the end of the
+ *  iteration such that the early write does not go out as a partial
+ *  segment.
+ *
+ *  Any data the peer cannot yet accept is kept in the transmit
+ *  buffer, with any data transmitted subsequently queued behind it,
+ *  until the connection resumes transmission with #ResumeTransmit.
+ *
+ *  @param[in]  aBuffer  A pointer to the data to transmit.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data to transmit.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If memory could not be allocated.
+ *  @retval  -ENOSPC          If the data could not be copied to the
+ *                            transmit buffer.
+ *
+ */
+Status
+ConnectionBasis :: Transmit(const uint8_t *aBuffer, const size_t &aSize)
+{
+    Status lRetval = kStatus_Success;
+
+    // While the peer cannot accept data, queue the data behind that
+    // it has yet to accept, preserving the order in which it was
+    // transmitted.
+
+    if (mTransmitBlocked)
+    {
+        lRetval = PutTransmit(aBuffer, aSize);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        goto done;
+    }
+
+    if (!mCoalescing)
+    {
+        lRetval = WriteTransmit(aBuffer, aSize);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        goto done;
+    }
+
+    // Allocate and initialize the transmit buffer on-demand, if one
+    // is not already in use.
+
+    if (!mTransmitBuffer)
+    {
+        lRetval = ConnectionBuffer::Create(mTransmitBuffer, kTransmitBufferCapacity);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    if (aSize > (mTransmitBuffer->GetCapacity() - mTransmitBuffer->GetSize()))
+    {
+        if (!mTransmitCorked)
+        {
+            mTransmitCorked = (SetCork(true) == kStatus_Success);
+        }
+
+        if (mTransmitBuffer->GetSize() > 0)
+        {
+            WriteTransmitBuffer();
+        }
+
+        // Data that would not fit even in an empty transmit buffer is
+        // written directly rather than copied in pieces, unless the
+        // peer could not accept all of the buffer, in which case it
+        // is queued behind it.
+
+        if (!mTransmitBlocked && (aSize > mTransmitBuffer->GetCapacity()))
+        {
+            lRetval = WriteTransmit(aBuffer, aSize);
+            nlREQUIRE_SUCCESS(lRetval, done);
+
+            goto schedule;
+        }
+    }
+
+    lRetval = PutTransmit(aBuffer, aSize);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ schedule:
+    lRetval = ScheduleFlushTransmit();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Write any data coalesced for transmission to the connection
+ *    peer.
+ *
+ *  This writes any data coalesced in the transmit buffer, unless the
+ *  peer has yet to accept prior data, and, if the connection was
+ *  corked for an early write, uncorks it such that the final partial
+ *  segment is sent immediately.
+ *
+ */
+void
+ConnectionBasis :: FlushTransmit(void)
+{
+    UnscheduleFlushTransmit();
+
+    if (!mTransmitBlocked && (mTransmitBuffer != nullptr) && (mTransmitBuffer->GetSize() > 0))
+    {
+        WriteTransmitBuffer();
+    }
+
+    if (mTransmitCorked)
+    {
+        SetCork(false);
+
+        mTransmitCorked = false;
+    }
+}
+
+/**
+ *  @brief
+ *    Resume writing data the connection peer could not previously
+ *    accept.
+ *
+ *  This is invoked by the connection once the peer can again accept
+ *  data after a write of which it accepted less than all. It writes
+ *  as much of the data pending in the transmit buffer as the peer
+ *  will now accept, keeping any remainder for a subsequent
+ *  resumption.
+ *
+ */
+void
+ConnectionBasis :: ResumeTransmit(void)
+{
+    nlEXPECT(mTransmitBlocked, done);
+
+    mTransmitBlocked = false;
+
+    if ((mTransmitBuffer != nullptr) && (mTransmitBuffer->GetSize() > 0))
+    {
+        WriteTransmitBuffer();
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Return whether the connection has data its peer could not yet
+ *    accept.
+ *
+ *  @returns
+ *    True if the connection has data pending that its peer could not
+ *    yet accept and is awaiting #ResumeTransmit; otherwise, false.
+ *
+ */
+bool
+ConnectionBasis :: IsTransmitBlocked(void) const
+{
+    return (mTransmitBlocked);
+}
+
+/**
+ *  @brief
+ *    Write the specified data to the connection peer, keeping any
+ *    the peer does not accept.
+ *
+ *  @param[in]  aBuffer  A pointer to the data to write.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data to write.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If memory could not be allocated for the
+ *                            data not accepted.
+ *  @retval  -ENOSPC          If the data not accepted could not be
+ *                            copied to the transmit buffer.
+ *
+ */
+Status
+ConnectionBasis :: WriteTransmit(const uint8_t *aBuffer, const size_t &aSize)
+{
+    size_t  lWritten;
+    Status  lRetval = kStatus_Success;
+
+    lWritten = ShouldTransmitDataHandler(aBuffer, aSize);
+
+    if (lWritten < aSize)
+    {
+        mTransmitBlocked = true;
+
+        lRetval = PutTransmit(aBuffer + lWritten, aSize - lWritten);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Write the data in the transmit buffer to the connection peer,
+ *    keeping any the peer does not accept.
+ *
+ */
+void
+ConnectionBasis :: WriteTransmitBuffer(void)
+{
+    size_t  lWritten;
+
+    lWritten = ShouldTransmitDataHandler(mTransmitBuffer->GetHead(), mTransmitBuffer->GetSize());
+
+    if (lWritten < mTransmitBuffer->GetSize())
+    {
+        mTransmitBlocked = true;
+    }
+
+    mTransmitBuffer->Get(lWritten);
+}
+
+/**
+ *  @brief
+ *    Copy the specified data to the transmit buffer, growing the
+ *    buffer as needed.
+ *
+ *  @param[in]  aBuffer  A pointer to the data to copy.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data to copy.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If memory could not be allocated.
+ *  @retval  -ENOSPC          If the data could not be copied to the
+ *                            transmit buffer.
+ *
+ */
+Status
+ConnectionBasis :: PutTransmit(const uint8_t *aBuffer, const size_t &aSize)
+{
+    uint8_t *  lPut;
+    Status     lRetval = kStatus_Success;
+
+    if (!mTransmitBuffer)
+    {
+        lRetval = ConnectionBuffer::Create(mTransmitBuffer, kTransmitBufferCapacity);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    if (aSize > (mTransmitBuffer->GetCapacity() - mTransmitBuffer->GetSize()))
+    {
+        lRetval = mTransmitBuffer->Reserve(mTransmitBuffer->GetSize() + aSize);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    lPut = mTransmitBuffer->Put(aBuffer, aSize);
+    nlREQUIRE_ACTION(lPut != nullptr, done, lRetval = -ENOSPC);
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Schedule a write of coalesced data at the end of the current
+ *    run loop iteration.
+ *
+ *  This schedules a run loop observer, creating it on first use, for
+ *  the points at which the run loop finishes an iteration: when it is
+ *  about to wait, when it starts the next iteration (which it may do
+ *  without waiting if sources remain ready), and when it exits. The
+ *  observer is only scheduled while there is data to write, such
+ *  that idle connections add no run loop overhead.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If the run loop observer could not be
+ *                            allocated.
+ *
+ */
+Status
+ConnectionBasis :: ScheduleFlushTransmit(void)
+{
+    const CFOptionFlags       kActivities = (kCFRunLoopBeforeTimers  |
+                                             kCFRunLoopBeforeWaiting |
+                                             kCFRunLoopExit);
+    constexpr Boolean         kRepeats    = true;
+    constexpr CFIndex         kOrder      = 0;
+    CFRunLoopObserverContext  lObserverContext = { 0, this, nullptr, nullptr, nullptr };
+    Status                    lRetval = kStatus_Success;
+
+    nlEXPECT(!mTransmitScheduled, done);
+
+    if (mTransmitObserverRef == nullptr)
+    {
+        mTransmitObserverRef = CFRunLoopObserverCreate(kCFAllocatorDefault,
+                                                       kActivities,
+                                                       kRepeats,
+                                                       kOrder,
+                                                       ConnectionBasis::CFRunLoopObserverCallback,
+                                                       &lObserverContext);
+        nlREQUIRE_ACTION(mTransmitObserverRef != nullptr, done, lRetval = -ENOMEM);
+    }
+
+    CFRunLoopAddObserver(GetRunLoopParameters().GetRunLoop(),
+                         mTransmitObserverRef,
+                         GetRunLoopParameters().GetRunLoopMode());
+
+    mTransmitScheduled = true;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Unschedule any pending write of coalesced data.
+ *
+ */
+void
+ConnectionBasis :: UnscheduleFlushTransmit(void)
+{
+    nlEXPECT(mTransmitScheduled, done);
+
+    CFRunLoopRemoveObserver(GetRunLoopParameters().GetRunLoop(),
+                            mTransmitObserverRef,
+                            GetRunLoopParameters().GetRunLoopMode());
+
+    mTransmitScheduled = false;
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Callback to handle the end of a run loop iteration with data
+ *    coalesced for transmission.
+ *
+ *  @param[in]  aObserver  A reference to the run loop observer that
+ *                         triggered the callback.
+ *  @param[in]  aActivity  The run loop activity that triggered the
+ *                         callback.
+ *
+ */
+void
+ConnectionBasis :: CFRunLoopObserverCallback(CFRunLoopObserverRef aObserver, CFRunLoopActivity aActivity)
+{
+    (void)aObserver;
+    (void)aActivity;
+
+    FlushTransmit();
+}
+
+/**
+ *  @brief
+ *    Callback trampoline to handle the end of a run loop iteration
+ *    with data coalesced for transmission.
+ *
+ *  @param[in]  aObserver  A reference to the run loop observer that
+ *                         triggered the callback.
+ *  @param[in]  aActivity  The run loop activity that triggered the
+ *                         callback.
+ *  @param[in]  aContext   A pointer to the connection class instance
+ *                         that registered this trampoline to call
+ *                         back into from the trampoline.
+ *
+ */
+void
+ConnectionBasis :: CFRunLoopObserverCallback(CFRunLoopObserverRef aObserver, CFRunLoopActivity aActivity, void *aContext)
+{
+    ConnectionBasis *lConnection = static_cast<ConnectionBasis *>(aContext);
+
+    if (lConnection != nullptr)
+    {
+        lConnection->CFRunLoopObserverCallback(aObserver, aActivity);
+    }
+
+    return;
+}
+
 /**
  *  @brief
  *    Get the network configuration associated with the
@@ -1322,6 +2011,21 @@ ConnectionBasis :: GetConfiguration(Common::IPAddress &aHostAddress,
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Returns whether or not the connection is connected to its peer.
+ *
+ *  @returns
+ *    True if the connection is connected to its peer; otherwise,
+ *    false.
+ *
+ */
+bool
+ConnectionBasis :: IsConnected(void) const
+{
+    return (IsState(kState_Connected));
+}
+
 /**
  *  @brief
  *    Returns whether or not the connection is in the specified state.
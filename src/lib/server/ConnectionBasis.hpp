@@ -27,7 +27,9 @@
 #define OPENHLXSERVERCONNECTIONBASIS_HPP
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <CoreFoundation/CFRunLoop.h>
 #include <CoreFoundation/CFSocket.h>
 #include <CoreFoundation/CFURL.h>
 
@@ -41,6 +43,7 @@
 #include <OpenHLX/Common/SocketAddress.hpp>
 #include <OpenHLX/Common/Timeout.hpp>
 #include <OpenHLX/Model/NetworkModel.hpp>
+#include <OpenHLX/Server/SubscriptionFilter.hpp>
 
 
 namespace HLX
@@ -50,11 +53,20 @@ namespace Server
 {
 
 class ConnectionBasisDelegate;
+class ConnectionWorker;
 
 /**
  *  @brief
  *    An object for a HLX server peer-to-peer network connection.
  *
+ *  By default, data transmitted by a connection within a single run
+ *  loop iteration is coalesced and written to the peer once, at the
+ *  end of that iteration, such that a multi-part response or a burst
+ *  of notifications goes out in as few segments as possible. Since
+ *  the connection coalesces its own writes, Nagle's algorithm is
+ *  disabled on TCP connections so that it does not further delay
+ *  the coalesced writes pending acknowledgements from the peer.
+ *
  *  @ingroup server
  *
  */
@@ -78,10 +90,22 @@ public:
             void           Close(void);
 
     IdentifierType GetIdentifier(void) const;
+    bool IsConnected(void) const;
+
+    SubscriptionFilter &GetSubscriptionFilter(void);
+    const SubscriptionFilter &GetSubscriptionFilter(void) const;
+
+    ConnectionWorker *GetWorker(void) const;
+    Common::Status SetWorker(ConnectionWorker *aWorker);
 
     Common::Status SetDelegate(ConnectionBasisDelegate *aDelegate);
     ConnectionBasisDelegate *GetDelegate(void) const;
 
+    bool IsCoalescing(void) const;
+    Common::Status SetCoalescing(const bool &aCoalescing);
+    Common::Status SetNoDelay(const bool &aNoDelay);
+    Common::Status SetCork(const bool &aCork);
+
     Common::Status GetConfiguration(Model::NetworkModel::EthernetEUI48Type &aEthernetEUI48,
                                     Common::IPAddress &aHostAddress,
                                     Common::IPAddress &aNetmask,
@@ -94,6 +118,11 @@ public:
      *  @brief
      *    Send the specified data to the connection peer.
      *
+     *  If the connection is sharded to a worker and this is called
+     *  from another thread, the data is posted to the worker to be
+     *  sent asynchronously and, therefore, must not be mutated once
+     *  sent.
+     *
      *  @param[in]  aBuffer  An immutable shared pointer to the data to
      *                       send to the connection peer.
      *
@@ -102,6 +131,8 @@ public:
      */
     virtual Common::Status Send(Common::ConnectionBuffer::ImmutableCountedPointer aBuffer) = 0;
 
+    static void CFRunLoopObserverCallback(CFRunLoopObserverRef aObserver, CFRunLoopActivity aActivity, void *aContext);
+
 protected:
     ConnectionBasis(CFStringRef aSchemeRef);
 
@@ -118,6 +149,35 @@ protected:
 
     void OnError(const Common::Error &aError);
 
+    Common::Status Transmit(const uint8_t *aBuffer, const size_t &aSize);
+    void           FlushTransmit(void);
+    void           ResumeTransmit(void);
+    bool           IsTransmitBlocked(void) const;
+
+    /**
+     *  @brief
+     *    Write the specified data to the connection peer.
+     *
+     *  This is invoked, with data coalesced from one or more calls to
+     *  #Transmit, once per run loop iteration or whenever the
+     *  coalesced data would otherwise exceed the transmit buffer
+     *  capacity, or immediately from #Transmit if coalescing is
+     *  disabled.
+     *
+     *  If the peer accepts less than all of the data, the remainder
+     *  is kept and the connection must invoke #ResumeTransmit once
+     *  the peer can again accept data.
+     *
+     *  @param[in]  aBuffer  A pointer to the data to write.
+     *  @param[in]  aSize    An immutable reference to the size, in
+     *                       bytes, of the data to write.
+     *
+     *  @returns
+     *    The number of bytes of the data the peer accepted.
+     *
+     */
+    virtual size_t ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize) = 0;
+
     /**
      *  @brief
      *    Enumeration of connection states.
@@ -148,11 +208,26 @@ protected:
 private:
     Common::Status GetConfiguration(Model::NetworkModel::EthernetEUI48Type *aEthernetEUI48, Common::IPAddress &aHostAddress, Common::IPAddress &aNetmask, Common::IPAddress &aDefaultRouterAddress) const;
 
+    Common::Status WriteTransmit(const uint8_t *aBuffer, const size_t &aSize);
+    void           WriteTransmitBuffer(void);
+    Common::Status PutTransmit(const uint8_t *aBuffer, const size_t &aSize);
+    Common::Status ScheduleFlushTransmit(void);
+    void           UnscheduleFlushTransmit(void);
+    void           CFRunLoopObserverCallback(CFRunLoopObserverRef aObserver, CFRunLoopActivity aActivity);
+
 private:
-    IdentifierType             mIdentifier;
-    CFSocketNativeHandle       mConnectedSocket;
-    State                      mState;
-    ConnectionBasisDelegate *  mDelegate;
+    IdentifierType                                   mIdentifier;
+    CFSocketNativeHandle                             mConnectedSocket;
+    State                                            mState;
+    ConnectionBasisDelegate *                        mDelegate;
+    SubscriptionFilter                               mSubscriptionFilter;
+    ConnectionWorker *                               mWorker;
+    bool                                             mCoalescing;
+    bool                                             mTransmitCorked;
+    bool                                             mTransmitBlocked;
+    bool                                             mTransmitScheduled;
+    CFRunLoopObserverRef                             mTransmitObserverRef;
+    Common::ConnectionBuffer::MutableCountedPointer  mTransmitBuffer;
 };
 
 }; // namespace Server
@@ -29,7 +29,9 @@
 #include <LogUtilities/LogUtilities.hpp>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Server/ConnectionTCP.hpp>
 #include <OpenHLX/Server/ConnectionTelnet.hpp>
+#include <OpenHLX/Server/ConnectionUnix.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
 
@@ -114,7 +116,9 @@ ConnectionFactory :: SupportsScheme(CFStringRef aSchemeRef) const
     const CFString lRequestedScheme(aSchemeRef);
     bool lRetval = false;
 
-    if (lRequestedScheme == ConnectionTelnet::kScheme)
+    if ((lRequestedScheme == ConnectionTelnet::kScheme) ||
+        (lRequestedScheme == ConnectionTCP::kScheme)    ||
+        (lRequestedScheme == ConnectionUnix::kScheme))
     {
         lRetval = true;
     }
@@ -150,6 +154,16 @@ ConnectionFactory :: CreateConnection(CFStringRef aSchemeRef) const
         lRetval.reset(new ConnectionTelnet());
         nlREQUIRE(lRetval != nullptr, done);
     }
+    else if (lRequestedScheme == ConnectionTCP::kScheme)
+    {
+        lRetval.reset(new ConnectionTCP());
+        nlREQUIRE(lRetval != nullptr, done);
+    }
+    else if (lRequestedScheme == ConnectionUnix::kScheme)
+    {
+        lRetval.reset(new ConnectionUnix());
+        nlREQUIRE(lRetval != nullptr, done);
+    }
 
  done:
     return (lRetval);
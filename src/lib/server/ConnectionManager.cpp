@@ -33,6 +33,8 @@
 #include <errno.h>
 #include <netdb.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #include <arpa/inet.h>
 
@@ -46,6 +48,7 @@
 #include <OpenHLX/Server/ConnectionBasis.hpp>
 #include <OpenHLX/Server/ConnectionTelnet.hpp>
 #include <OpenHLX/Server/ListenerTelnet.hpp>
+#include <OpenHLX/Server/ListenerUnix.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
 
@@ -59,6 +62,72 @@ namespace HLX
 namespace Server
 {
 
+/**
+ *  The maximum number of workers among which the input and output of
+ *  server connections may be sharded.
+ *
+ */
+const size_t ConnectionManager::kWorkersMax = 64;
+
+/**
+ *  The number of workers among which the input and output of server
+ *  connections are sharded.
+ *
+ *  This defaults to none, such that the input and output of server
+ *  connections is performed on the run loop with which the manager is
+ *  initialized.
+ *
+ */
+size_t       ConnectionManager::sWorkers    = 0;
+
+/**
+ *  The maximum number of concurrently-active server connections.
+ *
+ *  This defaults to none (0), such that connections are not limited.
+ *
+ */
+size_t       ConnectionManager::sConnectionsMax = 0;
+
+/**
+ *  The duration, in milliseconds, after which a server connection
+ *  that has received no data is disconnected.
+ *
+ *  This defaults to none (0), such that idle connections are never
+ *  disconnected.
+ *
+ */
+Timeout::Value ConnectionManager::sIdleTimeout = 0;
+
+/**
+ *  The rate, in requests per second, to which the requests of each
+ *  server connection are limited and the burst of requests above that
+ *  rate admitted at once.
+ *
+ *  These default to none (0), such that requests are not limited.
+ *
+ */
+uint32_t     ConnectionManager::sRequestRate  = 0;
+uint32_t     ConnectionManager::sRequestBurst = 0;
+
+/**
+ *  @brief
+ *    Return the current monotonic time, in milliseconds.
+ *
+ *  @returns
+ *    The current monotonic time, in milliseconds.
+ *
+ */
+static TokenBucket::TimeType
+GetMonotonicMilliseconds(void)
+{
+    struct timespec  lNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &lNow);
+
+    return ((static_cast<TokenBucket::TimeType>(lNow.tv_sec) * 1000) +
+            (static_cast<TokenBucket::TimeType>(lNow.tv_nsec) / 1000000));
+}
+
 /**
  *  @brief
  *    This is the class default constructor.
@@ -72,8 +141,20 @@ ConnectionManager :: ConnectionManager(void) :
     mActiveConnections(),
     mInactiveConnections(),
     mDelegates(),
-    mSchemeIdentifierManager()
+    mSchemeIdentifierManager(),
+    mOnSendHandler(nullptr),
+    mOnSendContext(nullptr),
+    mOnDisposeHandler(nullptr),
+    mOnDisposeContext(nullptr),
+    mAdmissionStates(),
+    mAdmissionCounters(),
+    mIdleTimer(),
+    mWorkerPool()
 {
+    mAdmissionCounters.mConnectionsRejected = 0;
+    mAdmissionCounters.mConnectionsEvicted  = 0;
+    mAdmissionCounters.mRequestsRejected    = 0;
+
     return;
 }
 
@@ -88,9 +169,15 @@ ConnectionManager :: ConnectionManager(void) :
  *                                  loop parameters to initialize the
  *                                  connection manager with.
  *
+ *  If a nonzero number of workers has been set, this also starts a
+ *  pool of that many workers among which the input and output of
+ *  server connections are sharded. If an idle timeout has been set,
+ *  this also starts a timer, firing at half that timeout, on which
+ *  idle connections are evicted.
+ *
  *  @retval  kStatus_Success  If successful.
- *  @retval  -ENOMEM          Resources for the connection factory could
- *                            not be allocated.
+ *  @retval  -ENOMEM          Resources for the connection factory or
+ *                            the idle timer could not be allocated.
  *
  */
 Status
@@ -109,12 +196,176 @@ ConnectionManager :: Init(const RunLoopParameters &aRunLoopParameters)
     lRetval = mConnectionFactory.Init(aRunLoopParameters);
     nlREQUIRE_SUCCESS(lRetval, done);
 
+    if (sWorkers > 0)
+    {
+        lRetval = mWorkerPool.Init(aRunLoopParameters, sWorkers, *this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    if (sIdleTimeout > 0)
+    {
+        // Check at half the idle timeout such that an idle connection
+        // is evicted no later than one and a half timeouts after it
+        // last received data.
+
+        const Timeout lInterval(std::max<Timeout::Value>(sIdleTimeout / 2, 1));
+
+        lRetval = mIdleTimer.Init(aRunLoopParameters, lInterval);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = mIdleTimer.SetDelegate(this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = mIdleTimer.Start();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
     mRunLoopParameters = aRunLoopParameters;
 
 done:
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Set the number of workers among which the input and output of
+ *    server connections are sharded.
+ *
+ *  This sets the number of workers, each with a thread and run loop
+ *  of its own, among which the telnet decoding, request framing,
+ *  response encoding, and stream input and output of server
+ *  connections are sharded. Requests continue to be dispatched on the
+ *  run loop with which the manager is initialized. This must be
+ *  called before any connection manager is initialized.
+ *
+ *  @param[in]  aWorkers  The number of workers to set. Zero (0)
+ *                        disables sharding.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *  @retval  -ERANGE                  If the specified value is
+ *                                    larger than supported.
+ *
+ */
+Status
+ConnectionManager :: SetWorkers(const size_t &aWorkers)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlREQUIRE_ACTION(aWorkers <= kWorkersMax, done, lRetval = -ERANGE);
+
+    nlEXPECT_ACTION(sWorkers != aWorkers, done, lRetval = kStatus_ValueAlreadySet);
+
+    sWorkers = aWorkers;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Set the maximum number of concurrently-active server
+ *    connections.
+ *
+ *  This sets the maximum number of server connections that may be
+ *  active at once. Connections accepted beyond that number are
+ *  immediately closed. This must be called before any connection
+ *  manager accepts connections.
+ *
+ *  @param[in]  aConnectionsMax  The maximum number of connections to
+ *                               set. Zero (0) disables the limit.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *
+ */
+Status
+ConnectionManager :: SetConnectionsMax(const size_t &aConnectionsMax)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlEXPECT_ACTION(sConnectionsMax != aConnectionsMax, done, lRetval = kStatus_ValueAlreadySet);
+
+    sConnectionsMax = aConnectionsMax;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Set the duration after which an idle server connection is
+ *    disconnected.
+ *
+ *  This sets the duration, in milliseconds, after which a server
+ *  connection that has received no data from its peer is
+ *  disconnected. This must be called before any connection manager
+ *  is initialized.
+ *
+ *  @param[in]  aMilliseconds  The idle timeout to set, in
+ *                             milliseconds. Zero (0) disables idle
+ *                             eviction.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified value was
+ *                                    already set.
+ *
+ */
+Status
+ConnectionManager :: SetIdleTimeout(const Timeout::Value &aMilliseconds)
+{
+    Status lRetval = kStatus_Success;
+
+
+    nlEXPECT_ACTION(sIdleTimeout != aMilliseconds, done, lRetval = kStatus_ValueAlreadySet);
+
+    sIdleTimeout = aMilliseconds;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Set the rate to which the requests of each server connection are
+ *    limited.
+ *
+ *  This sets the rate, in requests per second, to which the requests
+ *  of each server connection are limited, with bursts of up to the
+ *  specified number of requests admitted at once. Requests in excess
+ *  of the limit are dropped without a response. This must be called
+ *  before any connection manager accepts connections.
+ *
+ *  @param[in]  aRate   The rate to set, in requests per second. Zero
+ *                      (0) disables the limit.
+ *  @param[in]  aBurst  The number of requests admitted at once. Zero
+ *                      (0) defaults to the rate.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the specified values were
+ *                                    already set.
+ *
+ */
+Status
+ConnectionManager :: SetRequestRateLimit(const uint32_t &aRate, const uint32_t &aBurst)
+{
+    const uint32_t  lBurst  = (((aRate > 0) && (aBurst == 0)) ? aRate : aBurst);
+    Status          lRetval = kStatus_Success;
+
+
+    nlEXPECT_ACTION((sRequestRate != aRate) || (sRequestBurst != lBurst), done, lRetval = kStatus_ValueAlreadySet);
+
+    sRequestRate  = aRate;
+    sRequestBurst = lBurst;
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Determine whether the manager supports connections with the
@@ -139,8 +390,31 @@ ConnectionManager :: SupportsScheme(CFStringRef aSchemeRef) const
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Listen for unsolicited, asynchronous connections from HLX client
+ *    peers with the specified protocol scheme at the specified socket
+ *    addresses.
+ *
+ *  @param[in]  aSchemeRef  A reference to a CoreFoundation string
+ *                          containing the protocol (for example,
+ *                          "telnet") scheme with which to listen.
+ *  @param[in]  aFirst      A pointer to the first socket address at
+ *                          which to listen.
+ *  @param[in]  aLast       A pointer to one past the last socket
+ *                          address at which to listen.
+ *
+ *  @retval  kStatus_Success   If successful.
+ *  @retval  -EINVAL           If either socket address pointer was
+ *                             null.
+ *  @retval  -EPROTONOSUPPORT  If the protocol scheme is not
+ *                             supported.
+ *  @retval  -ENOMEM           Resources could not be allocated to
+ *                             listen.
+ *
+ */
 Status
-ConnectionManager :: Listen(const SocketAddress *aFirst, const SocketAddress *aLast)
+ConnectionManager :: Listen(CFStringRef aSchemeRef, const SocketAddress *aFirst, const SocketAddress *aLast)
 {
     const SocketAddress *  lCurrent = aFirst;
     bool                   lSchemeSupported;
@@ -149,14 +423,14 @@ ConnectionManager :: Listen(const SocketAddress *aFirst, const SocketAddress *aL
     nlREQUIRE_ACTION(aFirst != nullptr, done, lRetval = -EINVAL);
     nlREQUIRE_ACTION(aLast != nullptr, done, lRetval = -EINVAL);
 
-    lSchemeSupported = mListenerFactory.SupportsScheme(ListenerTelnet::kScheme);
+    lSchemeSupported = SupportsScheme(aSchemeRef);
     nlREQUIRE_ACTION(lSchemeSupported, done, lRetval = -EPROTONOSUPPORT);
 
     while (lCurrent != aLast)
     {
         Listeners::value_type  lListener;
 
-        lListener = mListenerFactory.CreateListener(ListenerTelnet::kScheme);
+        lListener = mListenerFactory.CreateListener(aSchemeRef);
         nlREQUIRE_ACTION(lListener != nullptr, done, lRetval = -ENOMEM);
 
         lRetval = lListener->Init(mRunLoopParameters);
@@ -182,6 +456,58 @@ ConnectionManager :: Listen(const SocketAddress *aFirst, const SocketAddress *aL
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Listen for unsolicited, asynchronous connections from co-located
+ *    HLX client peers at the specified local socket URL.
+ *
+ *  @param[in]  aSchemeRef  A reference to a CoreFoundation string
+ *                          containing the local socket (that is,
+ *                          "unix") protocol scheme with which to
+ *                          listen.
+ *  @param[in]  aURLRef     A reference to a CoreFoundation URL whose
+ *                          path is the file system path of the local
+ *                          socket at which to listen.
+ *
+ *  @retval  kStatus_Success   If successful.
+ *  @retval  -EINVAL           If the URL has no path.
+ *  @retval  -ENAMETOOLONG     If the URL path is too long for a local
+ *                             socket address.
+ *  @retval  -EPROTONOSUPPORT  If the protocol scheme is not
+ *                             supported.
+ *  @retval  -ENOMEM           Resources could not be allocated to
+ *                             listen.
+ *
+ */
+Status
+ConnectionManager :: ListenLocal(CFStringRef aSchemeRef, CFURLRef aURLRef)
+{
+    CFString       lPath;
+    size_t         lPathLength;
+    SocketAddress  lSocketAddress;
+    Status         lRetval = kStatus_Success;
+
+
+    lPath = CFURLCopyFileSystemPath(aURLRef, kCFURLPOSIXPathStyle);
+    nlREQUIRE_ACTION(lPath.GetString() != nullptr, done, lRetval = -ENOMEM);
+
+    lPathLength = strlen(lPath.GetCString());
+    nlREQUIRE_ACTION(lPathLength > 0, done, lRetval = -EINVAL);
+    nlREQUIRE_ACTION(lPathLength < sizeof (lSocketAddress.uSocketAddressLocal.sun_path), done, lRetval = -ENAMETOOLONG);
+
+    memset(&lSocketAddress, 0, sizeof (lSocketAddress));
+
+    lSocketAddress.uSocketAddress.sa_family = AF_LOCAL;
+
+    memcpy(lSocketAddress.uSocketAddressLocal.sun_path, lPath.GetCString(), lPathLength);
+
+    lRetval = Listen(aSchemeRef, &lSocketAddress, &lSocketAddress + 1);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Listen for unsolicited, asynchronous connections from HLX client
@@ -263,7 +589,8 @@ ConnectionManager :: Listen(const Versions &aVersions)
         n++;
     }
 
-    lRetval = Listen(lSocketAddresses.begin(),
+    lRetval = Listen(ListenerTelnet::kScheme,
+                     lSocketAddresses.begin(),
                      lSocketAddresses.begin() + n);
     nlREQUIRE_SUCCESS(lRetval, done);
 
@@ -318,6 +645,12 @@ ConnectionManager :: Listen(const char *aMaybeURL)
  *  from HLX client peers at the IPv4 and/or IPv6 addresses associated
  *  with the specified URL, host name, or host name and port.
  *
+ *  The protocol scheme of the URL, if any, determines the protocol
+ *  (for example, "telnet" or "tcp") of the connections accepted;
+ *  otherwise, the telnet protocol is used. A "unix" URL (for example,
+ *  "unix:///var/run/hlxproxyd.sock") listens for co-located clients
+ *  at the local socket with the URL path instead.
+ *
  *  @param[in]  aMaybeURL  A pointer to a null-terminated C string
  *                         containing the URL, host name, or host name
  *                         and port to listen on. The URL or host name
@@ -334,6 +667,8 @@ ConnectionManager :: Listen(const char *aMaybeURL)
  *                                    listening.
  *  @retval  -ENOMEM                  Resources could not be allocated
  *                                    to listen.
+ *  @retval  -EPROTONOSUPPORT         If the URL protocol scheme is not
+ *                                    supported.
  *
  */
 Status
@@ -345,6 +680,7 @@ ConnectionManager :: Listen(const char *aMaybeURL,
     CFString                    lHostName;
     int32_t                     lPossiblePort;
     CFURLRef                    lURLRef = nullptr;
+    CFStringRef                 lSchemeRef = nullptr;
     IPAddresses                 lIPAddresses;
     IPAddresses::const_iterator lCurrent;
     IPAddresses::const_iterator lLast;
@@ -369,6 +705,21 @@ ConnectionManager :: Listen(const char *aMaybeURL,
         // resolved IP addresses and attempt to connect to a URL
         // formed from them and the scheme until one succeeds.
 
+        lSchemeRef = CFURLCopyScheme(lURLRef);
+        nlREQUIRE_ACTION(lSchemeRef != nullptr, done, lRetval = -ENOMEM);
+
+        // A local socket URL has a file system path rather than a
+        // host name to resolve and a port, so listen at it directly.
+
+        if (CFString(lSchemeRef) == ListenerUnix::kScheme)
+        {
+            lRetval = ListenLocal(lSchemeRef, lURLRef);
+
+            CFURelease(lURLRef);
+
+            goto done;
+        }
+
         lHostName = CFURLCopyHostName(lURLRef);
         nlREQUIRE_ACTION(lHostName.GetString() != nullptr, done, lRetval = -ENOMEM);
 
@@ -440,11 +791,17 @@ ConnectionManager :: Listen(const char *aMaybeURL,
         lCurrent++;
     }
 
-    lRetval = Listen(&lSocketAddresses[0],
+    // Listen with the scheme from the URL, if one was given;
+    // otherwise, default to telnet.
+
+    lRetval = Listen(((lSchemeRef != nullptr) ? lSchemeRef : ListenerTelnet::kScheme),
+                     &lSocketAddresses[0],
                      &lSocketAddresses[0] + lSocketAddresses.size());
     nlREQUIRE_SUCCESS(lRetval, done);
 
 done:
+    CFURelease(lSchemeRef);
+
     return (lRetval);
 }
 
@@ -500,6 +857,77 @@ ConnectionManager :: RemoveDelegate(ConnectionManagerDelegate *aDelegate)
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Set the send handler for the connection manager.
+ *
+ *  This attempts to set a handler that will be invoked, in lieu of
+ *  sending directly, for each buffer to be sent over each
+ *  connection. This allows, for example, a simulator to delay,
+ *  fragment, or otherwise shape the data sent to clients.
+ *
+ *  @param[in]  aOnSendHandler  The handler to invoke for each buffer to
+ *                              send or null to restore sending directly
+ *                              over the connection.
+ *  @param[in]  aContext        A pointer to caller-specific context to
+ *                              pass to @a aOnSendHandler.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the handler and context were
+ *                                    already set to the specified
+ *                                    values.
+ *
+ */
+Status
+ConnectionManager :: SetSendHandler(OnSendFunc aOnSendHandler, void *aContext)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION((aOnSendHandler != mOnSendHandler) || (aContext != mOnSendContext), done, lRetval = kStatus_ValueAlreadySet);
+
+    mOnSendHandler = aOnSendHandler;
+    mOnSendContext = aContext;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Set the dispose handler for the connection manager.
+ *
+ *  This attempts to set a handler that will be invoked as each
+ *  connection is disposed of, whether it disconnected or failed to be
+ *  accepted. This allows, for example, a send handler holding data
+ *  for a connection to discard it before the connection is
+ *  destroyed.
+ *
+ *  @param[in]  aOnDisposeHandler  The handler to invoke for each
+ *                                 connection disposed of or null for
+ *                                 none.
+ *  @param[in]  aContext           A pointer to caller-specific context
+ *                                 to pass to @a aOnDisposeHandler.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the handler and context were
+ *                                    already set to the specified
+ *                                    values.
+ *
+ */
+Status
+ConnectionManager :: SetDisposeHandler(OnDisposeFunc aOnDisposeHandler, void *aContext)
+{
+    Status lRetval = kStatus_Success;
+
+    nlEXPECT_ACTION((aOnDisposeHandler != mOnDisposeHandler) || (aContext != mOnDisposeContext), done, lRetval = kStatus_ValueAlreadySet);
+
+    mOnDisposeHandler = aOnDisposeHandler;
+    mOnDisposeContext = aContext;
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Predicate class adapter for comparing a raw, bare pointer
@@ -554,7 +982,8 @@ private:
  *  @brief
  *    Send a buffer to all connected clients.
  *
- *  This attempts to send a buffer to all connected clients.
+ *  This attempts to send a buffer to all connected clients, limited
+ *  for each by the objects to which it subscribes.
  *
  *  @param[in]  aBuffer  An immutable shared pointer to the
  *                       buffer to send.
@@ -572,7 +1001,7 @@ ConnectionManager :: Send(Common::ConnectionBuffer::ImmutableCountedPointer aBuf
 
     while ((lCurrent != lLast))
     {
-        lRetval = (*lCurrent)->Send(aBuffer);
+        lRetval = SendFiltered(*lCurrent->get(), aBuffer);
         nlREQUIRE_SUCCESS(lRetval, next);
 
     next:
@@ -582,13 +1011,78 @@ ConnectionManager :: Send(Common::ConnectionBuffer::ImmutableCountedPointer aBuf
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Determine whether a request from the specified connection is
+ *    admitted.
+ *
+ *  This takes, on behalf of a request received from the specified
+ *  connection, a token from the connection request rate limiter,
+ *  if any.
+ *
+ *  @param[in]  aConnection  A reference to the connection from which
+ *                           the request was received.
+ *
+ *  @returns
+ *    True if the request is admitted and should be dispatched;
+ *    otherwise, false, if it exceeds the request rate limit and
+ *    should be dropped.
+ *
+ */
+bool
+ConnectionManager :: AdmitRequest(ConnectionBasis &aConnection)
+{
+    AdmissionStates::iterator  lResult;
+    bool                       lRetval = true;
+
+
+    nlEXPECT(sRequestRate > 0, done);
+
+    lResult = mAdmissionStates.find(&aConnection);
+    nlEXPECT(lResult != mAdmissionStates.end(), done);
+
+    lRetval = lResult->second.mRequestBucket.Take(GetMonotonicMilliseconds());
+
+    if (!lRetval)
+    {
+        DeclareLogIndentWithValue(lLogIndent, 0);
+        DeclareLogLevelWithValue(lLogLevel, 1);
+
+        mAdmissionCounters.mRequestsRejected++;
+
+        LogDebug(lLogIndent,
+                 lLogLevel,
+                 "Dropping request from connection %zu in excess of the rate limit.\n",
+                 aConnection.GetIdentifier());
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return the admission control counters.
+ *
+ *  @returns
+ *    An immutable reference to the counters of connections and
+ *    requests refused or evicted by admission control.
+ *
+ */
+const ConnectionManager::AdmissionCounters &
+ConnectionManager :: GetAdmissionCounters(void) const
+{
+    return (mAdmissionCounters);
+}
+
 /**
  *  @brief
  *    Send a buffer preferrentially to one connected client but
  *    subsequently to all other connected clients.
  *
  *  This attempts to send a buffer preferrentially to one connected
- *  client but subsequently to all other connected clients.
+ *  client but subsequently to all other connected clients, limited
+ *  for each of the latter by the objects to which it subscribes.
  *
  *  @param[in]  aConnection  A reference to the connection to
  *                           preferentially send the specified buffer
@@ -611,19 +1105,21 @@ ConnectionManager :: Send(ConnectionBasis &aConnection,
 
     // First, preferrentially send over the specified connection.
 
-    lRetval = aConnection.Send(aBuffer);
+    lRetval = SendOne(aConnection, aBuffer);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // Next, send over all other active connections, skipping the
     // already-sent-upon specified connection, since a connection
     // serves as a proxy for an active subscription to server state
-    // changes.
+    // changes. The specified connection, having made the request
+    // to which the buffer is the response, receives it in full
+    // whereas the others receive only what they subscribe to.
 
     while ((lCurrent != lLast))
     {
         if (!lComparator(*lCurrent))
         {
-            lRetval = (*lCurrent)->Send(aBuffer);
+            lRetval = SendFiltered(*lCurrent->get(), aBuffer);
             nlREQUIRE_SUCCESS(lRetval, next);
         }
 
@@ -635,6 +1131,80 @@ ConnectionManager :: Send(ConnectionBasis &aConnection,
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Send a buffer to one connected client, limited by the objects to
+ *    which it subscribes.
+ *
+ *  This attempts to send a buffer to one connected client after
+ *  removing from it any response concerning an object to which the
+ *  client does not subscribe. If nothing remains, nothing is sent.
+ *
+ *  @param[in]  aConnection  A reference to the connection to send the
+ *                           specified buffer to.
+ *  @param[in]  aBuffer      An immutable shared pointer to the
+ *                           buffer to send.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If resources for the filtered buffer
+ *                            could not be allocated.
+ *
+ */
+Status
+ConnectionManager :: SendFiltered(ConnectionBasis &aConnection,
+                                  ConnectionBuffer::ImmutableCountedPointer aBuffer)
+{
+    ConnectionBuffer::ImmutableCountedPointer  lBuffer;
+    Status                                     lRetval;
+
+
+    lRetval = aConnection.GetSubscriptionFilter().Filter(aBuffer, lBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    if (lBuffer)
+    {
+        lRetval = SendOne(aConnection, lBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Send a buffer to one connected client.
+ *
+ *  This attempts to send a buffer to one connected client, either
+ *  directly over the connection or, if one has been set, by way of
+ *  the send handler.
+ *
+ *  @param[in]  aConnection  A reference to the connection to send the
+ *                           specified buffer to.
+ *  @param[in]  aBuffer      An immutable shared pointer to the
+ *                           buffer to send.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+ConnectionManager :: SendOne(ConnectionBasis &aConnection,
+                             ConnectionBuffer::ImmutableCountedPointer aBuffer)
+{
+    Status  lRetval;
+
+    if (mOnSendHandler != nullptr)
+    {
+        lRetval = mOnSendHandler(aConnection, aBuffer, mOnSendContext);
+    }
+    else
+    {
+        lRetval = aConnection.Send(aBuffer);
+    }
+
+    return (lRetval);
+}
+
 // NOTE: Until C++17, only std::vector allows for moving a unique_ptr
 //       from one collection to another.
 //
@@ -656,6 +1226,13 @@ ConnectionManager :: DisposeInactiveConnection(ConnectionBasis &aConnection)
     lReleased = mSchemeIdentifierManager.ReleaseSchemeIdentifier(CFString(aConnection.GetScheme()).GetUTF8String(), aConnection.GetIdentifier());
     nlREQUIRE_ACTION(lReleased == true, done, lRetval = -EIDRM);
 
+    mAdmissionStates.erase(&aConnection);
+
+    if (mOnDisposeHandler != nullptr)
+    {
+        mOnDisposeHandler(aConnection, mOnDisposeContext);
+    }
+
     // Move the result to the inactive connections collection.
 
     mInactiveConnections.push_back(std::move(*lResult));
@@ -670,9 +1247,83 @@ ConnectionManager :: DisposeInactiveConnection(ConnectionBasis &aConnection)
 
 void ConnectionManager :: FlushInactiveConnections(void)
 {
+    Connections::iterator  lCurrent = mInactiveConnections.begin();
+    Connections::iterator  lLast    = mInactiveConnections.end();
+    Status                 lStatus;
+
+    // Connections sharded to a worker may yet be in use on the worker
+    // run loop. Rather than destroying them here, hand them off to
+    // the worker pool, which destroys them once their worker has
+    // released them.
+
+    while (lCurrent != lLast)
+    {
+        if ((*lCurrent)->GetWorker() != nullptr)
+        {
+            lStatus = mWorkerPool.Release(*lCurrent);
+            nlVERIFY_SUCCESS(lStatus);
+        }
+
+        ++lCurrent;
+    }
+
     mInactiveConnections.clear();
 }
 
+void ConnectionManager :: EvictIdleConnections(void)
+{
+    const TokenBucket::TimeType      lNow = GetMonotonicMilliseconds();
+    std::vector<ConnectionBasis *>   lIdleConnections;
+    AdmissionStates::const_iterator  lCurrent = mAdmissionStates.begin();
+    AdmissionStates::const_iterator  lLast    = mAdmissionStates.end();
+    Status                           lStatus;
+
+    // Collect the idle connections first since disconnecting one
+    // directly disposes of its admission state.
+
+    while (lCurrent != lLast)
+    {
+        if ((lNow - lCurrent->second.mLastActivity) >= sIdleTimeout)
+        {
+            lIdleConnections.push_back(const_cast<ConnectionBasis *>(lCurrent->first));
+        }
+
+        ++lCurrent;
+    }
+
+    for (ConnectionBasis *lConnection : lIdleConnections)
+    {
+        ConnectionWorker *  lWorker = lConnection->GetWorker();
+
+        // Discard the admission state up front such that a connection
+        // whose disconnection is still in flight is not evicted
+        // again.
+
+        mAdmissionStates.erase(lConnection);
+
+        Log::Info().Write("Disconnecting connection %zu idle for at least %u ms.\n",
+                          lConnection->GetIdentifier(),
+                          sIdleTimeout);
+
+        mAdmissionCounters.mConnectionsEvicted++;
+
+        // Connections sharded to a worker may only be disconnected on
+        // the worker run loop; for those, post the disconnection,
+        // the outcome of which is delegated back as for any other.
+
+        if (lWorker != nullptr)
+        {
+            lStatus = lWorker->Disconnect(*lConnection);
+            nlVERIFY_SUCCESS(lStatus);
+        }
+        else if (lConnection->IsConnected())
+        {
+            lStatus = lConnection->Disconnect();
+            nlVERIFY_SUCCESS(lStatus);
+        }
+    }
+}
+
 Status
 ConnectionManager :: CreateConnection(CFStringRef aScheme,
                                       const int &aSocket,
@@ -681,6 +1332,7 @@ ConnectionManager :: CreateConnection(CFStringRef aScheme,
     bool                                               lSchemeSupported;
     ConnectionSchemeIdentifierManager::IdentifierType  lIdentifier;
     Connections::value_type                            lConnection;
+    ConnectionWorker *                                 lWorker;
     Status                                             lRetval = kStatus_Success;
 
     // Attempt to allocate and connect a new connection.
@@ -694,20 +1346,71 @@ ConnectionManager :: CreateConnection(CFStringRef aScheme,
     lConnection = mConnectionFactory.CreateConnection(aScheme);
     nlREQUIRE_ACTION(lConnection != nullptr, done, lRetval = -ENOMEM);
 
-    lRetval = lConnection->Init(mRunLoopParameters, lIdentifier);
-    nlREQUIRE_SUCCESS(lRetval, done);
+    // Establish the admission control state for the connection
+    // before it is connected, such that it is in place before any
+    // data is received from its peer.
 
-    lRetval = lConnection->SetDelegate(this);
-    nlREQUIRE_SUCCESS(lRetval, done);
+    {
+        const TokenBucket::TimeType  lNow            = GetMonotonicMilliseconds();
+        AdmissionState &             lAdmissionState = mAdmissionStates[lConnection.get()];
 
-    lRetval = lConnection->Connect(aSocket, aPeerAddress);
-    nlREQUIRE_SUCCESS(lRetval, done);
+        lAdmissionState.mLastActivity = lNow;
 
-    // Add the connection to the tracked list of active connections.
+        if (sRequestRate > 0)
+        {
+            lRetval = lAdmissionState.mRequestBucket.Init(sRequestRate, sRequestBurst, lNow);
+            nlREQUIRE_SUCCESS(lRetval, done);
+        }
+    }
 
-    mActiveConnections.push_back(std::move(lConnection));
+    lWorker = mWorkerPool.GetWorker();
+
+    if (lWorker != nullptr)
+    {
+        // Shard the connection to the worker, which will connect it
+        // and serve as its delegate on the worker run loop, posting
+        // its delegations back to this manager via the worker pool.
+
+        lRetval = lConnection->Init(lWorker->GetRunLoopParameters(), lIdentifier);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = lConnection->SetDelegate(lWorker);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = lConnection->SetWorker(lWorker);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = lWorker->Connect(*lConnection, aSocket, aPeerAddress);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        // Add the connection to the tracked list of active
+        // connections.
+
+        mActiveConnections.push_back(std::move(lConnection));
+    }
+    else
+    {
+        lRetval = lConnection->Init(mRunLoopParameters, lIdentifier);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = lConnection->SetDelegate(this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = lConnection->Connect(aSocket, aPeerAddress);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        // Add the connection to the tracked list of active
+        // connections.
+
+        mActiveConnections.push_back(std::move(lConnection));
+    }
 
  done:
+    if ((lRetval != kStatus_Success) && (lConnection != nullptr))
+    {
+        mAdmissionStates.erase(lConnection.get());
+    }
+
     return (lRetval);
 }
 
@@ -878,6 +1581,20 @@ Status ConnectionManager :: ListenerDidAccept(ListenerBasis &aListener, const in
 
     FlushInactiveConnections();
 
+    // Refuse the connection if the maximum number of connections are
+    // already active. The listener closes the socket when refused.
+
+    if ((sConnectionsMax > 0) && (mActiveConnections.size() >= sConnectionsMax))
+    {
+        mAdmissionCounters.mConnectionsRejected++;
+
+        Log::Info().Write("Refusing connection at the limit of %zu connections.\n",
+                          sConnectionsMax);
+
+        lRetval = -ECONNREFUSED;
+        goto done;
+    }
+
     lRetval = CreateConnection(aListener.GetScheme(), aSocket, aPeerAddress);
     nlREQUIRE_SUCCESS(lRetval, done);
 
@@ -981,6 +1698,13 @@ ConnectionManager :: ConnectionDidNotAccept(ConnectionBasis &aConnection, const
 void
 ConnectionManager :: ConnectionDidReceiveApplicationData(ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer aBuffer)
 {
+    AdmissionStates::iterator  lResult = mAdmissionStates.find(&aConnection);
+
+    if (lResult != mAdmissionStates.end())
+    {
+        lResult->second.mLastActivity = GetMonotonicMilliseconds();
+    }
+
     if (GetApplicationDataDelegate() != nullptr)
     {
         GetApplicationDataDelegate()->ConnectionManagerDidReceiveApplicationData(*this, aConnection, aBuffer);
@@ -1123,6 +1847,28 @@ ConnectionManager :: ConnectionError(ConnectionBasis &aConnection, const Common:
     }
 }
 
+// MARK: Timer Delegate Method
+
+/**
+ *  @brief
+ *    Delegation from a timer that it has fired.
+ *
+ *  On the idle timer, this disconnects any connection that has not
+ *  received data within the idle timeout.
+ *
+ *  @param[in]  aTimer  A reference to the timer that issued the
+ *                      delegation.
+ *
+ */
+void
+ConnectionManager :: TimerDidFire(Common::Timer &aTimer)
+{
+    if (aTimer == mIdleTimer)
+    {
+        EvictIdleConnections();
+    }
+}
+
 }; // namespace Server
 
 }; // namespace HLX
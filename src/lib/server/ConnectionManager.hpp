@@ -27,19 +27,26 @@
 #define OPENHLXSERVERCONNECTIONMANAGER_HPP
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include <stdint.h>
+
 #include <CoreFoundation/CFURL.h>
 
 #include <OpenHLX/Common/ConnectionManagerApplicationDataDelegate.hpp>
 #include <OpenHLX/Common/ConnectionManagerBasis.hpp>
 #include <OpenHLX/Common/SocketAddress.hpp>
 #include <OpenHLX/Common/Timeout.hpp>
+#include <OpenHLX/Common/Timer.hpp>
+#include <OpenHLX/Common/TimerDelegate.hpp>
+#include <OpenHLX/Common/TokenBucket.hpp>
 #include <OpenHLX/Server/ConnectionBasis.hpp>
 #include <OpenHLX/Server/ConnectionBasisDelegate.hpp>
 #include <OpenHLX/Server/ConnectionFactory.hpp>
 #include <OpenHLX/Server/ConnectionManagerDelegate.hpp>
+#include <OpenHLX/Server/ConnectionWorkerPool.hpp>
 #include <OpenHLX/Server/ConnectionSchemeIdentifierManager.hpp>
 #include <OpenHLX/Server/ListenerBasis.hpp>
 #include <OpenHLX/Server/ListenerBasisAcceptDelegate.hpp>
@@ -72,14 +79,59 @@ class ConnectionManager :
     public Common::ConnectionManagerBasis,
     public ListenerBasisAcceptDelegate,
     public ListenerBasisDelegate,
-    public ConnectionBasisDelegate
+    public ConnectionBasisDelegate,
+    public Common::TimerDelegate
 {
+public:
+    /**
+     *  @brief
+     *    Counters of connections and requests refused or evicted by
+     *    admission control.
+     *
+     */
+    struct AdmissionCounters
+    {
+        size_t  mConnectionsRejected; //!< Connections refused at the connection limit.
+        size_t  mConnectionsEvicted;  //!< Connections disconnected for being idle.
+        size_t  mRequestsRejected;    //!< Requests dropped for exceeding the request rate limit.
+    };
+
+    /**
+     *  @brief
+     *    Send handler callback function.
+     *
+     *  This defines a function to call, in lieu of sending directly
+     *  over the connection, when a buffer is to be sent over a
+     *  connection. The handler assumes responsibility for sending the
+     *  buffer, whenever and however it sees fit, by invoking the
+     *  connection's own send method.
+     *
+     */
+    typedef Common::Status (* OnSendFunc)(ConnectionBasis &aConnection, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer, void *aContext);
+
+    /**
+     *  @brief
+     *    Dispose handler callback function.
+     *
+     *  This defines a function to call when a connection is disposed
+     *  of, after which it may no longer be sent upon, such that any
+     *  state a send handler holds for the connection may be
+     *  discarded.
+     *
+     */
+    typedef void (* OnDisposeFunc)(ConnectionBasis &aConnection, void *aContext);
+
 public:
     ConnectionManager(void);
     virtual ~ConnectionManager(void) = default;
 
     Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters);
 
+    static Common::Status SetWorkers(const size_t &aWorkers);
+    static Common::Status SetConnectionsMax(const size_t &aConnectionsMax);
+    static Common::Status SetIdleTimeout(const Common::Timeout::Value &aMilliseconds);
+    static Common::Status SetRequestRateLimit(const uint32_t &aRate, const uint32_t &aBurst);
+
     bool SupportsScheme(CFStringRef aSchemeRef) const final;
 
     Common::Status Listen(void);
@@ -90,9 +142,15 @@ public:
     Common::Status AddDelegate(ConnectionManagerDelegate *aDelegate);
     Common::Status RemoveDelegate(ConnectionManagerDelegate *aDelegate);
 
+    Common::Status SetSendHandler(OnSendFunc aOnSendHandler, void *aContext);
+    Common::Status SetDisposeHandler(OnDisposeFunc aOnDisposeHandler, void *aContext);
+
     Common::Status Send(Common::ConnectionBuffer::ImmutableCountedPointer aBuffer);
     Common::Status Send(ConnectionBasis &aConnection, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer);
 
+    bool AdmitRequest(ConnectionBasis &aConnection);
+    const AdmissionCounters &GetAdmissionCounters(void) const;
+
     // Listener Basis Delegate Methods
 
     // Listen
@@ -133,23 +191,44 @@ public:
 
     void ConnectionError(ConnectionBasis &aConnection, const Common::Error &aError) final;
 
+    // Timer Delegate Method
+
+    void TimerDidFire(Common::Timer &aTimer) final;
+
 private:
     void OnWillResolve(const char *aHost) final;
     void OnIsResolving(const char *aHost) final;
     void OnDidResolve(const char *aHost, const Common::IPAddress &aIPAddress) final;
     void OnDidNotResolve(const char *aHost, const Common::Error &aError) final;
 
-    Common::Status Listen(const Common::SocketAddress *aFirst, const Common::SocketAddress *aLast);
+    Common::Status Listen(CFStringRef aSchemeRef, const Common::SocketAddress *aFirst, const Common::SocketAddress *aLast);
+    Common::Status ListenLocal(CFStringRef aSchemeRef, CFURLRef aURLRef);
 
     Common::Status CreateConnection(CFStringRef aScheme, const int &aSocket, const Common::SocketAddress &aPeerAddress);
 
+    Common::Status SendFiltered(ConnectionBasis &aConnection, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer);
+    Common::Status SendOne(ConnectionBasis &aConnection, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer);
+
     Common::Status DisposeInactiveConnection(ConnectionBasis &aConnection);
     void FlushInactiveConnections(void);
 
+    void EvictIdleConnections(void);
+
 private:
-    typedef std::unordered_set<ConnectionManagerDelegate *> ConnectionManagerDelegates;
-    typedef std::vector<std::unique_ptr<ConnectionBasis>>   Connections;
-    typedef std::vector<std::unique_ptr<ListenerBasis>>     Listeners;
+    /**
+     *  Admission control state for a single active connection.
+     *
+     */
+    struct AdmissionState
+    {
+        Common::TokenBucket            mRequestBucket; //!< The request rate limiter for the connection.
+        Common::TokenBucket::TimeType  mLastActivity;  //!< When the connection last received data, in milliseconds.
+    };
+
+    typedef std::unordered_set<ConnectionManagerDelegate *>               ConnectionManagerDelegates;
+    typedef std::vector<std::unique_ptr<ConnectionBasis>>                 Connections;
+    typedef std::vector<std::unique_ptr<ListenerBasis>>                   Listeners;
+    typedef std::unordered_map<const ConnectionBasis *, AdmissionState>   AdmissionStates;
 
     ListenerFactory                             mListenerFactory;
     ConnectionFactory                           mConnectionFactory;
@@ -159,6 +238,26 @@ private:
     Common::RunLoopParameters                   mRunLoopParameters;
     ConnectionManagerDelegates                  mDelegates;
     ConnectionSchemeIdentifierManager           mSchemeIdentifierManager;
+    OnSendFunc                                  mOnSendHandler;
+    void *                                      mOnSendContext;
+    OnDisposeFunc                               mOnDisposeHandler;
+    void *                                      mOnDisposeContext;
+    AdmissionStates                             mAdmissionStates;
+    AdmissionCounters                           mAdmissionCounters;
+    Common::Timer                               mIdleTimer;
+
+    // The worker pool is intentionally last such that it, and its
+    // workers, are stopped before, and no longer reference, any
+    // connection destroyed with the manager.
+
+    ConnectionWorkerPool                        mWorkerPool;
+
+    static const size_t                         kWorkersMax;
+    static size_t                               sWorkers;
+    static size_t                               sConnectionsMax;
+    static Common::Timeout::Value               sIdleTimeout;
+    static uint32_t                             sRequestRate;
+    static uint32_t                             sRequestBurst;
 };
 
 }; // namespace Server
@@ -0,0 +1,875 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a base object for a HLX server
+ *      peer-to-peer network connection that exchanges data over the
+ *      socket streams of an accepted connection.
+ *
+ */
+
+#include <ConnectionStreamBasis.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <CoreFoundation/CFSocket.h>
+#include <CoreFoundation/CFStream.h>
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/SocketAddress.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+namespace HLX
+{
+
+namespace Server
+{
+
+// Global Variables
+
+// The fixed capacity, in bytes, of the connection receive buffer. This
+// must accommodate a single request, or a burst of requests, from a client.
+
+static const size_t kReceiveBufferCapacity = 4096;
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  This constructs an instance of the class with the specified URL
+ *  scheme.
+ *
+ *  @param[in]  aSchemeRef  A reference to a CoreFoundation string
+ *                          containing the protocol (for example,
+ *                          "telnet") scheme supported by the
+ *                          connection.
+ *
+ */
+ConnectionStreamBasis :: ConnectionStreamBasis(CFStringRef aSchemeRef) :
+    ConnectionBasis(aSchemeRef),
+    mReadStreamRef(nullptr),
+    mWriteStreamRef(nullptr),
+    mReceiveBuffer()
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionStreamBasis :: ~ConnectionStreamBasis(void)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Connect to the HLX client peer.
+ *
+ *  This establishes connection state for the HLX client peer at the
+ *  specified socket and peer address.
+ *
+ *  @param[in]  aSocket        An immutable reference to the native
+ *                             socket descriptor associated with the
+ *                             accepted connection.
+ *  @param[in]  aPeerAddress   An immutable reference to the socket
+ *                             address associated with the peer client
+ *                             at the remote end of the accepted
+ *                             connection.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the peer address was already
+ *                                    set.
+ *  @retval  -EINVAL                  The socket was invalid or the
+ *                                    connection scheme is null or has
+ *                                    zero (0) length.
+ *  @retval  -ENOMEM                  If memory could not be allocated.
+ *  @retval  -ECONNREFUSED            If read and write streams could
+ *                                    not be created for the socket.
+ *  @retval  -EIO                     If read and write streams could
+ *                                    not be opened for the socket.
+ *
+ *  @sa OpenStreams
+ *
+ */
+Status
+ConnectionStreamBasis :: Connect(const int &aSocket,
+                                 const Common::SocketAddress &aPeerAddress)
+{
+    DeclareLogIndentWithValue(lLogIndent, 0);
+    DeclareLogLevelWithValue(lLogLevel, 1);
+    const State  lCurrentState = GetState();
+    int          lFlags;
+    Status       lRetval = kStatus_Success;
+
+    LogDebug(lLogIndent, lLogLevel, "Connecting Socket: %d\n", aSocket);
+
+    lRetval = ConnectionBasis::Connect(aSocket, aPeerAddress);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    OnWillAccept();
+
+    SetState(kState_Accepting);
+
+    OnIsAccepting();
+
+    // Set the socket to non-blocking
+
+    lFlags = fcntl(aSocket, F_GETFL);
+
+    lRetval = fcntl(aSocket, F_SETFL, lFlags | O_NONBLOCK);
+    nlREQUIRE_ACTION(lRetval >= 0, done, lRetval = -errno);
+
+    lRetval = OpenStreams(aSocket);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+ done:
+    if (lRetval != kStatus_Success)
+    {
+        CloseStreams();
+
+        SetState(lCurrentState);
+
+        OnDidNotAccept(lRetval);
+
+        OnError(lRetval);
+    }
+    else
+    {
+        SetState(kState_Accepted);
+
+        OnDidAccept();
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Open the read and write streams for a connected peer.
+ *
+ *  This creates, schedules on the connection run loop, and opens a
+ *  pair of read and write streams for the specified accepted,
+ *  non-blocking socket.
+ *
+ *  @param[in]  aSocket  An immutable reference to the native socket
+ *                       descriptor associated with the accepted
+ *                       connection.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If the stream clients could not be set.
+ *  @retval  -ECONNREFUSED    If read and write streams could not be
+ *                            created for the socket.
+ *  @retval  -EIO             If read and write streams could not be
+ *                            opened for the socket.
+ *
+ */
+Status
+ConnectionStreamBasis :: OpenStreams(const int &aSocket)
+{
+    const CFOptionFlags    kCommonStreamEvents = (kCFStreamEventErrorOccurred | kCFStreamEventEndEncountered);
+    const CFOptionFlags    kReadStreamEvents   = (kCommonStreamEvents | kCFStreamEventHasBytesAvailable);
+    const CFOptionFlags    kWriteStreamEvents  = (kCommonStreamEvents | kCFStreamEventCanAcceptBytes);
+    CFStreamClientContext  lStreamClientContext;
+    CFRunLoopRef           lRunLoop = nullptr;
+    CFRunLoopMode          lRunLoopMode;
+    bool                   lStatus;
+    Status                 lRetval = kStatus_Success;
+
+    CFStreamCreatePairWithSocket(kCFAllocatorDefault,
+                                 aSocket,
+                                 &mReadStreamRef,
+                                 &mWriteStreamRef);
+
+    if ((mReadStreamRef == nullptr) || (mWriteStreamRef == nullptr))
+    {
+        if (mReadStreamRef)
+        {
+            Log::Error().Write("Failed to create read stream.\n");
+
+            CFReadStreamClose(mReadStreamRef);
+            CFRelease(mReadStreamRef);
+            mReadStreamRef = nullptr;
+        }
+
+        if (mWriteStreamRef)
+        {
+            Log::Error().Write("Failed to create write stream.\n");
+
+            CFWriteStreamClose(mWriteStreamRef);
+            CFRelease(mWriteStreamRef);
+            mWriteStreamRef = nullptr;
+        }
+
+        lRetval = -ECONNREFUSED;
+        goto done;
+    }
+
+    lRunLoop = GetRunLoopParameters().GetRunLoop();
+    lRunLoopMode = GetRunLoopParameters().GetRunLoopMode();
+
+    lStreamClientContext.version         = 0;
+    lStreamClientContext.info            = this;
+    lStreamClientContext.retain          = nullptr;
+    lStreamClientContext.release         = nullptr;
+    lStreamClientContext.copyDescription = nullptr;
+
+#if USE_kCFStreamPropertyShouldCloseNativeSocket
+    CFReadStreamSetProperty(mReadStreamRef,
+                            kCFStreamPropertyShouldCloseNativeSocket,
+                            kCFBooleanFalse);
+#endif
+
+    lStatus = CFReadStreamSetClient(mReadStreamRef,
+                                    kReadStreamEvents,
+                                    &CFReadStreamCallback,
+                                    &lStreamClientContext);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to set read stream client.\n");
+
+        lRetval = -EINVAL;
+        goto done;
+    }
+
+    CFReadStreamScheduleWithRunLoop(mReadStreamRef,
+                                    lRunLoop,
+                                    lRunLoopMode);
+
+#if USE_kCFStreamPropertyShouldCloseNativeSocket
+    CFWriteStreamSetProperty(mWriteStreamRef,
+                             kCFStreamPropertyShouldCloseNativeSocket,
+                             kCFBooleanFalse);
+#endif
+
+    lStatus = CFWriteStreamSetClient(mWriteStreamRef,
+                                     kWriteStreamEvents,
+                                     &CFWriteStreamCallback,
+                                     &lStreamClientContext);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to set write stream client.\n");
+
+        lRetval = -EINVAL;
+        goto done;
+    }
+
+    CFWriteStreamScheduleWithRunLoop(mWriteStreamRef,
+                                     lRunLoop,
+                                     lRunLoopMode);
+
+    lStatus = CFReadStreamOpen(mReadStreamRef);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to open the read stream.\n");
+
+        lRetval = -EIO;
+        goto done;
+    }
+
+    lStatus = CFWriteStreamOpen(mWriteStreamRef);
+
+    if (!lStatus)
+    {
+        Log::Error().Write("Failed to open the write stream.\n");
+
+        lRetval = -EIO;
+        goto done;
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Close the read and write stream associated with a connected peer.
+ *
+ *  @retval  kStatus_Success  Unconditionally.
+ *
+ */
+Status
+ConnectionStreamBasis :: CloseStreams(void)
+{
+    CFRunLoopRef  lRunLoop = GetRunLoopParameters().GetRunLoop();
+    CFRunLoopMode lRunLoopMode = GetRunLoopParameters().GetRunLoopMode();
+    Status        lRetval = kStatus_Success;
+
+    if (mReadStreamRef != nullptr)
+    {
+        CFReadStreamUnscheduleFromRunLoop(mReadStreamRef, lRunLoop, lRunLoopMode);
+        CFReadStreamSetClient(mReadStreamRef, kCFStreamEventNone, nullptr, nullptr);
+        CFReadStreamClose(mReadStreamRef);
+        CFRelease(mReadStreamRef);
+        mReadStreamRef = nullptr;
+    }
+
+    if (mWriteStreamRef != nullptr)
+    {
+        CFWriteStreamUnscheduleFromRunLoop(mWriteStreamRef, lRunLoop, lRunLoopMode);
+        CFWriteStreamSetClient(mWriteStreamRef, kCFStreamEventNone, nullptr, nullptr);
+        CFWriteStreamClose(mWriteStreamRef);
+        CFRelease(mWriteStreamRef);
+        mWriteStreamRef = nullptr;
+    }
+
+    ConnectionBasis::Close();
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return whether the connection streams are open.
+ *
+ *  @returns True if the read and write streams are open; otherwise,
+ *           false.
+ *
+ */
+bool
+ConnectionStreamBasis :: AreStreamsOpen(void) const
+{
+    return (mWriteStreamRef != nullptr);
+}
+
+/**
+ *  @brief
+ *    Disconnect from the HLX client peer.
+ *
+ *  This attempts to asynchronously disconnect from the
+ *  currently-connected HLX client peer, if any.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+ConnectionStreamBasis :: Disconnect(void)
+{
+    DeclareScopedFunctionTracer(lTracer);
+    const State  lCurrentState = GetState();
+    Status       lRetval       = kStatus_Success;
+
+    OnWillDisconnect();
+
+    SetState(kState_Disconnecting);
+
+    // Write any data still coalesced for transmission before closing
+    // the streams.
+
+    FlushTransmit();
+
+    lRetval = CloseStreams();
+
+    if (lRetval == kStatus_Success)
+    {
+        if (mReceiveBuffer != nullptr)
+        {
+            mReceiveBuffer->Flush();
+        }
+
+        ResetSession();
+
+        SetState(kState_Disconnected);
+
+        OnDidDisconnect(lRetval);
+
+        lRetval = ConnectionBasis::Disconnect();
+    }
+    else
+    {
+        SetState(lCurrentState);
+
+        OnDidNotDisconnect(lRetval);
+
+        OnError(lRetval);
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Reset any session state the connection layers over its streams.
+ *
+ *  This is invoked once the streams have been closed, either on
+ *  disconnection or on a stream error, such that any session state
+ *  (for example, a telnet session confirmation) is established anew
+ *  on the next connection. By default, there is no such state.
+ *
+ */
+void
+ConnectionStreamBasis :: ResetSession(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Handle data read from the connection peer.
+ *
+ *  This is invoked with the data, as read, from the connection
+ *  socket. By default, the data is user data and is pushed into the
+ *  receive buffer as-is; derived connections that encode user data
+ *  (for example, with the telnet protocol) decode it and push the
+ *  decoded data with #DidReceiveDataHandler.
+ *
+ *  @param[in]  aBuffer  A pointer to the data read.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data read.
+ *
+ */
+void
+ConnectionStreamBasis :: DidReadDataHandler(const uint8_t *aBuffer, const size_t &aSize)
+{
+    DidReceiveDataHandler(aBuffer, aSize);
+}
+
+/**
+ *  @brief
+ *    Handle the connection peer becoming able to accept data.
+ *
+ *  By default, this writes any data the peer previously could not
+ *  accept.
+ *
+ */
+void
+ConnectionStreamBasis :: CanTransmitDataHandler(void)
+{
+    ResumeTransmit();
+}
+
+static void
+DecodeStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription)
+{
+    Log::Error().Write("%s: received %s event type 0x%lx w/ error domain %lu code %d\n",
+                       __func__,
+                       aStreamDescription,
+                       aType,
+                       aStreamError.domain,
+                       static_cast<int>(aStreamError.error));
+}
+
+/**
+ *  @brief
+ *    Handle an error associated with a connection stream.
+ *
+ *  This handles any errors associated with either a read or write
+ *  connection stream.
+ *
+ *  @param[in]  aType               The type of stream error that
+ *                                  triggered the error.
+ *  @param[in]  aStreamError        An immutable reference to the
+ *                                  stream error.
+ *  @param[in]  aStreamDescription  An optional pointer to a null-
+ *                                  terminated C string describing
+ *                                  the stream on which the error
+ *                                  occurred.
+ *
+ */
+void
+ConnectionStreamBasis :: HandleStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription)
+{
+    const State  lState = GetState();
+    Error        lError;
+
+    DecodeStreamError(aType, aStreamError, aStreamDescription);
+
+    Log::Debug().Write("%s: state is %d\n", __FUNCTION__, lState);
+
+    switch (aStreamError.domain)
+    {
+
+    case kCFStreamErrorDomainPOSIX:
+        lError = -aStreamError.error;
+        break;
+
+    default:
+        lError = kError_Unknown;
+        break;
+
+    }
+
+    switch (lState)
+    {
+
+    case kState_Accepting:
+        {
+            SetState(kState_Disconnected);
+
+            OnDidNotAccept(lError);
+
+            OnError(lError);
+        }
+        break;
+
+    case kState_Accepted:
+        {
+            CloseStreams();
+
+            if (mReceiveBuffer != nullptr)
+            {
+                mReceiveBuffer->Flush();
+            }
+
+            ResetSession();
+
+            SetState(kState_Disconnected);
+
+            OnDidDisconnect(lError);
+
+            OnError(lError);
+        }
+        break;
+
+    case kState_Unknown:
+    case kState_Disconnecting:
+    case kState_Disconnected:
+    default:
+        break;
+
+    }
+}
+
+/**
+ *  @brief
+ *    Callback to handle connection read stream activity.
+ *
+ *  This handles any read stream activity associated with the
+ *  connected peer.
+ *
+ *  @param[in]  aStream  A reference to the read stream that
+ *                       triggered the callback.
+ *  @param[in]  aType    The type of event that triggered the
+ *                       callback.
+ *
+ */
+void
+ConnectionStreamBasis :: CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType)
+{
+    Boolean lStatus;
+
+    switch (aType)
+    {
+
+    case kCFStreamEventHasBytesAvailable:
+        {
+            lStatus = CFReadStreamHasBytesAvailable(aStream);
+            if (lStatus)
+            {
+                const CFIndex lRequestedBytes = 4096;
+                uint8_t       lBuffer[lRequestedBytes];
+                CFIndex       lResult;
+
+
+                lResult = CFReadStreamRead(aStream, lBuffer, lRequestedBytes);
+
+                if (lResult > 0)
+                {
+                    DidReadDataHandler(lBuffer, static_cast<size_t>(lResult));
+                }
+            }
+        }
+        break;
+
+    case kCFStreamEventErrorOccurred:
+        {
+            const CFStreamError lStreamError = CFReadStreamGetError(aStream);
+
+            HandleStreamError(aType, lStreamError, "read");
+        }
+        break;
+
+    case kCFStreamEventEndEncountered:
+        {
+            const CFStreamError lStreamError = { kCFStreamErrorDomainPOSIX, ECONNRESET };
+
+            HandleStreamError(aType, lStreamError, "read");
+        }
+        break;
+
+    default:
+        {
+            Log::Error().Write("%s: read event type 0x%lx unhandled\n", __func__, aType);
+        }
+        break;
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Callback to handle connection write stream activity.
+ *
+ *  This handles any write stream activity associated with the
+ *  connected peer.
+ *
+ *  @param[in]  aStream  A reference to the write stream that
+ *                       triggered the callback.
+ *  @param[in]  aType    The type of event that triggered the
+ *                       callback.
+ *
+ */
+void
+ConnectionStreamBasis :: CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType)
+{
+    Boolean lStatus;
+
+    switch (aType)
+    {
+
+    case kCFStreamEventCanAcceptBytes:
+        {
+            lStatus = CFWriteStreamCanAcceptBytes(aStream);
+            if (lStatus)
+            {
+                CanTransmitDataHandler();
+            }
+        }
+        break;
+
+    case kCFStreamEventErrorOccurred:
+        {
+            const CFStreamError lStreamError = CFWriteStreamGetError(aStream);
+
+            HandleStreamError(aType, lStreamError, "write");
+        }
+        break;
+
+    default:
+        {
+            Log::Error().Write("%s: write event type 0x%lx unhandled\n", __func__, aType);
+        }
+        break;
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Callback trampoline to handle connection read stream activity.
+ *
+ *  @param[in]  aStream   A reference to the read stream that
+ *                        triggered the callback.
+ *  @param[in]  aType     The type of event that triggered the
+ *                        callback.
+ *  @param[in]  aContext  A pointer to the connection class
+ *                        instance that registered this
+ *                        trampoline to call back into from
+ *                        the trampoline.
+ *
+ */
+void
+ConnectionStreamBasis :: CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType, void *aContext)
+{
+    ConnectionStreamBasis *lConnection = static_cast<ConnectionStreamBasis *>(aContext);
+
+    if (lConnection != nullptr)
+    {
+        lConnection->CFReadStreamCallback(aStream, aType);
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Callback trampoline to handle connection write stream activity.
+ *
+ *  @param[in]  aStream   A reference to the write stream that
+ *                        triggered the callback.
+ *  @param[in]  aType     The type of event that triggered the
+ *                        callback.
+ *  @param[in]  aContext  A pointer to the connection class
+ *                        instance that registered this
+ *                        trampoline to call back into from
+ *                        the trampoline.
+ *
+ */
+void
+ConnectionStreamBasis :: CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType, void *aContext)
+{
+    ConnectionStreamBasis *lConnection = static_cast<ConnectionStreamBasis *>(aContext);
+
+    if (lConnection != nullptr)
+    {
+        lConnection->CFWriteStreamCallback(aStream, aType);
+    }
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Handle user data received from the connection peer.
+ *
+ *  This pushes the user data received from the peer into the
+ *  fixed-capacity receive buffer, dispatching it upwards as it is
+ *  pushed.
+ *
+ *  @param[in]  aBuffer  A pointer to the data received.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data received.
+ *
+ */
+void
+ConnectionStreamBasis :: DidReceiveDataHandler(const uint8_t *aBuffer, const size_t &aSize)
+{
+    DeclareLogIndentWithValue(lLogIndent, 0);
+    DeclareLogLevelWithValue(lLogLevel, 1);
+    const uint8_t *  lCurrent = aBuffer;
+    size_t           lRemaining = aSize;
+    uint8_t *        lPut;
+    Status           lStatus;
+
+    LogDebug(lLogIndent,
+             lLogLevel,
+             "Received %zu bytes of user data.\n",
+             aSize);
+#if (defined(DEBUG) && DEBUG) && !defined(NDEBUG)
+    Log::Utilities::Memory::Write(lLogIndent,
+                                  lLogLevel,
+                                  aBuffer,
+                                  aSize);
+#endif // (defined(DEBUG) && DEBUG) && !defined(NDEBUG)
+
+    // Allocate and initialize the receive buffer on-demand, if one is
+    // not already in use.
+
+    if (!mReceiveBuffer)
+    {
+        lStatus = ConnectionBuffer::Create(mReceiveBuffer, kReceiveBufferCapacity);
+        nlREQUIRE_SUCCESS(lStatus, done);
+    }
+
+    // Push the received user data into the receive buffer,
+    // dispatching it as it is pushed. The receive buffer is a
+    // fixed-capacity ring: data consumed by the dispatch is simply
+    // advanced past and its space is reclaimed by subsequent pushes,
+    // such that the buffer neither grows nor moves data on every
+    // consumption.
+
+    while (lRemaining > 0)
+    {
+        size_t  lHeadroom = (mReceiveBuffer->GetCapacity() - mReceiveBuffer->GetSize());
+        size_t  lChunk;
+
+        // If the buffer is full and nothing in it could be consumed,
+        // then it contains unterminated data larger than any valid
+        // input. Discard it rather than growing the buffer without
+        // bound.
+
+        if (lHeadroom == 0)
+        {
+            Log::Error().Write("Receive buffer full; discarding %zu bytes of unterminated data.\n",
+                               mReceiveBuffer->GetSize());
+
+            mReceiveBuffer->Flush();
+
+            lHeadroom = mReceiveBuffer->GetCapacity();
+        }
+
+        lChunk = ((lRemaining < lHeadroom) ? lRemaining : lHeadroom);
+
+        lPut = mReceiveBuffer->Put(lCurrent, lChunk);
+        nlREQUIRE_ACTION(lPut != nullptr, done, lStatus = -ENOSPC);
+
+        lCurrent   += lChunk;
+        lRemaining -= lChunk;
+
+        OnApplicationDataReceived(mReceiveBuffer);
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Write the specified data to the connection peer.
+ *
+ *  If the peer accepts less than all of the data, the connection
+ *  basis keeps the remainder and this connection resumes writing it
+ *  once the write stream can again accept data. A write error is
+ *  handled by the write stream callback.
+ *
+ *  @param[in]  aBuffer  A pointer to the data to write.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data to write.
+ *
+ *  @returns
+ *    The number of bytes of the data the peer accepted.
+ *
+ */
+size_t
+ConnectionStreamBasis :: ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize)
+{
+    CFIndex lResult = 0;
+    CFIndex lStatus = 0;
+    size_t  lRetval = 0;
+
+    lStatus = CFWriteStreamCanAcceptBytes(mWriteStreamRef);
+    if (lStatus)
+    {
+        lResult = CFWriteStreamWrite(mWriteStreamRef,
+                                     aBuffer,
+                                     static_cast<CFIndex>(aSize));
+
+        if (lResult > 0)
+        {
+            lRetval = static_cast<size_t>(lResult);
+        }
+
+        if (lRetval != aSize)
+        {
+            Log::Debug().Write("Only wrote %zu of %zu bytes!\n", lRetval, aSize);
+        }
+    }
+    else
+    {
+        Log::Debug().Write("Write stream cannot accept data!\n");
+    }
+
+    return (lRetval);
+}
+
+}; // namespace Server
+
+}; // namespace HLX
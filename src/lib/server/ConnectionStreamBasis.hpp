@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines a base object for a HLX server peer-to-peer
+ *      network connection that exchanges data over the socket
+ *      streams of an accepted connection.
+ *
+ */
+
+#ifndef OPENHLXSERVERCONNECTIONSTREAMBASIS_HPP
+#define OPENHLXSERVERCONNECTIONSTREAMBASIS_HPP
+
+#include <CoreFoundation/CFStream.h>
+#include <CoreFoundation/CFString.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Server/ConnectionBasis.hpp>
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  @brief
+ *    A base object for a HLX server peer-to-peer network connection
+ *    that exchanges data over the socket streams of an accepted
+ *    connection.
+ *
+ *  This opens, schedules, and closes the CoreFoundation read and
+ *  write streams for the accepted connection socket, handles their
+ *  events and errors, and pushes the data received from the peer
+ *  into a fixed-capacity receive buffer, dispatching it upwards as
+ *  it is pushed.
+ *
+ *  Derived connections supply only how data read from the peer is
+ *  decoded and how data is encoded and sent to it (for example, with
+ *  or without the telnet protocol).
+ *
+ *  @ingroup server
+ *
+ */
+class ConnectionStreamBasis :
+    public Server::ConnectionBasis
+{
+public:
+    virtual ~ConnectionStreamBasis(void);
+
+    Common::Status Connect(const int &aSocket,
+                           const Common::SocketAddress &aPeerAddress) final;
+    Common::Status Disconnect(void) final;
+
+    static void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType, void *aContext);
+    static void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType, void *aContext);
+
+protected:
+    ConnectionStreamBasis(CFStringRef aSchemeRef);
+
+    virtual Common::Status OpenStreams(const int &aSocket);
+    virtual Common::Status CloseStreams(void);
+    bool                   AreStreamsOpen(void) const;
+
+    virtual void   ResetSession(void);
+    virtual void   DidReadDataHandler(const uint8_t *aBuffer, const size_t &aSize);
+    virtual void   CanTransmitDataHandler(void);
+
+    void           DidReceiveDataHandler(const uint8_t *aBuffer, const size_t &aSize);
+    size_t         ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize) override;
+    void           HandleStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription);
+
+private:
+    void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType);
+    void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType);
+
+private:
+    CFReadStreamRef                                  mReadStreamRef;
+    CFWriteStreamRef                                 mWriteStreamRef;
+    Common::ConnectionBuffer::MutableCountedPointer  mReceiveBuffer;
+};
+
+}; // namespace Server
+
+}; // namespace HLX
+
+#endif // OPENHLXSERVERCONNECTIONSTREAMBASIS_HPP
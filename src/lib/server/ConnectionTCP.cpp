@@ -0,0 +1,450 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for a HLX server peer-to-peer
+ *      network connection that uses raw TCP, without telnet protocol
+ *      encoding.
+ *
+ */
+
+#include <ConnectionTCP.hpp>
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sys/socket.h>
+
+#include <CoreFoundation/CFStream.h>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/EventLoop.hpp>
+#include <OpenHLX/Common/SocketRing.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+#include "ConnectionWorker.hpp"
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+// Preprocessor Defintions
+
+/**
+ *  @def SEND_FLAGS
+ *
+ *  @brief
+ *    A portability mnemonic to address platforms which have or have
+ *    not defined MSG_NOSIGNAL.
+ *
+ */
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+// Static Class Data Members
+
+/**
+ *  @brief
+ *    A CoreFoundation string constant for the URL protocol scheme
+ *    supported by this connection.
+ *
+ */
+CFStringRef ConnectionTCP :: kScheme = CFSTR("tcp");
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+ConnectionTCP :: ConnectionTCP(void) :
+    ConnectionStreamBasis(kScheme),
+    mSocket(-1)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  This constructs an instance of the class with the specified URL
+ *  scheme, for derived connections that exchange data over a socket
+ *  other than TCP in the same way.
+ *
+ *  @param[in]  aSchemeRef  A reference to a CoreFoundation string
+ *                          containing the protocol (for example,
+ *                          "unix") scheme supported by the
+ *                          connection.
+ *
+ */
+ConnectionTCP :: ConnectionTCP(CFStringRef aSchemeRef) :
+    ConnectionStreamBasis(aSchemeRef),
+    mSocket(-1)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionTCP :: ~ConnectionTCP(void)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    Open the connection for a connected peer.
+ *
+ *  With a native socket ring or event loop, this registers the
+ *  accepted socket with it directly rather than creating socket
+ *  streams.
+ *
+ *  @param[in]  aSocket  An immutable reference to the native socket
+ *                       descriptor associated with the accepted
+ *                       connection.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If the stream clients could not be set.
+ *  @retval  -ECONNREFUSED    If read and write streams could not be
+ *                            created for the socket.
+ *  @retval  -EIO             If read and write streams could not be
+ *                            opened for the socket.
+ *  @retval  -errno           The system error associated with
+ *                            registering the socket with a native
+ *                            event loop.
+ *
+ */
+Status
+ConnectionTCP :: OpenStreams(const int &aSocket)
+{
+    Status lRetval = kStatus_Success;
+
+    if (GetRunLoopParameters().GetSocketRing() != nullptr)
+    {
+        lRetval = GetRunLoopParameters().GetSocketRing()->Receive(aSocket, this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        mSocket = aSocket;
+    }
+    else if (GetRunLoopParameters().GetEventLoop() != nullptr)
+    {
+        lRetval = GetRunLoopParameters().GetEventLoop()->Add(aSocket, EventLoop::kEventReadable, this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        mSocket = aSocket;
+    }
+    else
+    {
+        lRetval = ConnectionStreamBasis::OpenStreams(aSocket);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Close the socket or the read and write stream associated with a
+ *    connected peer.
+ *
+ *  @retval  kStatus_Success  Unconditionally.
+ *
+ */
+Status
+ConnectionTCP :: CloseStreams(void)
+{
+    if (mSocket != -1)
+    {
+        if (GetRunLoopParameters().GetSocketRing() != nullptr)
+        {
+            GetRunLoopParameters().GetSocketRing()->Remove(mSocket);
+        }
+        else
+        {
+            GetRunLoopParameters().GetEventLoop()->Remove(mSocket);
+        }
+
+        mSocket = -1;
+    }
+
+    return (ConnectionStreamBasis::CloseStreams());
+}
+
+/**
+ *  @brief
+ *    Send the specified data to the connection peer.
+ *
+ *  If the connection is sharded to a worker and this is invoked from
+ *  other than the worker thread, the data is posted to the worker,
+ *  which sends it on its run loop.
+ *
+ *  @param[in]  aBuffer  An immutable shared pointer to the data to
+ *                       send to the connection peer.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  -ENOTCONN              If the connection streams are not
+ *                                  open.
+ *  @retval  kError_NotInitialized  If the connection worker has not
+ *                                  been initialized.
+ *
+ */
+Status
+ConnectionTCP :: Send(ConnectionBuffer::ImmutableCountedPointer aBuffer)
+{
+    ConnectionWorker * lWorker = GetWorker();
+    Status             lRetval = kStatus_Success;
+
+    if ((lWorker != nullptr) && !lWorker->IsCurrent())
+    {
+        lRetval = lWorker->Send(*this, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+    else
+    {
+        nlEXPECT_ACTION(AreStreamsOpen() || (mSocket != -1), done, lRetval = -ENOTCONN);
+
+        // Each fragment of a chained buffer is sent in turn. With a
+        // native socket ring, the fragment itself, rather than a copy,
+        // is queued and sent in the next batch, which the ring submits
+        // once per event loop iteration; only a fragment that does not
+        // own its data is copied. Otherwise, the data is coalesced and
+        // written at the end of the run loop iteration.
+
+        for (; aBuffer; aBuffer = aBuffer->GetNext())
+        {
+            if (GetRunLoopParameters().GetSocketRing() != nullptr)
+            {
+                lRetval = GetRunLoopParameters().GetSocketRing()->Send(mSocket, aBuffer);
+                nlREQUIRE_SUCCESS(lRetval, done);
+            }
+            else
+            {
+                lRetval = Transmit(aBuffer->GetHead(), aBuffer->GetSize());
+                nlREQUIRE_SUCCESS(lRetval, done);
+            }
+        }
+    }
+
+done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Delegation from a native event loop that the connection socket
+ *    is ready.
+ *
+ *  This handles any socket activity associated with the connected
+ *  peer, as the read stream callback does for socket streams.
+ *
+ *  @param[in]  aEventLoop   A reference to the native event loop that
+ *                           issued the delegation.
+ *  @param[in]  aDescriptor  An immutable reference to the connection
+ *                           socket that is ready.
+ *  @param[in]  aEvents      An immutable reference to the events that
+ *                           are ready.
+ *
+ */
+void
+ConnectionTCP :: EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents)
+{
+    static const size_t  kRequestedBytes = 4096;
+    uint8_t              lBuffer[kRequestedBytes];
+    ssize_t              lResult;
+
+    nlEXPECT(aDescriptor == mSocket, done);
+
+    // Always attempt to read first, even on hangup, such that any
+    // data the peer sent before it hung up is dispatched.
+
+    if ((aEvents & (EventLoop::kEventReadable | EventLoop::kEventHangup | EventLoop::kEventError)) != 0)
+    {
+        do {
+            lResult = recv(aDescriptor, lBuffer, kRequestedBytes, 0);
+        } while ((lResult == -1) && (errno == EINTR));
+
+        if (lResult > 0)
+        {
+            DidReceiveDataHandler(lBuffer, static_cast<size_t>(lResult));
+        }
+        else if (lResult == 0)
+        {
+            const CFStreamError lStreamError = { kCFStreamErrorDomainPOSIX, ECONNRESET };
+
+            HandleStreamError(kCFStreamEventEndEncountered, lStreamError, "socket");
+        }
+        else if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+        {
+            const CFStreamError lStreamError = { kCFStreamErrorDomainPOSIX, errno };
+
+            HandleStreamError(kCFStreamEventErrorOccurred, lStreamError, "socket");
+        }
+    }
+
+    // Once the socket can again accept data, write any data it
+    // previously could not accept and, if it has now accepted all of
+    // it, cease waiting for it to become writable.
+
+    if (((aEvents & EventLoop::kEventWritable) != 0) && (mSocket != -1))
+    {
+        ResumeTransmit();
+
+        if (!IsTransmitBlocked())
+        {
+            (void)aEventLoop.Modify(mSocket, EventLoop::kEventReadable);
+        }
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Delegation from a native socket ring that data was received on
+ *    the connection socket.
+ *
+ *  @param[in]  aSocketRing  A reference to the native socket ring
+ *                           that issued the delegation.
+ *  @param[in]  aSocket      An immutable reference to the connection
+ *                           socket.
+ *  @param[in]  aBuffer      A pointer to the data received.
+ *  @param[in]  aSize        An immutable reference to the size, in
+ *                           bytes, of the data received.
+ *
+ */
+void
+ConnectionTCP :: SocketRingDidReceive(SocketRing &aSocketRing, const int &aSocket, const uint8_t *aBuffer, const size_t &aSize)
+{
+    (void)aSocketRing;
+    (void)aSocket;
+
+    DidReceiveDataHandler(aBuffer, aSize);
+}
+
+/**
+ *  @brief
+ *    Delegation from a native socket ring that a receive or send on
+ *    the connection socket failed or that the peer closed it.
+ *
+ *  @param[in]  aSocketRing  A reference to the native socket ring
+ *                           that issued the delegation.
+ *  @param[in]  aSocket      An immutable reference to the connection
+ *                           socket.
+ *  @param[in]  aError       An immutable reference to the error
+ *                           associated with the failure.
+ *
+ */
+void
+ConnectionTCP :: SocketRingError(SocketRing &aSocketRing, const int &aSocket, const Error &aError)
+{
+    const CFStreamEventType  lType        = ((aError == -ECONNRESET) ? kCFStreamEventEndEncountered : kCFStreamEventErrorOccurred);
+    const CFStreamError      lStreamError = { kCFStreamErrorDomainPOSIX, -aError };
+
+    (void)aSocketRing;
+    (void)aSocket;
+
+    HandleStreamError(lType, lStreamError, "socket");
+}
+
+/**
+ *  @brief
+ *    Write the specified data to the connection peer.
+ *
+ *  If the peer accepts less than all of the data, the connection
+ *  basis keeps the remainder and this connection resumes writing it
+ *  once the socket or write stream can again accept data.
+ *
+ *  @param[in]  aBuffer  A pointer to the data to write.
+ *  @param[in]  aSize    An immutable reference to the size, in bytes,
+ *                       of the data to write.
+ *
+ *  @returns
+ *    The number of bytes of the data the peer accepted.
+ *
+ */
+size_t
+ConnectionTCP :: ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize)
+{
+    ssize_t lResult = 0;
+    size_t  lRetval = 0;
+
+    if (mSocket != -1)
+    {
+        // With a native event loop, write to the socket directly.
+
+        do {
+            lResult = send(mSocket, aBuffer, aSize, SEND_FLAGS);
+        } while ((lResult == -1) && (errno == EINTR));
+
+        if (lResult > 0)
+        {
+            lRetval = static_cast<size_t>(lResult);
+        }
+
+        // Wait for the socket to become writable to write the
+        // remainder, unless the write failed outright, in which case
+        // the error is handled when the socket is next read.
+
+        if (lRetval != aSize)
+        {
+            Log::Debug().Write("Only wrote %zu of %zu bytes!\n", lRetval, aSize);
+
+            if ((GetRunLoopParameters().GetEventLoop() != nullptr) &&
+                ((lResult != -1) || (errno == EAGAIN) || (errno == EWOULDBLOCK)))
+            {
+                (void)GetRunLoopParameters().GetEventLoop()->Modify(mSocket, (EventLoop::kEventReadable | EventLoop::kEventWritable));
+            }
+        }
+    }
+    else
+    {
+        lRetval = ConnectionStreamBasis::ShouldTransmitDataHandler(aBuffer, aSize);
+    }
+
+    return (lRetval);
+}
+
+}; // namespace Server
+
+}; // namespace HLX
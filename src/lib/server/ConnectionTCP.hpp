@@ -0,0 +1,107 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for a HLX server peer-to-peer
+ *      network connection that uses raw TCP, without telnet protocol
+ *      encoding.
+ *
+ */
+
+#ifndef OPENHLXSERVERCONNECTIONTCP_HPP
+#define OPENHLXSERVERCONNECTIONTCP_HPP
+
+#include <CoreFoundation/CFString.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoopDelegate.hpp>
+#include <OpenHLX/Common/SocketRingDelegate.hpp>
+#include <OpenHLX/Server/ConnectionStreamBasis.hpp>
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  @brief
+ *    An object for a HLX server peer-to-peer network connection that
+ *    uses raw TCP.
+ *
+ *  Unlike #ConnectionTelnet, data is read from and written to the
+ *  connection socket streams directly, without telnet protocol
+ *  encoding or decoding and without the telnet session confirmation
+ *  exchange. This is suitable for peers, such as other OpenHLX
+ *  clients and proxies, that do not require telnet.
+ *
+ *  When the run loop parameters the connection is initialized with
+ *  have a native event loop, the connection socket is registered with
+ *  that event loop and read from and written to directly, rather than
+ *  through CoreFoundation socket streams. When they also have a
+ *  native socket ring, the connection instead receives with a single
+ *  multishot receive on that socket ring and sends through it,
+ *  batched with the sends of all other connections.
+ *
+ *  @ingroup server
+ *
+ */
+class ConnectionTCP :
+    public Server::ConnectionStreamBasis,
+    public Common::EventLoopDelegate,
+    public Common::SocketRingDelegate
+{
+public:
+    static CFStringRef kScheme;
+
+public:
+    ConnectionTCP(void);
+    virtual ~ConnectionTCP(void);
+
+    Common::Status Send(Common::ConnectionBuffer::ImmutableCountedPointer aBuffer) final;
+
+    // Event Loop Delegate Method
+
+    void EventLoopIsReady(Common::EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) final;
+
+    // Socket Ring Delegate Methods
+
+    void SocketRingDidReceive(Common::SocketRing &aSocketRing, const int &aSocket, const uint8_t *aBuffer, const size_t &aSize) final;
+    void SocketRingError(Common::SocketRing &aSocketRing, const int &aSocket, const Common::Error &aError) final;
+
+protected:
+    ConnectionTCP(CFStringRef aSchemeRef);
+
+private:
+    Common::Status OpenStreams(const int &aSocket) final;
+    Common::Status CloseStreams(void) final;
+
+    size_t ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize) final;
+
+private:
+    int                                              mSocket;
+};
+
+}; // namespace Server
+
+}; // namespace HLX
+
+#endif // OPENHLXSERVERCONNECTIONTCP_HPP
@@ -26,30 +26,18 @@
 #ifndef OPENHLXSERVERCONNECTIONTELNET_HPP
 #define OPENHLXSERVERCONNECTIONTELNET_HPP
 
-#include <sys/socket.h>
-
-#include <CoreFoundation/CFStream.h>
-#include <CoreFoundation/CFURL.h>
+#include <CoreFoundation/CFString.h>
 
 #include <libtelnet.h>
 
 #include <OpenHLX/Common/ConnectionBuffer.hpp>
 #include <OpenHLX/Common/Errors.hpp>
-#include <OpenHLX/Common/RegularExpression.hpp>
-#include <OpenHLX/Common/Timeout.hpp>
-#include <OpenHLX/Server/ConnectionBasis.hpp>
+#include <OpenHLX/Server/ConnectionStreamBasis.hpp>
 
 
 namespace HLX
 {
 
-namespace Common
-{
-
-    class ConnectionBuffer;
-
-}; // namespace Common
-
 namespace Server
 {
 
@@ -62,7 +50,7 @@ namespace Server
  *
  */
 class ConnectionTelnet :
-    public Server::ConnectionBasis
+    public Server::ConnectionStreamBasis
 {
 public:
     static CFStringRef kScheme;
@@ -74,39 +62,20 @@ public:
     Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters,
                         const IdentifierType &aIdentifier) final;
 
-    Common::Status Connect(const int &aSocket,
-                           const Common::SocketAddress &aPeerAddress) final;
-    Common::Status Disconnect(void) final;
-
     Common::Status Send(Common::ConnectionBuffer::ImmutableCountedPointer aBuffer) final;
 
-    static void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType, void *aContext);
-    static void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType, void *aContext);
     static void TelnetEventHandler(telnet_t *aTelnet, telnet_event_t *aEvent, void *aContext);
 
 private:
-    Common::Status CloseStreams(void);
-
-    Common::Status Put(Common::ConnectionBuffer &aBuffer, const uint8_t *aData, const size_t &aSize);
-
-    void CFReadStreamCallback(CFReadStreamRef aStream, CFStreamEventType aType);
-    void CFWriteStreamCallback(CFWriteStreamRef aStream, CFStreamEventType aType);
+    void ResetSession(void) final;
+    void DidReadDataHandler(const uint8_t *aBuffer, const size_t &aSize) final;
+    void CanTransmitDataHandler(void) final;
 
-    void TryServerConfirmationDataReceived(void);
-    void DidReceiveDataHandler(const uint8_t *aBuffer, const size_t &aSize);
-    void ShouldTransmitDataHandler(const uint8_t *aBuffer, const size_t &aSize);
     void TelnetEventHandler(telnet_t *aTelnet, telnet_event_t *aEvent);
-    void HandleStreamError(const CFStreamEventType &aType, const CFStreamError &aStreamError, const char *aStreamDescription);
 
 private:
     telnet_t *                                       mTelnet;
-    CFReadStreamRef                                  mReadStreamRef;
-    CFWriteStreamRef                                 mWriteStreamRef;
-    bool                                             mReadStreamReady;
-    bool                                             mWriteStreamReady;
-    Common::ConnectionBuffer::MutableCountedPointer  mReceiveBuffer;
     bool                                             mWaitingForServerConfirmation;
-    Common::RegularExpression                        mServerConfirmationRegexp;
 };
 
 }; // namespace Server
@@ -0,0 +1,79 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file implements an object for a HLX server peer-to-peer
+ *      connection that uses local (Unix domain) sockets, without
+ *      telnet protocol encoding.
+ *
+ */
+
+#include <ConnectionUnix.hpp>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+namespace HLX
+{
+
+namespace Server
+{
+
+// Static Class Data Members
+
+/**
+ *  @brief
+ *    A CoreFoundation string constant for the URL protocol scheme
+ *    supported by this connection.
+ *
+ */
+CFStringRef ConnectionUnix :: kScheme = CFSTR("unix");
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+ConnectionUnix :: ConnectionUnix(void) :
+    ConnectionTCP(kScheme)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionUnix :: ~ConnectionUnix(void)
+{
+    DeclareScopedFunctionTracer(lTracer);
+
+    return;
+}
+
+}; // namespace Server
+
+}; // namespace HLX
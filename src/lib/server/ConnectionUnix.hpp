@@ -0,0 +1,70 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+
+/**
+ *    @file
+ *      This file defines an object for a HLX server peer-to-peer
+ *      connection that uses local (Unix domain) sockets, without
+ *      telnet protocol encoding.
+ *
+ */
+
+#ifndef OPENHLXSERVERCONNECTIONUNIX_HPP
+#define OPENHLXSERVERCONNECTIONUNIX_HPP
+
+#include <CoreFoundation/CFString.h>
+
+#include <OpenHLX/Server/ConnectionTCP.hpp>
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  @brief
+ *    An object for a HLX server peer-to-peer connection that uses
+ *    local (Unix domain) sockets.
+ *
+ *  Once accepted, a local socket is read from and written to exactly
+ *  as a raw TCP one is, with the same command protocol. Only the
+ *  protocol scheme, and hence the URL with which the peer is
+ *  identified, differs.
+ *
+ *  @ingroup server
+ *
+ */
+class ConnectionUnix :
+    public ConnectionTCP
+{
+public:
+    static CFStringRef kScheme;
+
+public:
+    ConnectionUnix(void);
+    virtual ~ConnectionUnix(void);
+};
+
+}; // namespace Server
+
+}; // namespace HLX
+
+#endif // OPENHLXSERVERCONNECTIONUNIX_HPP
@@ -0,0 +1,711 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for performing the input and
+ *      output of HLX server client connections on a worker thread and
+ *      run loop of its own.
+ *
+ */
+
+#include "ConnectionWorker.hpp"
+
+#include <errno.h>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/ConcurrentRunLoopQueue.hpp>
+#include <OpenHLX/Server/ConnectionBasis.hpp>
+#include <OpenHLX/Server/ConnectionWorkerPool.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  The delimiter terminating each HLX client request.
+ *
+ */
+static const uint8_t kRequestDelimiter = ']';
+
+/**
+ *  The most data, in bytes, that may be held while waiting for the
+ *  remainder of a partially-received request, well in excess of the
+ *  longest valid request. Anything beyond this is discarded.
+ *
+ */
+static const size_t  kPartialRequestMax = 4096;
+
+/**
+ *  @brief
+ *    Post a connection delegation to the worker pool.
+ *
+ *  @param[in]  aPool        A reference to the pool to post the
+ *                           delegation to.
+ *  @param[in]  aWorker      A reference to the worker posting the
+ *                           delegation.
+ *  @param[in]  aType        The type of delegation to post.
+ *  @param[in]  aConnection  A reference to the connection that
+ *                           issued the delegation.
+ *  @param[in]  aError       An immutable reference to the error, if
+ *                           any, associated with the delegation.
+ *  @param[in]  aBuffer      The application data, if any, associated
+ *                           with the delegation.
+ *
+ *  @private
+ *
+ */
+static void
+Forward(ConnectionWorkerPool &aPool,
+        ConnectionWorker &aWorker,
+        const ConnectionWorkerPool::EventType &aType,
+        ConnectionBasis &aConnection,
+        const Common::Error &aError,
+        ConnectionBuffer::MutableCountedPointer aBuffer)
+{
+    ConnectionWorkerPool::Event  lEvent;
+    Status                       lStatus;
+
+    lEvent.mType       = aType;
+    lEvent.mWorker     = &aWorker;
+    lEvent.mConnection = &aConnection;
+    lEvent.mError      = aError;
+    lEvent.mBuffer     = aBuffer;
+
+    lStatus = aPool.Post(lEvent);
+    nlVERIFY_SUCCESS(lStatus);
+}
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+ConnectionWorker :: ConnectionWorker(void) :
+    ConnectionBasisDelegate(),
+    ConcurrentRunLoopQueueDelegate(),
+    mPool(nullptr),
+    mThread(),
+    mStopping(false),
+    mRunLoopParameters(),
+    mRequests(),
+    mConnectionCount(0)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionWorker :: ~ConnectionWorker(void)
+{
+    Stop();
+}
+
+/**
+ *  @brief
+ *    This is a class initializer.
+ *
+ *  This initializes the worker and starts its thread and run loop,
+ *  returning once the worker run loop is ready to host connections.
+ *
+ *  @param[in]  aPool  A reference to the pool to which the worker
+ *                     belongs and to which it is to post the
+ *                     delegations of its connections.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EBUSY           If the worker has already been started.
+ *  @retval  -ENOMEM          Resources for the worker request queue
+ *                            could not be allocated.
+ *
+ */
+Status
+ConnectionWorker :: Init(ConnectionWorkerPool &aPool)
+{
+    std::promise<Status>  lStarted;
+    std::future<Status>   lStartedResult = lStarted.get_future();
+    Status                lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(!mThread.joinable(), done, lRetval = -EBUSY);
+
+    mPool     = &aPool;
+    mStopping = false;
+
+    mThread = std::thread(&ConnectionWorker::Run, this, std::ref(lStarted));
+
+    // Wait for the worker to either start its run loop or fail
+    // trying.
+
+    lRetval = lStartedResult.get();
+
+    if (lRetval != kStatus_Success)
+    {
+        mThread.join();
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Stop the worker.
+ *
+ *  This stops the worker run loop and waits for the worker thread to
+ *  exit. Any operations posted to but not yet performed by the worker
+ *  are discarded.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+ConnectionWorker :: Stop(void)
+{
+    Status  lRetval = kStatus_Success;
+
+    nlEXPECT(mThread.joinable(), done);
+
+    mStopping = true;
+
+    CFRunLoopStop(mRunLoopParameters.GetRunLoop());
+
+    mThread.join();
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return the worker run loop parameters.
+ *
+ *  @returns
+ *    An immutable reference to the run loop parameters on which
+ *    connections sharded to the worker are to be initialized.
+ *
+ */
+const RunLoopParameters &
+ConnectionWorker :: GetRunLoopParameters(void) const
+{
+    return (mRunLoopParameters);
+}
+
+/**
+ *  @brief
+ *    Return the number of connections sharded to the worker.
+ *
+ *  @note
+ *    This may only be called from the owner run loop.
+ *
+ *  @returns
+ *    The number of connections connected to, but not yet released
+ *    from, the worker.
+ *
+ */
+size_t
+ConnectionWorker :: GetConnectionCount(void) const
+{
+    return (mConnectionCount);
+}
+
+/**
+ *  @brief
+ *    Determine whether the caller is running on the worker thread.
+ *
+ *  @returns
+ *    True if the caller is running on the worker thread; otherwise,
+ *    false.
+ *
+ */
+bool
+ConnectionWorker :: IsCurrent(void) const
+{
+    return (std::this_thread::get_id() == mThread.get_id());
+}
+
+/**
+ *  @brief
+ *    Connect a connection to its peer on the worker run loop.
+ *
+ *  This posts to the worker the connection of the specified
+ *  connection, initialized on the worker run loop, to the peer at
+ *  the specified socket and peer address. The outcome is delegated by
+ *  the connection, as with any other, by way of the pool.
+ *
+ *  @param[in]  aConnection   A reference to the connection to
+ *                            connect.
+ *  @param[in]  aSocket       An immutable reference to the native
+ *                            socket descriptor associated with the
+ *                            accepted connection.
+ *  @param[in]  aPeerAddress  An immutable reference to the socket
+ *                            address associated with the peer client
+ *                            at the remote end of the accepted
+ *                            connection.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the worker has not been
+ *                                  started.
+ *
+ */
+Status
+ConnectionWorker :: Connect(ConnectionBasis &aConnection, const int &aSocket, const SocketAddress &aPeerAddress)
+{
+    Request  lRequest;
+    Status   lRetval;
+
+    lRequest.mOperation   = kOperation_Connect;
+    lRequest.mConnection  = &aConnection;
+    lRequest.mSocket      = aSocket;
+    lRequest.mPeerAddress = aPeerAddress;
+
+    lRetval = Post(lRequest);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mConnectionCount++;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Send data over a connection on the worker run loop.
+ *
+ *  This posts to the worker the sending of the specified data over
+ *  the specified connection.
+ *
+ *  @note
+ *    Since the data is sent asynchronously, it must not be mutated
+ *    once sent.
+ *
+ *  @param[in]  aConnection  A reference to the connection to send
+ *                           the data over.
+ *  @param[in]  aBuffer      An immutable shared pointer to the data
+ *                           to send.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the worker has not been
+ *                                  started.
+ *
+ */
+Status
+ConnectionWorker :: Send(ConnectionBasis &aConnection, ConnectionBuffer::ImmutableCountedPointer aBuffer)
+{
+    Request  lRequest;
+
+    lRequest.mOperation  = kOperation_Send;
+    lRequest.mConnection = &aConnection;
+    lRequest.mSocket     = -1;
+    lRequest.mBuffer     = aBuffer;
+
+    return (Post(lRequest));
+}
+
+/**
+ *  @brief
+ *    Disconnect a connection from its peer on the worker run loop.
+ *
+ *  This posts to the worker the disconnection of the specified
+ *  connection from its peer. The outcome is delegated by the
+ *  connection itself and posted back to the pool as any other
+ *  disconnection.
+ *
+ *  @param[in]  aConnection  A reference to the connection to
+ *                           disconnect.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the worker has not been
+ *                                  started.
+ *
+ */
+Status
+ConnectionWorker :: Disconnect(ConnectionBasis &aConnection)
+{
+    Request  lRequest;
+
+    lRequest.mOperation  = kOperation_Disconnect;
+    lRequest.mConnection = &aConnection;
+    lRequest.mSocket     = -1;
+
+    return (Post(lRequest));
+}
+
+/**
+ *  @brief
+ *    Release a connection from the worker.
+ *
+ *  This posts to the worker the release of the specified connection
+ *  which, once performed, the worker confirms by posting a release
+ *  delegation back to the pool. Since the worker performs operations
+ *  in the order posted, the connection is no longer in use on the
+ *  worker run loop once the confirmation is delivered.
+ *
+ *  @param[in]  aConnection  A reference to the connection to
+ *                           release.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the worker has not been
+ *                                  started.
+ *
+ */
+Status
+ConnectionWorker :: Release(ConnectionBasis &aConnection)
+{
+    Request  lRequest;
+
+    lRequest.mOperation  = kOperation_Release;
+    lRequest.mConnection = &aConnection;
+    lRequest.mSocket     = -1;
+
+    return (Post(lRequest));
+}
+
+/**
+ *  @brief
+ *    Account for the confirmed release of a connection from the
+ *    worker.
+ *
+ *  @note
+ *    This may only be called from the owner run loop.
+ *
+ *  @param[in]  aConnection  A reference to the released connection.
+ *
+ */
+void
+ConnectionWorker :: DidRelease(ConnectionBasis &aConnection)
+{
+    (void)aConnection;
+
+    if (mConnectionCount > 0)
+    {
+        mConnectionCount--;
+    }
+}
+
+/**
+ *  @brief
+ *    Post an operation to the worker run loop.
+ *
+ *  @param[in]  aRequest  An immutable reference to the operation to
+ *                        post.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  -ENOMEM                If resources for the operation
+ *                                  could not be allocated.
+ *  @retval  kError_NotInitialized  If the worker has not been
+ *                                  started.
+ *
+ */
+Status
+ConnectionWorker :: Post(const Request &aRequest)
+{
+    Request *  lRequest = nullptr;
+    Status     lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mRequests != nullptr, done, lRetval = kError_NotInitialized);
+
+    lRequest = new Request(aRequest);
+    nlREQUIRE_ACTION(lRequest != nullptr, done, lRetval = -ENOMEM);
+
+    lRetval = mRequests->Push(lRequest);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRequest = nullptr;
+
+ done:
+    if (lRequest != nullptr)
+    {
+        delete lRequest;
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Run the worker run loop.
+ *
+ *  This is the body of the worker thread, which establishes the
+ *  worker run loop, signals the outcome of doing so, and then runs
+ *  the run loop until the worker is stopped.
+ *
+ *  @param[in,out]  aStarted  A reference to the promise through which
+ *                            to signal whether the worker run loop
+ *                            was successfully established.
+ *
+ */
+void
+ConnectionWorker :: Run(std::promise<Status> &aStarted)
+{
+    CFRunLoopRef  lRunLoop = CFRunLoopGetCurrent();
+    Status        lStatus = kStatus_Success;
+
+    lStatus = mRunLoopParameters.Init(lRunLoop, kCFRunLoopDefaultMode);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    mRequests.reset(new ConcurrentRunLoopQueue());
+    nlREQUIRE_ACTION(mRequests != nullptr, done, lStatus = -ENOMEM);
+
+    lStatus = mRequests->Init(mRunLoopParameters);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lStatus = mRequests->SetDelegate(this);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+ done:
+    if (lStatus != kStatus_Success)
+    {
+        mRequests.reset();
+    }
+
+    // The promise belongs to the starting thread and must not be
+    // touched once its value has been set.
+
+    aStarted.set_value(lStatus);
+
+    if (lStatus == kStatus_Success)
+    {
+        // The run loop may return early if it is stopped before it
+        // starts running; keep running it until the worker is
+        // stopped.
+
+        while (!mStopping)
+        {
+            CFRunLoopRun();
+        }
+
+        // Discard any operations posted to but not yet performed by
+        // the worker and then the queue itself, which must be
+        // destroyed on the worker run loop.
+
+        Flush();
+
+        mRequests.reset();
+    }
+}
+
+/**
+ *  @brief
+ *    Discard any operations posted to but not yet performed by the
+ *    worker.
+ *
+ */
+void
+ConnectionWorker :: Flush(void)
+{
+    ConcurrentRunLoopQueue::element_type  lElement;
+
+    while ((lElement = mRequests->Pop()) != nullptr)
+    {
+        delete static_cast<Request *>(lElement);
+    }
+}
+
+// MARK: Connection Basis Delegate Methods
+
+// MARK: Connection Basis Accept Methods
+
+void
+ConnectionWorker :: ConnectionWillAccept(ConnectionBasis &aConnection)
+{
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_WillAccept, aConnection, kStatus_Success, nullptr);
+}
+
+void
+ConnectionWorker :: ConnectionIsAccepting(ConnectionBasis &aConnection)
+{
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_IsAccepting, aConnection, kStatus_Success, nullptr);
+}
+
+void
+ConnectionWorker :: ConnectionDidAccept(ConnectionBasis &aConnection)
+{
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_DidAccept, aConnection, kStatus_Success, nullptr);
+}
+
+void
+ConnectionWorker :: ConnectionDidNotAccept(ConnectionBasis &aConnection, const Common::Error &aError)
+{
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_DidNotAccept, aConnection, aError, nullptr);
+}
+
+// MARK: Connection Basis Application Data Methods
+
+/**
+ *  @brief
+ *    Delegation from a connection that the connection has received
+ *    application data.
+ *
+ *  This frames the application data received so far into whole
+ *  requests and posts those to the pool, retaining any trailing,
+ *  partially-received request until the remainder of it arrives.
+ *
+ *  @param[in]  aConnection  A reference to the connection that
+ *                           issued the delegation.
+ *  @param[in]  aBuffer      The buffer containing the received
+ *                           application data.
+ *
+ */
+void
+ConnectionWorker :: ConnectionDidReceiveApplicationData(ConnectionBasis &aConnection, ConnectionBuffer::MutableCountedPointer aBuffer)
+{
+    const uint8_t *                          lHead = aBuffer->GetHead();
+    size_t                                   lRequestsSize = aBuffer->GetSize();
+    ConnectionBuffer::MutableCountedPointer  lRequests;
+    Status                                   lStatus;
+
+    // Find the end of the last whole request received so far.
+
+    while ((lRequestsSize > 0) && (lHead[lRequestsSize - 1] != kRequestDelimiter))
+    {
+        lRequestsSize--;
+    }
+
+    nlEXPECT(lRequestsSize > 0, done);
+
+    lStatus = ConnectionBuffer::Create(lRequests);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    lStatus = Common::Utilities::Put(*lRequests.get(), lHead, lRequestsSize);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    aBuffer->Get(lRequestsSize);
+
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_DidReceiveApplicationData, aConnection, kStatus_Success, lRequests);
+
+ done:
+    if (aBuffer->GetSize() > kPartialRequestMax)
+    {
+        aBuffer->Flush();
+    }
+
+    return;
+}
+
+// MARK: Connection Basis Disconnect Methods
+
+void
+ConnectionWorker :: ConnectionWillDisconnect(ConnectionBasis &aConnection, CFURLRef aURLRef)
+{
+    (void)aURLRef;
+
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_WillDisconnect, aConnection, kStatus_Success, nullptr);
+}
+
+void
+ConnectionWorker :: ConnectionDidDisconnect(ConnectionBasis &aConnection, CFURLRef aURLRef, const Common::Error &aError)
+{
+    (void)aURLRef;
+
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_DidDisconnect, aConnection, aError, nullptr);
+}
+
+void
+ConnectionWorker :: ConnectionDidNotDisconnect(ConnectionBasis &aConnection, CFURLRef aURLRef, const Common::Error &aError)
+{
+    (void)aURLRef;
+
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_DidNotDisconnect, aConnection, aError, nullptr);
+}
+
+// MARK: Connection Basis Error Method
+
+void
+ConnectionWorker :: ConnectionError(ConnectionBasis &aConnection, const Common::Error &aError)
+{
+    Forward(*mPool, *this, ConnectionWorkerPool::kEventType_Error, aConnection, aError, nullptr);
+}
+
+// MARK: Concurrent Run Loop Queue Delegate Method
+
+/**
+ *  @brief
+ *    Delegation from the worker request queue that the queue is not
+ *    empty.
+ *
+ *  This performs, in the order posted, all of the operations posted
+ *  to the worker since it last performed work.
+ *
+ *  @param[in]  aQueue  A reference to the run loop queue that
+ *                      issued the delegation.
+ *
+ */
+void
+ConnectionWorker :: QueueIsNotEmpty(ConcurrentRunLoopQueue &aQueue)
+{
+    ConcurrentRunLoopQueue::element_type  lElement;
+    Status                                lStatus;
+
+    while ((lElement = aQueue.Pop()) != nullptr)
+    {
+        Request *  lRequest = static_cast<Request *>(lElement);
+
+        switch (lRequest->mOperation)
+        {
+
+        case kOperation_Connect:
+            // The outcome, successful or not, is delegated by the
+            // connection itself.
+
+            lStatus = lRequest->mConnection->Connect(lRequest->mSocket, lRequest->mPeerAddress);
+            (void)lStatus;
+            break;
+
+        case kOperation_Send:
+            // Data sent over a connection that disconnected before
+            // the send was performed is simply dropped.
+
+            lStatus = lRequest->mConnection->Send(lRequest->mBuffer);
+            (void)lStatus;
+            break;
+
+        case kOperation_Disconnect:
+            // A connection that disconnected on its own before the
+            // disconnection was performed has nothing to disconnect.
+
+            if (lRequest->mConnection->IsConnected())
+            {
+                lStatus = lRequest->mConnection->Disconnect();
+                (void)lStatus;
+            }
+            break;
+
+        case kOperation_Release:
+            Forward(*mPool, *this, ConnectionWorkerPool::kEventType_DidRelease, *lRequest->mConnection, kStatus_Success, nullptr);
+            break;
+
+        }
+
+        delete lRequest;
+    }
+}
+
+}; // namespace Server
+
+}; // namespace HLX
@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for performing the input and
+ *      output of HLX server client connections on a worker thread and
+ *      run loop of its own.
+ *
+ */
+
+#ifndef OPENHLXSERVERCONNECTIONWORKER_HPP
+#define OPENHLXSERVERCONNECTIONWORKER_HPP
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <stddef.h>
+
+#include <CoreFoundation/CFURL.h>
+
+#include <OpenHLX/Common/ConcurrentRunLoopQueueDelegate.hpp>
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Common/SocketAddress.hpp>
+#include <OpenHLX/Server/ConnectionBasisDelegate.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+    class ConcurrentRunLoopQueue;
+
+}; // namespace Common
+
+namespace Server
+{
+
+class ConnectionBasis;
+class ConnectionWorkerPool;
+
+/**
+ *  @brief
+ *    An object for performing the input and output of HLX server
+ *    client connections on a worker thread and run loop of its own.
+ *
+ *  The streams of each connection sharded to the worker are
+ *  scheduled on the worker run loop, such that the telnet decoding
+ *  and framing of requests received from, and the telnet encoding of
+ *  responses sent to, the connection peer are performed on the worker
+ *  thread.
+ *
+ *  The worker, acting as the delegate of its connections, posts
+ *  their delegations, with received application data reduced to
+ *  whole requests, to its pool for delivery on the owner run loop,
+ *  where requests are dispatched and the model is mutated. Likewise,
+ *  connections are connected to, sent over, disconnected, and released
+ *  on behalf of the owner run loop by posting to the worker.
+ *
+ *  @ingroup server
+ *
+ */
+class ConnectionWorker :
+    public ConnectionBasisDelegate,
+    public Common::ConcurrentRunLoopQueueDelegate
+{
+public:
+    ConnectionWorker(void);
+    ~ConnectionWorker(void);
+
+    Common::Status Init(ConnectionWorkerPool &aPool);
+    Common::Status Stop(void);
+
+    const Common::RunLoopParameters &GetRunLoopParameters(void) const;
+    size_t GetConnectionCount(void) const;
+    bool IsCurrent(void) const;
+
+    Common::Status Connect(ConnectionBasis &aConnection, const int &aSocket, const Common::SocketAddress &aPeerAddress);
+    Common::Status Send(ConnectionBasis &aConnection, Common::ConnectionBuffer::ImmutableCountedPointer aBuffer);
+    Common::Status Disconnect(ConnectionBasis &aConnection);
+    Common::Status Release(ConnectionBasis &aConnection);
+
+    void DidRelease(ConnectionBasis &aConnection);
+
+    // Connection Basis Delegate Methods
+
+    // Accept Methods
+
+    void ConnectionWillAccept(ConnectionBasis &aConnection) final;
+    void ConnectionIsAccepting(ConnectionBasis &aConnection) final;
+    void ConnectionDidAccept(ConnectionBasis &aConnection) final;
+    void ConnectionDidNotAccept(ConnectionBasis &aConnection, const Common::Error &aError) final;
+
+    // Application Data Method
+
+    void ConnectionDidReceiveApplicationData(ConnectionBasis &aConnection, Common::ConnectionBuffer::MutableCountedPointer aBuffer) final;
+
+    // Disconnect Methods
+
+    void ConnectionWillDisconnect(ConnectionBasis &aConnection, CFURLRef aURLRef) final;
+    void ConnectionDidDisconnect(ConnectionBasis &aConnection, CFURLRef aURLRef, const Common::Error &aError) final;
+    void ConnectionDidNotDisconnect(ConnectionBasis &aConnection, CFURLRef aURLRef, const Common::Error &aError) final;
+
+    // Error Method
+
+    void ConnectionError(ConnectionBasis &aConnection, const Common::Error &aError) final;
+
+    // Concurrent Run Loop Queue Delegate Method
+
+    void QueueIsNotEmpty(Common::ConcurrentRunLoopQueue &aQueue) final;
+
+private:
+    /**
+     *  @brief
+     *    Enumeration of the operations performed on the worker run
+     *    loop on behalf of the owner run loop.
+     *
+     */
+    enum Operation
+    {
+        kOperation_Connect    = 0, //!< Connect a connection to its peer.
+        kOperation_Send       = 1, //!< Send data over a connection.
+        kOperation_Release    = 2, //!< Release a connection from the worker.
+        kOperation_Disconnect = 3  //!< Disconnect a connection from its peer.
+    };
+
+    /**
+     *  An operation posted to the worker run loop.
+     *
+     */
+    struct Request
+    {
+        Operation                                          mOperation;   //!< The operation to perform.
+        ConnectionBasis *                                  mConnection;  //!< The connection to perform it on.
+        int                                                mSocket;      //!< For connect, the accepted socket.
+        Common::SocketAddress                              mPeerAddress; //!< For connect, the peer address.
+        Common::ConnectionBuffer::ImmutableCountedPointer  mBuffer;      //!< For send, the data to send.
+    };
+
+    void Run(std::promise<Common::Status> &aStarted);
+    void Flush(void);
+
+    Common::Status Post(const Request &aRequest);
+
+private:
+    ConnectionWorkerPool *                            mPool;
+    std::thread                                       mThread;
+    std::atomic<bool>                                 mStopping;
+    Common::RunLoopParameters                         mRunLoopParameters;
+    std::unique_ptr<Common::ConcurrentRunLoopQueue>   mRequests;
+    size_t                                            mConnectionCount;
+};
+
+}; // namespace Server
+
+}; // namespace HLX
+
+#endif // OPENHLXSERVERCONNECTIONWORKER_HPP
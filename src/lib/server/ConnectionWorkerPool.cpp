@@ -0,0 +1,384 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for managing a pool of workers
+ *      among which the input and output of HLX server client
+ *      connections is sharded.
+ *
+ */
+
+#include "ConnectionWorkerPool.hpp"
+
+#include <errno.h>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Common/ConcurrentRunLoopQueue.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+
+
+using namespace HLX::Common;
+using namespace Nuovations;
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+ConnectionWorkerPool :: ConnectionWorkerPool(void) :
+    ConcurrentRunLoopQueueDelegate(),
+    mDelegate(nullptr),
+    mWorkers(),
+    mReleasingConnections(),
+    mEvents()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+ConnectionWorkerPool :: ~ConnectionWorkerPool(void)
+{
+    Stop();
+}
+
+/**
+ *  @brief
+ *    This is a class initializer.
+ *
+ *  This initializes the pool on the owner run loop with the
+ *  specified run loop parameters and starts the specified number of
+ *  workers.
+ *
+ *  @param[in]  aRunLoopParameters  An immutable reference to the run
+ *                                  loop parameters of the owner run
+ *                                  loop on which connection
+ *                                  delegations are to be delivered.
+ *  @param[in]  aWorkers            An immutable reference to the
+ *                                  number of workers to start.
+ *  @param[in]  aDelegate           A reference to the delegate to
+ *                                  deliver connection delegations
+ *                                  to.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If the number of workers is zero.
+ *  @retval  -ENOMEM          Resources for the delegation queue or a
+ *                            worker could not be allocated.
+ *
+ */
+Status
+ConnectionWorkerPool :: Init(const RunLoopParameters &aRunLoopParameters,
+                             const size_t &aWorkers,
+                             ConnectionBasisDelegate &aDelegate)
+{
+    size_t  lWorker;
+    Status  lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(aWorkers > 0, done, lRetval = -EINVAL);
+
+    mEvents.reset(new ConcurrentRunLoopQueue());
+    nlREQUIRE_ACTION(mEvents != nullptr, done, lRetval = -ENOMEM);
+
+    lRetval = mEvents->Init(aRunLoopParameters);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mEvents->SetDelegate(this);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mDelegate = &aDelegate;
+
+    for (lWorker = 0; lWorker < aWorkers; lWorker++)
+    {
+        std::unique_ptr<ConnectionWorker> lConnectionWorker(new ConnectionWorker());
+
+        nlREQUIRE_ACTION(lConnectionWorker != nullptr, done, lRetval = -ENOMEM);
+
+        lRetval = lConnectionWorker->Init(*this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        mWorkers.push_back(std::move(lConnectionWorker));
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Stop the pool.
+ *
+ *  This stops all of the workers in the pool, discards any
+ *  delegations posted by them but not yet delivered, and destroys
+ *  any connections pending release.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+ConnectionWorkerPool :: Stop(void)
+{
+    ConcurrentRunLoopQueue::element_type  lElement;
+    Status                                lRetval = kStatus_Success;
+
+    // Stop the workers first such that no further delegations are
+    // posted while those already posted are discarded.
+
+    mWorkers.clear();
+
+    if (mEvents != nullptr)
+    {
+        while ((lElement = mEvents->Pop()) != nullptr)
+        {
+            delete static_cast<Event *>(lElement);
+        }
+
+        mEvents.reset();
+    }
+
+    mReleasingConnections.clear();
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Return the worker to which the next connection is to be sharded.
+ *
+ *  @returns
+ *    A pointer to the worker with the fewest connections, if the pool
+ *    has any workers; otherwise, null.
+ *
+ */
+ConnectionWorker *
+ConnectionWorkerPool :: GetWorker(void)
+{
+    Workers::const_iterator  lCurrent;
+    ConnectionWorker *       lRetval = nullptr;
+
+    for (lCurrent = mWorkers.begin(); lCurrent != mWorkers.end(); lCurrent++)
+    {
+        if ((lRetval == nullptr) ||
+            ((*lCurrent)->GetConnectionCount() < lRetval->GetConnectionCount()))
+        {
+            lRetval = lCurrent->get();
+        }
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Release a connection from its worker and destroy it.
+ *
+ *  This assumes ownership of the specified connection and releases
+ *  it from its worker. The connection is destroyed once the worker
+ *  confirms the release.
+ *
+ *  @param[in,out]  aConnection  A reference to the owned connection
+ *                               to release, which is null on
+ *                               return.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  -EINVAL                If the connection has not been
+ *                                  sharded to a worker.
+ *  @retval  kError_NotInitialized  If the worker has been stopped.
+ *
+ */
+Status
+ConnectionWorkerPool :: Release(ConnectionPointer &aConnection)
+{
+    ConnectionWorker *  lWorker;
+    Status              lRetval;
+
+    lWorker = aConnection->GetWorker();
+    nlREQUIRE_ACTION(lWorker != nullptr, done, lRetval = -EINVAL);
+
+    lRetval = lWorker->Release(*aConnection);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    mReleasingConnections.push_back(std::move(aConnection));
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Post a connection delegation for delivery on the owner run
+ *    loop.
+ *
+ *  @note
+ *    This may be called from any worker thread.
+ *
+ *  @param[in]  aEvent  An immutable reference to the delegation to
+ *                      post.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  -ENOMEM                If resources for the delegation
+ *                                  could not be allocated.
+ *  @retval  kError_NotInitialized  If the pool has not been
+ *                                  initialized.
+ *
+ */
+Status
+ConnectionWorkerPool :: Post(const Event &aEvent)
+{
+    Event *  lEvent = nullptr;
+    Status   lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(mEvents != nullptr, done, lRetval = kError_NotInitialized);
+
+    lEvent = new Event(aEvent);
+    nlREQUIRE_ACTION(lEvent != nullptr, done, lRetval = -ENOMEM);
+
+    lRetval = mEvents->Push(lEvent);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lEvent = nullptr;
+
+ done:
+    if (lEvent != nullptr)
+    {
+        delete lEvent;
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Deliver a connection delegation to the pool delegate.
+ *
+ *  @param[in]  aEvent  An immutable reference to the delegation to
+ *                      deliver.
+ *
+ */
+void
+ConnectionWorkerPool :: Deliver(const Event &aEvent)
+{
+    ConnectionBasis &  lConnection = *aEvent.mConnection;
+
+    switch (aEvent.mType)
+    {
+
+    case kEventType_WillAccept:
+        mDelegate->ConnectionWillAccept(lConnection);
+        break;
+
+    case kEventType_IsAccepting:
+        mDelegate->ConnectionIsAccepting(lConnection);
+        break;
+
+    case kEventType_DidAccept:
+        mDelegate->ConnectionDidAccept(lConnection);
+        break;
+
+    case kEventType_DidNotAccept:
+        mDelegate->ConnectionDidNotAccept(lConnection, aEvent.mError);
+        break;
+
+    case kEventType_DidReceiveApplicationData:
+        mDelegate->ConnectionDidReceiveApplicationData(lConnection, aEvent.mBuffer);
+        break;
+
+    case kEventType_WillDisconnect:
+        mDelegate->ConnectionWillDisconnect(lConnection, lConnection.GetPeerAddress().GetURL());
+        break;
+
+    case kEventType_DidDisconnect:
+        mDelegate->ConnectionDidDisconnect(lConnection, lConnection.GetPeerAddress().GetURL(), aEvent.mError);
+        break;
+
+    case kEventType_DidNotDisconnect:
+        mDelegate->ConnectionDidNotDisconnect(lConnection, lConnection.GetPeerAddress().GetURL(), aEvent.mError);
+        break;
+
+    case kEventType_Error:
+        mDelegate->ConnectionError(lConnection, aEvent.mError);
+        break;
+
+    case kEventType_DidRelease:
+        {
+            Connections::iterator lCurrent = mReleasingConnections.begin();
+
+            aEvent.mWorker->DidRelease(lConnection);
+
+            // The worker is done with the connection; it may now be
+            // destroyed.
+
+            while (lCurrent != mReleasingConnections.end())
+            {
+                if (lCurrent->get() == &lConnection)
+                {
+                    mReleasingConnections.erase(lCurrent);
+                    break;
+                }
+
+                lCurrent++;
+            }
+        }
+        break;
+
+    }
+}
+
+// MARK: Concurrent Run Loop Queue Delegate Method
+
+/**
+ *  @brief
+ *    Delegation from the pool delegation queue that the queue is not
+ *    empty.
+ *
+ *  This delivers, in the order posted, all of the delegations posted
+ *  by the workers since the pool last delivered any.
+ *
+ *  @param[in]  aQueue  A reference to the run loop queue that
+ *                      issued the delegation.
+ *
+ */
+void
+ConnectionWorkerPool :: QueueIsNotEmpty(ConcurrentRunLoopQueue &aQueue)
+{
+    ConcurrentRunLoopQueue::element_type  lElement;
+
+    while ((lElement = aQueue.Pop()) != nullptr)
+    {
+        Event *  lEvent = static_cast<Event *>(lElement);
+
+        Deliver(*lEvent);
+
+        delete lEvent;
+    }
+}
+
+}; // namespace Server
+
+}; // namespace HLX
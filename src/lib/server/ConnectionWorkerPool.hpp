@@ -0,0 +1,153 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for managing a pool of workers
+ *      among which the input and output of HLX server client
+ *      connections is sharded.
+ *
+ */
+
+#ifndef OPENHLXSERVERCONNECTIONWORKERPOOL_HPP
+#define OPENHLXSERVERCONNECTIONWORKERPOOL_HPP
+
+#include <memory>
+#include <vector>
+
+#include <stddef.h>
+
+#include <OpenHLX/Common/ConcurrentRunLoopQueueDelegate.hpp>
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Server/ConnectionBasis.hpp>
+#include <OpenHLX/Server/ConnectionBasisDelegate.hpp>
+#include <OpenHLX/Server/ConnectionWorker.hpp>
+
+
+namespace HLX
+{
+
+namespace Common
+{
+
+    class ConcurrentRunLoopQueue;
+
+}; // namespace Common
+
+namespace Server
+{
+
+/**
+ *  @brief
+ *    An object for managing a pool of workers among which the input
+ *    and output of HLX server client connections is sharded.
+ *
+ *  The pool delivers the connection delegations posted by its
+ *  workers, in the order each worker posted them, to its delegate on
+ *  the owner run loop.
+ *
+ *  Since a worker may still be handling a connection when the owner
+ *  is finished with it, the pool also assumes ownership of released
+ *  connections, destroying each only once its worker confirms that
+ *  the connection is no longer in use on the worker run loop.
+ *
+ *  @ingroup server
+ *
+ */
+class ConnectionWorkerPool :
+    public Common::ConcurrentRunLoopQueueDelegate
+{
+public:
+    /**
+     *  @brief
+     *    Enumeration of the connection delegations posted by a worker
+     *    for delivery on the owner run loop.
+     *
+     */
+    enum EventType
+    {
+        kEventType_WillAccept                = 0,
+        kEventType_IsAccepting               = 1,
+        kEventType_DidAccept                 = 2,
+        kEventType_DidNotAccept              = 3,
+        kEventType_DidReceiveApplicationData = 4,
+        kEventType_WillDisconnect            = 5,
+        kEventType_DidDisconnect             = 6,
+        kEventType_DidNotDisconnect          = 7,
+        kEventType_Error                     = 8,
+        kEventType_DidRelease                = 9
+    };
+
+    /**
+     *  A connection delegation posted by a worker.
+     *
+     */
+    struct Event
+    {
+        EventType                                        mType;       //!< The delegation type.
+        ConnectionWorker *                               mWorker;     //!< The worker that posted the delegation.
+        ConnectionBasis *                                mConnection; //!< The connection that issued the delegation.
+        Common::Error                                    mError;      //!< The error, if any, associated with the delegation.
+        Common::ConnectionBuffer::MutableCountedPointer  mBuffer;     //!< The application data, if any, associated with the delegation.
+    };
+
+    /**
+     *  A type for an owned connection.
+     *
+     */
+    typedef std::unique_ptr<ConnectionBasis> ConnectionPointer;
+
+public:
+    ConnectionWorkerPool(void);
+    ~ConnectionWorkerPool(void);
+
+    Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters,
+                        const size_t &aWorkers,
+                        ConnectionBasisDelegate &aDelegate);
+    Common::Status Stop(void);
+
+    ConnectionWorker *GetWorker(void);
+
+    Common::Status Release(ConnectionPointer &aConnection);
+
+    Common::Status Post(const Event &aEvent);
+
+    // Concurrent Run Loop Queue Delegate Method
+
+    void QueueIsNotEmpty(Common::ConcurrentRunLoopQueue &aQueue) final;
+
+private:
+    typedef std::vector<std::unique_ptr<ConnectionWorker>>    Workers;
+    typedef std::vector<ConnectionPointer>                    Connections;
+
+    void Deliver(const Event &aEvent);
+
+private:
+    ConnectionBasisDelegate *                         mDelegate;
+    Workers                                           mWorkers;
+    Connections                                       mReleasingConnections;
+    std::unique_ptr<Common::ConcurrentRunLoopQueue>   mEvents;
+};
+
+}; // namespace Server
+
+}; // namespace HLX
+
+#endif // OPENHLXSERVERCONNECTIONWORKERPOOL_HPP
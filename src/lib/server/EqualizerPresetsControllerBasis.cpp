@@ -227,6 +227,59 @@ EqualizerPresetsControllerBasis :: HandleQueryReceived(ConnectionBuffer::Mutable
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Handle and generate the server command response for a equalizer
+ *    preset query request of the equalizer presets changed since a
+ *    change sequence number.
+ *
+ *  This handles and generates the server command response for a
+ *  equalizer preset query request of only those equalizer presets whose
+ *  state has changed since the specified change sequence number.
+ *
+ *  @param[in]      aSequence  An immutable reference to the change
+ *                             sequence number after which changed
+ *                             equalizer presets are to be generated.
+ *  @param[in,out]  aBuffer    A mutable reference to the shared pointer
+ *                             into which the response is to be
+ *                             generated.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the equalizer presets model has
+ *                                  not been completely and successfully
+ *                                  initialized.
+ *  @retval  -ENOMEM                If the buffer-owned backing store
+ *                                  cannot be allocated.
+ *  @retval  -ENOSPC                If the requested size exceeds the
+ *                                  buffer capacity.
+ *
+ */
+Status
+EqualizerPresetsControllerBasis :: HandleQueryChangedReceived(const ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    IdentifiersCollection  lChangedEqualizerPresets;
+    Status                 lRetval;
+
+
+    lRetval = lChangedEqualizerPresets.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mEqualizerPresetsModel.GetEqualizerPresetsChangedSince(aSequence, lChangedEqualizerPresets);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    for (auto lEqualizerPresetIdentifier = IdentifierModel::kIdentifierMin; lEqualizerPresetIdentifier <= mEqualizerPresetsMax; lEqualizerPresetIdentifier++)
+    {
+        if (!lChangedEqualizerPresets.ContainsIdentifier(lEqualizerPresetIdentifier))
+            continue;
+
+        lRetval = HandleQueryReceived(lEqualizerPresetIdentifier, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Handle and generate the server command response for an equalizer
@@ -282,7 +335,7 @@ EqualizerPresetsControllerBasis :: HandleQueryReceived(const Model::EqualizerPre
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // Band Response
@@ -301,7 +354,7 @@ EqualizerPresetsControllerBasis :: HandleQueryReceived(const Model::EqualizerPre
         lBuffer = lBandResponse.GetBuffer();
         lSize = lBandResponse.GetSize();
 
-        lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+        lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
         nlREQUIRE_SUCCESS(lRetval, done);
     }
 
@@ -364,7 +417,7 @@ EqualizerPresetsControllerBasis :: HandleBandResponse(const Model::EqualizerPres
     lBuffer = lBandResponse.GetBuffer();
     lSize = lBandResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
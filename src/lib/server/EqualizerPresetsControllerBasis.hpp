@@ -26,6 +26,7 @@
 #ifndef OPENHLXSERVEREQUALIZERPRESETSCONTROLLERBASIS_HPP
 #define OPENHLXSERVEREQUALIZERPRESETSCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/EqualizerPresetModel.hpp>
 #include <OpenHLX/Model/EqualizerPresetsModel.hpp>
 #include <OpenHLX/Server/EqualizerPresetsControllerCommands.hpp>
@@ -76,6 +77,7 @@ protected:
     // Observation (Query) Command Request Instance Handlers
 
     Common::Status HandleQueryReceived(Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
+    Common::Status HandleQueryChangedReceived(const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
     Common::Status HandleQueryReceived(const Model::EqualizerPresetModel::IdentifierType &aEqualizerPresetIdentifier,
                                        Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
 
@@ -194,6 +194,59 @@ FavoritesControllerBasis :: HandleQueryReceived(Common::ConnectionBuffer::Mutabl
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Handle and generate the server command response for a favorite
+ *    query request of the favorites changed since a change sequence
+ *    number.
+ *
+ *  This handles and generates the server command response for a
+ *  favorite query request of only those favorites whose state has
+ *  changed since the specified change sequence number.
+ *
+ *  @param[in]      aSequence  An immutable reference to the change
+ *                             sequence number after which changed
+ *                             favorites are to be generated.
+ *  @param[in,out]  aBuffer    A mutable reference to the shared pointer
+ *                             into which the response is to be
+ *                             generated.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the favorites model has
+ *                                  not been completely and successfully
+ *                                  initialized.
+ *  @retval  -ENOMEM                If the buffer-owned backing store
+ *                                  cannot be allocated.
+ *  @retval  -ENOSPC                If the requested size exceeds the
+ *                                  buffer capacity.
+ *
+ */
+Status
+FavoritesControllerBasis :: HandleQueryChangedReceived(const ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    IdentifiersCollection  lChangedFavorites;
+    Status                 lRetval;
+
+
+    lRetval = lChangedFavorites.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mFavoritesModel.GetFavoritesChangedSince(aSequence, lChangedFavorites);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    for (auto lFavoriteIdentifier = IdentifierModel::kIdentifierMin; lFavoriteIdentifier <= mFavoritesMax; lFavoriteIdentifier++)
+    {
+        if (!lChangedFavorites.ContainsIdentifier(lFavoriteIdentifier))
+            continue;
+
+        lRetval = HandleQueryReceived(lFavoriteIdentifier, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Handle and generate the server command response for a favorite
@@ -241,7 +294,7 @@ FavoritesControllerBasis :: HandleQueryReceived(const Model::FavoriteModel::Iden
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -26,6 +26,7 @@
 #ifndef OPENHLXSERVERFAVORITESCONTROLLERBASIS_HPP
 #define OPENHLXSERVERFAVORITESCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/FavoriteModel.hpp>
 #include <OpenHLX/Model/FavoritesModel.hpp>
 #include <OpenHLX/Server/FavoritesControllerCommands.hpp>
@@ -76,6 +77,7 @@ protected:
     // Observation (Query) Command Request Instance Handlers
 
     Common::Status HandleQueryReceived(Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
+    Common::Status HandleQueryChangedReceived(const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
     Common::Status HandleQueryReceived(const Model::FavoriteModel::IdentifierType &aFavoriteIdentifier, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
 
 protected:
@@ -252,7 +252,7 @@ FrontPanelControllerBasis :: HandleBrightnessResponse(const FrontPanelModel::Bri
     lBuffer = lBrightnessResponse.GetBuffer();
     lSize = lBrightnessResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -297,7 +297,7 @@ FrontPanelControllerBasis :: HandleLockedResponse(const FrontPanelModel::LockedT
     lBuffer = lLockedResponse.GetBuffer();
     lSize = lLockedResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
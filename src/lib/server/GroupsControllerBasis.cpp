@@ -283,6 +283,58 @@ GroupsControllerBasis :: HandleQueryReceived(Common::ConnectionBuffer::MutableCo
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Handle and generate the server command response for a group query
+ *    request of the groups changed since a change sequence number.
+ *
+ *  This handles and generates the server command response for a group
+ *  query request of only those groups whose state has changed since the
+ *  specified change sequence number.
+ *
+ *  @param[in]      aSequence  An immutable reference to the change
+ *                             sequence number after which changed
+ *                             groups are to be generated.
+ *  @param[in,out]  aBuffer    A mutable reference to the shared pointer
+ *                             into which the response is to be
+ *                             generated.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the groups model has
+ *                                  not been completely and successfully
+ *                                  initialized.
+ *  @retval  -ENOMEM                If the buffer-owned backing store
+ *                                  cannot be allocated.
+ *  @retval  -ENOSPC                If the requested size exceeds the
+ *                                  buffer capacity.
+ *
+ */
+Status
+GroupsControllerBasis :: HandleQueryChangedReceived(const ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    IdentifiersCollection  lChangedGroups;
+    Status                 lRetval;
+
+
+    lRetval = lChangedGroups.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mGroupsModel.GetGroupsChangedSince(aSequence, lChangedGroups);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    for (auto lGroupIdentifier = IdentifierModel::kIdentifierMin; lGroupIdentifier <= mGroupsMax; lGroupIdentifier++)
+    {
+        if (!lChangedGroups.ContainsIdentifier(lGroupIdentifier))
+            continue;
+
+        lRetval = HandleQueryReceived(lGroupIdentifier, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Handle and generate the server command response for a group
@@ -338,7 +390,7 @@ GroupsControllerBasis :: HandleQueryReceived(const Model::GroupModel::Identifier
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // Zone Membership Response
@@ -370,7 +422,7 @@ GroupsControllerBasis :: HandleQueryReceived(const Model::GroupModel::Identifier
             lBuffer = lZoneResponse.GetBuffer();
             lSize = lZoneResponse.GetSize();
 
-            lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+            lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
             nlREQUIRE_SUCCESS(lRetval, done);
 
             lZoneIdentifierCurrent++;
@@ -430,7 +482,7 @@ GroupsControllerBasis :: HandleAdjustVolumeResponse(const uint8_t *aInputBuffer,
     lBuffer = lAdjustVolumeResponse.GetBuffer();
     lSize = lAdjustVolumeResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aOutputBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aOutputBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -477,7 +529,7 @@ GroupsControllerBasis :: HandleSetMuteResponse(const Model::GroupModel::Identifi
     lBuffer = lSetMuteResponse.GetBuffer();
     lSize = lSetMuteResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -525,7 +577,7 @@ GroupsControllerBasis :: HandleSetVolumeResponse(const Model::GroupModel::Identi
     lBuffer = lSetVolumeResponse.GetBuffer();
     lSize = lSetVolumeResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -577,7 +629,7 @@ GroupsControllerBasis :: HandleToggleMuteResponse(const uint8_t *aInputBuffer,
     lBuffer = lToggleMuteResponse.GetBuffer();
     lSize = lToggleMuteResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aOutputBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aOutputBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
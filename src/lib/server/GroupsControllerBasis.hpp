@@ -26,6 +26,7 @@
 #ifndef OPENHLXSERVERGROUPSCONTROLLERBASIS_HPP
 #define OPENHLXSERVERGROUPSCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/GroupModel.hpp>
 #include <OpenHLX/Model/GroupsModel.hpp>
 #include <OpenHLX/Server/GroupsControllerCommands.hpp>
@@ -94,6 +95,7 @@ protected:
     // Observation (Query) Command Request Instance Handlers
 
     Common::Status HandleQueryReceived(Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
+    Common::Status HandleQueryChangedReceived(const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
     Common::Status HandleQueryReceived(const Model::GroupModel::IdentifierType &aGroupIdentifier, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
 
 protected:
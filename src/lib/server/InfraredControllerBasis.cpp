@@ -234,7 +234,7 @@ InfraredControllerBasis :: HandleDisabledResponse(const InfraredModel::DisabledT
     lBuffer = lDisabledResponse.GetBuffer();
     lSize = lDisabledResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
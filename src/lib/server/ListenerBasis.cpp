@@ -25,12 +25,17 @@
 
 #include <ListenerBasis.hpp>
 
+#include <algorithm>
+
 #include <errno.h>
+#include <string.h>
+#include <unistd.h>
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
 
 #include <sys/socket.h>
+#include <sys/stat.h>
 
 #include <CoreFoundation/CFSocket.h>
 
@@ -40,6 +45,8 @@
 #include <LogUtilities/LogUtilities.hpp>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoop.hpp>
+#include <OpenHLX/Common/SocketRing.hpp>
 #include <OpenHLX/Server/ListenerBasisAcceptDelegate.hpp>
 #include <OpenHLX/Server/ListenerBasisDelegate.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
@@ -93,6 +100,7 @@ ListenerBasis :: ListenerBasis(CFStringRef aSchemeRef) :
     mAcceptDelegate(nullptr),
     mSocketRef(nullptr),
     mRunLoopSourceRef(nullptr),
+    mSocket(-1),
     mHostURLAddress()
 {
     return;
@@ -163,7 +171,11 @@ ListenerBasis :: Init(in_port_t aDefaultPort, const RunLoopParameters &aRunLoopP
  *                                    to listen.
  *  @retval  -EPFNOSUPPORT            The @a aAddress specifies an
  *                                    unsupported protocol family
- *                                    other than PF_INET or PF_INET6.
+ *                                    other than PF_INET, PF_INET6, or
+ *                                    PF_LOCAL.
+ *  @retval  -EADDRINUSE              The @a aAddress specifies a
+ *                                    local socket path occupied by
+ *                                    something other than a socket.
  *
  */
 Status
@@ -174,6 +186,7 @@ ListenerBasis :: Listen(ListenerBasisAcceptDelegate *aAcceptDelegate,
 
     nlREQUIRE_ACTION(mSocketRef == nullptr, done, lRetval = -EBUSY);
     nlREQUIRE_ACTION(mRunLoopSourceRef == nullptr, done, lRetval = -EBUSY);
+    nlREQUIRE_ACTION(mSocket == -1, done, lRetval = -EBUSY);
 
     mAcceptDelegate = aAcceptDelegate;
 
@@ -476,6 +489,7 @@ ListenerBasis :: Listen(const SocketAddress &aAddress)
     const CFIndex lOrder = 0;
     const sockaddr *lSocketAddress = nullptr;
     size_t lSocketAddressSize;
+    int lSocketProtocol = IPPROTO_TCP;
     int one = 1;
     Status lRetval = kStatus_Success;
     int lSocket = -1;
@@ -506,6 +520,12 @@ ListenerBasis :: Listen(const SocketAddress &aAddress)
         lSocketAddressSize = sizeof (aAddress.uSocketAddressIPv6);
         break;
 
+    case PF_LOCAL:
+        lSocketAddress = reinterpret_cast<const sockaddr *>(&aAddress.uSocketAddressLocal);
+        lSocketAddressSize = sizeof (aAddress.uSocketAddressLocal);
+        lSocketProtocol = 0;
+        break;
+
     default:
         lRetval = -EPFNOSUPPORT;
         goto done;
@@ -519,30 +539,47 @@ ListenerBasis :: Listen(const SocketAddress &aAddress)
 
      // Create the native BSD socket.
 
-    lSocket = socket(lProtocolFamily, SOCK_STREAM | SOCK_FLAGS, IPPROTO_TCP);
+    lSocket = socket(lProtocolFamily, SOCK_STREAM | SOCK_FLAGS, lSocketProtocol);
     nlREQUIRE_ACTION(lSocket != -1, done, lRetval = -errno);
 
-    LogDebug(lLogIndent,
-             lLogLevel,
-             "Listening IPv%c Socket: %d\n",
-             ((lProtocolFamily == PF_INET) ? '4' : '6'),
-             lSocket);
+    if (lProtocolFamily == PF_LOCAL)
+    {
+        LogDebug(lLogIndent,
+                 lLogLevel,
+                 "Listening Local Socket: %d\n",
+                 lSocket);
+
+        // Local sockets have no address or port reuse semantics;
+        // instead, remove any stale socket left at the requested path
+        // by a prior listener that did not exit cleanly.
+
+        lRetval = UnlinkStaleLocalSocket(aAddress);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+    else
+    {
+        LogDebug(lLogIndent,
+                 lLogLevel,
+                 "Listening IPv%c Socket: %d\n",
+                 ((lProtocolFamily == PF_INET) ? '4' : '6'),
+                 lSocket);
 
-    // When we bind, indicate that we wish to attempt to forcibly bind
-    // to a socket already bound to the requested address.
+        // When we bind, indicate that we wish to attempt to forcibly bind
+        // to a socket already bound to the requested address.
 
 #if defined(SO_REUSEADDR)
-    lStatus = setsockopt(lSocket, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
-    nlREQUIRE_ACTION(lStatus != -1, done, lRetval = -errno);
+        lStatus = setsockopt(lSocket, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
+        nlREQUIRE_ACTION(lStatus != -1, done, lRetval = -errno);
 #endif
 
-    // When we bind, indicate that we wish to attempt to forcibly bind
-    // to a socket already bound to the requested port.
+        // When we bind, indicate that we wish to attempt to forcibly bind
+        // to a socket already bound to the requested port.
 
 #if defined(SO_REUSEPORT)
-    lStatus = setsockopt(lSocket, SOL_SOCKET, SO_REUSEPORT, &one, sizeof (one));
-    nlREQUIRE_ACTION(lStatus != -1, done, lRetval = -errno);
+        lStatus = setsockopt(lSocket, SOL_SOCKET, SO_REUSEPORT, &one, sizeof (one));
+        nlREQUIRE_ACTION(lStatus != -1, done, lRetval = -errno);
 #endif
+    }
 
     // Bind the BSD socket to the requested address and port
     // combination.
@@ -564,6 +601,28 @@ ListenerBasis :: Listen(const SocketAddress &aAddress)
     lStatus = listen(lSocket, lBacklog);
     nlREQUIRE_ACTION(lStatus >= 0, done, lRetval = -errno);
 
+    // With a native socket ring or event loop, register the listening
+    // BSD socket with it directly, retaining ownership of the socket.
+
+    if (mRunLoopParameters.GetSocketRing() != nullptr)
+    {
+        lRetval = mRunLoopParameters.GetSocketRing()->Accept(lSocket, this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        mSocket = lSocket;
+
+        goto done;
+    }
+    else if (mRunLoopParameters.GetEventLoop() != nullptr)
+    {
+        lRetval = mRunLoopParameters.GetEventLoop()->Add(lSocket, EventLoop::kEventReadable, this);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        mSocket = lSocket;
+
+        goto done;
+    }
+
     // Create a CoreFoundation socket reference to the BSD socket
 
     lSocketRef = CFSocketCreateWithNative(kCFAllocatorDefault,
@@ -606,7 +665,7 @@ ListenerBasis :: Listen(const SocketAddress &aAddress)
     {
         SetState(lCurrentState);
 
-        if ((mSocketRef == nullptr) && (lSocket != -1))
+        if ((lSocketRef == nullptr) && (lSocket != -1))
         {
             close(lSocket);
         }
@@ -624,9 +683,76 @@ ListenerBasis :: Listen(const SocketAddress &aAddress)
 void
 ListenerBasis :: Ignore(void)
 {
+    const SocketAddress &  lAddress = mHostURLAddress.GetAddress();
+
+    // A local listener leaves its socket in the file system after
+    // it is closed. If this listener was listening, remove it.
+
+    if (((mSocketRef != nullptr) || (mSocket != -1)) &&
+        (lAddress.uSocketAddress.sa_family == AF_LOCAL))
+    {
+        unlink(lAddress.uSocketAddressLocal.sun_path);
+    }
+
+    if (mSocket != -1)
+    {
+        if (mRunLoopParameters.GetSocketRing() != nullptr)
+        {
+            mRunLoopParameters.GetSocketRing()->Remove(mSocket);
+        }
+        else
+        {
+            mRunLoopParameters.GetEventLoop()->Remove(mSocket);
+        }
+
+        close(mSocket);
+
+        mSocket = -1;
+    }
+
     Ignore(mRunLoopParameters, mSocketRef, mRunLoopSourceRef);
 }
 
+/**
+ *  @brief
+ *    Remove a stale local socket at the specified local socket
+ *    address path.
+ *
+ *  A local (Unix domain) socket may not be bound to a path that
+ *  already exists. This removes the path if and only if it is a
+ *  socket, such as one left behind by a prior listener that did not
+ *  exit cleanly.
+ *
+ *  @param[in]  aAddress  An immutable reference to the local socket
+ *                        address whose path is to be removed.
+ *
+ *  @retval  kStatus_Success  If successful or if nothing exists at
+ *                            the path.
+ *  @retval  -EADDRINUSE      If something other than a socket exists
+ *                            at the path.
+ *
+ */
+Status
+ListenerBasis :: UnlinkStaleLocalSocket(const SocketAddress &aAddress)
+{
+    const char *  lPath = aAddress.uSocketAddressLocal.sun_path;
+    struct stat   lStat;
+    int           lStatus;
+    Status        lRetval = kStatus_Success;
+
+
+    lStatus = lstat(lPath, &lStat);
+    nlEXPECT(lStatus == 0, done);
+
+    nlREQUIRE_ACTION(S_ISSOCK(lStat.st_mode), done, lRetval = -EADDRINUSE);
+
+    lStatus = unlink(lPath);
+    nlREQUIRE_ACTION(lStatus == 0, done, lRetval = -errno);
+
+ done:
+    return (lRetval);
+}
+
 void
 ListenerBasis :: Ignore(const RunLoopParameters &aRunLoopParameters, CFSocketRef &aSocketRef, CFRunLoopSourceRef &aRunLoopSourceRef)
 {
@@ -689,12 +815,13 @@ ListenerBasis :: CFSocketAcceptCallback(CFSocketRef aSocketRef,
 {
     DeclareLogIndentWithValue(lLogIndent, 0);
     DeclareLogLevelWithValue(lLogLevel, 1);
-    const State            lCurrentState    = GetState();
 #if (defined(DEBUG) && DEBUG) && !defined(NDEBUG)
     CFSocketNativeHandle   lAcceptingSocket = CFSocketGetNative(aSocketRef);
 #endif // (defined(DEBUG) && DEBUG) && !defined(NDEBUG)
     CFSocketNativeHandle   lConnectedSocket = *static_cast<const CFSocketNativeHandle *>(aData);
-    Status                 lStatus          = kStatus_Success;
+    const uint8_t *        lData;
+    size_t                 lLength;
+    SocketAddress          lSocketAddress;
 
 
 #if ((!defined(DEBUG) && !DEBUG) || (defined(NDEBUG) && NDEBUG))
@@ -711,14 +838,169 @@ ListenerBasis :: CFSocketAcceptCallback(CFSocketRef aSocketRef,
     nlASSERT(aData != nullptr);
     nlASSERT(lConnectedSocket != -1);
 
+    lData   = CFDataGetBytePtr(aAddress);
+    lLength = static_cast<size_t>(CFDataGetLength(aAddress));
+
+    // The accepted peer address may be shorter than a socket address
+    // (for example, an unnamed local socket peer), so copy no more
+    // than was provided, leaving the remainder, and the termination
+    // of any local socket path, zeroed.
+
+    memset(&lSocketAddress, 0, sizeof (lSocketAddress));
+    memcpy(&lSocketAddress, lData, std::min(lLength, sizeof (lSocketAddress) - 1));
+
+    DidAccept(lConnectedSocket, lSocketAddress);
+}
+
+/**
+ *  @brief
+ *    Delegation from a native event loop that the listening socket is
+ *    ready.
+ *
+ *  This accepts every connection pending on the listening socket, up
+ *  to the point at which it would block, and handles each as the
+ *  CoreFoundation socket accept callback would.
+ *
+ *  @param[in]  aEventLoop   A reference to the native event loop that
+ *                           issued the delegation.
+ *  @param[in]  aDescriptor  An immutable reference to the listening
+ *                           socket that is ready.
+ *  @param[in]  aEvents      An immutable reference to the events that
+ *                           are ready.
+ *
+ */
+void
+ListenerBasis :: EventLoopIsReady(EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents)
+{
+    SocketAddress  lSocketAddress;
+    socklen_t      lSocketAddressSize;
+    int            lConnectedSocket;
+
+    (void)aEventLoop;
+
+    nlEXPECT((aEvents & EventLoop::kEventReadable) != 0, done);
+
+    while (mSocket == aDescriptor)
+    {
+        // As above, leave the termination of any local socket path
+        // zeroed.
+
+        memset(&lSocketAddress, 0, sizeof (lSocketAddress));
+
+        lSocketAddressSize = static_cast<socklen_t>(sizeof (lSocketAddress) - 1);
+
+        lConnectedSocket = accept(aDescriptor,
+                                  &lSocketAddress.uSocketAddress,
+                                  &lSocketAddressSize);
+        if (lConnectedSocket == -1)
+        {
+            if (errno == EINTR)
+                continue;
+
+            // Anything other than having accepted every pending
+            // connection is a listener error.
+
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            {
+                OnError(-errno);
+            }
+
+            break;
+        }
+
+        DidAccept(lConnectedSocket, lSocketAddress);
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Delegation from a native socket ring that a connection was
+ *    accepted on the listening socket.
+ *
+ *  @param[in]  aSocketRing        A reference to the native socket
+ *                                 ring that issued the delegation.
+ *  @param[in]  aListeningSocket   An immutable reference to the
+ *                                 listening socket.
+ *  @param[in]  aConnectedSocket   An immutable reference to the
+ *                                 accepted socket.
+ *
+ */
+void
+ListenerBasis :: SocketRingDidAccept(SocketRing &aSocketRing, const int &aListeningSocket, const int &aConnectedSocket)
+{
+    SocketAddress  lSocketAddress;
+    socklen_t      lSocketAddressSize;
+
+    (void)aSocketRing;
+    (void)aListeningSocket;
+
+    // The multishot accept does not return peer addresses, so
+    // retrieve it from the accepted socket, leaving, as above, the
+    // termination of any local socket path zeroed.
+
+    memset(&lSocketAddress, 0, sizeof (lSocketAddress));
+
+    lSocketAddressSize = static_cast<socklen_t>(sizeof (lSocketAddress) - 1);
+
+    (void)getpeername(aConnectedSocket, &lSocketAddress.uSocketAddress, &lSocketAddressSize);
+
+    DidAccept(aConnectedSocket, lSocketAddress);
+}
+
+/**
+ *  @brief
+ *    Delegation from a native socket ring that accepting on the
+ *    listening socket failed.
+ *
+ *  @param[in]  aSocketRing  A reference to the native socket ring
+ *                           that issued the delegation.
+ *  @param[in]  aSocket      An immutable reference to the listening
+ *                           socket.
+ *  @param[in]  aError       An immutable reference to the error
+ *                           associated with the failure.
+ *
+ */
+void
+ListenerBasis :: SocketRingError(SocketRing &aSocketRing, const int &aSocket, const Error &aError)
+{
+    (void)aSocketRing;
+    (void)aSocket;
+
+    OnError(aError);
+}
+
+/**
+ *  @brief
+ *    Handle an accepted connection.
+ *
+ *  This delegates the accepted connection to the accept delegate,
+ *  closing it if the delegate does not take it and issuing an error
+ *  delegation if the delegate failed to take it. A connection the
+ *  delegate refuses (for example, for admission control) is simply
+ *  closed, since that is a normal outcome rather than an error.
+ *
+ *  @param[in]  aConnectedSocket  An immutable reference to the native
+ *                                socket descriptor for the accepted
+ *                                connection.
+ *  @param[in]  aAddress          An immutable reference to the socket
+ *                                address of the remote peer.
+ *
+ */
+void
+ListenerBasis :: DidAccept(const int &aConnectedSocket, const SocketAddress &aAddress)
+{
+    const State  lCurrentState = GetState();
+    Status       lStatus       = kStatus_Success;
+
+
     SetState(kState_Accepting);
 
     if (mAcceptDelegate != nullptr)
     {
-        const uint8_t *       lData = CFDataGetBytePtr(aAddress);
-        const SocketAddress * lSocketAddress = reinterpret_cast<const SocketAddress *>(lData);
-
-        lStatus = mAcceptDelegate->ListenerDidAccept(*this, lConnectedSocket, *lSocketAddress);
+        lStatus = mAcceptDelegate->ListenerDidAccept(*this, aConnectedSocket, aAddress);
     }
     else
     {
@@ -735,9 +1017,12 @@ ListenerBasis :: CFSocketAcceptCallback(CFSocketRef aSocketRef,
 
     if (lStatus != kStatus_Success)
     {
-        close(lConnectedSocket);
+        close(aConnectedSocket);
 
-        OnError(lStatus);
+        if (lStatus != -ECONNREFUSED)
+        {
+            OnError(lStatus);
+        }
     }
 }
 
@@ -33,10 +33,12 @@
 
 #include <OpenHLX/Common/ConnectionBuffer.hpp>
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/EventLoopDelegate.hpp>
 #include <OpenHLX/Common/HostURLAddress.hpp>
 #include <OpenHLX/Common/RegularExpression.hpp>
 #include <OpenHLX/Common/RunLoopParameters.hpp>
 #include <OpenHLX/Common/SocketAddress.hpp>
+#include <OpenHLX/Common/SocketRingDelegate.hpp>
 
 
 namespace HLX
@@ -53,10 +55,18 @@ class ListenerBasisAcceptDelegate;
  *    A base, derivable object for HLX server network connection
  *    listeners.
  *
+ *  When the run loop parameters the listener is initialized with
+ *  have a native event loop, the listening socket is registered with
+ *  that event loop rather than with a CoreFoundation socket. When
+ *  they also have a native socket ring, connections are instead
+ *  accepted with a single multishot accept on that socket ring.
+ *
  *  @ingroup server
  *
  */
-class ListenerBasis
+class ListenerBasis :
+    public Common::EventLoopDelegate,
+    public Common::SocketRingDelegate
 {
 
 public:
@@ -91,6 +101,15 @@ public:
                                        const void *aData,
                                        void *aInfo);
 
+    // Event Loop Delegate Method
+
+    void EventLoopIsReady(Common::EventLoop &aEventLoop, const int &aDescriptor, const uint32_t &aEvents) final;
+
+    // Socket Ring Delegate Methods
+
+    void SocketRingDidAccept(Common::SocketRing &aSocketRing, const int &aListeningSocket, const int &aConnectedSocket) final;
+    void SocketRingError(Common::SocketRing &aSocketRing, const int &aSocket, const Common::Error &aError) final;
+
 protected:
     ListenerBasis(CFStringRef aScheme);
 
@@ -131,6 +150,8 @@ private:
     Common::Status Listen(const Common::SocketAddress &aAddress);
     void Ignore(void);
 
+    static Common::Status UnlinkStaleLocalSocket(const Common::SocketAddress &aAddress);
+
     static void Ignore(const Common::RunLoopParameters &aRunLoopParameters, CFSocketRef &aSocketRef, CFRunLoopSourceRef &aRunLoopSourceRef);
 
     void CFSocketAcceptCallback(CFSocketRef aSocketRef,
@@ -138,6 +159,8 @@ private:
                                 CFDataRef aAddress,
                                 const void *aData);
 
+    void DidAccept(const int &aConnectedSocket, const Common::SocketAddress &aAddress);
+
 private:
     CFStringRef                    mSchemeRef;
     in_port_t                      mDefaultPort;
@@ -147,6 +170,7 @@ private:
     ListenerBasisAcceptDelegate *  mAcceptDelegate;
     CFSocketRef                    mSocketRef;
     CFRunLoopSourceRef             mRunLoopSourceRef;
+    int                            mSocket;
     Common::HostURLAddress         mHostURLAddress;
 };
 
@@ -67,7 +67,10 @@ public:
      *  successful status if it was successfully able to do so. If the
      *  delegate is unable to successfully handle the accepted
      *  connection, non-successful status should be returned and the
-     *  connection will be closed and discarded.
+     *  connection will be closed and discarded. A delegate that
+     *  declines the connection by policy, rather than in error,
+     *  should return -ECONNREFUSED, in which case the connection is
+     *  closed and discarded without an error delegation.
      *
      *  @param[in]  aListener  A reference to the connection listener
      *                         that issued the delegation.
@@ -80,7 +83,8 @@ public:
      *
      *  @returns
      *    kStatus_Success if the delegate successfully handled the
-     *    delegation; otherwise, non-successful status on error.
+     *    delegation; -ECONNREFUSED if it declined the connection;
+     *    otherwise, non-successful status on error.
      *
      */
     virtual Common::Status ListenerDidAccept(ListenerBasis &aListener, const int &aSocket, const Common::SocketAddress &aAddress) = 0;
@@ -29,7 +29,9 @@
 #include <LogUtilities/LogUtilities.hpp>
 
 #include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Server/ListenerTCP.hpp>
 #include <OpenHLX/Server/ListenerTelnet.hpp>
+#include <OpenHLX/Server/ListenerUnix.hpp>
 #include <OpenHLX/Utilities/Assert.hpp>
 
 
@@ -114,7 +116,9 @@ ListenerFactory :: SupportsScheme(CFStringRef aSchemeRef) const
     const CFString lRequestedScheme(aSchemeRef);
     bool lRetval = false;
 
-    if (lRequestedScheme == ListenerTelnet::kScheme)
+    if ((lRequestedScheme == ListenerTelnet::kScheme) ||
+        (lRequestedScheme == ListenerTCP::kScheme)    ||
+        (lRequestedScheme == ListenerUnix::kScheme))
     {
         lRetval = true;
     }
@@ -150,6 +154,16 @@ ListenerFactory :: CreateListener(CFStringRef aSchemeRef) const
         lRetval.reset(new ListenerTelnet());
         nlREQUIRE(lRetval != nullptr, done);
     }
+    else if (lRequestedScheme == ListenerTCP::kScheme)
+    {
+        lRetval.reset(new ListenerTCP());
+        nlREQUIRE(lRetval != nullptr, done);
+    }
+    else if (lRequestedScheme == ListenerUnix::kScheme)
+    {
+        lRetval.reset(new ListenerUnix());
+        nlREQUIRE(lRetval != nullptr, done);
+    }
 
  done:
     return (lRetval);
@@ -0,0 +1,69 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines a derived object for a HLX server
+ *      connection listener that uses local (Unix domain) sockets,
+ *      without telnet protocol encoding.
+ *
+ */
+
+#ifndef OPENHLXSERVERLISTENERUNIX_HPP
+#define OPENHLXSERVERLISTENERUNIX_HPP
+
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Server/ListenerBasis.hpp>
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  @brief
+ *    A derived object for a HLX server connection listener that uses
+ *    local (Unix domain) sockets, without telnet protocol encoding.
+ *
+ *  Rather than a host and port, the listener is bound to a file
+ *  system path, such that access to it may be controlled by file
+ *  system permissions rather than network exposure.
+ *
+ *  @ingroup server
+ *
+ */
+class ListenerUnix :
+    public ListenerBasis
+{
+public:
+    static CFStringRef kScheme;
+
+public:
+    ListenerUnix(void);
+    virtual ~ListenerUnix(void);
+
+    Common::Status Init(const Common::RunLoopParameters &aRunLoopParameters) final;
+};
+
+}; // namespace Server
+
+}; // namespace HLX
+
+#endif // OPENHLXSERVERLISTENERUNIX_HPP
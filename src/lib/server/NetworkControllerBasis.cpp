@@ -252,7 +252,7 @@ NetworkControllerBasis :: HandleDHCPv4EnabledResponse(const NetworkModel::Enable
     lBuffer = lDHCPv4EnabledResponse.GetBuffer();
     lSize = lDHCPv4EnabledResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -300,7 +300,7 @@ NetworkControllerBasis :: HandleDefaultRouterAddressResponse(const IPAddress &aD
     lBuffer = lIPDefaultRouterAddressResponse.GetBuffer();
     lSize = lIPDefaultRouterAddressResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -345,7 +345,7 @@ NetworkControllerBasis :: HandleEthernetEUI48Response(const NetworkModel::Ethern
     lBuffer = lEthernetEUI48Response.GetBuffer();
     lSize = lEthernetEUI48Response.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -391,7 +391,7 @@ NetworkControllerBasis :: HandleHostAddressResponse(const IPAddress &aHostAddres
     lBuffer = lIPHostAddressResponse.GetBuffer();
     lSize = lIPHostAddressResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -437,7 +437,7 @@ NetworkControllerBasis :: HandleNetmaskResponse(const IPAddress &aNetmask,
     lBuffer = lIPNetmaskResponse.GetBuffer();
     lSize = lIPNetmaskResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -482,7 +482,7 @@ NetworkControllerBasis :: HandleSDDPEnabledResponse(const NetworkModel::EnabledT
     lBuffer = lSDDPEnabledResponse.GetBuffer();
     lSize = lSDDPEnabledResponse.GetSize();
 
-    lStatus = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lStatus = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lStatus, done);
 
  done:
@@ -183,6 +183,58 @@ SourcesControllerBasis :: HandleQueryReceived(Common::ConnectionBuffer::MutableC
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Handle and generate the server command response for a source query
+ *    request of the sources changed since a change sequence number.
+ *
+ *  This handles and generates the server command response for a source
+ *  query request of only those sources whose state has changed since
+ *  the specified change sequence number.
+ *
+ *  @param[in]      aSequence  An immutable reference to the change
+ *                             sequence number after which changed
+ *                             sources are to be generated.
+ *  @param[in,out]  aBuffer    A mutable reference to the shared pointer
+ *                             into which the response is to be
+ *                             generated.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the sources model has
+ *                                  not been completely and successfully
+ *                                  initialized.
+ *  @retval  -ENOMEM                If the buffer-owned backing store
+ *                                  cannot be allocated.
+ *  @retval  -ENOSPC                If the requested size exceeds the
+ *                                  buffer capacity.
+ *
+ */
+Status
+SourcesControllerBasis :: HandleQueryChangedReceived(const ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    IdentifiersCollection  lChangedSources;
+    Status                 lRetval;
+
+
+    lRetval = lChangedSources.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mSourcesModel.GetSourcesChangedSince(aSequence, lChangedSources);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    for (auto lSourceIdentifier = IdentifierModel::kIdentifierMin; lSourceIdentifier <= mSourcesMax; lSourceIdentifier++)
+    {
+        if (!lChangedSources.ContainsIdentifier(lSourceIdentifier))
+            continue;
+
+        lRetval = HandleQueryReceived(lSourceIdentifier, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Handle and generate the server command response for a source
@@ -233,7 +285,7 @@ SourcesControllerBasis :: HandleQueryReceived(const Model::SourceModel::Identifi
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
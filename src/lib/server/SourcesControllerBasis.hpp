@@ -26,6 +26,7 @@
 #ifndef OPENHLXSERVERSOURCESCONTROLLERBASIS_HPP
 #define OPENHLXSERVERSOURCESCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/SourceModel.hpp>
 #include <OpenHLX/Model/SourcesModel.hpp>
 #include <OpenHLX/Server/ObjectControllerBasis.hpp>
@@ -76,6 +77,7 @@ protected:
     // Observation (Query) Command Request Instance Handlers
 
     Common::Status HandleQueryReceived(Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
+    Common::Status HandleQueryChangedReceived(const Model::ChangeSequence::SequenceType &aSequence, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
     Common::Status HandleQueryReceived(const Model::SourceModel::IdentifierType &aSourceIdentifier, Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
 
 protected:
@@ -0,0 +1,534 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements an object for filtering the HLX server
+ *      command responses and state change notifications sent to a
+ *      client connection by the objects to which it subscribes.
+ *
+ */
+
+#include "SubscriptionFilter.hpp"
+
+#include <limits>
+
+#include <ctype.h>
+#include <errno.h>
+#include <string.h>
+
+#include <LogUtilities/LogUtilities.hpp>
+
+#include <OpenHLX/Utilities/Assert.hpp>
+#include <OpenHLX/Utilities/ElementsOf.hpp>
+
+
+using namespace HLX::Common;
+using namespace HLX::Model;
+using namespace HLX::Utilities;
+using namespace Nuovations;
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  The properties that may precede an object designator in a response
+ *  concerning that object (for example, "VM" in "VMO7" or "N" in
+ *  "NEP3"). The empty property admits responses, such as
+ *  "EP3B2L-1", led by the designator itself.
+ *
+ */
+static const char * const sObjectProperties[] = {
+    "",
+    "B",
+    "C",
+    "E",
+    "N",
+    "Q",
+    "T",
+    "V",
+    "VM",
+    "VMT",
+    "VUM"
+};
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+SubscriptionFilter :: SubscriptionFilter(void) :
+    mEnabled(false),
+    mIdentifiers()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class default initializer.
+ *
+ *  This initializes the filter such that the connection subscribes
+ *  to all server state changes.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+Status
+SubscriptionFilter :: Init(void)
+{
+    Status  lRetval = kStatus_Success;
+
+
+    for (auto &lIdentifiers : mIdentifiers)
+    {
+        lRetval = lIdentifiers.Init();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    mEnabled = false;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Determine whether the filter is enabled.
+ *
+ *  @returns
+ *    True if the connection subscribes to specific objects only;
+ *    otherwise, false if it subscribes to all server state changes.
+ *
+ */
+bool
+SubscriptionFilter :: IsEnabled(void) const
+{
+    return (mEnabled);
+}
+
+/**
+ *  @brief
+ *    Determine whether the connection subscribes to the specified
+ *    object.
+ *
+ *  @param[in]  aType        An immutable reference to the type of
+ *                           the object.
+ *  @param[in]  aIdentifier  An immutable reference to the identifier
+ *                           of the object.
+ *
+ *  @returns
+ *    True if the filter is not enabled or if the connection
+ *    subscribes to the specified object; otherwise, false.
+ *
+ */
+bool
+SubscriptionFilter :: IsSubscribed(const ObjectType &aType, const IdentifierType &aIdentifier) const
+{
+    bool  lRetval = true;
+
+    if (mEnabled && (aType < kObjectType_Count))
+    {
+        lRetval = mIdentifiers[aType].ContainsIdentifier(aIdentifier);
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Subscribe the connection to the specified object.
+ *
+ *  This subscribes the connection to the specified object and, if it
+ *  was not already, enables the filter such that the connection
+ *  receives only those responses concerning objects to which it
+ *  subscribes.
+ *
+ *  @param[in]  aType        An immutable reference to the type of
+ *                           the object.
+ *  @param[in]  aIdentifier  An immutable reference to the identifier
+ *                           of the object.
+ *
+ *  @retval  kStatus_Success          If successful.
+ *  @retval  kStatus_ValueAlreadySet  If the connection already
+ *                                    subscribes to the object.
+ *  @retval  -EINVAL                  If @a aType is not a valid object
+ *                                    type.
+ *  @retval  kError_NotInitialized    If the filter has not been
+ *                                    initialized.
+ *
+ */
+Status
+SubscriptionFilter :: Subscribe(const ObjectType &aType, const IdentifierType &aIdentifier)
+{
+    Status  lRetval = kStatus_Success;
+
+    nlREQUIRE_ACTION(aType < kObjectType_Count, done, lRetval = -EINVAL);
+
+    lRetval = mIdentifiers[aType].AddIdentifier(aIdentifier);
+    nlREQUIRE(lRetval >= kStatus_Success, done);
+
+    mEnabled = true;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Subscribe the connection to all server state changes.
+ *
+ *  This clears all subscriptions to specific objects and disables the
+ *  filter.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the filter has not been
+ *                                  initialized.
+ *
+ */
+Status
+SubscriptionFilter :: SubscribeAll(void)
+{
+    Status  lRetval = kStatus_Success;
+
+
+    for (auto &lIdentifiers : mIdentifiers)
+    {
+        lRetval = lIdentifiers.ClearIdentifiers();
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+    mEnabled = false;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Filter the specified buffer by the objects to which the
+ *    connection subscribes.
+ *
+ *  This removes from the specified buffer each response concerning
+ *  an object to which the connection does not subscribe. Responses
+ *  that do not concern any one zone, group, source, favorite, or
+ *  equalizer preset in particular, as well as any data outside of a
+ *  complete response, are retained.
+ *
+ *  When no response is removed, as is always the case when the filter
+ *  is not enabled, the specified buffer, including any fragments
+ *  chained to it, is itself returned without copying. Otherwise, the
+ *  data remaining is copied into a single, unchained buffer. When all
+ *  data is removed, null is returned.
+ *
+ *  @param[in]   aBuffer          An immutable shared pointer to the
+ *                                buffer to filter.
+ *  @param[out]  aFilteredBuffer  A reference to an immutable shared
+ *                                pointer to set to the filtered
+ *                                buffer, if any data remains to be
+ *                                sent; otherwise, null.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ENOMEM          If resources for the filtered buffer
+ *                            could not be allocated.
+ *
+ */
+Status
+SubscriptionFilter :: Filter(ConnectionBuffer::ImmutableCountedPointer aBuffer, ConnectionBuffer::ImmutableCountedPointer &aFilteredBuffer) const
+{
+    ConnectionBuffer::MutableCountedPointer    lFilteredBuffer;
+    ConnectionBuffer::ImmutableCountedPointer  lFragment;
+    Status                                     lRetval = kStatus_Success;
+
+
+    if (!mEnabled || !aBuffer)
+    {
+        aFilteredBuffer = aBuffer;
+        goto done;
+    }
+
+    // Each fragment of a chained buffer holds only whole responses
+    // and is filtered in turn.
+
+    for (lFragment = aBuffer; lFragment != nullptr; lFragment = lFragment->GetNext())
+    {
+        const uint8_t *  lCurrent = lFragment->GetHead();
+        const uint8_t *  lPending = lCurrent;
+        const uint8_t *  lEnd     = lCurrent + lFragment->GetSize();
+
+        while (lCurrent < lEnd)
+        {
+            const uint8_t *  lStart;
+            const uint8_t *  lBodyEnd;
+            bool             lQuoted = false;
+
+            // Find the start of the next response, if any.
+
+            lStart = static_cast<const uint8_t *>(memchr(lCurrent, '(', static_cast<size_t>(lEnd - lCurrent)));
+
+            if (lStart == nullptr)
+                break;
+
+            // Find the end of the response, skipping over any delimiter
+            // that appears in a quoted name.
+
+            for (lBodyEnd = lStart + 1; lBodyEnd < lEnd; lBodyEnd++)
+            {
+                if (*lBodyEnd == '"')
+                    lQuoted = !lQuoted;
+                else if (!lQuoted && (*lBodyEnd == ')'))
+                    break;
+            }
+
+            // An incomplete response, if any, is retained as-is.
+
+            if (lBodyEnd == lEnd)
+                break;
+
+            lCurrent = lBodyEnd + 1;
+
+            while ((lCurrent < lEnd) && ((*lCurrent == '\r') || (*lCurrent == '\n')))
+                lCurrent++;
+
+            if (!IsPassed(lStart + 1, lBodyEnd))
+            {
+                // Lazily allocate the filtered buffer on the first
+                // response removed and copy into it all data of any
+                // preceding fragments, as well as all data preceding
+                // the removed response not yet copied.
+
+                if (!lFilteredBuffer)
+                {
+                    ConnectionBuffer::ImmutableCountedPointer  lPrior;
+
+                    lRetval = ConnectionBuffer::Create(lFilteredBuffer, aBuffer->GetChainSize());
+                    nlREQUIRE_SUCCESS(lRetval, done);
+
+                    for (lPrior = aBuffer; lPrior != lFragment; lPrior = lPrior->GetNext())
+                    {
+                        lRetval = Common::Utilities::Put(*lFilteredBuffer.get(),
+                                                         lPrior->GetHead(),
+                                                         lPrior->GetSize());
+                        nlREQUIRE_SUCCESS(lRetval, done);
+                    }
+                }
+
+                lRetval = Common::Utilities::Put(*lFilteredBuffer.get(),
+                                                 lPending,
+                                                 static_cast<size_t>(lStart - lPending));
+                nlREQUIRE_SUCCESS(lRetval, done);
+
+                lPending = lCurrent;
+            }
+        }
+
+        if (lFilteredBuffer)
+        {
+            lRetval = Common::Utilities::Put(*lFilteredBuffer.get(),
+                                             lPending,
+                                             static_cast<size_t>(lEnd - lPending));
+            nlREQUIRE_SUCCESS(lRetval, done);
+        }
+    }
+
+    if (!lFilteredBuffer)
+    {
+        aFilteredBuffer = aBuffer;
+    }
+    else if (lFilteredBuffer->GetSize() > 0)
+    {
+        aFilteredBuffer = lFilteredBuffer;
+    }
+    else
+    {
+        aFilteredBuffer.reset();
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Get the object type for the specified object designator.
+ *
+ *  @param[in]   aDesignator        A pointer to the start of the
+ *                                  object designator (for example,
+ *                                  "O" or "EP").
+ *  @param[in]   aDesignatorLength  An immutable reference to the
+ *                                  length, in bytes, of the object
+ *                                  designator.
+ *  @param[out]  aType              A mutable reference to storage for
+ *                                  the object type.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -EINVAL          If the object designator does not
+ *                            designate a valid object type.
+ *
+ */
+Status
+SubscriptionFilter :: GetObjectType(const char *aDesignator, const size_t &aDesignatorLength, ObjectType &aType)
+{
+    Status  lRetval = kStatus_Success;
+
+    if (aDesignatorLength == 1)
+    {
+        switch (aDesignator[0])
+        {
+
+        case 'O':
+            aType = kObjectType_Zone;
+            break;
+
+        case 'G':
+            aType = kObjectType_Group;
+            break;
+
+        case 'I':
+            aType = kObjectType_Source;
+            break;
+
+        case 'F':
+            aType = kObjectType_Favorite;
+            break;
+
+        default:
+            lRetval = -EINVAL;
+            break;
+
+        }
+    }
+    else if ((aDesignatorLength == 2) && (strncmp(aDesignator, "EP", aDesignatorLength) == 0))
+    {
+        aType = kObjectType_EqualizerPreset;
+    }
+    else
+    {
+        lRetval = -EINVAL;
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Determine whether the specified property precedes an object
+ *    designator in a response concerning that object.
+ *
+ *  @param[in]  aProperty        A pointer to the start of the
+ *                               property.
+ *  @param[in]  aPropertyLength  An immutable reference to the length,
+ *                               in bytes, of the property.
+ *
+ *  @returns
+ *    True if the property is a known object property; otherwise,
+ *    false.
+ *
+ */
+bool
+SubscriptionFilter :: IsObjectProperty(const char *aProperty, const size_t &aPropertyLength)
+{
+    bool  lRetval = false;
+
+    for (size_t i = 0; i < ElementsOf(sObjectProperties); i++)
+    {
+        if ((strlen(sObjectProperties[i]) == aPropertyLength) &&
+            (strncmp(sObjectProperties[i], aProperty, aPropertyLength) == 0))
+        {
+            lRetval = true;
+            break;
+        }
+    }
+
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Determine whether the specified response passes the filter.
+ *
+ *  A response concerns a particular object when its leading run of
+ *  letters is exactly a known object property followed by that
+ *  object's designator and is immediately followed by the object's
+ *  identifier (for example, "VO7R-20" concerns zone 7 and "NEP3"
+ *  equalizer preset 3). Any other run, such as the network property
+ *  in "MACF0-..." or a run containing 'X' denoting all objects (for
+ *  example, "CXI2"), does not concern a particular object and always
+ *  passes.
+ *
+ *  @param[in]  aStart  A pointer to the start of the response, just
+ *                      past its leading delimiter.
+ *  @param[in]  aEnd    A pointer to the end of the response, at its
+ *                      trailing delimiter.
+ *
+ *  @returns
+ *    True if the response passes the filter; otherwise, false.
+ *
+ */
+bool
+SubscriptionFilter :: IsPassed(const uint8_t *aStart, const uint8_t *aEnd) const
+{
+    const uint8_t *  lCurrent = aStart;
+    const uint8_t *  lDesignator;
+    unsigned int     lIdentifier = 0;
+    ObjectType       lType;
+    Status           lStatus;
+    bool             lRetval = true;
+
+
+    while ((lCurrent < aEnd) && isupper(*lCurrent))
+    {
+        nlEXPECT(*lCurrent != 'X', done);
+
+        lCurrent++;
+    }
+
+    nlEXPECT(lCurrent > aStart, done);
+    nlEXPECT((lCurrent < aEnd) && isdigit(*lCurrent), done);
+
+    lDesignator = (((lCurrent - aStart) >= 2) && (lCurrent[-2] == 'E') && (lCurrent[-1] == 'P')) ? lCurrent - 2 : lCurrent - 1;
+
+    lStatus = GetObjectType(reinterpret_cast<const char *>(lDesignator),
+                            static_cast<size_t>(lCurrent - lDesignator),
+                            lType);
+    nlEXPECT_SUCCESS(lStatus, done);
+
+    nlEXPECT(IsObjectProperty(reinterpret_cast<const char *>(aStart),
+                              static_cast<size_t>(lDesignator - aStart)), done);
+
+    while ((lCurrent < aEnd) && isdigit(*lCurrent))
+    {
+        lIdentifier = (lIdentifier * 10) + static_cast<unsigned int>(*lCurrent - '0');
+        nlEXPECT(lIdentifier <= std::numeric_limits<IdentifierType>::max(), done);
+
+        lCurrent++;
+    }
+
+    lRetval = IsSubscribed(lType, static_cast<IdentifierType>(lIdentifier));
+
+ done:
+    return (lRetval);
+}
+
+}; // namespace Server
+
+}; // namespace HLX
@@ -0,0 +1,119 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file defines an object for filtering the HLX server
+ *      command responses and state change notifications sent to a
+ *      client connection by the objects to which it subscribes.
+ *
+ */
+
+#ifndef OPENHLXSERVERSUBSCRIPTIONFILTER_HPP
+#define OPENHLXSERVERSUBSCRIPTIONFILTER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Model/IdentifierModel.hpp>
+#include <OpenHLX/Model/IdentifiersCollection.hpp>
+
+
+namespace HLX
+{
+
+namespace Server
+{
+
+/**
+ *  @brief
+ *    An object for filtering the HLX server command responses and
+ *    state change notifications sent to a client connection by the
+ *    objects to which it subscribes.
+ *
+ *  By default, a client connection subscribes to all server state
+ *  changes and the filter passes all data through. Once the
+ *  connection subscribes to one or more specific zones, groups,
+ *  sources, favorites, or equalizer presets, only those responses
+ *  that concern one of the subscribed objects, or that do not concern
+ *  any one of those objects in particular (for example, front panel,
+ *  infrared, and network state or a change to all zones at once), are
+ *  passed through.
+ *
+ *  @ingroup server
+ *
+ */
+class SubscriptionFilter
+{
+public:
+    /**
+     *  Convenience type redeclaring @a IdentifierType from the
+     *  identifier model.
+     *
+     */
+    typedef Model::IdentifierModel::IdentifierType IdentifierType;
+
+    /**
+     *  @brief
+     *    Enumeration of the object types that may be subscribed to.
+     *
+     */
+    enum ObjectType
+    {
+        kObjectType_Zone            = 0, //!< Zones, designated 'O'.
+        kObjectType_Group           = 1, //!< Groups, designated 'G'.
+        kObjectType_Source          = 2, //!< Sources, designated 'I'.
+        kObjectType_Favorite        = 3, //!< Favorites, designated 'F'.
+        kObjectType_EqualizerPreset = 4, //!< Equalizer presets, designated 'EP'.
+
+        kObjectType_Count
+    };
+
+public:
+    SubscriptionFilter(void);
+    ~SubscriptionFilter(void) = default;
+
+    Common::Status Init(void);
+
+    bool IsEnabled(void) const;
+    bool IsSubscribed(const ObjectType &aType, const IdentifierType &aIdentifier) const;
+
+    Common::Status Subscribe(const ObjectType &aType, const IdentifierType &aIdentifier);
+    Common::Status SubscribeAll(void);
+
+    Common::Status Filter(Common::ConnectionBuffer::ImmutableCountedPointer aBuffer, Common::ConnectionBuffer::ImmutableCountedPointer &aFilteredBuffer) const;
+
+    static Common::Status GetObjectType(const char *aDesignator, const size_t &aDesignatorLength, ObjectType &aType);
+
+private:
+    bool IsPassed(const uint8_t *aStart, const uint8_t *aEnd) const;
+
+    static bool IsObjectProperty(const char *aProperty, const size_t &aPropertyLength);
+
+private:
+    bool                          mEnabled;
+    Model::IdentifiersCollection  mIdentifiers[kObjectType_Count];
+};
+
+}; // namespace Server
+
+}; // namespace HLX
+
+#endif // OPENHLXSERVERSUBSCRIPTIONFILTER_HPP
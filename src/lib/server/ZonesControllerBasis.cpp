@@ -456,6 +456,62 @@ ZonesControllerBasis :: HandleQueryReceived(const bool &aIsConfiguration,
     return (lRetval);
 }
 
+/**
+ *  @brief
+ *    Handle and generate the server command response for a zone query
+ *    request of the zones changed since a change sequence number.
+ *
+ *  This handles and generates the server command response for a zone
+ *  query request of only those zones whose state has changed since the
+ *  specified change sequence number. As with a query current
+ *  configuration request, all of the state of each such zone is
+ *  generated.
+ *
+ *  @param[in]      aSequence  An immutable reference to the change
+ *                             sequence number after which changed
+ *                             zones are to be generated.
+ *  @param[in,out]  aBuffer    A mutable reference to the shared
+ *                             pointer into which the response is to
+ *                             be generated.
+ *
+ *  @retval  kStatus_Success        If successful.
+ *  @retval  kError_NotInitialized  If the zones model has
+ *                                  not been completely and successfully
+ *                                  initialized.
+ *  @retval  -ENOMEM                If the buffer-owned backing store
+ *                                  cannot be allocated.
+ *  @retval  -ENOSPC                If the requested size exceeds the
+ *                                  buffer capacity.
+ *
+ */
+Status
+ZonesControllerBasis :: HandleQueryChangedReceived(const ChangeSequence::SequenceType &aSequence,
+                                                   Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const
+{
+    static constexpr bool  kIsConfiguration = true;
+    IdentifiersCollection  lChangedZones;
+    Status                 lRetval;
+
+
+    lRetval = lChangedZones.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    lRetval = mZonesModel.GetZonesChangedSince(aSequence, lChangedZones);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    for (auto lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= mZonesMax; lZoneIdentifier++)
+    {
+        if (!lChangedZones.ContainsIdentifier(lZoneIdentifier))
+            continue;
+
+        lRetval = HandleQueryReceived(kIsConfiguration, lZoneIdentifier, aBuffer);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
 /**
  *  @brief
  *    Handle and generate the server command response for a zone query
@@ -512,7 +568,7 @@ ZonesControllerBasis :: HandleQueryReceived(const bool &aIsConfiguration,
     lBuffer = lNameResponse.GetBuffer();
     lSize = lNameResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
     // Source Response
@@ -554,7 +610,7 @@ ZonesControllerBasis :: HandleQueryReceived(const bool &aIsConfiguration,
     lBuffer = lBalanceResponse.GetBuffer();
     lSize = lBalanceResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -963,7 +1019,7 @@ ZonesControllerBasis :: HandleQuerySourceReceived(const Model::ZoneModel::Identi
     lBuffer = lSourceResponse.GetBuffer();
     lSize = lSourceResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1197,7 +1253,7 @@ ZonesControllerBasis :: HandleEqualizerBandResponse(const Model::ZoneModel::Iden
     lBuffer = lEqualizerBandResponse.GetBuffer();
     lSize = lEqualizerBandResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1249,7 +1305,7 @@ ZonesControllerBasis :: HandleEqualizerPresetResponse(const Model::ZoneModel::Id
     lBuffer = lEqualizerPresetResponse.GetBuffer();
     lSize = lEqualizerPresetResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1298,7 +1354,7 @@ ZonesControllerBasis :: HandleHighpassCrossoverResponse(const Model::ZoneModel::
     lBuffer = lHighpassCrossoverResponse.GetBuffer();
     lSize = lHighpassCrossoverResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1347,7 +1403,7 @@ ZonesControllerBasis :: HandleLowpassCrossoverResponse(const Model::ZoneModel::I
     lBuffer = lLowpassCrossoverResponse.GetBuffer();
     lSize = lLowpassCrossoverResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1394,7 +1450,7 @@ ZonesControllerBasis :: HandleMuteResponse(const Model::ZoneModel::IdentifierTyp
     lBuffer = lMuteResponse.GetBuffer();
     lSize = lMuteResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1443,7 +1499,7 @@ ZonesControllerBasis :: HandleSoundModeResponse(const Model::ZoneModel::Identifi
     lBuffer = lSoundModeResponse.GetBuffer();
     lSize = lSoundModeResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1496,7 +1552,7 @@ ZonesControllerBasis :: HandleToneResponse(const Model::ZoneModel::IdentifierTyp
     lBuffer = lToneResponse.GetBuffer();
     lSize = lToneResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1544,7 +1600,7 @@ ZonesControllerBasis :: HandleVolumeResponse(const Model::ZoneModel::IdentifierT
     lBuffer = lVolumeResponse.GetBuffer();
     lSize = lVolumeResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
@@ -1593,7 +1649,7 @@ ZonesControllerBasis :: HandleVolumeFixedResponse(const Model::ZoneModel::Identi
     lBuffer = lVolumeFixedResponse.GetBuffer();
     lSize = lVolumeFixedResponse.GetSize();
 
-    lRetval = Common::Utilities::Put(*aBuffer.get(), lBuffer, lSize);
+    lRetval = Common::Utilities::Append(*aBuffer.get(), lBuffer, lSize);
     nlREQUIRE_SUCCESS(lRetval, done);
 
  done:
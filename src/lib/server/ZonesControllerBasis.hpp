@@ -26,6 +26,7 @@
 #ifndef OPENHLXSERVERZONESCONTROLLERBASIS_HPP
 #define OPENHLXSERVERZONESCONTROLLERBASIS_HPP
 
+#include <OpenHLX/Model/ChangeSequence.hpp>
 #include <OpenHLX/Model/EqualizerBandModel.hpp>
 #include <OpenHLX/Model/EqualizerPresetModel.hpp>
 #include <OpenHLX/Model/SoundModel.hpp>
@@ -76,6 +77,8 @@ protected:
 
     Common::Status        HandleQueryReceived(const bool &aIsConfiguration,
                                               Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
+    Common::Status        HandleQueryChangedReceived(const Model::ChangeSequence::SequenceType &aSequence,
+                                                     Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
     Common::Status        HandleQueryReceived(const bool &aIsConfiguration,
                                               const Model::ZoneModel::IdentifierType &aZoneIdentifier,
                                               Common::ConnectionBuffer::MutableCountedPointer &aBuffer) const;
@@ -0,0 +1,246 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the admission control of
+ *      HLX::Server::ConnectionManager.
+ *
+ */
+
+#include <string>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/RunLoopParameters.hpp>
+#include <OpenHLX/Server/ConnectionManager.hpp>
+#include <OpenHLX/Server/ConnectionManagerDelegate.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+using namespace HLX::Server;
+
+
+/**
+ *  A connection manager delegate that counts the delegations of
+ *  interest to the test and ignores all others.
+ *
+ */
+class TestConnectionManagerDelegate :
+    public ConnectionManagerDelegate
+{
+public:
+    TestConnectionManagerDelegate(void) :
+        mDidListen(0),
+        mDidAccept(0),
+        mErrors(0)
+    {
+        return;
+    }
+
+    void ConnectionManagerWillResolve(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, const char *) final { }
+    void ConnectionManagerIsResolving(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, const char *) final { }
+    void ConnectionManagerDidResolve(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, const char *, const IPAddress &) final { }
+    void ConnectionManagerDidNotResolve(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, const char *, const Error &) final { }
+
+    void ConnectionManagerWillListen(ConnectionManager &, CFURLRef) final { }
+    void ConnectionManagerIsListening(ConnectionManager &, CFURLRef) final { }
+    void ConnectionManagerDidListen(ConnectionManager &, CFURLRef) final { mDidListen++; }
+    void ConnectionManagerDidNotListen(ConnectionManager &, CFURLRef, const Error &) final { }
+
+    void ConnectionManagerWillAccept(ConnectionManager &, CFURLRef) final { }
+    void ConnectionManagerIsAccepting(ConnectionManager &, CFURLRef) final { }
+    void ConnectionManagerDidAccept(ConnectionManager &, CFURLRef) final { mDidAccept++; }
+    void ConnectionManagerDidNotAccept(ConnectionManager &, CFURLRef, const Error &) final { }
+
+    void ConnectionManagerWillDisconnect(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, CFURLRef) final { }
+    void ConnectionManagerDidDisconnect(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, CFURLRef, const Error &) final { }
+    void ConnectionManagerDidNotDisconnect(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, CFURLRef, const Error &) final { }
+
+    void ConnectionManagerError(ConnectionManagerBasis &, const ConnectionManagerBasis::Roles &, const Error &) final { mErrors++; }
+
+    size_t  mDidListen;
+    size_t  mDidAccept;
+    size_t  mErrors;
+};
+
+static int Connect(const std::string &aPath)
+{
+    struct sockaddr_un  lAddress;
+    int                 lSocket;
+    int                 lStatus;
+
+    lSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (lSocket != -1)
+    {
+        memset(&lAddress, 0, sizeof (lAddress));
+
+        lAddress.sun_family = AF_UNIX;
+        strncpy(lAddress.sun_path, aPath.c_str(), sizeof (lAddress.sun_path) - 1);
+
+        lStatus = connect(lSocket, reinterpret_cast<struct sockaddr *>(&lAddress), sizeof (lAddress));
+
+        if (lStatus != 0)
+        {
+            close(lSocket);
+            lSocket = -1;
+        }
+    }
+
+    return (lSocket);
+}
+
+static void Run(const ConnectionManager &aConnectionManager, const TestConnectionManagerDelegate &aDelegate)
+{
+    static const size_t kIterationsMax = 40;
+
+    // Run the run loop until the refusal has been counted or the
+    // iterations are exhausted, whichever comes first.
+
+    for (size_t i = 0; i < kIterationsMax; i++)
+    {
+        if ((aDelegate.mDidAccept > 0) &&
+            (aConnectionManager.GetAdmissionCounters().mConnectionsRejected > 0))
+        {
+            break;
+        }
+
+        CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0.05, true);
+    }
+}
+
+static void CheckRefusal(nlTestSuite *inSuite, const std::string &aDirectory)
+{
+    const std::string              lPath = aDirectory + "/server.sock";
+    const std::string              lURL  = "unix://" + lPath;
+    RunLoopParameters              lRunLoopParameters;
+    ConnectionManager              lConnectionManager;
+    TestConnectionManagerDelegate  lDelegate;
+    int                            lFirst  = -1;
+    int                            lSecond = -1;
+    char                           lByte;
+    ssize_t                        lResult;
+    Status                         lStatus;
+
+    // Admit only one connection at a time.
+
+    lStatus = ConnectionManager::SetConnectionsMax(1);
+    NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+
+    lStatus = lRunLoopParameters.Init(CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lConnectionManager.Init(lRunLoopParameters);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lConnectionManager.AddDelegate(&lDelegate);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lConnectionManager.Listen(lURL.c_str());
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    NL_TEST_ASSERT(inSuite, lDelegate.mDidListen == 1);
+
+    // The first connection is admitted; the second, over the limit,
+    // is refused.
+
+    lFirst = Connect(lPath);
+    NL_TEST_ASSERT(inSuite, lFirst != -1);
+
+    lSecond = Connect(lPath);
+    NL_TEST_ASSERT(inSuite, lSecond != -1);
+
+    Run(lConnectionManager, lDelegate);
+
+    NL_TEST_ASSERT(inSuite, lDelegate.mDidAccept == 1);
+    NL_TEST_ASSERT(inSuite, lConnectionManager.GetAdmissionCounters().mConnectionsRejected == 1);
+
+    // The refusal closes the refused connection without delivering
+    // an error, which a server would otherwise treat as fatal.
+
+    NL_TEST_ASSERT(inSuite, lDelegate.mErrors == 0);
+
+    lResult = read(lSecond, &lByte, sizeof (lByte));
+    NL_TEST_ASSERT(inSuite, lResult == 0);
+
+    close(lSecond);
+    close(lFirst);
+
+    lStatus = ConnectionManager::SetConnectionsMax(0);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+}
+
+static void TestRefusal(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    char  lDirectory[] = P_tmpdir "/TestConnectionManager.XXXXXX";
+
+    NL_TEST_ASSERT(inSuite, mkdtemp(lDirectory) != nullptr);
+
+    // The connection manager, and its listener, which removes its
+    // local socket, are destroyed before the directory is removed.
+
+    CheckRefusal(inSuite, lDirectory);
+
+    rmdir(lDirectory);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Refusal", TestRefusal),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Server Connection Manager",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
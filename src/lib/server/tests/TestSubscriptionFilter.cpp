@@ -0,0 +1,223 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for
+ *      HLX::Server::SubscriptionFilter.
+ *
+ */
+
+#include <string>
+
+#include <string.h>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Server/SubscriptionFilter.hpp>
+#include <OpenHLX/Utilities/ElementsOf.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+using namespace HLX::Server;
+using namespace HLX::Utilities;
+
+
+static std::string Filter(nlTestSuite *inSuite, const SubscriptionFilter &aFilter, const char *aData)
+{
+    ConnectionBuffer::MutableCountedPointer    lBuffer;
+    ConnectionBuffer::ImmutableCountedPointer  lFilteredBuffer;
+    std::string                                lRetval;
+    Status                                     lStatus;
+
+    lStatus = ConnectionBuffer::Create(lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = Common::Utilities::Put(*lBuffer.get(), reinterpret_cast<const uint8_t *>(aData), strlen(aData));
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = aFilter.Filter(lBuffer, lFilteredBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    if (lFilteredBuffer)
+    {
+        lRetval.assign(reinterpret_cast<const char *>(lFilteredBuffer->GetHead()),
+                       lFilteredBuffer->GetSize());
+    }
+
+    return (lRetval);
+}
+
+static std::string FilterChained(nlTestSuite *inSuite, const SubscriptionFilter &aFilter, const char * const *aResponses, const size_t &aCount)
+{
+    ConnectionBuffer::MutableCountedPointer    lBuffer;
+    ConnectionBuffer::ImmutableCountedPointer  lFilteredBuffer;
+    std::string                                lRetval;
+    Status                                     lStatus;
+
+    // Start with a buffer too small for any one response such that
+    // the responses are appended across several chained fragments.
+
+    lStatus = ConnectionBuffer::Create(lBuffer, 1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        lStatus = Common::Utilities::Append(*lBuffer.get(), reinterpret_cast<const uint8_t *>(aResponses[i]), strlen(aResponses[i]));
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+    }
+
+    NL_TEST_ASSERT(inSuite, lBuffer->GetNext() != nullptr);
+
+    lStatus = aFilter.Filter(lBuffer, lFilteredBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    for (; lFilteredBuffer; lFilteredBuffer = lFilteredBuffer->GetNext())
+    {
+        lRetval.append(reinterpret_cast<const char *>(lFilteredBuffer->GetHead()),
+                       lFilteredBuffer->GetSize());
+    }
+
+    return (lRetval);
+}
+
+static void TestObjects(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    SubscriptionFilter  lFilter;
+    Status              lStatus;
+
+    lStatus = lFilter.Init();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Without any subscription, everything passes.
+
+    NL_TEST_ASSERT(inSuite, Filter(inSuite, lFilter, "(VO2R-20)") == "(VO2R-20)");
+
+    lStatus = lFilter.Subscribe(SubscriptionFilter::kObjectType_Zone, 1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lFilter.Subscribe(SubscriptionFilter::kObjectType_EqualizerPreset, 1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Only responses concerning the subscribed objects pass.
+
+    NL_TEST_ASSERT(inSuite, Filter(inSuite, lFilter, "(VO1R-20)(VO2R-20)") == "(VO1R-20)");
+    NL_TEST_ASSERT(inSuite, Filter(inSuite, lFilter, "(VMO1)(VUMO2)(VMTO2)") == "(VMO1)");
+    NL_TEST_ASSERT(inSuite, Filter(inSuite, lFilter, "(NEP2\"Rock\")(EP1B2L-1)(QEP2)") == "(EP1B2L-1)");
+    NL_TEST_ASSERT(inSuite, Filter(inSuite, lFilter, "(NF1\"One\")(VG1R-20)") == "");
+
+    // Responses concerning all objects at once pass.
+
+    NL_TEST_ASSERT(inSuite, Filter(inSuite, lFilter, "(CXI2)(VXR-20)") == "(CXI2)(VXR-20)");
+}
+
+static void TestNonObjects(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    static const char * const kResponses =
+        "(MACF0-12-34-56-78-9A)"
+        "(IPFE80::1)"
+        "(GW192.168.1.1)"
+        "(NM255.255.255.0)"
+        "(DHCP1)"
+        "(SDDP0)"
+        "(SD2)"
+        "(FPL1)"
+        "(IRL0)";
+    SubscriptionFilter  lFilter;
+    Status              lStatus;
+
+    lStatus = lFilter.Init();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lFilter.Subscribe(SubscriptionFilter::kObjectType_Favorite, 1);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Network, front panel, and infrared responses do not concern any
+    // particular object and pass, even when their values begin with
+    // what might otherwise be taken for an object designator and
+    // identifier (for example, favorite 0 in "MACF0-...").
+
+    NL_TEST_ASSERT(inSuite, Filter(inSuite, lFilter, kResponses) == kResponses);
+}
+
+static void TestChained(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    static const char * const kResponses[] = {
+        "(VO1R-20)",
+        "(VO2R-20)",
+        "(VMO1)",
+        "(VUMO2)",
+        "(CXI2)"
+    };
+    SubscriptionFilter  lFilter;
+    Status              lStatus;
+
+    lStatus = lFilter.Init();
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Without any subscription, every fragment passes.
+
+    NL_TEST_ASSERT(inSuite, FilterChained(inSuite, lFilter, kResponses, ElementsOf(kResponses)) == "(VO1R-20)(VO2R-20)(VMO1)(VUMO2)(CXI2)");
+
+    lStatus = lFilter.Subscribe(SubscriptionFilter::kObjectType_Zone, 2);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    // Only responses concerning the subscribed objects pass, including
+    // those in fragments preceding the first removed response.
+
+    NL_TEST_ASSERT(inSuite, FilterChained(inSuite, lFilter, &kResponses[1], ElementsOf(kResponses) - 1) == "(VO2R-20)(VUMO2)(CXI2)");
+    NL_TEST_ASSERT(inSuite, FilterChained(inSuite, lFilter, kResponses, ElementsOf(kResponses)) == "(VO2R-20)(VUMO2)(CXI2)");
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Objects",      TestObjects),
+    NL_TEST_DEF("Non-objects",  TestNonObjects),
+    NL_TEST_DEF("Chained",      TestChained),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Server Subscription Filter",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
@@ -0,0 +1,252 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the delta-sync query of
+ *      HLX::Server::ZonesControllerBasis.
+ *
+ */
+
+#include <string>
+
+#include <nlunit-test.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Model/ChangeSequence.hpp>
+#include <OpenHLX/Model/IdentifierModel.hpp>
+#include <OpenHLX/Model/SoundModel.hpp>
+#include <OpenHLX/Model/ZoneModel.hpp>
+#include <OpenHLX/Model/ZonesModel.hpp>
+#include <OpenHLX/Server/ZonesControllerBasis.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+using namespace HLX::Model;
+using namespace HLX::Server;
+
+
+static const ZoneModel::IdentifierType kZonesMax = 4;
+
+/**
+ *  A zones controller that exposes its query handlers for test.
+ *
+ */
+class ZonesController :
+    public ZonesControllerBasis
+{
+public:
+    ZonesController(ZonesModel &aZonesModel) :
+        ZonesControllerBasis(aZonesModel, kZonesMax)
+    {
+        return;
+    }
+
+    using ZonesControllerBasis::HandleQueryReceived;
+    using ZonesControllerBasis::HandleQueryChangedReceived;
+};
+
+static void InitZones(nlTestSuite *inSuite, ZonesModel &aZonesModel)
+{
+    Status  lStatus;
+
+    lStatus = aZonesModel.Init(kZonesMax);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    for (auto lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= kZonesMax; lZoneIdentifier++)
+    {
+        const std::string  lName = "Zone " + std::to_string(lZoneIdentifier);
+        ZoneModel          lZoneModel;
+
+        lStatus = lZoneModel.Init(lName, lZoneIdentifier);
+        NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+        lStatus = lZoneModel.SetSource(IdentifierModel::kIdentifierMin);
+        NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+
+        lStatus = lZoneModel.SetVolume(-20);
+        NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+
+        lStatus = lZoneModel.SetVolumeFixed(false);
+        NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+
+        lStatus = lZoneModel.SetMute(false);
+        NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+
+        lStatus = lZoneModel.SetSoundMode(SoundModel::kSoundModeDisabled);
+        NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+
+        lStatus = lZoneModel.SetBalance(0);
+        NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+
+        lStatus = aZonesModel.SetZone(lZoneIdentifier, lZoneModel);
+        NL_TEST_ASSERT(inSuite, lStatus >= kStatus_Success);
+    }
+}
+
+static std::string GetChainData(ConnectionBuffer::ImmutableCountedPointer aBuffer)
+{
+    std::string  lRetval;
+
+    for (; aBuffer; aBuffer = aBuffer->GetNext())
+    {
+        lRetval.append(reinterpret_cast<const char *>(aBuffer->GetHead()), aBuffer->GetSize());
+    }
+
+    return (lRetval);
+}
+
+static std::string QueryChanged(nlTestSuite *inSuite, const ZonesController &aController, const ChangeSequence::SequenceType &aSequence)
+{
+    ConnectionBuffer::MutableCountedPointer  lBuffer;
+    Status                                   lStatus;
+
+    lStatus = ConnectionBuffer::Create(lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = aController.HandleQueryChangedReceived(aSequence, lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    return (GetChainData(lBuffer));
+}
+
+static std::string Query(nlTestSuite *inSuite, const ZonesController &aController, const ZoneModel::IdentifierType &aZoneIdentifier)
+{
+    static constexpr bool                    kIsConfiguration = true;
+    ConnectionBuffer::MutableCountedPointer  lBuffer;
+    Status                                   lStatus;
+
+    lStatus = ConnectionBuffer::Create(lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = aController.HandleQueryReceived(kIsConfiguration, aZoneIdentifier, lBuffer);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    return (GetChainData(lBuffer));
+}
+
+static void TestQueryChanged(nlTestSuite *inSuite, void *inContext __attribute__((unused)))
+{
+    static const ZoneModel::IdentifierType  kZoneIdentifier = 2;
+    ZonesModel                              lZonesModel;
+    ZonesController                         lController(lZonesModel);
+    ZoneModel *                             lZoneModel;
+    ChangeSequence::SequenceType            lSequence;
+    std::string                             lExpected;
+    Status                                  lStatus;
+
+    InitZones(inSuite, lZonesModel);
+
+    // Test 1: Test that all zones are returned since before
+    //         initialization.
+
+    lExpected.clear();
+
+    for (auto lZoneIdentifier = IdentifierModel::kIdentifierMin; lZoneIdentifier <= kZonesMax; lZoneIdentifier++)
+    {
+        lExpected += Query(inSuite, lController, lZoneIdentifier);
+    }
+
+    NL_TEST_ASSERT(inSuite, QueryChanged(inSuite, lController, ChangeSequence::kSequenceNone) == lExpected);
+
+    // Test 2: Test that no zones are returned since the sequence
+    //         number of the last response.
+
+    lSequence = ChangeSequence::GetSequence();
+
+    NL_TEST_ASSERT(inSuite, QueryChanged(inSuite, lController, lSequence).empty());
+
+    // Test 3: Test that only a zone changed in place is returned.
+
+    lStatus = lZonesModel.GetZone(kZoneIdentifier, lZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneModel->SetMute(true);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, QueryChanged(inSuite, lController, lSequence) == Query(inSuite, lController, kZoneIdentifier));
+
+    // Test 4: Test that a zone changed in place and then reverted
+    //         between queries, for example, muted and unmuted by two
+    //         requests, as a client that saw the intermediate state
+    //         through a notification would need to know, is returned.
+
+    lSequence = ChangeSequence::GetSequence();
+
+    lStatus = lZonesModel.GetZone(kZoneIdentifier, lZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneModel->SetMute(false);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZonesModel.GetZone(kZoneIdentifier, lZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneModel->SetMute(true);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    NL_TEST_ASSERT(inSuite, QueryChanged(inSuite, lController, lSequence) == Query(inSuite, lController, kZoneIdentifier));
+
+    // Test 5: Test that a zone accessed for mutation but not changed
+    //         is not returned.
+
+    lSequence = ChangeSequence::GetSequence();
+
+    lStatus = lZonesModel.GetZone(kZoneIdentifier, lZoneModel);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_Success);
+
+    lStatus = lZoneModel->SetMute(true);
+    NL_TEST_ASSERT(inSuite, lStatus == kStatus_ValueAlreadySet);
+
+    NL_TEST_ASSERT(inSuite, QueryChanged(inSuite, lController, lSequence).empty());
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF("Query Changed", TestQueryChanged),
+
+    NL_TEST_SENTINEL()
+};
+
+int main(void)
+{
+    nlTestSuite theSuite = {
+        "Server Zones Controller Basis",
+        &sTests[0],
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,
+        0,
+        0,
+        0,
+        0
+    };
+
+    // Generate human-readable output.
+    nlTestSetOutputStyle(OUTPUT_DEF);
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
@@ -148,6 +148,31 @@ inline Common::Status Parse(const uint8_t *aBuffer, const size_t &aBufferLength,
     return (Parse(reinterpret_cast<const char *>(aBuffer), aBufferLength, aValue));
 }
 
+/**
+ *  @brief
+ *    Parse an unsigned 32-bit value from the specified string buffer
+ *    extent.
+ *
+ *  This attempts to parse an unsigned 32-bit value from the specified
+ *  string buffer extent.
+ *
+ *  @param[in]   aBuffer        A pointer to the start of the string buffer
+ *                              extent.
+ *  @param[in]   aBufferLength  The length of the string buffer extent.
+ *  @param[out]  aValue         A mutable reference to storage to parse the
+ *                              unsigned 32-bit value into.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *  @retval  -ERANGE          The parsed value was out of range.
+ *  @retval  -EINVAL          No valid parseable characters were encountered.
+ *  @retval  -EOVERFLOW       The parsed value was too large to represent.
+ *
+ */
+inline Common::Status Parse(const uint8_t *aBuffer, const size_t &aBufferLength, uint32_t &aValue)
+{
+    return (Parse(reinterpret_cast<const char *>(aBuffer), aBufferLength, aValue));
+}
+
 /**
  *  @brief
  *    Parse a Boolean value from the specified null-terminated C
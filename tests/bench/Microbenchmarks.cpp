@@ -0,0 +1,950 @@
+/*
+ *    Copyright (c) 2022 Grant Erickson
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing,
+ *    software distributed under the License is distributed on an "AS
+ *    IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ *    express or implied.  See the License for the specific language
+ *    governing permissions and limitations under the License.
+ *
+ */
+
+/**
+ *    @file
+ *      This file implements microbenchmarks for the protocol parsing
+ *      and formatting primitives on the HLX server request and
+ *      response paths: request regular expression matching, request
+ *      dispatch, connection buffer growth, integer parsing, and
+ *      response formatting.
+ *
+ *      Results are written to standard output as a JSON object with
+ *      one entry per benchmark.
+ *
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <CoreFoundation/CFString.h>
+
+#include <OpenHLX/Common/ConnectionBuffer.hpp>
+#include <OpenHLX/Common/Errors.hpp>
+#include <OpenHLX/Common/RegularExpression.hpp>
+#include <OpenHLX/Server/CommandManager.hpp>
+#include <OpenHLX/Server/CommandRequestBasis.hpp>
+#include <OpenHLX/Server/ConfigurationControllerCommands.hpp>
+#include <OpenHLX/Server/ConnectionBasis.hpp>
+#include <OpenHLX/Server/ConnectionManager.hpp>
+#include <OpenHLX/Server/EqualizerPresetsControllerCommands.hpp>
+#include <OpenHLX/Server/FavoritesControllerCommands.hpp>
+#include <OpenHLX/Server/FrontPanelControllerCommands.hpp>
+#include <OpenHLX/Server/GroupsControllerCommands.hpp>
+#include <OpenHLX/Server/InfraredControllerCommands.hpp>
+#include <OpenHLX/Server/NetworkControllerCommands.hpp>
+#include <OpenHLX/Server/SourcesControllerCommands.hpp>
+#include <OpenHLX/Server/ZonesControllerCommands.hpp>
+#include <OpenHLX/Utilities/Assert.hpp>
+#include <OpenHLX/Utilities/ElementsOf.hpp>
+#include <OpenHLX/Utilities/Parse.hpp>
+
+
+using namespace HLX;
+using namespace HLX::Common;
+using namespace HLX::Model;
+using namespace HLX::Utilities;
+
+
+// Type Declarations
+
+/**
+ *  A monotonic time, in nanoseconds.
+ *
+ */
+typedef uint64_t Timestamp;
+
+/**
+ *  A function that runs the specified number of iterations of a
+ *  benchmark with the specified context.
+ *
+ */
+typedef Status (*BenchmarkFunction)(const void *aContext, const size_t &aIterations);
+
+/**
+ *  A named benchmark and its context.
+ *
+ */
+struct Benchmark
+{
+    const char *       mName;
+    BenchmarkFunction  mFunction;
+    const void *       mContext;
+};
+
+/**
+ *  A server command request, its initializer, and a request string
+ *  it matches.
+ *
+ */
+struct RequestSample
+{
+    const char *                     mName;
+    Server::Command::RequestBasis *  mRequest;
+    Status                        (* mInit)(Server::Command::RequestBasis &aRequest);
+    const char *                     mString;
+    unsigned int                     mWeight;
+};
+
+/**
+ *  A parse benchmark input and the type to parse it as.
+ *
+ */
+struct ParseSample
+{
+    enum Type
+    {
+        kTypeInt8,
+        kTypeUInt8,
+        kTypeUInt16,
+        kTypeUInt32
+    };
+
+    Type          mType;
+    const char *  mString;
+};
+
+/**
+ *  A connection buffer put benchmark input.
+ *
+ */
+struct PutSample
+{
+    size_t  mChunkSize;
+    size_t  mTotalSize;
+    bool    mReuse;
+};
+
+/**
+ *  A null server connection that discards anything sent to it, used
+ *  as the peer for request dispatch.
+ *
+ */
+class NullConnection :
+    public Server::ConnectionBasis
+{
+public:
+    NullConnection(void) : Server::ConnectionBasis(CFSTR("null")) { return; }
+    ~NullConnection(void) = default;
+
+    Status Send(ConnectionBuffer::ImmutableCountedPointer aBuffer) final
+    {
+        (void)aBuffer;
+
+        return (kStatus_Success);
+    }
+};
+
+// Global Variables
+
+static volatile size_t      sSink                = 0;
+static size_t               sDispatched          = 0;
+
+static Timestamp            sMinimumTime         = 100000000;
+static unsigned int         sRepetitions         = 5;
+
+/**
+ *  @brief
+ *    Initialize a server command request of the specified type.
+ *
+ *  The request initializers are not virtual, so this provides a
+ *  uniform way to initialize the heterogeneous requests below.
+ *
+ */
+template <typename RequestType>
+static Status
+Initialize(Server::Command::RequestBasis &aRequest)
+{
+    return (static_cast<RequestType &>(aRequest).Init());
+}
+
+// Server Command Requests
+
+static Server::Command::Configuration::LoadFromBackupRequest   sConfigurationLoadFromBackupRequest;
+static Server::Command::Configuration::QueryCurrentRequest     sConfigurationQueryCurrentRequest;
+static Server::Command::Configuration::ResetToDefaultsRequest  sConfigurationResetToDefaultsRequest;
+static Server::Command::Configuration::SaveToBackupRequest     sConfigurationSaveToBackupRequest;
+
+static Server::Command::EqualizerPresets::DecreaseBandRequest  sEqualizerPresetsDecreaseBandRequest;
+static Server::Command::EqualizerPresets::IncreaseBandRequest  sEqualizerPresetsIncreaseBandRequest;
+static Server::Command::EqualizerPresets::QueryRequest         sEqualizerPresetsQueryRequest;
+static Server::Command::EqualizerPresets::SetBandRequest       sEqualizerPresetsSetBandRequest;
+static Server::Command::EqualizerPresets::SetNameRequest       sEqualizerPresetsSetNameRequest;
+
+static Server::Command::Favorites::QueryRequest                sFavoritesQueryRequest;
+static Server::Command::Favorites::SetNameRequest              sFavoritesSetNameRequest;
+
+static Server::Command::FrontPanel::QueryRequest               sFrontPanelQueryRequest;
+static Server::Command::FrontPanel::SetBrightnessRequest       sFrontPanelSetBrightnessRequest;
+static Server::Command::FrontPanel::SetLockedRequest           sFrontPanelSetLockedRequest;
+
+static Server::Command::Groups::AddZoneRequest                 sGroupsAddZoneRequest;
+static Server::Command::Groups::ClearZonesRequest              sGroupsClearZonesRequest;
+static Server::Command::Groups::DecreaseVolumeRequest          sGroupsDecreaseVolumeRequest;
+static Server::Command::Groups::IncreaseVolumeRequest          sGroupsIncreaseVolumeRequest;
+static Server::Command::Groups::MuteRequest                    sGroupsMuteRequest;
+static Server::Command::Groups::QueryRequest                   sGroupsQueryRequest;
+static Server::Command::Groups::RemoveZoneRequest              sGroupsRemoveZoneRequest;
+static Server::Command::Groups::SetNameRequest                 sGroupsSetNameRequest;
+static Server::Command::Groups::SetSourceRequest               sGroupsSetSourceRequest;
+static Server::Command::Groups::SetVolumeRequest               sGroupsSetVolumeRequest;
+static Server::Command::Groups::ToggleMuteRequest              sGroupsToggleMuteRequest;
+
+static Server::Command::Infrared::QueryRequest                 sInfraredQueryRequest;
+static Server::Command::Infrared::SetDisabledRequest           sInfraredSetDisabledRequest;
+
+static Server::Command::Network::QueryRequest                  sNetworkQueryRequest;
+static Server::Command::Network::SetDHCPv4EnabledRequest       sNetworkSetDHCPv4EnabledRequest;
+static Server::Command::Network::SetSDDPEnabledRequest         sNetworkSetSDDPEnabledRequest;
+
+static Server::Command::Sources::SetNameRequest                sSourcesSetNameRequest;
+
+static Server::Command::Zones::AdjustBalanceRequest            sZonesAdjustBalanceRequest;
+static Server::Command::Zones::DecreaseBassRequest             sZonesDecreaseBassRequest;
+static Server::Command::Zones::DecreaseEqualizerBandRequest    sZonesDecreaseEqualizerBandRequest;
+static Server::Command::Zones::DecreaseTrebleRequest           sZonesDecreaseTrebleRequest;
+static Server::Command::Zones::DecreaseVolumeRequest           sZonesDecreaseVolumeRequest;
+static Server::Command::Zones::IncreaseBassRequest             sZonesIncreaseBassRequest;
+static Server::Command::Zones::IncreaseEqualizerBandRequest    sZonesIncreaseEqualizerBandRequest;
+static Server::Command::Zones::IncreaseTrebleRequest           sZonesIncreaseTrebleRequest;
+static Server::Command::Zones::IncreaseVolumeRequest           sZonesIncreaseVolumeRequest;
+static Server::Command::Zones::MuteRequest                     sZonesMuteRequest;
+static Server::Command::Zones::QueryMuteRequest                sZonesQueryMuteRequest;
+static Server::Command::Zones::QueryRequest                    sZonesQueryRequest;
+static Server::Command::Zones::QuerySourceRequest              sZonesQuerySourceRequest;
+static Server::Command::Zones::QueryVolumeRequest              sZonesQueryVolumeRequest;
+static Server::Command::Zones::SetBalanceRequest               sZonesSetBalanceRequest;
+static Server::Command::Zones::SetEqualizerBandRequest         sZonesSetEqualizerBandRequest;
+static Server::Command::Zones::SetEqualizerPresetRequest       sZonesSetEqualizerPresetRequest;
+static Server::Command::Zones::SetHighpassCrossoverRequest     sZonesSetHighpassCrossoverRequest;
+static Server::Command::Zones::SetLowpassCrossoverRequest      sZonesSetLowpassCrossoverRequest;
+static Server::Command::Zones::SetNameRequest                  sZonesSetNameRequest;
+static Server::Command::Zones::SetSoundModeRequest             sZonesSetSoundModeRequest;
+static Server::Command::Zones::SetSourceAllRequest             sZonesSetSourceAllRequest;
+static Server::Command::Zones::SetSourceRequest                sZonesSetSourceRequest;
+static Server::Command::Zones::SetToneRequest                  sZonesSetToneRequest;
+static Server::Command::Zones::SetVolumeAllRequest             sZonesSetVolumeAllRequest;
+static Server::Command::Zones::SetVolumeFixedRequest           sZonesSetVolumeFixedRequest;
+static Server::Command::Zones::SetVolumeRequest                sZonesSetVolumeRequest;
+static Server::Command::Zones::ToggleMuteRequest               sZonesToggleMuteRequest;
+
+/**
+ *  Every server command request, a request string it matches, and
+ *  its relative weight in the dispatch request mix.
+ *
+ *  The weights approximate the traffic of a typical control client:
+ *  dominated by zone and group volume, mute, and source queries and
+ *  mutations, with configuration, naming, and equalization rare.
+ *
+ */
+static const RequestSample  sRequestSamples[] = {
+    { "configuration.load-from-backup",  &sConfigurationLoadFromBackupRequest,    Initialize<Server::Command::Configuration::LoadFromBackupRequest>,       "[LOAD]",                 0 },
+    { "configuration.query-current",     &sConfigurationQueryCurrentRequest,      Initialize<Server::Command::Configuration::QueryCurrentRequest>,         "[QX]",                   1 },
+    { "configuration.reset-to-defaults", &sConfigurationResetToDefaultsRequest,   Initialize<Server::Command::Configuration::ResetToDefaultsRequest>,      "[RESET]",                0 },
+    { "configuration.save-to-backup",    &sConfigurationSaveToBackupRequest,      Initialize<Server::Command::Configuration::SaveToBackupRequest>,         "[SAVE]",                 0 },
+
+    { "equalizer-presets.decrease-band", &sEqualizerPresetsDecreaseBandRequest,   Initialize<Server::Command::EqualizerPresets::DecreaseBandRequest>,      "[EP1B3D]",               0 },
+    { "equalizer-presets.increase-band", &sEqualizerPresetsIncreaseBandRequest,   Initialize<Server::Command::EqualizerPresets::IncreaseBandRequest>,      "[EP1B3U]",               0 },
+    { "equalizer-presets.query",         &sEqualizerPresetsQueryRequest,          Initialize<Server::Command::EqualizerPresets::QueryRequest>,             "[QEP1]",                 1 },
+    { "equalizer-presets.set-band",      &sEqualizerPresetsSetBandRequest,        Initialize<Server::Command::EqualizerPresets::SetBandRequest>,           "[EP1B3L-4]",             0 },
+    { "equalizer-presets.set-name",      &sEqualizerPresetsSetNameRequest,        Initialize<Server::Command::EqualizerPresets::SetNameRequest>,           "[NEP1\"Rock\"]",         0 },
+
+    { "favorites.query",                 &sFavoritesQueryRequest,                 Initialize<Server::Command::Favorites::QueryRequest>,                    "[QF1]",                  1 },
+    { "favorites.set-name",              &sFavoritesSetNameRequest,               Initialize<Server::Command::Favorites::SetNameRequest>,                  "[NF1\"Jazz\"]",          0 },
+
+    { "front-panel.query",               &sFrontPanelQueryRequest,                Initialize<Server::Command::FrontPanel::QueryRequest>,                   "[QFPL]",                 1 },
+    { "front-panel.set-brightness",      &sFrontPanelSetBrightnessRequest,        Initialize<Server::Command::FrontPanel::SetBrightnessRequest>,           "[SD2]",                  0 },
+    { "front-panel.set-locked",          &sFrontPanelSetLockedRequest,            Initialize<Server::Command::FrontPanel::SetLockedRequest>,               "[FPL1]",                 0 },
+
+    { "groups.add-zone",                 &sGroupsAddZoneRequest,                  Initialize<Server::Command::Groups::AddZoneRequest>,                     "[G1AO2]",                0 },
+    { "groups.clear-zones",              &sGroupsClearZonesRequest,               Initialize<Server::Command::Groups::ClearZonesRequest>,                  "[GAR]",                  0 },
+    { "groups.decrease-volume",          &sGroupsDecreaseVolumeRequest,           Initialize<Server::Command::Groups::DecreaseVolumeRequest>,              "[VG1D]",                 2 },
+    { "groups.increase-volume",          &sGroupsIncreaseVolumeRequest,           Initialize<Server::Command::Groups::IncreaseVolumeRequest>,              "[VG1U]",                 2 },
+    { "groups.mute",                     &sGroupsMuteRequest,                     Initialize<Server::Command::Groups::MuteRequest>,                        "[VMG1]",                 1 },
+    { "groups.query",                    &sGroupsQueryRequest,                    Initialize<Server::Command::Groups::QueryRequest>,                       "[QG1]",                  4 },
+    { "groups.remove-zone",              &sGroupsRemoveZoneRequest,               Initialize<Server::Command::Groups::RemoveZoneRequest>,                  "[G1RO2]",                0 },
+    { "groups.set-name",                 &sGroupsSetNameRequest,                  Initialize<Server::Command::Groups::SetNameRequest>,                     "[NG1\"Downstairs\"]",    0 },
+    { "groups.set-source",               &sGroupsSetSourceRequest,                Initialize<Server::Command::Groups::SetSourceRequest>,                   "[CG1I2]",                2 },
+    { "groups.set-volume",               &sGroupsSetVolumeRequest,                Initialize<Server::Command::Groups::SetVolumeRequest>,                   "[VG1R-20]",              2 },
+    { "groups.toggle-mute",              &sGroupsToggleMuteRequest,               Initialize<Server::Command::Groups::ToggleMuteRequest>,                  "[VMTG1]",                1 },
+
+    { "infrared.query",                  &sInfraredQueryRequest,                  Initialize<Server::Command::Infrared::QueryRequest>,                     "[QIRL]",                 1 },
+    { "infrared.set-disabled",           &sInfraredSetDisabledRequest,            Initialize<Server::Command::Infrared::SetDisabledRequest>,               "[IRL0]",                 0 },
+
+    { "network.query",                   &sNetworkQueryRequest,                   Initialize<Server::Command::Network::QueryRequest>,                      "[QE]",                   1 },
+    { "network.set-dhcpv4-enabled",      &sNetworkSetDHCPv4EnabledRequest,        Initialize<Server::Command::Network::SetDHCPv4EnabledRequest>,           "[DHCP1]",                0 },
+    { "network.set-sddp-enabled",        &sNetworkSetSDDPEnabledRequest,          Initialize<Server::Command::Network::SetSDDPEnabledRequest>,             "[SDDP1]",                0 },
+
+    { "sources.set-name",                &sSourcesSetNameRequest,                 Initialize<Server::Command::Sources::SetNameRequest>,                    "[NI1\"Turntable\"]",     0 },
+
+    { "zones.adjust-balance",            &sZonesAdjustBalanceRequest,             Initialize<Server::Command::Zones::AdjustBalanceRequest>,                "[BO1LU]",                1 },
+    { "zones.decrease-bass",             &sZonesDecreaseBassRequest,              Initialize<Server::Command::Zones::DecreaseBassRequest>,                 "[TO1BD]",                1 },
+    { "zones.decrease-equalizer-band",   &sZonesDecreaseEqualizerBandRequest,     Initialize<Server::Command::Zones::DecreaseEqualizerBandRequest>,        "[EO1B3D]",               0 },
+    { "zones.decrease-treble",           &sZonesDecreaseTrebleRequest,            Initialize<Server::Command::Zones::DecreaseTrebleRequest>,               "[TO1TD]",                1 },
+    { "zones.decrease-volume",           &sZonesDecreaseVolumeRequest,            Initialize<Server::Command::Zones::DecreaseVolumeRequest>,               "[VO1D]",                 8 },
+    { "zones.increase-bass",             &sZonesIncreaseBassRequest,              Initialize<Server::Command::Zones::IncreaseBassRequest>,                 "[TO1BU]",                1 },
+    { "zones.increase-equalizer-band",   &sZonesIncreaseEqualizerBandRequest,     Initialize<Server::Command::Zones::IncreaseEqualizerBandRequest>,        "[EO1B3U]",               0 },
+    { "zones.increase-treble",           &sZonesIncreaseTrebleRequest,            Initialize<Server::Command::Zones::IncreaseTrebleRequest>,               "[TO1TU]",                1 },
+    { "zones.increase-volume",           &sZonesIncreaseVolumeRequest,            Initialize<Server::Command::Zones::IncreaseVolumeRequest>,               "[VO1U]",                 8 },
+    { "zones.mute",                      &sZonesMuteRequest,                      Initialize<Server::Command::Zones::MuteRequest>,                         "[VMO1]",                 3 },
+    { "zones.query",                     &sZonesQueryRequest,                     Initialize<Server::Command::Zones::QueryRequest>,                        "[QO1]",                 12 },
+    { "zones.query-mute",                &sZonesQueryMuteRequest,                 Initialize<Server::Command::Zones::QueryMuteRequest>,                    "[QVMO1]",                6 },
+    { "zones.query-source",              &sZonesQuerySourceRequest,               Initialize<Server::Command::Zones::QuerySourceRequest>,                  "[QCO1]",                 6 },
+    { "zones.query-volume",              &sZonesQueryVolumeRequest,               Initialize<Server::Command::Zones::QueryVolumeRequest>,                  "[QVO1]",                 6 },
+    { "zones.set-balance",               &sZonesSetBalanceRequest,                Initialize<Server::Command::Zones::SetBalanceRequest>,                   "[BO1L20]",               1 },
+    { "zones.set-equalizer-band",        &sZonesSetEqualizerBandRequest,          Initialize<Server::Command::Zones::SetEqualizerBandRequest>,             "[EO1B3L-4]",             1 },
+    { "zones.set-equalizer-preset",      &sZonesSetEqualizerPresetRequest,        Initialize<Server::Command::Zones::SetEqualizerPresetRequest>,           "[EO1P2]",                1 },
+    { "zones.set-highpass-crossover",    &sZonesSetHighpassCrossoverRequest,      Initialize<Server::Command::Zones::SetHighpassCrossoverRequest>,         "[EO1HP100]",             0 },
+    { "zones.set-lowpass-crossover",     &sZonesSetLowpassCrossoverRequest,       Initialize<Server::Command::Zones::SetLowpassCrossoverRequest>,          "[EO1LP100]",             0 },
+    { "zones.set-name",                  &sZonesSetNameRequest,                   Initialize<Server::Command::Zones::SetNameRequest>,                      "[NO1\"Kitchen\"]",       0 },
+    { "zones.set-sound-mode",            &sZonesSetSoundModeRequest,              Initialize<Server::Command::Zones::SetSoundModeRequest>,                 "[EO1M1]",                1 },
+    { "zones.set-source",                &sZonesSetSourceRequest,                 Initialize<Server::Command::Zones::SetSourceRequest>,                    "[CO1I2]",                6 },
+    { "zones.set-source-all",            &sZonesSetSourceAllRequest,              Initialize<Server::Command::Zones::SetSourceAllRequest>,                 "[CXI2]",                 0 },
+    { "zones.set-tone",                  &sZonesSetToneRequest,                   Initialize<Server::Command::Zones::SetToneRequest>,                      "[TO1B2T-2]",             1 },
+    { "zones.set-volume",                &sZonesSetVolumeRequest,                 Initialize<Server::Command::Zones::SetVolumeRequest>,                    "[VO1R-20]",              8 },
+    { "zones.set-volume-all",            &sZonesSetVolumeAllRequest,              Initialize<Server::Command::Zones::SetVolumeAllRequest>,                 "[VXR-20]",               0 },
+    { "zones.set-volume-fixed",          &sZonesSetVolumeFixedRequest,            Initialize<Server::Command::Zones::SetVolumeFixedRequest>,               "[VO1F1]",                0 },
+    { "zones.toggle-mute",               &sZonesToggleMuteRequest,                Initialize<Server::Command::Zones::ToggleMuteRequest>,                   "[VMTO1]",                4 }
+};
+
+static const ParseSample    sParseSamples[] = {
+    { ParseSample::kTypeInt8,   "-80"        },
+    { ParseSample::kTypeUInt8,  "24"         },
+    { ParseSample::kTypeUInt16, "15000"      },
+    { ParseSample::kTypeUInt32, "4000000000" }
+};
+
+static const PutSample      sPutSamples[] = {
+    { 16,  4096, false },
+    { 256, 4096, false },
+    { 16,  4096, true  }
+};
+
+static const struct option  sOptions[] = {
+    { "help",                    no_argument,        nullptr,   'h'                         },
+    { "minimum-time",            required_argument,  nullptr,   'm'                         },
+    { "repetitions",             required_argument,  nullptr,   'r'                         },
+
+    { nullptr,                   0,                  nullptr,   0                           }
+};
+
+static const char * const   sUsageString =
+"Usage: %s [ options ] [ <filter> ... ]\n"
+"\n"
+"Run the microbenchmarks whose names contain any of the specified\n"
+"filters or, if none are specified, all of them, writing the results\n"
+"to standard output as JSON.\n"
+"\n"
+"  -h, --help                  Print this help, then exit.\n"
+"  -m, --minimum-time=MS       Run each repetition of each benchmark for at\n"
+"                              least MS milliseconds (default: 100).\n"
+"  -r, --repetitions=COUNT     Run each benchmark COUNT times, reporting the\n"
+"                              minimum and median (default: 5).\n"
+"\n";
+
+static Timestamp
+GetTimestamp(void)
+{
+    static constexpr Timestamp kNanosecondsPerSecond = 1000000000;
+    struct timespec            lTimespec;
+
+    clock_gettime(CLOCK_MONOTONIC, &lTimespec);
+
+    return ((static_cast<Timestamp>(lTimespec.tv_sec) * kNanosecondsPerSecond) +
+            static_cast<Timestamp>(lTimespec.tv_nsec));
+}
+
+// MARK: Request Regular Expression Match
+
+/**
+ *  @brief
+ *    Match a request string against its request regular expression.
+ *
+ */
+static Status
+BenchmarkMatch(const void *aContext, const size_t &aIterations)
+{
+    const RequestSample &  lSample = *static_cast<const RequestSample *>(aContext);
+    const size_t           lLength = strlen(lSample.mString);
+    Status                 lRetval = kStatus_Success;
+
+    for (size_t i = 0; i < aIterations; i++)
+    {
+        lRetval = lSample.mRequest->GetRegularExpression().Match(lSample.mString,
+                                                                 lLength,
+                                                                 lSample.mRequest->GetMatches());
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Request Dispatch
+
+static void
+OnRequestReceived(Server::ConnectionBasis &aConnection, const uint8_t *aBuffer, const size_t &aSize, const RegularExpression::Matches &aMatches, void *aContext)
+{
+    (void)aConnection;
+    (void)aBuffer;
+    (void)aSize;
+    (void)aMatches;
+    (void)aContext;
+
+    sDispatched++;
+}
+
+/**
+ *  @brief
+ *    Dispatch a weighted mix of requests, one request per received
+ *    buffer, through a server command manager with every server
+ *    command request registered.
+ *
+ */
+static Status
+BenchmarkDispatch(const void *aContext, const size_t &aIterations)
+{
+    Server::CommandManager *                 lCommandManager = const_cast<Server::CommandManager *>(static_cast<const Server::CommandManager *>(aContext));
+    Server::ConnectionManager                lConnectionManager;
+    NullConnection                           lConnection;
+    std::vector<const RequestSample *>       lMix;
+    ConnectionBuffer::MutableCountedPointer  lBuffer;
+    const size_t                             lDispatched = sDispatched;
+    Status                                   lRetval = kStatus_Success;
+
+    for (size_t i = 0; i < ElementsOf(sRequestSamples); i++)
+    {
+        lMix.insert(lMix.end(), sRequestSamples[i].mWeight, &sRequestSamples[i]);
+    }
+
+    // Interleave the mix deterministically rather than issuing each
+    // request type in a run.
+
+    for (size_t i = 0, j = 0; i < lMix.size(); i++)
+    {
+        j = ((j * 7) + 13) % lMix.size();
+
+        std::swap(lMix[i], lMix[j]);
+    }
+
+    lRetval = ConnectionBuffer::Create(lBuffer);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    for (size_t i = 0; i < aIterations; i++)
+    {
+        const RequestSample &lSample = *lMix[i % lMix.size()];
+
+        lRetval = Common::Utilities::Put(*lBuffer.get(),
+                                         reinterpret_cast<const uint8_t *>(lSample.mString),
+                                         strlen(lSample.mString));
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lCommandManager->ConnectionManagerDidReceiveApplicationData(lConnectionManager,
+                                                                    lConnection,
+                                                                    lBuffer);
+    }
+
+    nlREQUIRE_ACTION((sDispatched - lDispatched) == aIterations, done, lRetval = kError_BadCommand);
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Connection Buffer Put
+
+/**
+ *  @brief
+ *    Put fixed-size chunks into a connection buffer until it reaches
+ *    the total size.
+ *
+ *  When the sample does not reuse the buffer, each iteration starts
+ *  from a new, empty buffer, measuring growth. Otherwise, one buffer
+ *  is flushed and reused, measuring steady-state appends.
+ *
+ */
+static Status
+BenchmarkPut(const void *aContext, const size_t &aIterations)
+{
+    const PutSample &        lSample = *static_cast<const PutSample *>(aContext);
+    std::vector<uint8_t>     lChunk(lSample.mChunkSize, 'V');
+    ConnectionBuffer         lReusedBuffer;
+    Status                   lRetval = kStatus_Success;
+
+    lRetval = lReusedBuffer.Init();
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    for (size_t i = 0; i < aIterations; i++)
+    {
+        ConnectionBuffer   lNewBuffer;
+        ConnectionBuffer & lBuffer = (lSample.mReuse ? lReusedBuffer : lNewBuffer);
+
+        if (!lSample.mReuse)
+        {
+            lRetval = lNewBuffer.Init();
+            nlREQUIRE_SUCCESS(lRetval, done);
+        }
+
+        for (size_t lSize = 0; lSize < lSample.mTotalSize; lSize += lSample.mChunkSize)
+        {
+            lRetval = Common::Utilities::Put(lBuffer, &lChunk[0], lChunk.size());
+            nlREQUIRE_SUCCESS(lRetval, done);
+        }
+
+        sSink += lBuffer.GetSize();
+
+        lBuffer.Flush();
+    }
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Integer Parse
+
+/**
+ *  @brief
+ *    Parse a decimal integer string of a known length, as request
+ *    handlers do for each matched substring.
+ *
+ */
+static Status
+BenchmarkParse(const void *aContext, const size_t &aIterations)
+{
+    const ParseSample &  lSample = *static_cast<const ParseSample *>(aContext);
+    const size_t         lLength = strlen(lSample.mString);
+    int8_t               lInt8;
+    uint8_t              lUInt8;
+    uint16_t             lUInt16;
+    uint32_t             lUInt32;
+    Status               lRetval = kStatus_Success;
+
+    for (size_t i = 0; i < aIterations; i++)
+    {
+        switch (lSample.mType)
+        {
+
+        case ParseSample::kTypeInt8:
+            lRetval = Parse(lSample.mString, lLength, lInt8);
+            sSink += static_cast<size_t>(lInt8);
+            break;
+
+        case ParseSample::kTypeUInt8:
+            lRetval = Parse(lSample.mString, lLength, lUInt8);
+            sSink += lUInt8;
+            break;
+
+        case ParseSample::kTypeUInt16:
+            lRetval = Parse(lSample.mString, lLength, lUInt16);
+            sSink += lUInt16;
+            break;
+
+        case ParseSample::kTypeUInt32:
+            lRetval = Parse(lSample.mString, lLength, lUInt32);
+            sSink += lUInt32;
+            break;
+
+        }
+
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+// MARK: Response Formatting
+
+/**
+ *  @brief
+ *    Construct and format a server response, as request handlers do
+ *    for each response they send.
+ *
+ */
+template <typename ResponseType, typename ... Arguments>
+static Status
+BenchmarkResponse(const size_t &aIterations, const Arguments & ... aArguments)
+{
+    Status lRetval = kStatus_Success;
+
+    for (size_t i = 0; i < aIterations; i++)
+    {
+        ResponseType lResponse;
+
+        lRetval = lResponse.Init(aArguments...);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        sSink += lResponse.GetSize();
+    }
+
+ done:
+    return (lRetval);
+}
+
+static Status
+BenchmarkGroupsSetVolumeResponse(const void *aContext, const size_t &aIterations)
+{
+    const GroupModel::IdentifierType  lGroup  = 1;
+    const VolumeModel::LevelType      lVolume = -20;
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Groups::SetVolumeResponse>(aIterations, lGroup, lVolume));
+}
+
+static Status
+BenchmarkGroupsSourceResponse(const void *aContext, const size_t &aIterations)
+{
+    const GroupModel::IdentifierType  lGroup  = 1;
+    const SourceModel::IdentifierType lSource = 2;
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Groups::SourceResponse>(aIterations, lGroup, lSource));
+}
+
+static Status
+BenchmarkZonesEqualizerBandResponse(const void *aContext, const size_t &aIterations)
+{
+    const ZoneModel::IdentifierType           lZone  = 1;
+    const EqualizerBandModel::IdentifierType  lBand  = 3;
+    const EqualizerBandModel::LevelType       lLevel = -4;
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Zones::EqualizerBandResponse>(aIterations, lZone, lBand, lLevel));
+}
+
+static Status
+BenchmarkZonesMuteResponse(const void *aContext, const size_t &aIterations)
+{
+    const ZoneModel::IdentifierType  lZone  = 1;
+    const VolumeModel::MuteType      lMute  = true;
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Zones::MuteResponse>(aIterations, lZone, lMute));
+}
+
+static Status
+BenchmarkZonesNameResponse(const void *aContext, const size_t &aIterations)
+{
+    const ZoneModel::IdentifierType  lZone  = 1;
+    const char * const               lName  = "Kitchen";
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Zones::NameResponse>(aIterations, lZone, lName));
+}
+
+static Status
+BenchmarkZonesSourceResponse(const void *aContext, const size_t &aIterations)
+{
+    const ZoneModel::IdentifierType   lZone   = 1;
+    const SourceModel::IdentifierType lSource = 2;
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Zones::SourceResponse>(aIterations, lZone, lSource));
+}
+
+static Status
+BenchmarkZonesToneResponse(const void *aContext, const size_t &aIterations)
+{
+    const ZoneModel::IdentifierType  lZone   = 1;
+    const ToneModel::LevelType       lBass   = 2;
+    const ToneModel::LevelType       lTreble = -2;
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Zones::ToneResponse>(aIterations, lZone, lBass, lTreble));
+}
+
+static Status
+BenchmarkZonesVolumeResponse(const void *aContext, const size_t &aIterations)
+{
+    const ZoneModel::IdentifierType  lZone   = 1;
+    const VolumeModel::LevelType     lVolume = -20;
+
+    (void)aContext;
+
+    return (BenchmarkResponse<Server::Command::Zones::VolumeResponse>(aIterations, lZone, lVolume));
+}
+
+// MARK: Harness
+
+/**
+ *  @brief
+ *    Time a number of iterations of a benchmark.
+ *
+ *  @param[in]   aBenchmark   An immutable reference to the benchmark
+ *                            to run.
+ *  @param[in]   aIterations  The number of iterations to run.
+ *  @param[out]  aElapsed     A mutable reference to storage for the
+ *                            elapsed time, in nanoseconds.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+static Status
+Time(const Benchmark &aBenchmark, const size_t &aIterations, Timestamp &aElapsed)
+{
+    const Timestamp  lStart = GetTimestamp();
+    Status           lRetval;
+
+    lRetval = aBenchmark.mFunction(aBenchmark.mContext, aIterations);
+    nlREQUIRE_SUCCESS(lRetval, done);
+
+    aElapsed = GetTimestamp() - lStart;
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Run and report a benchmark.
+ *
+ *  This first scales the iteration count until a run takes at least
+ *  the minimum time and then times the requested number of
+ *  repetitions at that count, reporting the minimum and median time
+ *  per iteration.
+ *
+ *  @param[in]  aBenchmark  An immutable reference to the benchmark
+ *                          to run.
+ *  @param[in]  aFirst      Whether this is the first benchmark
+ *                          reported.
+ *
+ *  @retval  kStatus_Success  If successful.
+ *
+ */
+static Status
+Run(const Benchmark &aBenchmark, const bool &aFirst)
+{
+    static constexpr size_t  kScaleMax = 100;
+    size_t                   lIterations = 1;
+    Timestamp                lElapsed = 0;
+    std::vector<double>      lPerIteration;
+    Status                   lRetval;
+
+    while (true)
+    {
+        size_t lScale;
+
+        lRetval = Time(aBenchmark, lIterations, lElapsed);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        if (lElapsed >= sMinimumTime)
+        {
+            break;
+        }
+
+        lScale = ((lElapsed == 0) ? kScaleMax : static_cast<size_t>(((sMinimumTime * 6) / 5) / lElapsed) + 1);
+        lScale = std::min(std::max(lScale, static_cast<size_t>(2)), kScaleMax);
+
+        lIterations *= lScale;
+    }
+
+    for (unsigned int i = 0; i < sRepetitions; i++)
+    {
+        lRetval = Time(aBenchmark, lIterations, lElapsed);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lPerIteration.push_back(static_cast<double>(lElapsed) / static_cast<double>(lIterations));
+    }
+
+    std::sort(lPerIteration.begin(), lPerIteration.end());
+
+    printf("%s    { \"name\": \"%s\", \"iterations\": %zu, "
+           "\"repetitions\": %u, \"ns_per_op_min\": %.2f, "
+           "\"ns_per_op_median\": %.2f }",
+           (aFirst ? "" : ",\n"),
+           aBenchmark.mName,
+           lIterations,
+           sRepetitions,
+           lPerIteration.front(),
+           lPerIteration[lPerIteration.size() / 2]);
+
+ done:
+    if (lRetval != kStatus_Success)
+    {
+        fprintf(stderr, "Benchmark \"%s\" failed: %d\n", aBenchmark.mName, lRetval);
+    }
+
+    return (lRetval);
+}
+
+static bool
+IsSelected(const char *aName, const int &aFilterCount, char * const aFilters[])
+{
+    bool lRetval = (aFilterCount == 0);
+
+    for (int i = 0; !lRetval && (i < aFilterCount); i++)
+    {
+        lRetval = (strstr(aName, aFilters[i]) != nullptr);
+    }
+
+    return (lRetval);
+}
+
+static Status
+Init(Server::CommandManager &aCommandManager)
+{
+    Status lRetval = kStatus_Success;
+
+    for (size_t i = 0; i < ElementsOf(sRequestSamples); i++)
+    {
+        Server::Command::RequestBasis * const lRequest = sRequestSamples[i].mRequest;
+
+        lRetval = sRequestSamples[i].mInit(*lRequest);
+        nlREQUIRE_SUCCESS(lRetval, done);
+
+        lRetval = aCommandManager.RegisterRequestHandler(*lRequest, nullptr, OnRequestReceived);
+        nlREQUIRE_SUCCESS(lRetval, done);
+    }
+
+ done:
+    return (lRetval);
+}
+
+int main(int argc, char * const argv[])
+{
+    static constexpr Timestamp  kNanosecondsPerMillisecond = 1000000;
+    Server::CommandManager      lCommandManager;
+    std::vector<Benchmark>      lBenchmarks;
+    std::vector<std::string>    lNames;
+    uint32_t                    lValue;
+    bool                        lFirst = true;
+    int                         c;
+    Status                      lStatus;
+
+    while ((c = getopt_long(argc, argv, "hm:r:", sOptions, nullptr)) != -1)
+    {
+        switch (c)
+        {
+
+        case 'm':
+            lStatus = Parse(optarg, lValue);
+            nlREQUIRE_SUCCESS_ACTION(lStatus, usage, c = EXIT_FAILURE);
+
+            sMinimumTime = lValue * kNanosecondsPerMillisecond;
+            break;
+
+        case 'r':
+            lStatus = Parse(optarg, lValue);
+            nlREQUIRE_SUCCESS_ACTION(lStatus, usage, c = EXIT_FAILURE);
+            nlREQUIRE_ACTION(lValue > 0, usage, c = EXIT_FAILURE);
+
+            sRepetitions = lValue;
+            break;
+
+        case 'h':
+            c = EXIT_SUCCESS;
+            goto usage;
+
+        default:
+            c = EXIT_FAILURE;
+            goto usage;
+
+        }
+    }
+
+    lStatus = Init(lCommandManager);
+    nlREQUIRE_SUCCESS(lStatus, done);
+
+    // Establish the benchmarks, names first such that the name
+    // storage is stable once the benchmarks refer to it.
+
+    lNames.reserve(ElementsOf(sRequestSamples) + ElementsOf(sParseSamples) + ElementsOf(sPutSamples));
+
+    for (size_t i = 0; i < ElementsOf(sRequestSamples); i++)
+    {
+        lNames.push_back(std::string("match.") + sRequestSamples[i].mName);
+        lBenchmarks.push_back({ lNames.back().c_str(), BenchmarkMatch, &sRequestSamples[i] });
+    }
+
+    lBenchmarks.push_back({ "dispatch.mix", BenchmarkDispatch, &lCommandManager });
+
+    for (size_t i = 0; i < ElementsOf(sPutSamples); i++)
+    {
+        char lName[64];
+
+        snprintf(lName, sizeof (lName), "put.%s.%zux%zu",
+                 (sPutSamples[i].mReuse ? "reuse" : "grow"),
+                 sPutSamples[i].mChunkSize,
+                 (sPutSamples[i].mTotalSize / sPutSamples[i].mChunkSize));
+
+        lNames.push_back(lName);
+        lBenchmarks.push_back({ lNames.back().c_str(), BenchmarkPut, &sPutSamples[i] });
+    }
+
+    for (size_t i = 0; i < ElementsOf(sParseSamples); i++)
+    {
+        static const char * const kTypeNames[] = { "int8", "uint8", "uint16", "uint32" };
+
+        lNames.push_back(std::string("parse.") + kTypeNames[sParseSamples[i].mType]);
+        lBenchmarks.push_back({ lNames.back().c_str(), BenchmarkParse, &sParseSamples[i] });
+    }
+
+    lBenchmarks.push_back({ "response.groups.set-volume",    BenchmarkGroupsSetVolumeResponse,    nullptr });
+    lBenchmarks.push_back({ "response.groups.source",        BenchmarkGroupsSourceResponse,       nullptr });
+    lBenchmarks.push_back({ "response.zones.equalizer-band", BenchmarkZonesEqualizerBandResponse, nullptr });
+    lBenchmarks.push_back({ "response.zones.mute",           BenchmarkZonesMuteResponse,          nullptr });
+    lBenchmarks.push_back({ "response.zones.name",           BenchmarkZonesNameResponse,          nullptr });
+    lBenchmarks.push_back({ "response.zones.source",         BenchmarkZonesSourceResponse,        nullptr });
+    lBenchmarks.push_back({ "response.zones.tone",           BenchmarkZonesToneResponse,          nullptr });
+    lBenchmarks.push_back({ "response.zones.volume",         BenchmarkZonesVolumeResponse,        nullptr });
+
+    printf("{\n");
+    printf("  \"minimum_time_ns\": %" PRIu64 ",\n", sMinimumTime);
+    printf("  \"benchmarks\": [\n");
+
+    for (const Benchmark &lBenchmark : lBenchmarks)
+    {
+        if (IsSelected(lBenchmark.mName, argc - optind, &argv[optind]))
+        {
+            lStatus = Run(lBenchmark, lFirst);
+            nlREQUIRE_SUCCESS(lStatus, done);
+
+            lFirst = false;
+
+            fflush(stdout);
+        }
+    }
+
+    printf("\n  ]\n");
+    printf("}\n");
+
+ done:
+    return ((lStatus == kStatus_Success) ? EXIT_SUCCESS : EXIT_FAILURE);
+
+ usage:
+    fprintf(((c == EXIT_SUCCESS) ? stdout : stderr), sUsageString, argv[0]);
+
+    return (c);
+}